@@ -1,10 +1,141 @@
 import csv
 import os
+import sys
 
 # Configuration
 CSV_FILE = 'cards.csv'
 OUTPUT_FILE = 'src/Questions.h'
 
+# Question text box on screen (center x, center y, width, height), see main.cpp
+QUESTION_BOX = (400, 210, 640, 280)
+
+# Question fonts, largest first; must match QUESTION_FONTS in src/DeckFonts.h
+FONT_LADDER = ['Lexend_Light40pt7b', 'Lexend_Light28pt7b', 'Lexend_Light22pt7b']
+
+# Line capacity of Utf8TextLayout (UTF8_LAYOUT_MAX_LINES in src/Utf8GfxHelper.h)
+LAYOUT_MAX_LINES = 16
+
+# CSV category id -> display name (CATEGORY_NAMES in Questions.h)
+CAT_MAP = {
+    "Emotions": "EMOCE",
+    "Fantasy": "FANTAZIE",
+    "Relationships": "VZTAHY",
+    "MyBody": "JÁ A MOJE TĚLO",
+    "School": "ŠKOLA ŽIVOTA",
+    "Nature": "PŘÍRODA",
+    "WhatIf": "CO BY KDYBY",
+    "Secrets": "SKRYTÁ ZÁKOUTÍ"
+}
+
+def load_font_metrics(name):
+    """
+    Per-codepoint (xAdvance, yOffset, height) and yAdvance of the sparse font
+    the device draws with (src/<name>_sparse.h, written by subset_font.py).
+    """
+    sys.path.insert(0, 'src')
+    from subset_font import parse_sparse_font
+
+    glyphs, y_advance = parse_sparse_font(f'src/{name}_sparse.h')
+    metrics = {cp: (g[3], g[5], g[2]) for cp, g in glyphs.items()}
+    return metrics, y_advance
+
+
+def missing_codepoints(data, metrics):
+    """Codepoints of UTF-8 text the font has no glyph for (line breaks aside)."""
+    missing = set()
+    i = 0
+    while i < len(data):
+        cp, n = decode_utf8(data, i)
+        if cp not in metrics and cp not in (ord('\n'), ord('\r')):
+            missing.add(cp)
+        i += n
+    return missing
+
+
+def decode_utf8(data, i):
+    """Same rules as decodeUtf8Char() in Utf8GfxHelper.h: (codepoint, bytes)."""
+    c = data[i]
+    if c < 0x80:
+        return c, 1
+    length = 2 if 0xC2 <= c < 0xE0 else 3 if 0xE0 <= c < 0xF0 else 4 if 0xF0 <= c < 0xF5 else 0
+    if length:
+        lo, hi = {0xE0: (0xA0, 0xBF), 0xED: (0x80, 0x9F), 0xF0: (0x90, 0xBF), 0xF4: (0x80, 0x8F)}.get(c, (0x80, 0xBF))
+        tail = data[i + 1:i + length]
+        if (len(tail) == length - 1 and lo <= tail[0] <= hi
+                and all(b & 0xC0 == 0x80 for b in tail[1:])):
+            cp = c & (0x7F >> length)
+            for b in tail:
+                cp = (cp << 6) | (b & 0x3F)
+            return cp, length
+    return ord('?'), 1
+
+
+def layout_text(data, font):
+    """
+    Port of layoutUtf8Text() in Utf8GfxHelper.h for the question box.
+
+    Returns (lines, fits): lines are (start, length, width, top, bottom) with
+    top/bottom relative to the baseline; fits is False if maxLines cut the text.
+    """
+    metrics, y_advance = font
+    max_width, max_height = QUESTION_BOX[2], QUESTION_BOX[3]
+    max_lines = min(max(max_height // y_advance, 1), LAYOUT_MAX_LINES - 1)
+
+    lines = []
+    p = 0
+    ended_with_break = False
+    while p < len(data) and len(lines) < max_lines:
+        line_start = p
+        line = None
+        line_width = 0
+        line_top = line_bottom = 0
+        last_space = None
+        ended_with_break = False
+
+        while p < len(data):
+            cp, n = decode_utf8(data, p)
+            if cp == ord('\n'):
+                line = (line_start, p - line_start, line_width, line_top, line_bottom)
+                p += n
+                ended_with_break = True
+                break
+            if cp == ord('\r'):
+                p += n
+                continue
+
+            char_width, char_top, char_bottom = 0, 0, 0
+            if cp in metrics:
+                char_width, y_offset, height = metrics[cp]
+                if height > 0:
+                    char_top, char_bottom = y_offset, y_offset + height
+
+            if line_width + char_width > max_width and line_start != p:
+                if last_space is not None:
+                    line = last_space
+                    p = last_space[0] + last_space[1] + 1
+                else:
+                    line = (line_start, p - line_start, line_width, line_top, line_bottom)
+                ended_with_break = True
+                break
+
+            if cp == ord(' '):
+                last_space = (line_start, p - line_start, line_width, line_top, line_bottom)
+
+            p += n
+            line_width += char_width
+            line_top = min(line_top, char_top)
+            line_bottom = max(line_bottom, char_bottom)
+
+        if line is None:
+            line = (line_start, p - line_start, line_width, line_top, line_bottom)
+        lines.append(line)
+
+    fits = p >= len(data)
+    if ended_with_break:
+        lines.append((p, 0, 0, 0, 0))
+    return lines, fits
+
+
 def convert():
     if not os.path.exists(CSV_FILE):
         print(f"Error: {CSV_FILE} not found!")
@@ -13,16 +144,7 @@ def convert():
     categories_data = []
     questions_data = []
 
-    cat_map = {
-        "Emotions": "EMOCE",
-        "Fantasy": "FANTAZIE",
-        "Relationships": "VZTAHY",
-        "MyBody": "JÁ A MOJE TĚLO",
-        "School": "ŠKOLA ŽIVOTA",
-        "Nature": "PŘÍRODA",
-        "WhatIf": "CO BY KDYBY",
-        "Secrets": "SKRYTÁ ZÁKOUTÍ"
-    }
+    cat_map = CAT_MAP
 
     cat_enum_names = list(cat_map.keys())
 
@@ -59,7 +181,9 @@ def convert():
             text = text.strip()
 
             if cat_id in cat_map:
-                questions_data.append((text, cat_id))
+                # The string the device sees once the C escapes are resolved
+                runtime_text = text.replace('\\n', '\n').replace('\\"', '"')
+                questions_data.append((text, cat_id, runtime_text))
             else:
                 print(f"Warning: Unknown category '{cat_id}' for question: {text[:30]}...")
 
@@ -98,9 +222,81 @@ const Question QUESTIONS[] PROGMEM = {
 """
 
     questions_list = []
-    for text, cat_id in questions_data:
+    for text, cat_id, _ in questions_data:
         questions_list.append(f'    {{"{text}", CAT_{cat_id.upper()}}}')
 
+    # Precompute the layout: largest ladder font that fits the whole question
+    fonts = [load_font_metrics(name) for name in FONT_LADDER]
+
+    # The subset fonts must cover the deck, or the layout and the screen would both lose characters
+    for name, (metrics, _) in zip(FONT_LADDER, fonts):
+        missing = set()
+        for _, _, runtime_text in questions_data:
+            missing |= missing_codepoints(runtime_text.encode('utf-8'), metrics)
+        if missing:
+            print(f"Error: src/{name}_sparse.h has no glyph for " +
+                  ", ".join(f"U+{cp:04X}" for cp in sorted(missing)) +
+                  "; run src/subset_font.py first (see README)")
+            sys.exit(1)
+    layouts = []
+    overflows = []
+    for index, (_, _, runtime_text) in enumerate(questions_data):
+        data = runtime_text.encode('utf-8')
+        for font_index, font in enumerate(fonts):
+            lines, fits = layout_text(data, font)
+            if fits:
+                break
+        if not fits:
+            overflows.append(index)
+        layouts.append((font_index, lines))
+
+    if overflows:
+        for index in overflows:
+            print(f"Error: question {index} does not fit the {QUESTION_BOX[2]}x{QUESTION_BOX[3]} box "
+                  f"even in {FONT_LADDER[-1]}: {questions_data[index][2][:40]}...")
+        sys.exit(1)
+
+    layout_header = f"""
+// =============================================================================
+// PRECOMPUTED LAYOUT (generated by convert_csv.py, see QuestionLayout.h)
+// =============================================================================
+
+// Question text box: center and size
+const int16_t QUESTION_BOX_CENTER_X = {QUESTION_BOX[0]};
+const int16_t QUESTION_BOX_CENTER_Y = {QUESTION_BOX[1]};
+const uint16_t QUESTION_BOX_WIDTH = {QUESTION_BOX[2]};
+const uint16_t QUESTION_BOX_HEIGHT = {QUESTION_BOX[3]};
+
+// Number of fonts in the ladder the layout was computed for ({', '.join(FONT_LADDER)})
+const uint8_t QUESTION_FONT_COUNT = {len(FONT_LADDER)};
+
+// One wrapped line: byte span of the question text, pixel width, and glyph extent around the baseline
+struct QuestionLine
+{{
+  uint16_t start;
+  uint16_t length;
+  uint16_t width;
+  int8_t top;
+  int8_t bottom;
+}};
+
+// Lines of one question and the index of its font in QUESTION_FONTS
+struct QuestionLayout
+{{
+  uint16_t firstLine;
+  uint8_t lineCount;
+  uint8_t font;
+}};
+
+const QuestionLine QUESTION_LINES[] PROGMEM = {{
+"""
+    line_list = []
+    layout_list = []
+    for index, (font_index, lines) in enumerate(layouts):
+        layout_list.append(f'    {{{len(line_list)}, {len(lines)}, {font_index}}}')
+        for start, length, width, top, bottom in lines:
+            line_list.append(f'    {{{start}, {length}, {width}, {top}, {bottom}}}')
+
     footer = """
 const int QUESTION_COUNT = sizeof(QUESTIONS) / sizeof(QUESTIONS[0]);
 
@@ -125,6 +321,14 @@ inline const char *getQuestionCategory(int index)
   return (const char*)pgm_read_ptr(&CATEGORY_NAMES[cat]);
 }
 
+// Get precomputed layout by index (nullptr if out of range)
+inline const QuestionLayout *getQuestionLayout(int index)
+{
+  if (index < 0 || index >= QUESTION_COUNT)
+    return nullptr;
+  return &QUESTION_LAYOUTS[index];
+}
+
 // Get total number of questions
 inline int getQuestionCount()
 {
@@ -137,10 +341,17 @@ inline int getQuestionCount()
     with open(OUTPUT_FILE, 'w', encoding='utf-8') as f:
         f.write(header)
         f.write(',\n'.join(questions_list))
-        f.write('\n};')
+        f.write('\n};\n')
+        f.write(layout_header)
+        f.write(',\n'.join(line_list))
+        f.write('\n};\n\nconst QuestionLayout QUESTION_LAYOUTS[] PROGMEM = {\n')
+        f.write(',\n'.join(layout_list))
+        f.write('\n};\n')
         f.write(footer)
 
+    per_font = [sum(1 for font_index, _ in layouts if font_index == i) for i in range(len(FONT_LADDER))]
     print(f"Successfully converted {len(questions_data)} questions to {OUTPUT_FILE}")
+    print("Fonts: " + ", ".join(f"{name} x{count}" for name, count in zip(FONT_LADDER, per_font)))
 
 if __name__ == "__main__":
     convert()
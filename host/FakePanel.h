@@ -0,0 +1,147 @@
+#ifndef HOST_FAKE_PANEL_H
+#define HOST_FAKE_PANEL_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+/**
+ * Stand-in for the GDEQ0426T82 panel driver that PagedDisplay writes to:
+ * the controller's two RAM planes (0x24 current, 0x26 previous) as plain
+ * arrays, and a refresh count instead of a waveform.
+ *
+ * With -DEPD_SPI_DMA a write is only recorded, with a checksum of its
+ * source rows, and copied into RAM by finishWrite(), as EpdDmaPanel sends
+ * it: the next write, refresh(), powerOff() or hibernate() finish it
+ * first. A band whose rows changed in between was drawn into while in
+ * flight and is counted in corruptWrites.
+ */
+class FakePanel
+{
+public:
+  static const uint16_t WIDTH = 800;
+  static const uint16_t WIDTH_VISIBLE = WIDTH;
+  static const uint16_t HEIGHT = 480;
+  static const bool hasFastPartialUpdate = true;
+
+  uint8_t current[(WIDTH / 8) * HEIGHT];  // Plane 0x24
+  uint8_t previous[(WIDTH / 8) * HEIGHT]; // Plane 0x26
+  uint32_t writes, refreshes, corruptWrites;
+
+  FakePanel() : writes(0), refreshes(0), corruptWrites(0), _pending(false)
+  {
+    memset(current, 0xFF, sizeof(current));
+    memset(previous, 0xFF, sizeof(previous));
+  }
+
+  void init(uint32_t, bool, uint16_t, bool) {}
+  void selectSPI(SPIClass &, SPISettings) {}
+
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    _write(current, bitmap, 0, 0, w, x, y, w, h);
+  }
+
+  void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    _write(previous, bitmap, 0, 0, w, x, y, w, h);
+    _write(current, bitmap, 0, 0, w, x, y, w, h);
+  }
+
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    _write(previous, bitmap, 0, 0, w, x, y, w, h);
+    _write(current, bitmap, 0, 0, w, x, y, w, h);
+  }
+
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t,
+                      int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    _write(current, bitmap, x_part, y_part, w_bitmap, x, y, w, h);
+  }
+
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t,
+                           int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    _write(previous, bitmap, x_part, y_part, w_bitmap, x, y, w, h);
+    _write(current, bitmap, x_part, y_part, w_bitmap, x, y, w, h);
+  }
+
+  void refresh(bool = false)
+  {
+    finishWrite();
+    refreshes++;
+  }
+
+  void refresh(int16_t, int16_t, int16_t, int16_t)
+  {
+    finishWrite();
+    refreshes++;
+  }
+
+  void powerOff() { finishWrite(); }
+  void hibernate() { finishWrite(); }
+
+  // Whether a write is still in flight (always false without EPD_SPI_DMA)
+  bool busy() const { return _pending; }
+
+  void finishWrite()
+  {
+    if (!_pending)
+      return;
+    _pending = false;
+    if (_checksum(_p) != _p.checksum)
+      corruptWrites++;
+    _copy(_p);
+  }
+
+private:
+  struct Write
+  {
+    uint8_t *plane;
+    const uint8_t *bitmap;
+    int16_t x_part, y_part, w_bitmap, x, y, w, h;
+    uint32_t checksum;
+  };
+
+  Write _p;
+  bool _pending;
+
+  void _write(uint8_t *plane, const uint8_t *bitmap, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t x,
+              int16_t y, int16_t w, int16_t h)
+  {
+    finishWrite();
+    writes++;
+    Write write = {plane, bitmap, x_part, y_part, w_bitmap, x, y, w, h, 0};
+#ifdef EPD_SPI_DMA
+    write.checksum = _checksum(write);
+    _p = write;
+    _pending = true;
+#else
+    _copy(write);
+#endif
+  }
+
+  // FNV-1a over the source rectangle
+  static uint32_t _checksum(const Write &write)
+  {
+    uint32_t hash = 2166136261u;
+    for (int16_t r = 0; r < write.h; r++)
+    {
+      const uint8_t *src = write.bitmap + (uint32_t)(write.y_part + r) * (write.w_bitmap / 8) + write.x_part / 8;
+      for (int16_t b = 0; b < write.w / 8; b++)
+        hash = (hash ^ src[b]) * 16777619u;
+    }
+    return hash;
+  }
+
+  static void _copy(const Write &write)
+  {
+    for (int16_t r = 0; r < write.h; r++)
+    {
+      const uint8_t *src = write.bitmap + (uint32_t)(write.y_part + r) * (write.w_bitmap / 8) + write.x_part / 8;
+      memcpy(write.plane + (uint32_t)(write.y + r) * (WIDTH / 8) + write.x / 8, src, write.w / 8);
+    }
+  }
+};
+
+#endif // HOST_FAKE_PANEL_H
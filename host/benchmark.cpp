@@ -0,0 +1,12 @@
+#include <Arduino.h>
+#include "PagedDisplay.h"
+#include "RenderBenchmark.h"
+
+// The on-device render benchmark on a full-frame canvas, as with the default EPD_PAGE_HEIGHT
+int main()
+{
+  static uint8_t frame[(800 / 8) * 480];
+  PagedCanvas canvas(800, 480, frame, 480);
+  runRenderBenchmark(canvas);
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include <Arduino.h>
+#include "FakePanel.h"
+#include "PagedDisplay.h"
+
+// Band handoff of -DEPD_SPI_DMA: every page height has to leave the same panel RAM as the full frame,
+// without drawing into a band still in flight or leaving one in flight after a screen
+
+static int failures = 0;
+
+static void check(bool ok, const char *what, uint16_t pageHeight, int step)
+{
+  if (!ok)
+  {
+    Serial.printf("MISMATCH: %s, page height %u, step %d\n", what, pageHeight, step);
+    failures++;
+  }
+}
+
+// Shapes spread over every band, different for each seed
+template <typename Display>
+static void drawScene(Display &display, int seed)
+{
+  display.fillScreen(GxEPD_WHITE);
+  int16_t w = display.width(), h = display.height();
+  for (int i = 0; i < 12; i++)
+  {
+    int16_t x = (int16_t)((seed * 97 + i * 61) % w);
+    int16_t y = (int16_t)((seed * 53 + i * 41) % h);
+    display.fillRoundRect(x - 40, y - 30, 90 + i * 7, 70 + i * 5, 6 + i, i & 1 ? GxEPD_BLACK : GxEPD_WHITE);
+    display.drawLine(0, y, w - 1, (y * 3 + seed) % h, GxEPD_BLACK);
+    display.drawRect(x / 2, y / 2, w / 3, h / 4, GxEPD_BLACK);
+  }
+}
+
+template <typename Display>
+static void drawScreen(Display &display, int seed)
+{
+  display.firstPage();
+  do
+  {
+    drawScene(display, seed);
+  } while (display.nextPage());
+}
+
+// Native rows with a diagonal pattern, for writeFullFrame()
+static void fillRows(uint8_t *rows, uint16_t y, uint16_t h)
+{
+  for (uint16_t r = 0; r < h; r++)
+    for (uint16_t b = 0; b < FakePanel::WIDTH / 8; b++)
+      rows[(uint32_t)r * (FakePanel::WIDTH / 8) + b] = (uint8_t)((y + r) * 7 + b * 13);
+}
+
+// The same screens on a display with one page (the reference) and on one drawn in bands
+template <uint16_t page_height>
+static void checkPageHeight()
+{
+  static PagedDisplay<FakePanel, FakePanel::HEIGHT> reference(FakePanel{});
+  static PagedDisplay<FakePanel, page_height> banded(FakePanel{});
+  reference.init(0);
+  banded.init(0);
+
+  for (int step = 0; step < 6; step++)
+  {
+    uint8_t rotation = step == 3 ? 1 : step == 5 ? 3 : 0;
+    reference.setRotation(rotation);
+    banded.setRotation(rotation);
+    if (step == 4)
+    {
+      reference.writeFullFrame(fillRows);
+      banded.writeFullFrame(fillRows);
+    }
+    else
+    {
+      if (step == 0 || step == 5)
+      {
+        reference.setFullWindow();
+        banded.setFullWindow();
+      }
+      else
+      {
+        reference.setPartialWindow(40 + step * 16, 30 + step * 10, 300 + step * 24, 200 + step * 20);
+        banded.setPartialWindow(40 + step * 16, 30 + step * 10, 300 + step * 24, 200 + step * 20);
+      }
+      drawScreen(reference, step + 1);
+      drawScreen(banded, step + 1);
+    }
+
+    check(!memcmp(reference.epd2.current, banded.epd2.current, sizeof(banded.epd2.current)), "current plane",
+          page_height, step);
+    check(!memcmp(reference.epd2.previous, banded.epd2.previous, sizeof(banded.epd2.previous)), "previous plane",
+          page_height, step);
+    check(reference.epd2.refreshes == banded.epd2.refreshes, "refresh count", page_height, step);
+    check(banded.epd2.corruptWrites == 0, "band drawn while in flight", page_height, step);
+    check(!banded.epd2.busy(), "transfer left in flight", page_height, step);
+  }
+  Serial.printf("page height %3u: %lu writes, %lu refreshes\n", page_height, (unsigned long)banded.epd2.writes,
+                (unsigned long)banded.epd2.refreshes);
+}
+
+int main()
+{
+  // The reference itself: a full screen lands in both planes as a canvas draws it
+  static uint8_t frame[(FakePanel::WIDTH / 8) * FakePanel::HEIGHT];
+  PagedCanvas canvas(FakePanel::WIDTH, FakePanel::HEIGHT, frame, FakePanel::HEIGHT);
+  drawScene(canvas, 1);
+  static PagedDisplay<FakePanel, FakePanel::HEIGHT> single(FakePanel{});
+  single.init(0);
+  drawScreen(single, 1);
+  check(!memcmp(single.epd2.current, frame, sizeof(frame)) && !memcmp(single.epd2.previous, frame, sizeof(frame)),
+        "full frame", FakePanel::HEIGHT, 0);
+
+#ifdef EPD_SPI_DMA
+  // The fake catches a band changed while in flight
+  static FakePanel panel;
+  panel.writeImage(frame, 0, 0, FakePanel::WIDTH, 8);
+  frame[0] ^= 0xFF;
+  panel.finishWrite();
+  check(panel.corruptWrites == 1, "in-flight change not detected", 8, 0);
+#endif
+
+  checkPageHeight<60>();
+  checkPageHeight<64>();
+  checkPageHeight<16>();
+  checkPageHeight<FakePanel::HEIGHT>();
+
+  Serial.printf("mismatches: %d\n", failures);
+  return failures ? 1 : 0;
+}
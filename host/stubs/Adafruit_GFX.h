@@ -0,0 +1,80 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+// Font structures as in Adafruit GFX's gfxfont.h
+typedef struct
+{
+  uint16_t bitmapOffset; // Pointer into GFXfont->bitmap
+  uint8_t width;         // Bitmap dimensions in pixels
+  uint8_t height;        // Bitmap dimensions in pixels
+  uint8_t xAdvance;      // Distance to advance cursor (x axis)
+  int8_t xOffset;        // X dist from cursor pos to UL corner
+  int8_t yOffset;        // Y dist from cursor pos to UL corner
+} GFXglyph;
+
+typedef struct
+{
+  uint8_t *bitmap;  // Glyph bitmaps, concatenated
+  GFXglyph *glyph;  // Glyph array
+  uint16_t first;   // ASCII extents (first char)
+  uint16_t last;    // ASCII extents (last char)
+  uint8_t yAdvance; // Newline distance (y axis)
+} GFXfont;
+
+/**
+ * Host stand-in for Adafruit_GFX: the drawing primitives the renderer and
+ * the render benchmark use, with the library's algorithms and call
+ * structure (the write*() hooks forward to the overridable draw*() calls),
+ * so the per-pixel reference paths draw the same pixels as on the device.
+ * Text printing is left out; Utf8GfxHelper.h draws glyphs itself.
+ */
+class Adafruit_GFX
+{
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite() {}
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  virtual void endWrite() {}
+
+  virtual void setRotation(uint8_t r);
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color);
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color);
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t radius, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t radius, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+
+  void setFont(const GFXfont *f) { gfxFont = (GFXfont *)f; }
+  void setTextColor(uint16_t c) { textcolor = c; }
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  uint8_t getRotation() const { return rotation; }
+
+protected:
+  int16_t WIDTH;  // Display width, never changes
+  int16_t HEIGHT; // Display height, never changes
+  int16_t _width;  // Width as modified by the current rotation
+  int16_t _height; // Height as modified by the current rotation
+  uint8_t rotation;
+  uint16_t textcolor;
+  GFXfont *gfxFont;
+};
+
+#endif // HOST_ADAFRUIT_GFX_H
@@ -0,0 +1,5 @@
+#include "Arduino.h"
+#include "SPI.h"
+
+HostSerial Serial;
+SPIClass SPI;
@@ -0,0 +1,98 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Just enough of the Arduino-ESP32 core to build the renderer on a PC (see host/CMakeLists.txt)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Flash is ordinary memory on the host, as it is memory-mapped on the ESP32
+#define PROGMEM
+// Read through memcpy rather than a cast pointer: no aliasing, and fine on unaligned data
+inline uint8_t pgm_read_byte(const void *addr) { return *(const uint8_t *)addr; }
+
+inline uint16_t pgm_read_word(const void *addr)
+{
+  uint16_t v;
+  memcpy(&v, addr, sizeof(v));
+  return v;
+}
+
+inline uint32_t pgm_read_dword(const void *addr)
+{
+  uint32_t v;
+  memcpy(&v, addr, sizeof(v));
+  return v;
+}
+
+inline void *pgm_read_ptr(const void *addr)
+{
+  void *v;
+  memcpy(&v, addr, sizeof(v));
+  return v;
+}
+
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+// The ESP32 core takes min/max from the standard library as well
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+
+inline unsigned long micros()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long) {}
+inline void yield() {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+
+// Every Print writes to stdout
+class Print
+{
+public:
+  int printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n;
+  }
+
+  void print(const char *s) { fputs(s, stdout); }
+  void print(unsigned long v) { printf("%lu", v); }
+  void println(const char *s = "") { puts(s); }
+  void println(unsigned long v) { printf("%lu\n", v); }
+};
+
+class HostSerial : public Print
+{
+public:
+  void begin(unsigned long) {}
+  void flush() { fflush(stdout); }
+};
+
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,23 @@
+#ifndef HOST_GXEPD2_BW_H
+#define HOST_GXEPD2_BW_H
+
+#include <Adafruit_GFX.h>
+#include <SPI.h>
+
+// The helpers PagedDisplay takes from GxEPD2; the panel driver is faked in host/FakePanel.h
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+template <typename T>
+static inline void _swap_(T &a, T &b)
+{
+  T t = a;
+  a = b;
+  b = t;
+}
+
+static inline uint16_t gx_uint16_min(uint16_t a, uint16_t b) { return (a < b ? a : b); }
+static inline uint16_t gx_uint16_max(uint16_t a, uint16_t b) { return (a > b ? a : b); }
+
+#endif // HOST_GXEPD2_BW_H
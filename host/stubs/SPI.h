@@ -0,0 +1,24 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+// Only the types PagedDisplay::init() passes through to the panel driver
+class SPISettings
+{
+public:
+  SPISettings() {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass
+{
+public:
+  void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+};
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
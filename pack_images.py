@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Compress the 1bpp bitmaps of src/logo.h and src/image.h into src/Images.h.
+
+Each bitmap (Adafruit drawBitmap() layout: rows of (w + 7) / 8 bytes, MSB
+first, bit set = black) is inverted to the page buffer's layout (bit set =
+white) and PackBits-encoded as one stream, the same scheme as src/PackBits.h.
+On the device it is decoded row by row straight into the page band
+(drawPackedImage() in src/PackedImage.h).
+
+Run from the repository root after changing an image:
+
+python pack_images.py
+"""
+
+import re
+import sys
+
+sys.path.insert(0, 'src')
+from subset_font import write_bytes  # noqa: E402
+
+OUTPUT_FILE = 'src/Images.h'
+
+# (header, array) of every image to pack
+ASSETS = [
+    ('src/logo.h', 'logo'),
+    ('src/image.h', 'dr_mario'),
+]
+
+
+def parse_bitmap(path, name):
+    """Return (w, h, bytes) of a PROGMEM array preceded by a "// 'title', WxHpx" comment."""
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    m = re.search(r"//\s*'[^']*',\s*(\d+)x(\d+)px\s*\n\s*const unsigned char " + re.escape(name) +
+                  r"\[\]\s*PROGMEM\s*=\s*\{([^}]*)\}", text)
+    if not m:
+        raise ValueError(f"{name} not found in {path}")
+    w, h = int(m.group(1)), int(m.group(2))
+    data = [int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{2})', m.group(3))]
+    if len(data) != (w + 7) // 8 * h:
+        raise ValueError(f"{name} in {path}: {len(data)} bytes, expected {(w + 7) // 8 * h}")
+    return w, h, data
+
+
+def to_page_layout(w, h, data):
+    """Invert to bit set = white; padding bits past w become white as well."""
+    stride = (w + 7) // 8
+    pad = (1 << (stride * 8 - w)) - 1
+    out = [b ^ 0xFF for b in data]
+    for r in range(h):
+        out[r * stride + stride - 1] |= pad
+    return out
+
+
+def packbits_encode(src):
+    """Same packets as packBitsEncode() in src/PackBits.h."""
+    out = []
+    i, n = 0, len(src)
+    while i < n:
+        # Repeat packet for 2 or more equal bytes
+        run = 1
+        while i + run < n and run < 128 and src[i + run] == src[i]:
+            run += 1
+        if run >= 2:
+            out += [257 - run, src[i]]
+            i += run
+            continue
+
+        # Literal packet up to the next run of 3 (a shorter run is cheaper kept literal)
+        start = i
+        i += 1
+        while i < n and i - start < 128 and not (i + 2 < n and src[i] == src[i + 1] == src[i + 2]):
+            i += 1
+        out.append(i - start - 1)
+        out += src[start:i]
+    return out
+
+
+def packbits_decode(data):
+    out = []
+    i = 0
+    while i < len(data):
+        c = data[i]
+        i += 1
+        if c < 128:
+            out += data[i:i + c + 1]
+            i += c + 1
+        elif c > 128:
+            out += [data[i]] * (257 - c)
+            i += 1
+    return out
+
+
+def main():
+    images = []
+    for path, name in ASSETS:
+        w, h, raw = parse_bitmap(path, name)
+        rows = to_page_layout(w, h, raw)
+        packed = packbits_encode(rows)
+        if packbits_decode(packed) != rows:
+            print(f"Error: {name} does not decode to its bitmap")
+            return
+        images.append((path, name, w, h, len(raw), packed))
+
+    with open(OUTPUT_FILE, 'w', encoding='utf-8') as f:
+        f.write("""#ifndef IMAGES_H
+#define IMAGES_H
+
+#include "PackedImage.h"
+
+// Bitmaps of logo.h and image.h, PackBits-compressed by pack_images.py, do not edit
+
+""")
+        for path, name, w, h, raw_size, packed in images:
+            ident = name.upper()
+            f.write(f"// {path[4:]} '{name}', {w}x{h}: {raw_size} -> {len(packed)} bytes\n")
+            f.write(f"const uint8_t {ident}_PACKED[] PROGMEM = {{\n")
+            write_bytes(f, packed)
+            f.write(f"const PackedImage {ident}_IMAGE = {{{w}, {h}, {ident}_PACKED, sizeof({ident}_PACKED)}};\n\n")
+        f.write("#endif // IMAGES_H\n")
+
+    print(f"Successfully packed {len(images)} images to {OUTPUT_FILE}")
+    for path, name, w, h, raw_size, packed in images:
+        print(f"  {name} ({w}x{h}): {raw_size} -> {len(packed)} bytes ({len(packed) * 100 // raw_size}%)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,321 @@
+#!/usr/bin/env python3
+"""
+Pre-rasterize the static parts of the question screen into src/Chrome.h.
+
+The border and one category banner per CATEGORY_NAMES entry are drawn here
+the same way main.cpp would draw them (Adafruit_GFX rounded rectangles and
+the banner font), cut into byte-aligned pieces and written as 1bpp rows
+(bit set = white, as in the page buffer). On the device they are blitted
+row by row instead of being rasterized on every refresh.
+
+Run from the repository root after convert_csv.py or a font change:
+
+python render_chrome.py
+"""
+
+import os
+import sys
+
+sys.path.insert(0, 'src')
+from convert_csv import CAT_MAP  # noqa: E402
+from subset_font import parse_font, glyph_bits, write_bytes  # noqa: E402
+
+OUTPUT_FILE = 'src/Chrome.h'
+
+# Screen of the question deck (display coordinates, rotation 0)
+SCREEN_W, SCREEN_H = 800, 480
+
+# Border around the question: box, corner radius, thickness (nested 1 px outlines)
+BORDER_BOX = (50, 50, 700, 320)
+BORDER_RADIUS = 20
+BORDER_THICKNESS = 5
+
+# Category banner: box, corner radius, font (BANNER_FONT in src/DeckFonts.h) and text baseline
+BANNER_BOX = (250, 400, 300, 50)
+BANNER_RADIUS = 10
+BANNER_FONT = 'Lexend_Bold24pt7b'
+BANNER_BASELINE = 435
+
+
+class Canvas:
+    """1bpp screen, True = black, with the drawing rules of PagedCanvas/Adafruit_GFX."""
+
+    def __init__(self):
+        self.ink = [[False] * SCREEN_W for _ in range(SCREEN_H)]
+
+    def pixel(self, x, y, black):
+        if 0 <= x < SCREEN_W and 0 <= y < SCREEN_H:
+            self.ink[y][x] = black
+
+    def fill_rect(self, x, y, w, h, black):
+        for yy in range(y, y + h):
+            for xx in range(x, x + w):
+                self.pixel(xx, yy, black)
+
+    def circle_helper(self, x0, y0, r, corner, black):
+        """Adafruit_GFX::drawCircleHelper()."""
+        f, ddf_x, ddf_y, x, y = 1 - r, 1, -2 * r, 0, r
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            if corner & 0x4:
+                self.pixel(x0 + x, y0 + y, black)
+                self.pixel(x0 + y, y0 + x, black)
+            if corner & 0x2:
+                self.pixel(x0 + x, y0 - y, black)
+                self.pixel(x0 + y, y0 - x, black)
+            if corner & 0x8:
+                self.pixel(x0 - y, y0 + x, black)
+                self.pixel(x0 - x, y0 + y, black)
+            if corner & 0x1:
+                self.pixel(x0 - y, y0 - x, black)
+                self.pixel(x0 - x, y0 - y, black)
+
+    def fill_circle_helper(self, x0, y0, r, corners, delta, black):
+        """Adafruit_GFX::fillCircleHelper()."""
+        f, ddf_x, ddf_y, x, y = 1 - r, 1, -2 * r, 0, r
+        px, py = x, y
+        delta += 1
+        while x < y:
+            if f >= 0:
+                y -= 1
+                ddf_y += 2
+                f += ddf_y
+            x += 1
+            ddf_x += 2
+            f += ddf_x
+            if x < y + 1:
+                if corners & 1:
+                    self.fill_rect(x0 + x, y0 - y, 1, 2 * y + delta, black)
+                if corners & 2:
+                    self.fill_rect(x0 - x, y0 - y, 1, 2 * y + delta, black)
+            if y != py:
+                if corners & 1:
+                    self.fill_rect(x0 + py, y0 - px, 1, 2 * px + delta, black)
+                if corners & 2:
+                    self.fill_rect(x0 - py, y0 - px, 1, 2 * px + delta, black)
+                py = y
+            px = x
+
+    def round_rect(self, x, y, w, h, r, black):
+        """Adafruit_GFX::drawRoundRect()."""
+        r = min(r, min(w, h) // 2)
+        self.fill_rect(x + r, y, w - 2 * r, 1, black)
+        self.fill_rect(x + r, y + h - 1, w - 2 * r, 1, black)
+        self.fill_rect(x, y + r, 1, h - 2 * r, black)
+        self.fill_rect(x + w - 1, y + r, 1, h - 2 * r, black)
+        self.circle_helper(x + r, y + r, r, 1, black)
+        self.circle_helper(x + w - r - 1, y + r, r, 2, black)
+        self.circle_helper(x + w - r - 1, y + h - r - 1, r, 4, black)
+        self.circle_helper(x + r, y + h - r - 1, r, 8, black)
+
+    def fill_round_rect(self, x, y, w, h, r, black):
+        """Adafruit_GFX::fillRoundRect()."""
+        r = min(r, min(w, h) // 2)
+        self.fill_rect(x + r, y, w - 2 * r, h, black)
+        self.fill_circle_helper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, black)
+        self.fill_circle_helper(x + r, y + r, r, 2, h - 2 * r - 1, black)
+
+    def text_centered(self, font, text, center_x, baseline, black):
+        """drawUtf8StringCentered() in Utf8GfxHelper.h; codepoints missing from the font are skipped."""
+        bitmaps, glyphs, first, last = font
+        found = [glyphs[ord(c) - first] for c in text if first <= ord(c) <= last]
+        x = center_x - sum(g[3] for g in found) // 2
+        for g in found:
+            _, w, h, x_advance, x_offset, y_offset = g
+            bits = glyph_bits(bitmaps, g)
+            for row in range(h):
+                for col in range(w):
+                    if bits[row * w + col]:
+                        self.pixel(x + x_offset + col, baseline + y_offset + row, black)
+            x += x_advance
+
+
+def cut(canvas, x, y, w, h):
+    """Byte-aligned piece covering (x, y, w, h): (x, y, w, h, rows), rows as page buffer bytes."""
+    x0 = x - x % 8
+    x1 = (x + w + 7) // 8 * 8
+    rows = []
+    for yy in range(y, y + h):
+        row = []
+        for bx in range(x0, x1, 8):
+            byte = 0
+            for bit in range(8):
+                if not canvas.ink[yy][bx + bit]:
+                    byte |= 0x80 >> bit
+            row.append(byte)
+        rows.append(row)
+    return (x0, y, x1 - x0, h, rows)
+
+
+def check_covered(canvas, pieces, what):
+    """Every black pixel of canvas must be inside one of the pieces."""
+    for yy in range(SCREEN_H):
+        for xx in range(SCREEN_W):
+            if canvas.ink[yy][xx] and not any(px <= xx < px + pw and py <= yy < py + ph
+                                              for px, py, pw, ph, _ in pieces):
+                print(f"Error: {what} has ink at ({xx}, {yy}) outside its pieces")
+                sys.exit(1)
+
+
+def border_pieces():
+    """Top and bottom strips with the corners, and the two straight sides."""
+    canvas = Canvas()
+    x, y, w, h = BORDER_BOX
+    for i in range(BORDER_THICKNESS):
+        canvas.round_rect(x + i, y + i, w - i * 2, h - i * 2, BORDER_RADIUS, True)
+
+    # Corner rows of the innermost outline end BORDER_RADIUS + BORDER_THICKNESS - 1 rows in
+    band = BORDER_RADIUS + BORDER_THICKNESS
+    pieces = [
+        cut(canvas, x, y, w, band),
+        cut(canvas, x, y + band, BORDER_THICKNESS, h - 2 * band),
+        cut(canvas, x + w - BORDER_THICKNESS, y + band, BORDER_THICKNESS, h - 2 * band),
+        cut(canvas, x, y + h - band, w, band),
+    ]
+    check_covered(canvas, pieces, 'border')
+    return pieces
+
+
+def banner_piece(font, name):
+    canvas = Canvas()
+    x, y, w, h = BANNER_BOX
+    canvas.fill_round_rect(x, y, w, h, BANNER_RADIUS, True)
+    canvas.text_centered(font, name, x + w // 2, BANNER_BASELINE, False)
+    piece = cut(canvas, x, y, w, h)
+    check_covered(canvas, [piece], f'banner {name}')
+    return piece
+
+
+def c_string(text):
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def write_rows(f, name, piece):
+    x, y, w, h, rows = piece
+    f.write(f"// {w}x{h} at ({x}, {y})\n")
+    f.write(f"const uint8_t {name}[] PROGMEM = {{\n")
+    write_bytes(f, [b for row in rows for b in row])
+    return w // 8 * h
+
+
+def main():
+    if not os.path.exists(f'src/{BANNER_FONT}.h'):
+        print(f"Error: src/{BANNER_FONT}.h not found!")
+        return
+    _, bitmaps, glyphs, first, last, _ = parse_font(f'src/{BANNER_FONT}.h')
+    font = (bitmaps, glyphs, first, last)
+    names = list(CAT_MAP.values())
+
+    border = border_pieces()
+    banners = [banner_piece(font, name) for name in names]
+
+    size = 0
+    with open(OUTPUT_FILE, 'w', encoding='utf-8') as f:
+        f.write("""#ifndef CHROME_H
+#define CHROME_H
+
+#include <Arduino.h>
+#include "PagedDisplay.h"
+
+// Static parts of the question screen, pre-rasterized by render_chrome.py, do not edit
+
+/**
+ * One byte-aligned piece of pre-rasterized screen: 1bpp rows of w / 8 bytes
+ * in PROGMEM, MSB first, bit set = white (the page buffer's layout).
+ */
+struct ChromeBitmap
+{
+  int16_t x, y; // Top-left in display coordinates, x a multiple of 8
+  uint16_t w, h; // w a multiple of 8
+  const uint8_t *rows;
+};
+
+""")
+        f.write(f"""// Border around the question: nested 1 px rounded outlines
+const int16_t CHROME_BORDER_X = {BORDER_BOX[0]};
+const int16_t CHROME_BORDER_Y = {BORDER_BOX[1]};
+const int16_t CHROME_BORDER_W = {BORDER_BOX[2]};
+const int16_t CHROME_BORDER_H = {BORDER_BOX[3]};
+const int16_t CHROME_BORDER_RADIUS = {BORDER_RADIUS};
+const int16_t CHROME_BORDER_THICKNESS = {BORDER_THICKNESS};
+
+// Category banner: filled rounded box, name centered on the baseline in white ({BANNER_FONT})
+const int16_t CHROME_BANNER_X = {BANNER_BOX[0]};
+const int16_t CHROME_BANNER_Y = {BANNER_BOX[1]};
+const int16_t CHROME_BANNER_W = {BANNER_BOX[2]};
+const int16_t CHROME_BANNER_H = {BANNER_BOX[3]};
+const int16_t CHROME_BANNER_RADIUS = {BANNER_RADIUS};
+const int16_t CHROME_BANNER_BASELINE = {BANNER_BASELINE};
+
+""")
+        for i, piece in enumerate(border):
+            size += write_rows(f, f"CHROME_BORDER_ROWS_{i}", piece)
+        for i, piece in enumerate(banners):
+            size += write_rows(f, f"CHROME_BANNER_ROWS_{i}", piece)
+
+        f.write("const ChromeBitmap CHROME_BORDER[] = {\n")
+        for i, (x, y, w, h, _) in enumerate(border):
+            f.write(f"    {{{x}, {y}, {w}, {h}, CHROME_BORDER_ROWS_{i}}},\n")
+        f.write("};\n\n")
+
+        f.write("// Banner of each category name (CATEGORY_NAMES order when generated)\n")
+        f.write("const char *const CHROME_BANNER_NAMES[] = {\n")
+        for name in names:
+            f.write(f"    {c_string(name)},\n")
+        f.write("};\n\nconst ChromeBitmap CHROME_BANNERS[] = {\n")
+        for i, (x, y, w, h, _) in enumerate(banners):
+            f.write(f"    {{{x}, {y}, {w}, {h}, CHROME_BANNER_ROWS_{i}}},\n")
+        f.write("};\n")
+
+        f.write("""
+const uint8_t CHROME_BORDER_PIECES = sizeof(CHROME_BORDER) / sizeof(CHROME_BORDER[0]);
+const uint8_t CHROME_BANNER_COUNT = sizeof(CHROME_BANNERS) / sizeof(CHROME_BANNERS[0]);
+
+// Banner pre-rasterized for a category name, nullptr if there is none (regenerate Chrome.h)
+inline const ChromeBitmap *findChromeBanner(const char *category)
+{
+  for (uint8_t i = 0; i < CHROME_BANNER_COUNT; i++)
+  {
+    if (strcmp(CHROME_BANNER_NAMES[i], category) == 0)
+      return &CHROME_BANNERS[i];
+  }
+  return nullptr;
+}
+
+/**
+ * Blit a piece into the current page band: rows outside the band are
+ * skipped, the rest are ANDed in (black pixels drawn, white ones leave the
+ * buffer alone), so pieces can be drawn in any order. Native orientation
+ * only; returns false without drawing on a rotated canvas.
+ */
+inline bool drawChrome(PagedCanvas &canvas, const ChromeBitmap &piece)
+{
+  if (canvas.getRotation() != 0)
+    return false;
+
+  int16_t x = piece.x, y = piece.y, w = piece.w, h = piece.h;
+  if (!canvas.clipToPage(x, y, w, h))
+    return true;
+
+  // PROGMEM is memory-mapped on the ESP32, rows are read in place
+  uint16_t stride = piece.w / 8;
+  for (int16_t row = y; row < y + h; row++)
+    canvas.drawRowBytes(piece.x, row, piece.rows + (uint32_t)(row - piece.y) * stride, stride);
+  return true;
+}
+
+#endif // CHROME_H
+""")
+
+    print(f"Successfully rendered the border ({len(border)} pieces) and {len(banners)} banners to {OUTPUT_FILE}")
+    print(f"Flash: {size} bytes of rows")
+
+
+if __name__ == "__main__":
+    main()
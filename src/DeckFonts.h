@@ -0,0 +1,41 @@
+#ifndef DECK_FONTS_H
+#define DECK_FONTS_H
+
+#include <Adafruit_GFX.h>
+
+/**
+ * Fonts drawn on the question screen, subset to the deck's characters by
+ * src/subset_font.py. Build with -DRLE_FONTS to use the run-length encoded
+ * variants: less flash, slightly more CPU per glyph.
+ */
+#ifdef RLE_FONTS
+#include "Lexend_Bold24pt7b_rle.h"
+#include "Lexend_Light22pt7b_rle.h"
+#include "Lexend_Light28pt7b_rle.h"
+#include "Lexend_Light40pt7b_rle.h"
+
+// Question fonts, largest first; must match FONT_LADDER in convert_csv.py
+static const GFXfont *const QUESTION_FONTS[] = {
+    &Lexend_Light40pt7b_rle.font,
+    &Lexend_Light28pt7b_rle.font,
+    &Lexend_Light22pt7b_rle.font,
+};
+static const GFXfont *const BANNER_FONT = &Lexend_Bold24pt7b_rle.font;
+#else
+#include "Lexend_Bold24pt7b_sparse.h"
+#include "Lexend_Light22pt7b_sparse.h"
+#include "Lexend_Light28pt7b_sparse.h"
+#include "Lexend_Light40pt7b_sparse.h"
+
+// Question fonts, largest first; must match FONT_LADDER in convert_csv.py
+static const GFXfont *const QUESTION_FONTS[] = {
+    &Lexend_Light40pt7b_sparse.font,
+    &Lexend_Light28pt7b_sparse.font,
+    &Lexend_Light22pt7b_sparse.font,
+};
+static const GFXfont *const BANNER_FONT = &Lexend_Bold24pt7b_sparse.font;
+#endif
+
+static const GFXfont *const QUESTION_FONT = QUESTION_FONTS[0];
+
+#endif // DECK_FONTS_H
@@ -0,0 +1,59 @@
+#include "DirtyRegion.h"
+
+void DirtyRegion::clear()
+{
+  _x0 = _y0 = INT16_MAX;
+  _x1 = _y1 = INT16_MIN;
+}
+
+void DirtyRegion::add(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (w <= 0 || h <= 0)
+    return;
+
+  if (x < _x0)
+    _x0 = x;
+  if (y < _y0)
+    _y0 = y;
+  if (x + w > _x1)
+    _x1 = x + w;
+  if (y + h > _y1)
+    _y1 = y + h;
+}
+
+void DirtyRegion::add(const DirtyRegion &other)
+{
+  add(other.x(), other.y(), other.width(), other.height());
+}
+
+void DirtyRegion::clip(int16_t w, int16_t h)
+{
+  if (isEmpty())
+    return;
+
+  if (_x0 < 0)
+    _x0 = 0;
+  if (_y0 < 0)
+    _y0 = 0;
+  if (_x1 > w)
+    _x1 = w;
+  if (_y1 > h)
+    _y1 = h;
+  if (isEmpty())
+    clear();
+}
+
+void DirtyRegion::alignX(uint8_t granularity)
+{
+  if (isEmpty() || granularity <= 1)
+    return;
+
+  // Round x0 down and x1 up (% keeps the sign, so fix up negative remainders)
+  int16_t r = _x0 % granularity;
+  _x0 -= (r < 0) ? r + granularity : r;
+  r = _x1 % granularity;
+  if (r < 0)
+    r += granularity;
+  if (r)
+    _x1 += granularity - r;
+}
@@ -0,0 +1,41 @@
+#ifndef DIRTY_REGION_H
+#define DIRTY_REGION_H
+
+#include <Arduino.h>
+
+/**
+ * Bounding box of screen content that changes between two frames.
+ *
+ * Record the boxes of everything drawn on the outgoing screen and on the
+ * incoming one, then refresh only their union instead of a fixed window.
+ * Coordinates are display (rotated) coordinates, as for setPartialWindow().
+ */
+class DirtyRegion
+{
+public:
+  DirtyRegion() { clear(); }
+
+  void clear();
+  bool isEmpty() const { return _x1 <= _x0 || _y1 <= _y0; }
+
+  // Grow the region to include a rectangle (empty rectangles are ignored)
+  void add(int16_t x, int16_t y, int16_t w, int16_t h);
+  void add(const DirtyRegion &other);
+
+  // Limit the region to a w x h screen
+  void clip(int16_t w, int16_t h);
+
+  // Widen x to multiples of granularity (the SSD1677 addresses RAM in 8-pixel columns)
+  void alignX(uint8_t granularity = 8);
+
+  int16_t x() const { return _x0; }
+  int16_t y() const { return _y0; }
+  int16_t width() const { return isEmpty() ? 0 : _x1 - _x0; }
+  int16_t height() const { return isEmpty() ? 0 : _y1 - _y0; }
+  uint32_t area() const { return (uint32_t)width() * height(); }
+
+private:
+  int16_t _x0, _y0, _x1, _y1; // Half-open: [x0, x1) x [y0, y1)
+};
+
+#endif // DIRTY_REGION_H
@@ -1,7 +1,7 @@
 #include "DisplayManager.h"
 #include "config.h"
-#include "image.h"
-#include "logo.h"
+#include "Images.h"
+#include "PackBits.h"
 #include "SDCardManager.h"
 #include <Fonts/FreeMonoBold18pt7b.h>
 #include <Fonts/FreeMonoBold12pt7b.h>
@@ -13,19 +13,41 @@ static DisplayManager *g_displayManagerInstance = nullptr;
 // FreeRTOS task wrapper
 void displayUpdateTaskWrapper(void *parameter)
 {
-  while (1)
+  g_displayManagerInstance->runDisplayTask();
+}
+
+// Task blocked in waitWhileBusy(), woken by the BUSY falling edge
+static volatile TaskHandle_t g_busyWaiter = nullptr;
+
+static void IRAM_ATTR onBusyReleased()
+{
+  TaskHandle_t waiter = g_busyWaiter;
+  if (waiter != nullptr)
   {
-    if (g_displayManagerInstance != nullptr)
-    {
-      g_displayManagerInstance->updateDisplay();
-    }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(waiter, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+// GxEPD2 busy callback: sleep until the controller drops BUSY instead of polling every 1 ms
+static void waitWhileBusy(const void *)
+{
+  g_busyWaiter = xTaskGetCurrentTaskHandle();
+
+  // Re-check after publishing the waiter so an edge in between is not lost
+  if (digitalRead(EPD_BUSY) == HIGH)
+  {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EPD_BUSY_WAIT_MS));
   }
+  g_busyWaiter = nullptr;
 }
 
-DisplayManager::DisplayManager(GxEPD2_BW<GxEPD2_426_GDEQ0426T82, GxEPD2_426_GDEQ0426T82::HEIGHT> &disp)
-    : display(disp), batteryMonitor(nullptr), displayCommand(DISPLAY_NONE),
-      currentPressedButton(NONE), displayTaskHandle(NULL)
+DisplayManager::DisplayManager(EpdDisplay &disp)
+    : display(disp), batteryMonitor(nullptr), displayQueue(NULL), questionRenderer(nullptr), idleWork(nullptr),
+      currentPressedButton(NONE), displayTaskHandle(NULL), panelPower(PANEL_HIBERNATING), panelUsedAt(0),
+      awakeSince(0), awakeMs(0), hibernations(0), coldRefreshes(0), warmRefreshes(0), coldFirstPixelMs(0),
+      warmFirstPixelMs(0)
 {
   g_displayManagerInstance = this;
 }
@@ -38,28 +60,188 @@ void DisplayManager::begin()
   // Initialize display
   SPISettings spi_settings(SPI_FQ, MSBFIRST, SPI_MODE0);
   display.init(115200, true, 2, false, SPI, spi_settings);
+#ifdef EPD_SPI_DMA
+  if (!display.epd2.beginDma(EPD_SCLK, EPD_MOSI, SD_SPI_MISO, SPI_FQ))
+  {
+    Serial.println("SPI DMA unavailable, frame data goes out byte by byte");
+  }
+#endif
 
   // Setup display properties - Try rotation 0 for GDEQ0426T82
   display.setRotation(0); // No rotation, native landscape
   display.setTextColor(GxEPD_BLACK);
+
+  // BUSY is high while the controller refreshes; its falling edge wakes the waiting task
+  attachInterrupt(digitalPinToInterrupt(EPD_BUSY), onBusyReleased, FALLING);
+  display.epd2.setBusyCallback(waitWhileBusy);
 }
 
 void DisplayManager::startDisplayTask()
 {
-  // Create display update task on core 0 (main loop runs on core 1)
-  xTaskCreatePinnedToCore(displayUpdateTaskWrapper, // Task function
-                          "DisplayUpdate",          // Task name
-                          4096,                     // Stack size
-                          NULL,                     // Parameters
-                          1,                        // Priority
-                          &displayTaskHandle,       // Task handle
-                          0                         // Core 0
+  displayQueue = xQueueCreate(DISPLAY_QUEUE_LENGTH, sizeof(DisplayRequest));
+
+  // Single core: same priority as loop(), which keeps running while this task waits on BUSY
+  xTaskCreate(displayUpdateTaskWrapper, // Task function
+              "DisplayUpdate",          // Task name
+              DISPLAY_TASK_STACK,       // Stack size
+              NULL,                     // Parameters
+              1,                        // Priority
+              &displayTaskHandle        // Task handle
   );
 }
 
-void DisplayManager::setDisplayCommand(DisplayCommand cmd)
+bool DisplayManager::post(DisplayCommand cmd, int16_t question)
+{
+  if (displayQueue == NULL)
+    return false;
+
+  DisplayRequest request = {cmd, question, millis()};
+  return xQueueSend(displayQueue, &request, 0) == pdTRUE;
+}
+
+bool DisplayManager::isIdle() const
+{
+  // Jobs stay in the queue until they are drawn (see runDisplayTask())
+  return displayQueue == NULL || uxQueueMessagesWaiting(displayQueue) == 0;
+}
+
+void DisplayManager::waitUntilIdle()
 {
-  displayCommand = cmd;
+  while (!isIdle())
+  {
+    delay(10);
+  }
+}
+
+void DisplayManager::drawAndWait(DisplayCommand cmd, int16_t question)
+{
+  if (displayQueue == NULL)
+  {
+    // No display task yet: draw here
+    DisplayRequest request = {cmd, question, millis()};
+    render(request);
+    if (cmd == DISPLAY_SLEEP)
+      display.hibernate();
+    return;
+  }
+
+  // A full queue empties as the task draws
+  while (!post(cmd, question))
+  {
+    delay(10);
+  }
+  waitUntilIdle();
+}
+
+void DisplayManager::runDisplayTask()
+{
+  DisplayRequest request;
+  bool idlePending = true;
+
+  // setup() has drawn the first screen, so the controller starts out awake
+  panelPower = PANEL_ON;
+  panelUsedAt = awakeSince = millis();
+
+  while (1)
+  {
+    // Peek, draw, then remove, so isIdle() stays false until the refresh (and a hibernate) is done.
+    // With idle work left, only check for a job and do one step of the work otherwise;
+    // without it, sleep until a job comes in or the controller is due to power down.
+    TickType_t powerWait = stepPanelPower();
+    TickType_t wait = (idleWork != nullptr && idlePending) ? 0 : powerWait;
+    if (xQueuePeek(displayQueue, &request, wait) != pdTRUE)
+    {
+      if (idleWork != nullptr && idlePending)
+        idlePending = idleWork();
+      continue;
+    }
+    idlePending = true;
+
+    bool cold = panelPower == PANEL_HIBERNATING;
+    unsigned long start = millis();
+    display.resetTimings();
+    render(request);
+    unsigned long end = millis();
+
+    // Transfer is the time the CPU waited for frame data to go out; the rest is drawing and panel commands
+    Serial.printf("Display: command %d started %lu ms after the press, took %lu ms (transfer %lu ms, refresh %lu ms)\n",
+                  request.command, start - request.queuedAt, end - start,
+                  (unsigned long)(display.transferMicros() / 1000), (unsigned long)(display.refreshMicros() / 1000));
+
+    // Jobs that skipped the refresh left the controller alone
+    if (display.refreshMicros() > 0)
+    {
+      // A cold refresh first resets and re-initializes the controller
+      uint32_t firstPixel = (start - request.queuedAt) + display.firstRefreshMicros() / 1000;
+      Serial.printf("Display: first pixel %lu ms after the press (%s)\n", (unsigned long)firstPixel,
+                    cold ? "cold" : "warm");
+      if (cold)
+      {
+        coldRefreshes++;
+        coldFirstPixelMs += firstPixel;
+        awakeSince = start;
+      }
+      else
+      {
+        warmRefreshes++;
+        warmFirstPixelMs += firstPixel;
+      }
+      panelPower = PANEL_ON;
+      panelUsedAt = end;
+    }
+
+    // Deep sleep follows; the panel keeps the sleep screen without power
+    if (request.command == DISPLAY_SLEEP)
+      hibernatePanel();
+    xQueueReceive(displayQueue, &request, 0);
+  }
+}
+
+TickType_t DisplayManager::stepPanelPower()
+{
+  if (panelPower == PANEL_HIBERNATING)
+    return portMAX_DELAY;
+
+  uint32_t idle = millis() - panelUsedAt;
+  if (idle >= EPD_HIBERNATE_IDLE_MS)
+  {
+    hibernatePanel();
+    return portMAX_DELAY;
+  }
+  if (panelPower == PANEL_ON && idle >= EPD_POWER_OFF_IDLE_MS)
+  {
+    display.powerOff();
+    panelPower = PANEL_POWERED_OFF;
+  }
+
+  uint32_t due = (panelPower == PANEL_ON) ? EPD_POWER_OFF_IDLE_MS : EPD_HIBERNATE_IDLE_MS;
+  return pdMS_TO_TICKS(due - idle) + 1;
+}
+
+void DisplayManager::hibernatePanel()
+{
+  if (panelPower == PANEL_HIBERNATING)
+    return;
+
+  display.hibernate();
+  panelPower = PANEL_HIBERNATING;
+  hibernations++;
+  awakeMs += millis() - awakeSince;
+  Serial.printf("Display: controller hibernating after %lu ms awake\n", (unsigned long)(millis() - awakeSince));
+}
+
+void DisplayManager::printPowerStats(Print &out) const
+{
+  uint32_t awake = awakeMs;
+  if (panelPower != PANEL_HIBERNATING)
+    awake += millis() - awakeSince;
+
+  out.printf("Panel power: %s, awake %lu s in total, %lu hibernations\n",
+             panelPower == PANEL_ON ? "on" : (panelPower == PANEL_POWERED_OFF ? "booster off" : "hibernating"),
+             (unsigned long)(awake / 1000), (unsigned long)hibernations);
+  out.printf("  first pixel: %lu cold refreshes, %lu ms avg; %lu warm refreshes, %lu ms avg\n",
+             (unsigned long)coldRefreshes, (unsigned long)(coldRefreshes ? coldFirstPixelMs / coldRefreshes : 0),
+             (unsigned long)warmRefreshes, (unsigned long)(warmRefreshes ? warmFirstPixelMs / warmRefreshes : 0));
 }
 
 bool DisplayManager::isCharging()
@@ -139,7 +321,8 @@ void DisplayManager::drawSdTopFiles()
     display.print(s);
   };
 
-  // Use SDCardManager to get file list
+  // Use SDCardManager to get file list; the SD card shares the bus with a band still being sent
+  display.finishTransfer();
   SDCardManager sdManager;
   auto files = sdManager.getTopFiles(maxLines);
 
@@ -155,63 +338,75 @@ void DisplayManager::drawSdTopFiles()
   }
 }
 
-void DisplayManager::updateDisplay()
+void DisplayManager::showLogo()
 {
-  if (displayCommand != DISPLAY_NONE)
+  const PackedImage &image = LOGO_IMAGE;
+  if (image.w != EpdPanel::WIDTH || image.h != EpdPanel::HEIGHT)
   {
-    DisplayCommand cmd = displayCommand;
-    displayCommand = DISPLAY_NONE;
-
-    if (cmd == DISPLAY_INITIAL)
+    // Not a native frame: draw it like any other screen
+    display.setFullWindow();
+    display.firstPage();
+    do
     {
-      // Use full window for sleep screen with logo only
-      display.setFullWindow();
-      display.firstPage();
-      do
-      {
-        display.fillScreen(GxEPD_WHITE);
+      display.fillScreen(GxEPD_WHITE);
+      drawPackedImage(display, image, 0, 0);
+    } while (display.nextPage());
+    return;
+  }
 
-        // Draw fullscreen logo image
-        display.drawBitmap(0, 0, logo, 800, 480, GxEPD_BLACK);
-      } while (display.nextPage());
-    }
-    else if (cmd == DISPLAY_TEXT)
+  // Rows go from the decoder through the page buffer to the controller, nothing is drawn
+  PackBitsReader reader(image.data);
+  display.writeFullFrame([&](uint8_t *rows, uint16_t y, uint16_t h) {
+    if (y == 0)
+      reader = PackBitsReader(image.data);
+    reader.read(rows, (uint32_t)h * (image.w / 8));
+  });
+}
+
+void DisplayManager::render(const DisplayRequest &request)
+{
+  DisplayCommand cmd = request.command;
+
+  if (cmd == DISPLAY_QUESTION)
+  {
+    if (questionRenderer != nullptr)
     {
-      // Use partial refresh for text updates
-      display.setPartialWindow(0, 75, display.width(), 225);
-      display.firstPage();
-      do
-      {
-        display.fillScreen(GxEPD_WHITE);
-        display.setFont(&FreeMonoBold12pt7b);
-        display.setCursor(20, 100);
-        display.print(getButtonName(currentPressedButton));
-        drawBatteryInfo();
-      } while (display.nextPage());
+      questionRenderer(request.question);
     }
-    else if (cmd == DISPLAY_BATTERY)
+  }
+  else if (cmd == DISPLAY_INITIAL)
+  {
+    // Sleep screen with logo only
+    showLogo();
+  }
+  else if (cmd == DISPLAY_TEXT)
+  {
+    // Use partial refresh for text updates
+    display.setPartialWindow(0, 75, display.width(), 225);
+    display.firstPage();
+    do
     {
-      // Use partial refresh for battery updates
-      display.setPartialWindow(0, 135, display.width(), 200);
-      display.firstPage();
-      do
-      {
-        display.fillScreen(GxEPD_WHITE);
-        drawBatteryInfo();
-      } while (display.nextPage());
-    }
-    else if (cmd == DISPLAY_SLEEP)
+      display.fillScreen(GxEPD_WHITE);
+      display.setFont(&FreeMonoBold12pt7b);
+      display.setCursor(20, 100);
+      display.print(getButtonName(currentPressedButton));
+      drawBatteryInfo();
+    } while (display.nextPage());
+  }
+  else if (cmd == DISPLAY_BATTERY)
+  {
+    // Use partial refresh for battery updates
+    display.setPartialWindow(0, 135, display.width(), 200);
+    display.firstPage();
+    do
     {
-      // Use full window for sleep screen
-      display.setFullWindow();
-      display.firstPage();
-      do
-      {
-        display.fillScreen(GxEPD_WHITE);
-
-        // Draw fullscreen logo image
-        display.drawBitmap(0, 0, logo, 800, 480, GxEPD_BLACK);
-      } while (display.nextPage());
-    }
+      display.fillScreen(GxEPD_WHITE);
+      drawBatteryInfo();
+    } while (display.nextPage());
+  }
+  else if (cmd == DISPLAY_SLEEP)
+  {
+    // Fullscreen logo, streamed to the panel right before deep sleep
+    showLogo();
   }
 }
@@ -2,10 +2,27 @@
 #define DISPLAY_MANAGER_H
 
 #include <Arduino.h>
-#include <GxEPD2_BW.h>
+#include "PagedDisplay.h"
 #include "ButtonHandler.h"
 #include "BatteryMonitor.h"
 
+// Rows of the page buffer: the default full frame takes 48 KB for the device's whole life,
+// -DEPD_PAGE_HEIGHT=60 takes 6 KB and draws each screen in 8 bands (see the render benchmark)
+#ifndef EPD_PAGE_HEIGHT
+#define EPD_PAGE_HEIGHT GxEPD2_426_GDEQ0426T82::HEIGHT
+#endif
+
+// Panel driver: GxEPD2's, or with -DEPD_SPI_DMA one that sends frame data by DMA
+#ifdef EPD_SPI_DMA
+#include "EpdDmaPanel.h"
+typedef EpdDmaPanel<GxEPD2_426_GDEQ0426T82> EpdPanel;
+#else
+typedef GxEPD2_426_GDEQ0426T82 EpdPanel;
+#endif
+
+// Display type shared by main.cpp and the managers
+typedef PagedDisplay<EpdPanel, EPD_PAGE_HEIGHT> EpdDisplay;
+
 // Display command enum
 enum DisplayCommand
 {
@@ -13,28 +30,63 @@ enum DisplayCommand
   DISPLAY_INITIAL,
   DISPLAY_TEXT,
   DISPLAY_BATTERY,
-  DISPLAY_SLEEP
+  DISPLAY_SLEEP,
+  DISPLAY_QUESTION
+};
+
+// One queued display job
+struct DisplayRequest
+{
+  DisplayCommand command;
+  int16_t question;  // Question index for DISPLAY_QUESTION
+  uint32_t queuedAt; // millis() when posted, for the latency log
 };
 
+// Controller power state between jobs
+enum PanelPower
+{
+  PANEL_HIBERNATING = 0, // Deep sleep; the next write resets and re-initializes the controller
+  PANEL_POWERED_OFF,     // Initialized with the booster off
+  PANEL_ON               // As the last refresh left it
+};
+
+// Draws and refreshes a question screen; runs on the display task
+typedef void (*QuestionRenderer)(int index);
+
+// Background work for the display task while its queue is empty; returns true if there is more
+typedef bool (*IdleWork)();
+
 class DisplayManager
 {
 public:
-  DisplayManager(GxEPD2_BW<GxEPD2_426_GDEQ0426T82, GxEPD2_426_GDEQ0426T82::HEIGHT> &display);
+  DisplayManager(EpdDisplay &display);
 
   // Initialize display
   void begin();
 
-  // Start display update task on core 0
+  // Start the display task; from then on all drawing goes through post()
   void startDisplayTask();
 
-  // Set display command
-  void setDisplayCommand(DisplayCommand cmd);
+  // Queue a display job without waiting for it; false if the queue is full
+  bool post(DisplayCommand cmd, int16_t question = -1);
+
+  // Queue a display command (same as post(cmd))
+  void setDisplayCommand(DisplayCommand cmd) { post(cmd); }
+
+  // True when no job is queued or being drawn
+  bool isIdle() const;
+
+  // Block until the display task has finished every queued job
+  void waitUntilIdle();
+
+  // Draw a job after the queued ones and block until it is done (drawn directly before startDisplayTask())
+  void drawAndWait(DisplayCommand cmd, int16_t question = -1);
 
-  // Get display command
-  DisplayCommand getDisplayCommand() const { return displayCommand; }
+  // Set the function that draws DISPLAY_QUESTION jobs
+  void setQuestionRenderer(QuestionRenderer renderer) { questionRenderer = renderer; }
 
-  // Clear display command
-  void clearDisplayCommand() { displayCommand = DISPLAY_NONE; }
+  // Set work done in small steps between jobs (called again after every job)
+  void setIdleWork(IdleWork work) { idleWork = work; }
 
   // Set current pressed button for display
   void setCurrentButton(Button btn) { currentPressedButton = btn; }
@@ -42,19 +94,40 @@ public:
   // Set battery monitor reference
   void setBatteryMonitor(BatteryMonitor *monitor) { batteryMonitor = monitor; }
 
-  // Display update task (called from FreeRTOS task)
-  void updateDisplay();
+  // Display task body: draw queued jobs one at a time
+  void runDisplayTask();
+
+  // Print cold/warm time to first pixel and how long the controller stayed awake, e.g. printPowerStats(Serial)
+  void printPowerStats(Print &out) const;
 
 private:
-  GxEPD2_BW<GxEPD2_426_GDEQ0426T82, GxEPD2_426_GDEQ0426T82::HEIGHT> &display;
+  EpdDisplay &display;
   BatteryMonitor *batteryMonitor;
-  volatile DisplayCommand displayCommand;
+  QueueHandle_t displayQueue;
+  QuestionRenderer questionRenderer;
+  IdleWork idleWork;
   Button currentPressedButton;
   TaskHandle_t displayTaskHandle;
 
+  // Controller power (display task only)
+  PanelPower panelPower;
+  uint32_t panelUsedAt; // millis() of the last refresh
+  uint32_t awakeSince;  // millis() of the first refresh after hibernating
+  uint32_t awakeMs;     // Time awake before the last hibernation, summed
+  uint32_t hibernations;
+  uint32_t coldRefreshes, warmRefreshes;
+  uint32_t coldFirstPixelMs, warmFirstPixelMs; // Press to first refresh, summed
+
+  void render(const DisplayRequest &request);
+
+  // Power down as far as the idle time allows; returns ticks until the next step is due
+  TickType_t stepPanelPower();
+  void hibernatePanel();
+
   // Drawing functions
   void drawBatteryInfo();
   void drawSdTopFiles();
+  void showLogo(); // Full refresh with the logo
   const char *getButtonName(Button btn);
   bool isCharging();
 };
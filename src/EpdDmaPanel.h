@@ -0,0 +1,327 @@
+#ifndef EPD_DMA_PANEL_H
+#define EPD_DMA_PANEL_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <GxEPD2_BW.h>
+#include <driver/spi_master.h>
+#include <soc/soc_memory_layout.h>
+#include <soc/spi_struct.h>
+
+// Bytes per DMA transaction of frame data (a multiple of 4, at most the 4092-byte descriptor limit)
+#ifndef EPD_DMA_CHUNK
+#define EPD_DMA_CHUNK 4092
+#endif
+
+// Transactions queued to the SPI peripheral at a time
+#define EPD_DMA_QUEUE 4
+
+/**
+ * SSD1677 panel driver whose frame data goes out by DMA (-DEPD_SPI_DMA).
+ *
+ * GxEPD2 sends controller RAM one SPI.transfer() per byte, with the CPU
+ * waiting on every byte. The write*() methods below hide the driver's: the
+ * RAM window and write command still go through GxEPD2's SPI calls, then the
+ * rows are queued to the SPI peripheral in EPD_DMA_CHUNK transactions and the
+ * call returns while they are in flight. PagedDisplay renders the next band
+ * into its other page buffer meanwhile. The next write, refresh(), powerOff()
+ * or hibernate() waits for the transfer first (finishWrite()).
+ *
+ * Only whole rows of a word-aligned RAM bitmap go by DMA, as one contiguous
+ * block the driver can send without a bounce buffer. Column slices, flash
+ * bitmaps, inverted or mirrored writes and the first write after init or
+ * hibernate (GxEPD2 sets up the controller there) go through GxEPD2.
+ *
+ * The SD card is on the same bus. The Arduino SPI transaction is held from
+ * the data phase until finishWrite(), so SD access from other tasks waits
+ * for the transfer; the task drawing the bands has to call
+ * PagedDisplay::finishTransfer() before it touches the SD card itself. The
+ * SPI registers the Arduino driver relies on are saved before each transfer
+ * and put back afterwards.
+ *
+ * Experimental: this has not run on the device. The register save/restore
+ * works behind both the Arduino and the ESP-IDF SPI driver, and the host
+ * build's fake panel cannot exercise it.
+ */
+template <typename Panel>
+class EpdDmaPanel : public Panel
+{
+public:
+  EpdDmaPanel(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+      : Panel(cs, dc, rst, busy), _device(nullptr), _active(false), _inFlight(0), _next(0)
+  {
+  }
+
+  /**
+   * Attach to the SPI bus after SPI.begin() and display init, with the
+   * same pins. Returns false if the bus cannot be claimed; writes then stay
+   * on GxEPD2's byte path.
+   */
+  bool beginDma(int8_t sclk, int8_t mosi, int8_t miso, uint32_t frequency)
+  {
+    _saveArduinoSpi();
+
+    spi_bus_config_t bus = {};
+    bus.sclk_io_num = sclk;
+    bus.mosi_io_num = mosi;
+    bus.miso_io_num = miso;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = EPD_DMA_CHUNK;
+    if (spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK)
+    {
+      _restoreArduinoSpi();
+      return false;
+    }
+
+    // CS stays under GxEPD2's control (digitalWrite), as for its own transfers
+    spi_device_interface_config_t dev = {};
+    dev.clock_speed_hz = frequency;
+    dev.mode = 0;
+    dev.spics_io_num = -1;
+    dev.queue_size = EPD_DMA_QUEUE;
+    if (spi_bus_add_device(SPI2_HOST, &dev, &_device) != ESP_OK)
+    {
+      spi_bus_free(SPI2_HOST);
+      _device = nullptr;
+    }
+    _restoreArduinoSpi();
+    return _device != nullptr;
+  }
+
+  bool hasDma() const { return _device != nullptr; }
+
+  // Controller planes: 0x24 = current image, 0x26 = previous image (for differential refresh)
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+                  bool mirror_y = false, bool pgm = false)
+  {
+    if (!_canDma(bitmap, 0, x, w, w, invert || mirror_y || pgm))
+      return Panel::writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+    _write(0x24, bitmap, 0, w, x, y, w, h);
+  }
+
+  void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                                bool invert = false, bool mirror_y = false, bool pgm = false)
+  {
+    if (!_canDma(bitmap, 0, x, w, w, invert || mirror_y || pgm))
+      return Panel::writeImageForFullRefresh(bitmap, x, y, w, h, invert, mirror_y, pgm);
+    _write(0x26, bitmap, 0, w, x, y, w, h);
+    _write(0x24, bitmap, 0, w, x, y, w, h);
+  }
+
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+                       bool mirror_y = false, bool pgm = false)
+  {
+    if (!_canDma(bitmap, 0, x, w, w, invert || mirror_y || pgm))
+      return Panel::writeImageAgain(bitmap, x, y, w, h, invert, mirror_y, pgm);
+    _write(0x26, bitmap, 0, w, x, y, w, h);
+    _write(0x24, bitmap, 0, w, x, y, w, h);
+  }
+
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                      int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false,
+                      bool pgm = false)
+  {
+    if (!_canDma(bitmap, x_part, x, w, w_bitmap, invert || mirror_y || pgm))
+      return Panel::writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    _write(0x24, bitmap, y_part, w_bitmap, x, y, w, h);
+  }
+
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                           int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+                           bool mirror_y = false, bool pgm = false)
+  {
+    if (!_canDma(bitmap, x_part, x, w, w_bitmap, invert || mirror_y || pgm))
+      return Panel::writeImagePartAgain(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y,
+                                        pgm);
+    _write(0x26, bitmap, y_part, w_bitmap, x, y, w, h);
+    _write(0x24, bitmap, y_part, w_bitmap, x, y, w, h);
+  }
+
+  // Everything else talks to the controller, so the frame data has to be out first
+  void refresh(bool partial_update_mode = false)
+  {
+    finishWrite();
+    Panel::refresh(partial_update_mode);
+  }
+
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    finishWrite();
+    Panel::refresh(x, y, w, h);
+  }
+
+  void powerOff()
+  {
+    finishWrite();
+    Panel::powerOff();
+  }
+
+  void hibernate()
+  {
+    finishWrite();
+    Panel::hibernate();
+  }
+
+  // Wait until the queued frame data is sent and hand the bus back
+  void finishWrite()
+  {
+    if (!_active)
+      return;
+
+    while (_inFlight > 0)
+    {
+      spi_transaction_t *done;
+      spi_device_get_trans_result(_device, &done, portMAX_DELAY);
+      _inFlight--;
+    }
+    spi_device_release_bus(_device);
+    _restoreArduinoSpi();
+    digitalWrite(this->_cs, HIGH);
+    this->_pSPIx->endTransaction();
+    _active = false;
+  }
+
+private:
+  spi_device_handle_t _device;
+  bool _active;      // Bus taken for a transfer, CS low
+  uint8_t _inFlight; // Queued transactions not yet reaped
+  uint8_t _next;     // Next free entry of _trans
+  spi_transaction_t _trans[EPD_DMA_QUEUE];
+
+  // Arduino driver state of the SPI peripheral, put back after each DMA transfer
+  uint32_t _savedUser, _savedUser1, _savedUser2, _savedCtrl, _savedClock, _savedMisc, _savedDmaConf;
+
+  /**
+   * Whether columns x_part..x_part + w of a bitmap w_bitmap wide, written at
+   * panel column x, can go by DMA: whole rows inside the panel (one
+   * contiguous block) of a 4-byte aligned bitmap in DMA-capable RAM.
+   * Otherwise the pending transfer is finished so that GxEPD2 can have the
+   * bus.
+   */
+  bool _canDma(const uint8_t *bitmap, int16_t x_part, int16_t x, int16_t w, int16_t w_bitmap, bool special)
+  {
+    bool rows = x_part == 0 && w == w_bitmap && x >= 0 && x % 8 == 0 && x + w <= int16_t(Panel::WIDTH);
+    bool aligned = (w_bitmap & 31) == 0 && ((uintptr_t)bitmap & 3) == 0 && esp_ptr_dma_capable(bitmap);
+    // GxEPD2 initialises the controller (and clears its RAM) on the first write after init/hibernate
+    if (!_device || special || !this->_init_display_done || this->_initial_write || !rows || !aligned)
+    {
+      finishWrite();
+      return false;
+    }
+    return true;
+  }
+
+  // Same RAM window as GxEPD2_426_GDEQ0426T82::_setPartialRamArea(): x in pixels, gates scanned bottom up
+  void _setRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+  {
+    y = Panel::HEIGHT - y - h;
+    this->_writeCommand(0x11); // Data entry mode: x increment, y decrement
+    this->_writeData(0x01);
+    this->_writeCommand(0x44);
+    this->_writeData(x % 256);
+    this->_writeData(x / 256);
+    this->_writeData((x + w - 1) % 256);
+    this->_writeData((x + w - 1) / 256);
+    this->_writeCommand(0x45);
+    this->_writeData((y + h - 1) % 256);
+    this->_writeData((y + h - 1) / 256);
+    this->_writeData(y % 256);
+    this->_writeData(y / 256);
+    this->_writeCommand(0x4E);
+    this->_writeData(x % 256);
+    this->_writeData(x / 256);
+    this->_writeCommand(0x4F);
+    this->_writeData((y + h - 1) % 256);
+    this->_writeData((y + h - 1) / 256);
+  }
+
+  /**
+   * Send h rows from row y_part of a bitmap w_bitmap wide (whole rows, see
+   * _canDma()) to controller plane command at (x, y), clipped to the panel
+   * rows as GxEPD2 does. Returns with the last rows still in flight.
+   */
+  void _write(uint8_t command, const uint8_t *bitmap, int16_t y_part, int16_t w_bitmap, int16_t x, int16_t y,
+              int16_t w, int16_t h)
+  {
+    finishWrite();
+
+    if (y < 0)
+    {
+      y_part -= y;
+      h += y;
+      y = 0;
+    }
+    if (y + h > int16_t(Panel::HEIGHT))
+      h = Panel::HEIGHT - y;
+    if (h <= 0)
+      return;
+
+    _setRamArea(x, y, w, h);
+    this->_writeCommand(command);
+
+    // Data phase: keep the Arduino SPI transaction (and so the SD card) off the bus until finishWrite()
+    this->_pSPIx->beginTransaction(this->_spi_settings);
+    _saveArduinoSpi();
+    digitalWrite(this->_cs, LOW);
+    spi_device_acquire_bus(_device, portMAX_DELAY);
+    _active = true;
+
+    uint16_t stride = w_bitmap / 8;
+    _queue(bitmap + (uint32_t)y_part * stride, (uint32_t)stride * h);
+  }
+
+  void _queue(const uint8_t *data, uint32_t n)
+  {
+    while (n > 0)
+    {
+      // Reap the oldest transaction before its entry is reused
+      if (_inFlight == EPD_DMA_QUEUE)
+      {
+        spi_transaction_t *done;
+        spi_device_get_trans_result(_device, &done, portMAX_DELAY);
+        _inFlight--;
+      }
+
+      uint32_t k = (n < EPD_DMA_CHUNK) ? n : EPD_DMA_CHUNK;
+      spi_transaction_t &t = _trans[_next];
+      memset(&t, 0, sizeof(t));
+      t.length = k * 8;
+      t.tx_buffer = data;
+      spi_device_queue_trans(_device, &t, portMAX_DELAY);
+      _next = (_next + 1) % EPD_DMA_QUEUE;
+      _inFlight++;
+      data += k;
+      n -= k;
+    }
+  }
+
+  void _saveArduinoSpi()
+  {
+    _savedUser = GPSPI2.user.val;
+    _savedUser1 = GPSPI2.user1.val;
+    _savedUser2 = GPSPI2.user2.val;
+    _savedCtrl = GPSPI2.ctrl.val;
+    _savedClock = GPSPI2.clock.val;
+    _savedMisc = GPSPI2.misc.val;
+    _savedDmaConf = GPSPI2.dma_conf.val;
+  }
+
+  // The ESP-IDF driver leaves DMA on and its own phases and clock set; Arduino's FIFO transfers need theirs
+  void _restoreArduinoSpi()
+  {
+    GPSPI2.dma_conf.val = _savedDmaConf;
+    GPSPI2.user.val = _savedUser;
+    GPSPI2.user1.val = _savedUser1;
+    GPSPI2.user2.val = _savedUser2;
+    GPSPI2.ctrl.val = _savedCtrl;
+    GPSPI2.clock.val = _savedClock;
+    GPSPI2.misc.val = _savedMisc;
+    // Latch the configuration into the SPI clock domain
+    GPSPI2.cmd.update = 1;
+    while (GPSPI2.cmd.update)
+      ;
+  }
+};
+
+#endif // EPD_DMA_PANEL_H
@@ -0,0 +1,206 @@
+#include "GhostingTracker.h"
+
+// Black pixels in count bytes of a 1bpp row (bit clear = black)
+static uint16_t inkBits(const uint8_t *bytes, uint16_t count)
+{
+  uint16_t n = 0;
+  for (uint16_t i = 0; i < count; i++)
+    n += __builtin_popcount((uint8_t)~bytes[i]);
+  return n;
+}
+
+GhostingTracker::GhostingTracker(int16_t width, int16_t height)
+    : _width(width), _height(height), _flipsPerPixel(0)
+{
+  _cols = (width + GHOSTING_TILE - 1) / GHOSTING_TILE;
+  _rows = (height + GHOSTING_TILE - 1) / GHOSTING_TILE;
+  reset();
+}
+
+void GhostingTracker::reset()
+{
+  memset(_ink, 0, sizeof(_ink));
+  memset(_flips, 0, sizeof(_flips));
+  _fullRefreshes = 0;
+  _flashes = 0;
+  _flashedPixels = 0;
+}
+
+uint32_t GhostingTracker::_tilePixels(uint8_t col, uint8_t row) const
+{
+  int16_t w = _width - col * GHOSTING_TILE;
+  int16_t h = _height - row * GHOSTING_TILE;
+  return (uint32_t)(w < GHOSTING_TILE ? w : GHOSTING_TILE) * (h < GHOSTING_TILE ? h : GHOSTING_TILE);
+}
+
+void GhostingTracker::recordFull(const uint8_t *rows, uint16_t stride, int16_t y, int16_t h)
+{
+  if (y == 0)
+  {
+    memset(_ink, 0, sizeof(_ink));
+    memset(_flips, 0, sizeof(_flips));
+    _fullRefreshes++;
+  }
+
+  const uint16_t tileBytes = GHOSTING_TILE / 8;
+  for (int16_t r = 0; r < h; r++)
+  {
+    const uint8_t *row = rows + (uint32_t)r * stride;
+    uint16_t *ink = &_ink[((y + r) / GHOSTING_TILE) * _cols];
+    for (uint8_t col = 0; col < _cols; col++)
+    {
+      uint16_t first = col * tileBytes;
+      uint16_t count = (first + tileBytes <= stride) ? tileBytes : stride - first;
+      ink[col] += inkBits(row + first, count);
+    }
+  }
+}
+
+void GhostingTracker::recordPartial(const uint8_t *rows, uint16_t stride, int16_t x, int16_t y, int16_t w,
+                                    int16_t h, const uint8_t *previous, uint16_t previousStride)
+{
+  if (w <= 0 || h <= 0)
+    return;
+
+  for (uint8_t row = y / GHOSTING_TILE; row <= (y + h - 1) / GHOSTING_TILE && row < _rows; row++)
+  {
+    int16_t y0 = row * GHOSTING_TILE;
+    int16_t y1 = y0 + GHOSTING_TILE;
+    if (y0 < y)
+      y0 = y;
+    if (y1 > y + h)
+      y1 = y + h;
+
+    for (uint8_t col = x / GHOSTING_TILE; col <= (x + w - 1) / GHOSTING_TILE && col < _cols; col++)
+    {
+      int16_t x0 = col * GHOSTING_TILE;
+      int16_t x1 = x0 + GHOSTING_TILE;
+      if (x0 < x)
+        x0 = x;
+      if (x1 > x + w)
+        x1 = x + w;
+
+      // Part of the tile covered by this update, in bytes of the row
+      uint16_t first = (x0 - x) / 8;
+      uint16_t count = (x1 - x0) / 8;
+      uint32_t newInk = 0, oldInk = 0, flips = 0;
+      for (int16_t yy = y0; yy < y1; yy++)
+      {
+        const uint8_t *a = rows + (uint32_t)(yy - y) * stride + first;
+        newInk += inkBits(a, count);
+        if (previous)
+        {
+          const uint8_t *b = previous + (uint32_t)(yy - y) * previousStride + first;
+          oldInk += inkBits(b, count);
+          for (uint16_t i = 0; i < count; i++)
+            flips += __builtin_popcount((uint8_t)(a[i] ^ b[i]));
+        }
+      }
+
+      uint16_t tile = row * _cols + col;
+      if (!previous)
+      {
+        // Assume the tile's ink was spread evenly over it and overlaps the new ink at random
+        uint32_t covered = (uint32_t)(x1 - x0) * (y1 - y0);
+        oldInk = (uint32_t)_ink[tile] * covered / _tilePixels(col, row);
+        flips = oldInk + newInk - 2 * (oldInk * newInk / covered);
+      }
+
+      int32_t ink = (int32_t)_ink[tile] - (int32_t)oldInk + (int32_t)newInk;
+      _ink[tile] = ink < 0 ? 0 : ink;
+      _flips[tile] += flips;
+    }
+  }
+}
+
+bool GhostingTracker::flashWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const
+{
+  if (_flipsPerPixel == 0)
+    return false;
+
+  // Nothing to do until a tile reaches the limit; then tiles past half of it are
+  // flashed along, so neighbours do not each trigger a flash of their own
+  bool due = false;
+  for (uint16_t tile = 0; tile < (uint16_t)_cols * _rows && !due; tile++)
+    due = _flips[tile] >= _limit(tile % _cols, tile / _cols);
+  if (!due)
+    return false;
+
+  int16_t col0 = _cols, row0 = _rows, col1 = -1, row1 = -1;
+  for (uint8_t row = 0; row < _rows; row++)
+  {
+    for (uint8_t col = 0; col < _cols; col++)
+    {
+      if (_flips[row * _cols + col] * 2 < _limit(col, row))
+        continue;
+      if (col < col0)
+        col0 = col;
+      if (col > col1)
+        col1 = col;
+      if (row < row0)
+        row0 = row;
+      if (row > row1)
+        row1 = row;
+    }
+  }
+  x = col0 * GHOSTING_TILE;
+  y = row0 * GHOSTING_TILE;
+  w = (col1 + 1) * GHOSTING_TILE > _width ? _width - x : (col1 + 1 - col0) * GHOSTING_TILE;
+  h = (row1 + 1) * GHOSTING_TILE > _height ? _height - y : (row1 + 1 - row0) * GHOSTING_TILE;
+  return true;
+}
+
+void GhostingTracker::flashed(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  for (uint8_t row = 0; row < _rows; row++)
+  {
+    for (uint8_t col = 0; col < _cols; col++)
+    {
+      int16_t tx = col * GHOSTING_TILE;
+      int16_t ty = row * GHOSTING_TILE;
+      int16_t tw = (tx + GHOSTING_TILE > _width) ? _width - tx : GHOSTING_TILE;
+      int16_t th = (ty + GHOSTING_TILE > _height) ? _height - ty : GHOSTING_TILE;
+      if (tx >= x && ty >= y && tx + tw <= x + w && ty + th <= y + h)
+        _flips[row * _cols + col] = 0;
+    }
+  }
+  _flashes++;
+  _flashedPixels += (uint32_t)w * h;
+}
+
+uint16_t GhostingTracker::peakFlipsPercent() const
+{
+  uint32_t peak = 0;
+  for (uint8_t row = 0; row < _rows; row++)
+  {
+    for (uint8_t col = 0; col < _cols; col++)
+    {
+      uint32_t percent = _flips[row * _cols + col] * 100 / _tilePixels(col, row);
+      if (percent > peak)
+        peak = percent;
+    }
+  }
+  return peak > 65535 ? 65535 : peak;
+}
+
+void GhostingTracker::printStats(Print &out) const
+{
+  uint16_t peak = peakFlipsPercent();
+  out.printf("Ghosting: peak %u.%02u flips/pixel (limit %u), %lu full refreshes, %lu flashes (%lu px)\n",
+             peak / 100, peak % 100, (unsigned)_flipsPerPixel, (unsigned long)_fullRefreshes,
+             (unsigned long)_flashes, (unsigned long)_flashedPixels);
+  if (_flipsPerPixel == 0)
+    return;
+
+  char line[GHOSTING_MAX_COLS + 1];
+  for (uint8_t row = 0; row < _rows; row++)
+  {
+    for (uint8_t col = 0; col < _cols; col++)
+    {
+      uint32_t level = _flips[row * _cols + col] * 10 / _limit(col, row);
+      line[col] = _flips[row * _cols + col] == 0 ? '.' : level > 9 ? '#' : '0' + level;
+    }
+    line[_cols] = '\0';
+    out.printf("  %s\n", line);
+  }
+}
@@ -0,0 +1,82 @@
+#ifndef GHOSTING_TRACKER_H
+#define GHOSTING_TRACKER_H
+
+#include <Arduino.h>
+
+// Tile edge in pixels; flips are accumulated per tile
+#define GHOSTING_TILE 32
+
+// Tiles of the largest supported panel (800x480)
+#define GHOSTING_MAX_COLS ((800 + GHOSTING_TILE - 1) / GHOSTING_TILE)
+#define GHOSTING_MAX_ROWS ((480 + GHOSTING_TILE - 1) / GHOSTING_TILE)
+
+/**
+ * Counts how often partial updates flip the pixels of each screen tile, so
+ * ghosting can be dealt with where it builds up instead of with a full
+ * refresh every N updates: worn tiles are flashed black and back through a
+ * partial update, which reduces their ghosting (see main.cpp).
+ *
+ * Frames are fed in native orientation as 1bpp rows (bit set = white), the
+ * same way PagedDisplay sends them. With the previous frame available (the
+ * shadow framebuffer) flips are counted exactly; without it each tile keeps
+ * its ink count and the flips of a covered part are estimated from old and
+ * new ink, assuming the two overlap at random.
+ */
+class GhostingTracker
+{
+public:
+  GhostingTracker(int16_t width, int16_t height);
+
+  // Forget all counts, as on a blank panel
+  void reset();
+
+  // Flash a tile once its flips reach flipsPerPixel times its pixel count (0 = never)
+  void setFlipsPerPixel(uint8_t flipsPerPixel) { _flipsPerPixel = flipsPerPixel; }
+
+  /**
+   * Rows of a full refresh (x = 0, full width). The first band (y = 0)
+   * clears all flips, since a full refresh leaves the panel clean.
+   */
+  void recordFull(const uint8_t *rows, uint16_t stride, int16_t y, int16_t h);
+
+  /**
+   * Rows of a partial update at native (x, y), x and w multiples of 8.
+   *
+   * @param previous Same rectangle of the frame on the panel before the update, or nullptr
+   * @param previousStride Bytes per row of previous
+   */
+  void recordPartial(const uint8_t *rows, uint16_t stride, int16_t x, int16_t y, int16_t w, int16_t h,
+                     const uint8_t *previous = nullptr, uint16_t previousStride = 0);
+
+  /**
+   * Tile-aligned box around every tile that reached the limit, to be flashed
+   * before the next partial update. Returns false if no tile did.
+   */
+  bool flashWindow(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+
+  // A tile-aligned box was flashed: its tiles start over
+  void flashed(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  // Flips of the worst tile relative to its pixel count, in percent
+  uint16_t peakFlipsPercent() const;
+
+  uint32_t fullRefreshes() const { return _fullRefreshes; }
+  uint32_t flashes() const { return _flashes; }
+  uint32_t flashedPixels() const { return _flashedPixels; }
+
+  // Print counters and a map of flips per tile (0-9 = tenths of the limit, # = over), e.g. printStats(Serial)
+  void printStats(Print &out) const;
+
+private:
+  int16_t _width, _height;
+  uint8_t _cols, _rows;
+  uint8_t _flipsPerPixel;
+  uint16_t _ink[GHOSTING_MAX_COLS * GHOSTING_MAX_ROWS];   // Black pixels on the panel per tile
+  uint32_t _flips[GHOSTING_MAX_COLS * GHOSTING_MAX_ROWS]; // Pixel flips since the tile was last flashed
+  uint32_t _fullRefreshes, _flashes, _flashedPixels;
+
+  uint32_t _tilePixels(uint8_t col, uint8_t row) const;
+  uint32_t _limit(uint8_t col, uint8_t row) const { return _flipsPerPixel * _tilePixels(col, row); }
+};
+
+#endif // GHOSTING_TRACKER_H
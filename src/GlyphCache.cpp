@@ -0,0 +1,161 @@
+#include "GlyphCache.h"
+#include "SparseFont.h"
+
+GlyphCache::GlyphCache()
+{
+  clear();
+  resetStats();
+}
+
+void GlyphCache::clear()
+{
+  for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+  {
+    _entries[i].font = nullptr;
+    _entries[i].lastUse = 0;
+    _entries[i].rows = nullptr;
+  }
+  _head = 0;
+  _tick = 0;
+}
+
+void GlyphCache::resetStats()
+{
+  _hits = 0;
+  _misses = 0;
+  _evictions = 0;
+  _unpacks = 0;
+}
+
+CachedGlyph *GlyphCache::get(const GFXfont *font, uint32_t codepoint)
+{
+  // Pick the set from codepoint and font, then look through its ways
+  uint32_t hash = codepoint * 0x9E3779B1UL + ((uintptr_t)font >> 2);
+  CachedGlyph *set = &_entries[((hash >> 16) % GLYPH_CACHE_SETS) * GLYPH_CACHE_WAYS];
+  _tick++;
+
+  CachedGlyph *victim = &set[0];
+  for (int way = 0; way < GLYPH_CACHE_WAYS; way++)
+  {
+    CachedGlyph *entry = &set[way];
+    if (entry->font == font && entry->codepoint == codepoint)
+    {
+      entry->lastUse = _tick;
+      _hits++;
+      return entry;
+    }
+    if (entry->lastUse < victim->lastUse)
+      victim = entry;
+  }
+
+  // Miss: replace the least recently used way, rows are unpacked lazily
+  _misses++;
+  if (victim->font)
+    _evictions++;
+
+  const GFXglyph *glyph = getFontGlyph(font, codepoint);
+  victim->font = font;
+  victim->codepoint = codepoint;
+  victim->lastUse = _tick;
+  victim->glyph = glyph;
+  victim->rows = nullptr;
+  if (!glyph)
+  {
+    victim->width = victim->height = victim->xAdvance = 0;
+    victim->xOffset = victim->yOffset = 0;
+    victim->stride = 0;
+    return victim;
+  }
+
+  victim->width = pgm_read_byte(&glyph->width);
+  victim->height = pgm_read_byte(&glyph->height);
+  victim->xAdvance = pgm_read_byte(&glyph->xAdvance);
+  victim->xOffset = (int8_t)pgm_read_byte(&glyph->xOffset);
+  victim->yOffset = (int8_t)pgm_read_byte(&glyph->yOffset);
+  victim->stride = (victim->width + 7) / 8;
+  return victim;
+}
+
+const uint8_t *GlyphCache::rows(CachedGlyph *entry)
+{
+  if (!entry->rows && entry->glyph)
+  {
+    uint16_t size = (uint16_t)entry->stride * entry->height;
+    if (size == 0 || size > GLYPH_CACHE_BYTES)
+      return nullptr;
+    entry->rows = _allocate(size);
+    _unpack(entry);
+  }
+  return entry->rows;
+}
+
+uint8_t *GlyphCache::_allocate(uint16_t size)
+{
+  if ((uint32_t)_head + size > GLYPH_CACHE_BYTES)
+    _head = 0;
+  uint8_t *start = _storage + _head;
+  uint8_t *end = start + size;
+  _head += size;
+
+  // Glyphs whose rows get overwritten are unpacked again on their next draw
+  for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++)
+  {
+    CachedGlyph &entry = _entries[i];
+    if (entry.rows && entry.rows < end && entry.rows + (uint16_t)entry.stride * entry.height > start)
+      entry.rows = nullptr;
+  }
+  return start;
+}
+
+void GlyphCache::_unpack(CachedGlyph *entry)
+{
+  const GFXfont *font = entry->font;
+  const uint8_t *bitmap = (const uint8_t *)pgm_read_ptr(&font->bitmap) + pgm_read_word(&entry->glyph->bitmapOffset);
+  uint8_t w = entry->width;
+  uint16_t total = (uint16_t)w * entry->height;
+  memset(entry->rows, 0, (uint16_t)entry->stride * entry->height);
+  _unpacks++;
+
+  if (isRleFont(font))
+  {
+    // Set runs become bits in the row they land on
+    RleGlyphReader rle(bitmap);
+    uint16_t pos = 0;
+    while (pos < total)
+    {
+      pos += rle.nextRun();
+      if (pos >= total)
+        break;
+      uint16_t run = rle.nextRun();
+      for (; run > 0 && pos < total; run--, pos++)
+      {
+        uint8_t *row = entry->rows + (pos / w) * entry->stride;
+        uint8_t col = pos % w;
+        row[col >> 3] |= 0x80 >> (col & 7);
+      }
+    }
+  }
+  else
+  {
+    // Re-align the bit-packed rows to byte boundaries
+    for (uint16_t pos = 0; pos < total; pos++)
+    {
+      if (pgm_read_byte(&bitmap[pos >> 3]) & (0x80 >> (pos & 7)))
+      {
+        uint8_t *row = entry->rows + (pos / w) * entry->stride;
+        uint8_t col = pos % w;
+        row[col >> 3] |= 0x80 >> (col & 7);
+      }
+    }
+  }
+}
+
+void GlyphCache::printStats(Print &out) const
+{
+  uint32_t lookups = _hits + _misses;
+  out.printf("Glyph cache: %u entries, %u B of rows, %lu hits, %lu misses, %lu evictions, %lu unpacks "
+             "(%.1f%% hit rate)\n",
+             (unsigned)GLYPH_CACHE_ENTRIES, (unsigned)GLYPH_CACHE_BYTES, (unsigned long)_hits,
+             (unsigned long)_misses, (unsigned long)_evictions, (unsigned long)_unpacks,
+             lookups ? 100.0 * _hits / lookups : 0.0);
+}
@@ -0,0 +1,87 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+// RAM for cached glyph rows; each drawn glyph takes stride * height bytes of it
+#ifndef GLYPH_CACHE_BYTES
+#define GLYPH_CACHE_BYTES 10240
+#endif
+
+// Glyphs whose metrics are cached, across all fonts
+#ifndef GLYPH_CACHE_ENTRIES
+#define GLYPH_CACHE_ENTRIES 128
+#endif
+
+// Entries per set; the cache is set associative with LRU replacement inside a set
+#define GLYPH_CACHE_WAYS 4
+
+#define GLYPH_CACHE_SETS (GLYPH_CACHE_ENTRIES / GLYPH_CACHE_WAYS)
+
+static_assert(GLYPH_CACHE_SETS > 0, "GLYPH_CACHE_ENTRIES must be at least GLYPH_CACHE_WAYS");
+static_assert(GLYPH_CACHE_BYTES <= 0xFFFF, "Row offsets in the glyph cache are 16 bit");
+
+/**
+ * One cached glyph: metrics copied out of flash and, once the glyph is
+ * drawn, its bitmap unpacked into byte-aligned rows (MSB first, set bit =
+ * ink), ready for PagedCanvas::drawBitmapRows().
+ */
+struct CachedGlyph
+{
+  const GFXfont *font;
+  uint32_t codepoint;
+  uint32_t lastUse;
+  const GFXglyph *glyph; // Flash glyph, nullptr if the font has none
+  uint8_t width, height, xAdvance;
+  int8_t xOffset, yOffset;
+  uint8_t stride; // Bytes per cached row
+  uint8_t *rows;  // Unpacked rows in the cache's row buffer, nullptr until drawn or once overwritten
+};
+
+/**
+ * LRU cache of glyphs keyed by (font, codepoint).
+ *
+ * Text in this deck repeats a small alphabet, so after the first page most
+ * glyphs come from RAM: no glyph table search, no pgm_read_* of metrics,
+ * and no unpacking of bit-packed or RLE bitmaps from flash.
+ *
+ * Rows take exactly stride * height bytes, appended to a ring buffer of
+ * GLYPH_CACHE_BYTES; when it wraps, the glyphs whose rows are overwritten
+ * keep their metrics and are unpacked again on their next draw.
+ */
+class GlyphCache
+{
+public:
+  GlyphCache();
+
+  // Cached entry for a codepoint, loading its metrics on a miss
+  CachedGlyph *get(const GFXfont *font, uint32_t codepoint);
+
+  // Unpacked rows of an entry (filled on first use), nullptr if they do not fit in GLYPH_CACHE_BYTES
+  const uint8_t *rows(CachedGlyph *entry);
+
+  // Drop all entries, e.g. after switching fonts
+  void clear();
+
+  uint32_t hits() const { return _hits; }
+  uint32_t misses() const { return _misses; }
+  uint32_t evictions() const { return _evictions; }
+  uint32_t unpacks() const { return _unpacks; }
+  void resetStats();
+
+  // Print budget and hit/miss counters, e.g. printStats(Serial)
+  void printStats(Print &out) const;
+
+private:
+  CachedGlyph _entries[GLYPH_CACHE_ENTRIES];
+  uint8_t _storage[GLYPH_CACHE_BYTES];
+  uint16_t _head; // Next free byte of _storage
+  uint32_t _tick;
+  uint32_t _hits, _misses, _evictions, _unpacks;
+
+  uint8_t *_allocate(uint16_t size);
+  void _unpack(CachedGlyph *entry);
+};
+
+#endif // GLYPH_CACHE_H
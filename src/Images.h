@@ -0,0 +1,1183 @@
+#ifndef IMAGES_H
+#define IMAGES_H
+
+#include "PackedImage.h"
+
+// Bitmaps of logo.h and image.h, PackBits-compressed by pack_images.py, do not edit
+
+// logo.h 'logo', 800x480: 48000 -> 10116 bytes
+const uint8_t LOGO_PACKED[] PROGMEM = {
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x91, 0xFF, 
+  0x00, 0xEF, 0x9E, 0xFF, 0x00, 0xF7, 0x9E, 0xFF, 0x00, 0xE7, 0x9E, 0xFF, 
+  0x00, 0xD7, 0x9E, 0xFF, 0x00, 0xAB, 0x9E, 0xFF, 0x00, 0x55, 0x9E, 0xFF, 
+  0x00, 0x22, 0x9E, 0xFF, 0x01, 0x55, 0x7F, 0xFB, 0xFF, 0x00, 0xDF, 0xFA, 
+  0xFF, 0x00, 0xFD, 0xFD, 0xFF, 0x00, 0xFD, 0xF8, 0xFF, 0x00, 0xF7, 0xFC, 
+  0xFF, 0x00, 0xF7, 0xC4, 0xFF, 0x01, 0xFE, 0xAA, 0xFD, 0xFF, 0x24, 0xE7, 
+  0xF3, 0xFE, 0x07, 0xFC, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x07, 0xF0, 0x3F, 
+  0xFF, 0xE0, 0x3F, 0xF0, 0x3F, 0x8F, 0xFF, 0xCF, 0x80, 0x3E, 0x01, 0xFF, 
+  0xFF, 0x80, 0xFF, 0x3F, 0xCF, 0xFF, 0xBF, 0x80, 0xFF, 0x00, 0x7C, 0x01, 
+  0xC8, 0xFF, 0x02, 0xFD, 0x55, 0x5F, 0xFE, 0xFF, 0x24, 0xE7, 0xF1, 0xFC, 
+  0x01, 0xFD, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x07, 0xC0, 0x1F, 0xFF, 0xC0, 
+  0x1F, 0xC0, 0x1F, 0xC7, 0xFF, 0xDF, 0x00, 0x7E, 0x00, 0x7F, 0xFF, 0x00, 
+  0x7F, 0x1F, 0xCF, 0xFF, 0x3F, 0x00, 0x7F, 0x00, 0x7C, 0x01, 0xC8, 0xFF, 
+  0x02, 0xFA, 0x22, 0x3F, 0xFE, 0xFF, 0x23, 0xE7, 0xF3, 0xF8, 0xF1, 0xFC, 
+  0xFF, 0xF3, 0xE3, 0xFF, 0xFE, 0x7F, 0x87, 0x8F, 0xFF, 0xE7, 0x8F, 0x87, 
+  0x8F, 0xCF, 0xEF, 0x9F, 0x9F, 0xFE, 0x7C, 0x7F, 0xFE, 0x3E, 0x3F, 0x0F, 
+  0xCF, 0xFE, 0x3E, 0x3E, 0x3F, 0x3F, 0xFC, 0xC7, 0xFF, 0x02, 0xF5, 0x55, 
+  0x5F, 0xFE, 0xFF, 0x23, 0xC7, 0xF1, 0xF1, 0xFC, 0xFC, 0xFF, 0xF7, 0xF1, 
+  0xFF, 0xFE, 0x7F, 0xDF, 0xC7, 0xFF, 0xC7, 0xC7, 0x9F, 0xC7, 0xC7, 0xCF, 
+  0x1F, 0x1F, 0xFC, 0x7C, 0x7F, 0xFC, 0x7F, 0x1F, 0x07, 0xCF, 0xFC, 0x7C, 
+  0x7F, 0x1F, 0x3F, 0xFC, 0xC7, 0xFF, 0x02, 0xFA, 0xAA, 0xAF, 0xFE, 0xFF, 
+  0x23, 0xE7, 0xF3, 0xE3, 0xFC, 0xFC, 0xFF, 0xF3, 0xF8, 0xFF, 0xFE, 0x7F, 
+  0x9F, 0xE3, 0xFF, 0xEF, 0xCF, 0x9F, 0xE3, 0xE7, 0x8F, 0x9F, 0x9F, 0xFE, 
+  0x7E, 0x7F, 0xFC, 0xFF, 0x9F, 0x23, 0xCF, 0xFC, 0xFC, 0xFF, 0x3F, 0x3F, 
+  0xFC, 0xC7, 0xFF, 0x02, 0xF5, 0x55, 0x57, 0xFE, 0xFF, 0x24, 0xE7, 0xF1, 
+  0xF7, 0xFC, 0x7D, 0xFF, 0xF3, 0xFD, 0xFF, 0xFE, 0x7F, 0x1F, 0xF3, 0xFF, 
+  0xC7, 0xC7, 0x1F, 0xF7, 0xE7, 0x07, 0x1F, 0x15, 0x7E, 0x7E, 0x7F, 0xFD, 
+  0xFF, 0x1F, 0x33, 0xCF, 0xFD, 0xFD, 0xFF, 0x1F, 0x3F, 0xFC, 0x7F, 0xC8, 
+  0xFF, 0x02, 0xE2, 0x22, 0x23, 0xFE, 0xFF, 0x24, 0xE0, 0x03, 0xE3, 0xFE, 
+  0x7C, 0xFF, 0xF3, 0xF8, 0xFF, 0xFE, 0x7F, 0x3F, 0xF3, 0xFF, 0xE2, 0x0F, 
+  0x3F, 0xF3, 0xE3, 0x27, 0x3F, 0x80, 0xFE, 0x38, 0x7F, 0xF8, 0xFF, 0x9F, 
+  0x31, 0xCF, 0xF9, 0xF8, 0xFF, 0x9F, 0x00, 0xFC, 0x03, 0xC8, 0xFF, 0x02, 
+  0xD5, 0x55, 0x55, 0xFE, 0xFF, 0x24, 0xC0, 0x01, 0xE7, 0xFC, 0x7C, 0xFF, 
+  0xF7, 0xFD, 0xFF, 0xFE, 0x7F, 0x1F, 0xF3, 0xFF, 0xC0, 0x1F, 0x1F, 0xF7, 
+  0xF7, 0x77, 0x7F, 0x04, 0x7C, 0x00, 0xFF, 0xFD, 0xFF, 0x9F, 0x1D, 0xCF, 
+  0xF9, 0xFD, 0xFF, 0x1F, 0x00, 0xFC, 0x01, 0xC8, 0xFF, 0x02, 0xEA, 0xAA, 
+  0xAB, 0xFE, 0xFF, 0x23, 0xE7, 0xF3, 0xE3, 0xFE, 0x7C, 0xFF, 0xF3, 0xF8, 
+  0xFF, 0xFE, 0x7F, 0xBF, 0xE3, 0xFF, 0xE0, 0xBF, 0x3F, 0xE3, 0xF2, 0x72, 
+  0x3F, 0x9F, 0xFE, 0x01, 0xFF, 0xF8, 0xFF, 0x9F, 0x3C, 0xCF, 0xFB, 0xF8, 
+  0xFF, 0x9F, 0x3F, 0xFC, 0xC7, 0xFF, 0xFE, 0x55, 0x27, 0x7F, 0xFF, 0xFF, 
+  0xE7, 0xF1, 0xF3, 0xFC, 0x7D, 0xFF, 0xF3, 0xF9, 0xFF, 0xFE, 0x7F, 0x1F, 
+  0xF7, 0xFF, 0xC7, 0xFF, 0x1F, 0xF7, 0xF0, 0x70, 0x7F, 0x1F, 0xFE, 0x71, 
+  0xFF, 0xFC, 0x7F, 0x1F, 0x1C, 0x4F, 0xF3, 0xFC, 0x7F, 0x1F, 0x3F, 0xFC, 
+  0x7F, 0xC8, 0xFF, 0x02, 0xA2, 0x22, 0x22, 0xFE, 0xFF, 0x23, 0xE7, 0xF3, 
+  0xF3, 0xF8, 0xFC, 0xFF, 0xF3, 0xF9, 0xFF, 0xFE, 0x7F, 0x8F, 0xE7, 0xFF, 
+  0xE7, 0xFF, 0x8F, 0xE7, 0xF8, 0x78, 0x7F, 0x9F, 0xFE, 0x78, 0xFF, 0xFC, 
+  0x7F, 0x3F, 0x3E, 0x0F, 0xE3, 0xFC, 0x7E, 0x3F, 0x3F, 0xFC, 0xC7, 0xFF, 
+  0xFE, 0x55, 0x03, 0x7F, 0xFF, 0xFF, 0xC7, 0xFE, 0xF1, 0x1F, 0xFC, 0xDF, 
+  0xF5, 0xD1, 0xFF, 0xFE, 0x7F, 0xC7, 0xC7, 0xFF, 0xC7, 0xFF, 0xC7, 0xC7, 
+  0xF8, 0xFC, 0x7F, 0x1D, 0xFC, 0x7C, 0x7F, 0xFC, 0x5C, 0x7F, 0x1F, 0x0F, 
+  0xC7, 0xFC, 0x5C, 0x7F, 0x3F, 0xFC, 0xC8, 0xFF, 0x00, 0xFE, 0xFE, 0xAA, 
+  0x26, 0xBF, 0xFF, 0xFF, 0xE7, 0xF3, 0xF8, 0x03, 0xFC, 0x03, 0xF0, 0x03, 
+  0xFF, 0xFE, 0x7F, 0xE0, 0x0F, 0xFF, 0xEF, 0xFF, 0xE0, 0x0F, 0xF8, 0xF8, 
+  0xFF, 0x80, 0x3E, 0x7C, 0x7F, 0xFE, 0x00, 0x7F, 0x3F, 0x8F, 0xCF, 0xFE, 
+  0x00, 0xFF, 0x3F, 0xFC, 0xC8, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x27, 0x5F, 
+  0xFF, 0xFF, 0xE7, 0xF1, 0xFD, 0x07, 0xFC, 0x01, 0xF0, 0x17, 0xFF, 0xFE, 
+  0x7F, 0xF0, 0x5F, 0xFF, 0xC7, 0xFF, 0xF0, 0x5F, 0xFD, 0xFD, 0xFF, 0x00, 
+  0x7E, 0x7E, 0x7F, 0xFF, 0x41, 0xFF, 0x1F, 0xCF, 0xDF, 0xFF, 0x41, 0xFF, 
+  0x3F, 0xFC, 0x7F, 0xC9, 0xFF, 0x00, 0xFE, 0xFE, 0x22, 0x00, 0x3F, 0xE1, 
+  0xFF, 0x00, 0x9F, 0xC3, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x00, 0x57, 0xE1, 
+  0xFF, 0x00, 0x9F, 0xC3, 0xFF, 0x00, 0xFA, 0xFE, 0xAA, 0x00, 0xAF, 0xE1, 
+  0xFF, 0x00, 0xBF, 0xC3, 0xFF, 0x00, 0xF5, 0xFE, 0x55, 0x00, 0x57, 0xA2, 
+  0xFF, 0x00, 0xF2, 0xFE, 0x22, 0x00, 0x23, 0x81, 0xFF, 0x81, 0xFF, 0x81, 
+  0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 
+  0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 
+  0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 
+  0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x82, 0xFF, 0x00, 0xEF, 0x9E, 0xFF, 0x00, 
+  0xF5, 0x9E, 0xFF, 0x00, 0xE2, 0x9E, 0xFF, 0x01, 0xF5, 0x5F, 0x9F, 0xFF, 
+  0x01, 0xEA, 0xAF, 0x9F, 0xFF, 0x01, 0xF5, 0x57, 0x9F, 0xFF, 0x01, 0xE2, 
+  0x23, 0x9F, 0xFF, 0x02, 0xF5, 0x55, 0x7F, 0xA0, 0xFF, 0x02, 0xEA, 0xAA, 
+  0xBF, 0xC5, 0xFF, 0x00, 0xF5, 0xFA, 0x55, 0x00, 0x57, 0xE5, 0xFF, 0x02, 
+  0xF5, 0x55, 0x57, 0xC5, 0xFF, 0xF8, 0xAA, 0x00, 0xBF, 0xE6, 0xFF, 0x02, 
+  0xE2, 0x22, 0x23, 0xC6, 0xFF, 0x00, 0xFD, 0xF8, 0x55, 0x00, 0x57, 0xF0, 
+  0xFF, 0x0C, 0xFC, 0xFF, 0x7F, 0x00, 0x71, 0xFC, 0x70, 0x01, 0xFF, 0xFF, 
+  0xF5, 0x55, 0x55, 0xC6, 0xFF, 0x00, 0xFA, 0xF8, 0xAA, 0x00, 0xAB, 0xF0, 
+  0xFF, 0x0C, 0xFC, 0xFE, 0x3E, 0x00, 0xF8, 0xF8, 0xF0, 0x03, 0xFF, 0xFF, 
+  0xEA, 0xAA, 0xAA, 0xC6, 0xFF, 0x00, 0xD5, 0xF7, 0x55, 0x00, 0x7F, 0xF1, 
+  0xFF, 0x0D, 0xFC, 0x7F, 0x7F, 0x77, 0x7C, 0x71, 0xF7, 0x17, 0xFF, 0xFF, 
+  0xF5, 0x55, 0x55, 0x5F, 0xC7, 0xFF, 0xF6, 0xAA, 0x00, 0xBF, 0xF1, 0xFF, 
+  0x0D, 0xF8, 0x3E, 0x3E, 0x3F, 0xFE, 0x33, 0xFF, 0x3F, 0xFF, 0xFF, 0xE2, 
+  0x22, 0x22, 0x2F, 0xC8, 0xFF, 0x00, 0xFD, 0xF6, 0x55, 0x00, 0x5F, 0xF1, 
+  0xFF, 0x0D, 0xFD, 0x1F, 0x7F, 0x7F, 0xFF, 0x17, 0xFF, 0x1F, 0xFF, 0xFF, 
+  0xF5, 0x55, 0x55, 0x57, 0xC8, 0xFF, 0x00, 0xFE, 0xF6, 0xAA, 0x00, 0xAF, 
+  0xF1, 0xFF, 0x0D, 0xFC, 0x8E, 0x3E, 0x3F, 0xFF, 0x07, 0xFF, 0x3F, 0xFF, 
+  0xFF, 0xEA, 0xAA, 0xAA, 0xAF, 0xDE, 0xFF, 0x00, 0x3F, 0xEC, 0xFF, 0x00, 
+  0xF5, 0xF6, 0x55, 0x00, 0x57, 0xF1, 0xFF, 0x0D, 0xFD, 0xC7, 0x7F, 0x01, 
+  0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x5F, 0xDE, 0xFF, 
+  0x00, 0x9F, 0xEC, 0xFF, 0x00, 0xFA, 0xF6, 0xAA, 0x00, 0xAB, 0xF1, 0xFF, 
+  0x0D, 0xF8, 0xE6, 0x3E, 0x01, 0xFF, 0x8F, 0xFF, 0x3F, 0xFF, 0xFF, 0xE2, 
+  0x22, 0x22, 0x3F, 0xDE, 0xFF, 0x00, 0x0F, 0xEC, 0xFF, 0x00, 0xD5, 0xF5, 
+  0x55, 0xF1, 0xFF, 0x0D, 0xFD, 0xF7, 0x7F, 0x7F, 0xFF, 0x07, 0xFF, 0x1F, 
+  0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x7F, 0xDE, 0xFF, 0x00, 0x87, 0xEC, 0xFF, 
+  0x00, 0xEA, 0xF5, 0xAA, 0xF1, 0xFF, 0x0C, 0xFC, 0xF2, 0x3E, 0x3F, 0xFE, 
+  0x23, 0xFF, 0x3F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAB, 0xDD, 0xFF, 0x00, 0x03, 
+  0xEC, 0xFF, 0x00, 0xD5, 0xF5, 0x55, 0x00, 0x7F, 0xF2, 0xFF, 0x0C, 0xFD, 
+  0xF1, 0x7F, 0x7F, 0xFC, 0x71, 0xFF, 0x1F, 0xFF, 0xFF, 0xF5, 0x55, 0x57, 
+  0xDD, 0xFF, 0x00, 0x81, 0xEC, 0xFF, 0xF4, 0xAA, 0xF1, 0xFF, 0xFF, 0xF8, 
+  0x0A, 0x3E, 0x3F, 0xFC, 0xF9, 0xFF, 0x3F, 0xFF, 0xFF, 0xE2, 0x22, 0x2F, 
+  0xDD, 0xFF, 0x01, 0x00, 0x7F, 0xED, 0xFF, 0xF4, 0x55, 0x00, 0x7F, 0xF2, 
+  0xFF, 0x0C, 0xFD, 0xFC, 0x7F, 0x00, 0x7C, 0xFC, 0xFF, 0x1F, 0xFF, 0xFF, 
+  0xF5, 0x55, 0x5F, 0xDD, 0xFF, 0x01, 0x80, 0x7F, 0xED, 0xFF, 0xF4, 0xAA, 
+  0x00, 0xBF, 0xF2, 0xFF, 0x0B, 0xFC, 0xFE, 0x3E, 0x00, 0xF9, 0xFC, 0xFF, 
+  0x3F, 0xFF, 0xFF, 0xEA, 0xAA, 0xDC, 0xFF, 0x01, 0x00, 0x1F, 0xED, 0xFF, 
+  0xF4, 0x55, 0x00, 0x5F, 0xE8, 0xFF, 0x02, 0xF5, 0x55, 0x7F, 0xDD, 0xFF, 
+  0x01, 0x80, 0x0F, 0xEE, 0xFF, 0x00, 0xFE, 0xF4, 0xAA, 0x00, 0xBF, 0xE8, 
+  0xFF, 0x01, 0xE2, 0x23, 0xDC, 0xFF, 0x01, 0x00, 0x07, 0xEE, 0xFF, 0x00, 
+  0xFD, 0xF4, 0x55, 0x00, 0x5F, 0xE8, 0xFF, 0x01, 0xF5, 0x57, 0xDC, 0xFF, 
+  0x01, 0x80, 0x03, 0xEE, 0xFF, 0x00, 0xFE, 0xF4, 0xAA, 0x00, 0xAF, 0xE8, 
+  0xFF, 0x01, 0xEA, 0xAF, 0xDC, 0xFF, 0x01, 0x00, 0x01, 0xEE, 0xFF, 0x00, 
+  0xFD, 0xF4, 0x55, 0x00, 0x57, 0xE8, 0xFF, 0x01, 0xF5, 0x5F, 0xDC, 0xFF, 
+  0x01, 0x80, 0x00, 0xEE, 0xFF, 0x00, 0xFA, 0xF4, 0xAA, 0x00, 0xAF, 0xE8, 
+  0xFF, 0x01, 0xE2, 0x7F, 0xDC, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xEF, 0xFF, 
+  0x00, 0xFD, 0xF4, 0x55, 0x00, 0x57, 0xE8, 0xFF, 0x00, 0xF5, 0xDB, 0xFF, 
+  0x02, 0x80, 0x00, 0x3F, 0xEF, 0xFF, 0x00, 0xFA, 0xF4, 0xAA, 0x00, 0xAF, 
+  0xE8, 0xFF, 0x00, 0xEB, 0xDB, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xEF, 0xFF, 
+  0x00, 0xF5, 0xFC, 0x55, 0x03, 0xFD, 0x55, 0x55, 0xFF, 0xFD, 0x55, 0x00, 
+  0x57, 0xE8, 0xFF, 0x00, 0xF7, 0xDB, 0xFF, 0x02, 0x80, 0x00, 0x0F, 0xEF, 
+  0xFF, 0x00, 0xFA, 0xFD, 0xAA, 0x04, 0xBF, 0xFF, 0xAA, 0xAB, 0xFF, 0xFD, 
+  0xAA, 0x00, 0xAF, 0xC1, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0x00, 
+  0xF5, 0xFD, 0x55, 0x04, 0x5F, 0xFF, 0xD5, 0x55, 0xFF, 0xFD, 0x55, 0x00, 
+  0x57, 0xC1, 0xFF, 0x02, 0x80, 0x00, 0x03, 0xEF, 0xFF, 0x00, 0xFA, 0xFD, 
+  0xAA, 0xFF, 0xFF, 0x02, 0xEA, 0xAB, 0xFF, 0xFD, 0xAA, 0x00, 0xAF, 0xC1, 
+  0xFF, 0xFF, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x00, 0xF5, 0xFD, 0x55, 0x04, 
+  0x7F, 0xFF, 0xF5, 0x55, 0xFF, 0xFD, 0x55, 0x00, 0x57, 0xC1, 0xFF, 0x02, 
+  0x80, 0x00, 0x00, 0xEF, 0xFF, 0x00, 0xFA, 0xFE, 0xAA, 0x05, 0xAB, 0xFF, 
+  0xFF, 0xFA, 0xAB, 0xFF, 0xFD, 0xAA, 0x00, 0xAB, 0xC1, 0xFF, 0xFE, 0x00, 
+  0x00, 0x7F, 0xF0, 0xFF, 0x00, 0xF5, 0xFD, 0x55, 0xFF, 0xFF, 0x02, 0xF5, 
+  0x55, 0xFF, 0xFD, 0x55, 0x00, 0x57, 0xC1, 0xFF, 0x03, 0x80, 0x00, 0x00, 
+  0x3F, 0xF0, 0xFF, 0x00, 0xFA, 0xFD, 0xAA, 0xFF, 0xFF, 0x02, 0xFA, 0xAB, 
+  0xFF, 0xFD, 0xAA, 0x00, 0xAF, 0xC1, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF0, 
+  0xFF, 0x00, 0xF5, 0xFD, 0x55, 0x04, 0x7F, 0x5F, 0xFD, 0x55, 0xFF, 0xFD, 
+  0x55, 0x00, 0x57, 0xC1, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 
+  0x00, 0xFA, 0xFD, 0xAA, 0x04, 0xBF, 0xAF, 0xFA, 0xAB, 0xFF, 0xFD, 0xAA, 
+  0x00, 0xAB, 0xC1, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x00, 0xF5, 
+  0xFD, 0x55, 0x04, 0x5D, 0x5F, 0xFD, 0x55, 0xFF, 0xFD, 0x55, 0x00, 0x57, 
+  0xC1, 0xFF, 0x03, 0x80, 0x00, 0x00, 0x03, 0xF0, 0xFF, 0x00, 0xFA, 0xFD, 
+  0xAA, 0x04, 0xAE, 0xAF, 0xFA, 0xAB, 0xFF, 0xFD, 0xAA, 0x00, 0xAF, 0xC4, 
+  0xFF, 0x00, 0xD0, 0xEE, 0x00, 0x04, 0x01, 0x7F, 0xFF, 0xFF, 0xF5, 0xFC, 
+  0x55, 0x03, 0x5F, 0xF5, 0x55, 0xFF, 0xFD, 0x55, 0x00, 0x57, 0xC4, 0xFF, 
+  0xEC, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFA, 0xFC, 0xAA, 0x03, 0xFF, 0xFA, 
+  0xAB, 0xFF, 0xFD, 0xAA, 0x00, 0xAB, 0xC5, 0xFF, 0x00, 0xFC, 0xEC, 0x00, 
+  0x03, 0x05, 0xFF, 0xFF, 0xF5, 0xFC, 0x55, 0x03, 0xFF, 0xF5, 0x55, 0xFF, 
+  0xFD, 0x55, 0x00, 0x57, 0xC5, 0xFF, 0x00, 0xF8, 0xEB, 0x00, 0xFF, 0xFF, 
+  0x00, 0xFA, 0xFD, 0xAA, 0x04, 0xAF, 0xFF, 0xEA, 0xAB, 0xFE, 0xFD, 0xAA, 
+  0x00, 0xAF, 0xC5, 0xFF, 0x00, 0xD0, 0xEB, 0x00, 0x02, 0x7F, 0xFF, 0xF5, 
+  0xFD, 0x55, 0x04, 0x57, 0xFF, 0xD5, 0x55, 0xFF, 0xFD, 0x55, 0x00, 0x57, 
+  0xC5, 0xFF, 0x00, 0x80, 0xEB, 0x00, 0x02, 0x3F, 0xFF, 0xFA, 0xFD, 0xAA, 
+  0x04, 0xAB, 0xFF, 0xAA, 0xAA, 0xFE, 0xFD, 0xAA, 0x00, 0xAB, 0xC5, 0xFF, 
+  0xEA, 0x00, 0x02, 0x1F, 0xFF, 0xF5, 0xFC, 0x55, 0x03, 0xFF, 0x55, 0x55, 
+  0xFD, 0xFD, 0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 0xFE, 0xEA, 0x00, 0x02, 
+  0x0F, 0xFF, 0xFA, 0xFD, 0xAA, 0x04, 0xAB, 0xFE, 0xAA, 0xAA, 0xFE, 0xFD, 
+  0xAA, 0x00, 0xAF, 0xC6, 0xFF, 0x00, 0xFC, 0xEA, 0x00, 0x02, 0x07, 0xFF, 
+  0xF5, 0xF4, 0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 0xFC, 0xEA, 0x00, 0x02, 
+  0x03, 0xFF, 0xFA, 0xF4, 0xAA, 0x00, 0xAB, 0xC6, 0xFF, 0x00, 0xFC, 0xEA, 
+  0x00, 0x02, 0x01, 0xFF, 0xF5, 0xF4, 0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 
+  0xF8, 0xEA, 0x00, 0x02, 0x01, 0xFF, 0xFA, 0xFC, 0xAA, 0x03, 0xEA, 0xAA, 
+  0xAA, 0xFA, 0xFD, 0xAA, 0x00, 0xAF, 0xC6, 0xFF, 0x00, 0xF0, 0xEA, 0x00, 
+  0x02, 0x01, 0xFF, 0xF5, 0xFC, 0x55, 0x03, 0xF5, 0x55, 0x55, 0x7D, 0xFD, 
+  0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 0xE0, 0xE9, 0x00, 0x01, 0xFF, 0xFA, 
+  0xFD, 0xAA, 0x04, 0xAB, 0xFE, 0xAA, 0xAB, 0xFF, 0xFD, 0xAA, 0x00, 0xAB, 
+  0xC6, 0xFF, 0x00, 0xE0, 0xF5, 0x00, 0x00, 0x40, 0xF6, 0x00, 0x01, 0x7F, 
+  0xF5, 0xFD, 0x55, 0x04, 0x57, 0xFD, 0x55, 0x55, 0xFF, 0xFD, 0x55, 0x00, 
+  0x57, 0xC6, 0xFF, 0x00, 0xE0, 0xF6, 0x00, 0x01, 0x03, 0xC0, 0xF6, 0x00, 
+  0x01, 0x7F, 0xFA, 0xFD, 0xAA, 0x04, 0xAF, 0xFE, 0xAA, 0xAB, 0xFF, 0xFD, 
+  0xAA, 0x00, 0xAF, 0xC6, 0xFF, 0x00, 0xC0, 0xF6, 0x00, 0x01, 0x07, 0xC0, 
+  0xF6, 0x00, 0x01, 0x7F, 0xF5, 0xFD, 0x55, 0x04, 0x57, 0xFD, 0x55, 0x55, 
+  0xFF, 0xFD, 0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 0xC0, 0xF6, 0x00, 0x01, 
+  0x1F, 0xE0, 0xF6, 0x00, 0x01, 0x3F, 0xFA, 0xFD, 0xAA, 0x04, 0xAF, 0xFE, 
+  0xAA, 0xAB, 0xFF, 0xFD, 0xAA, 0x00, 0xAF, 0xC6, 0xFF, 0x00, 0xC0, 0xF6, 
+  0x00, 0x01, 0x1F, 0xC0, 0xF6, 0x00, 0x01, 0x3F, 0xF5, 0xFD, 0x55, 0x04, 
+  0x57, 0xFD, 0x55, 0x55, 0xFF, 0xFD, 0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 
+  0x80, 0xF6, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0x01, 0x3F, 0xFA, 0xFD, 0xAA, 
+  0x04, 0xAB, 0xFA, 0xAA, 0xAA, 0xFE, 0xFD, 0xAA, 0x00, 0xAF, 0xC6, 0xFF, 
+  0x00, 0xC0, 0xF6, 0x00, 0x00, 0x10, 0xF5, 0x00, 0x01, 0x1F, 0xFD, 0xF4, 
+  0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 0x80, 0xFC, 0x00, 0x01, 0x0B, 0xA0, 
+  0xF0, 0x00, 0x01, 0x3F, 0xFA, 0xF4, 0xAA, 0x00, 0xAF, 0xC6, 0xFF, 0x1A, 
+  0xC0, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x5F, 0xF4, 0x07, 0xF0, 0x07, 0xC0, 
+  0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 
+  0x00, 0x1F, 0xFD, 0xF4, 0x55, 0x00, 0x57, 0xC6, 0xFF, 0x1A, 0x80, 0x00, 
+  0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x03, 0xF8, 0x0F, 0xC0, 0xFF, 0xFC, 
+  0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 
+  0xFE, 0xF4, 0xAA, 0x00, 0xAF, 0xC6, 0xFF, 0x1A, 0x80, 0x00, 0x01, 0xFF, 
+  0xFC, 0x01, 0xFF, 0xFF, 0x01, 0xF0, 0x1F, 0xC0, 0xFF, 0xFC, 0x07, 0xFF, 
+  0xFC, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFD, 0xF4, 
+  0x55, 0x00, 0x5F, 0xC6, 0xFF, 0x1A, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x03, 
+  0xFF, 0xFF, 0x81, 0xF8, 0x0F, 0x80, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 
+  0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xF4, 0xAA, 0x00, 
+  0xBF, 0xC6, 0xFF, 0x1A, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 
+  0xC1, 0xFC, 0x1F, 0xC0, 0xDF, 0xDC, 0x07, 0xFF, 0xFF, 0x01, 0xFD, 0xDC, 
+  0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0x55, 0x00, 0x5F, 0xC6, 
+  0xFF, 0x1A, 0x80, 0x00, 0x03, 0xF8, 0xFE, 0x07, 0xF8, 0x7F, 0xC0, 0xFC, 
+  0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xF0, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x0F, 
+  0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xF4, 0xAA, 0x00, 0xBF, 0xC6, 0xFF, 0x1A, 
+  0x80, 0x00, 0x01, 0xF0, 0x7E, 0x07, 0xF0, 0x1F, 0xC0, 0x7C, 0x1F, 0x00, 
+  0x1F, 0xC0, 0x07, 0xF0, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x00, 
+  0x00, 0x1F, 0xFF, 0xF4, 0x55, 0x00, 0x7F, 0xC6, 0xFF, 0x1A, 0x80, 0x00, 
+  0x03, 0xF8, 0xFE, 0x0F, 0xE0, 0x0F, 0xE0, 0x7E, 0x3F, 0x00, 0x0F, 0xC0, 
+  0x03, 0xF0, 0x3F, 0x80, 0xFE, 0xA8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 
+  0xFF, 0xF4, 0xAA, 0xC5, 0xFF, 0x1B, 0xC0, 0x00, 0x01, 0xF5, 0xFC, 0x07, 
+  0xE0, 0x0F, 0xC0, 0x7E, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x1F, 0x81, 
+  0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xD5, 0xF5, 0x55, 
+  0x00, 0x7F, 0xC6, 0xFF, 0x1B, 0x80, 0x00, 0x03, 0xFF, 0xFE, 0x0F, 0xE0, 
+  0x0F, 0xE0, 0x3E, 0x7E, 0x00, 0x0F, 0xC0, 0x07, 0xF0, 0x1F, 0x80, 0xFF, 
+  0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xEA, 0xF5, 0xAA, 0xC5, 
+  0xFF, 0x1B, 0x80, 0x00, 0x01, 0xFF, 0xFC, 0x07, 0xE0, 0x0F, 0xC0, 0x7F, 
+  0x7E, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x1F, 0x81, 0xFF, 0xFC, 0x00, 0x07, 
+  0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF5, 0xF5, 0x55, 0xC5, 0xFF, 0x1B, 0x80, 
+  0x00, 0x03, 0xFF, 0xF8, 0x0F, 0xE0, 0x0F, 0xE0, 0x3F, 0xFE, 0x00, 0x0F, 
+  0xC0, 0x03, 0xF0, 0x3F, 0x80, 0xFF, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x00, 
+  0x3F, 0xFF, 0xFA, 0xF6, 0xAA, 0x00, 0xAB, 0xC5, 0xFF, 0x1B, 0xC0, 0x00, 
+  0x01, 0xFF, 0xF0, 0x07, 0xF0, 0x1F, 0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xC0, 
+  0x07, 0xF0, 0x1F, 0x81, 0xFD, 0x54, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x1F, 
+  0xFF, 0xFD, 0xF6, 0x55, 0x00, 0x57, 0xC5, 0xFF, 0x1B, 0x80, 0x00, 0x03, 
+  0xFF, 0xE0, 0x07, 0xF0, 0x1F, 0xC0, 0x1F, 0xFC, 0x00, 0x0F, 0xC0, 0x07, 
+  0xF0, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 
+  0xFE, 0xF6, 0xAA, 0x00, 0xAF, 0xC5, 0xFF, 0x1B, 0x80, 0x00, 0x01, 0xF5, 
+  0x00, 0x07, 0xFD, 0x7F, 0xC0, 0x1F, 0xFC, 0x00, 0x1F, 0xC0, 0x07, 0xF1, 
+  0x7F, 0x01, 0xFC, 0x00, 0x01, 0x17, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 
+  0xF6, 0x55, 0x00, 0x5F, 0xC5, 0xFF, 0x1B, 0x80, 0x00, 0x03, 0xF8, 0x00, 
+  0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 
+  0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF6, 
+  0xAA, 0xC4, 0xFF, 0x1C, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 
+  0x00, 0x07, 0xF0, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 
+  0x07, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xD5, 0xF7, 0x55, 0xC4, 
+  0xFF, 0x1C, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 
+  0xF0, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 
+  0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFA, 0xF8, 0xAA, 0x00, 0xAF, 0xC4, 
+  0xFF, 0x15, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x07, 
+  0xF0, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 
+  0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xF8, 0x55, 0x00, 0x5F, 0xC4, 0xFF, 
+  0x15, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xE0, 
+  0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 
+  0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0xFA, 0xFA, 0xAA, 0x00, 0xAB, 0xC3, 
+  0xFF, 0x15, 0xC0, 0x00, 0x01, 0x50, 0x00, 0x00, 0x15, 0x40, 0x00, 0x05, 
+  0x40, 0x00, 0x55, 0x54, 0x05, 0x55, 0x00, 0x01, 0x55, 0x55, 0x00, 0x54, 
+  0xFE, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0xFF, 0xDD, 0xFD, 0x55, 0x00, 0x5D, 
+  0xC2, 0xFF, 0x00, 0xC0, 0xE9, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xFD, 0xAA, 
+  0x00, 0xBF, 0xC2, 0xFF, 0x00, 0xC0, 0xE9, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 
+  0x00, 0xD5, 0xFE, 0x55, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0xE0, 0xE9, 0x00, 
+  0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xEA, 0xFE, 0xAA, 0x00, 0xBF, 0xC2, 0xFF, 
+  0x00, 0xF0, 0xE9, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00, 0xF5, 0xFE, 0x55, 
+  0x00, 0x7F, 0xC2, 0xFF, 0x00, 0xF0, 0xE9, 0x00, 0xFA, 0xFF, 0x00, 0xFA, 
+  0xFE, 0xAA, 0x00, 0xBF, 0xC2, 0xFF, 0x00, 0xF0, 0xEA, 0x00, 0x00, 0x01, 
+  0xFA, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0xF8, 
+  0xEA, 0x00, 0x00, 0x01, 0xFA, 0xFF, 0x00, 0xFE, 0xFE, 0xAA, 0x00, 0xBF, 
+  0xC2, 0xFF, 0x00, 0xFC, 0xEA, 0x00, 0x01, 0x01, 0x7F, 0xFA, 0xFF, 0xFE, 
+  0x55, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0xFE, 0xE9, 0x00, 0x00, 0x0F, 0xFA, 
+  0xFF, 0xFE, 0xAA, 0x00, 0xBF, 0xC1, 0xFF, 0xE9, 0x00, 0x00, 0x05, 0xFA, 
+  0xFF, 0x03, 0xD5, 0x55, 0x55, 0x7F, 0xC1, 0xFF, 0xE8, 0x00, 0x00, 0x3F, 
+  0xFB, 0xFF, 0x03, 0xFA, 0xAA, 0xAA, 0xBF, 0xC1, 0xFF, 0x00, 0xC0, 0xE9, 
+  0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x03, 0xF5, 0x55, 0x55, 0x7F, 0xC1, 0xFF, 
+  0x00, 0xE0, 0xE9, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x03, 0xFA, 0xAA, 0xAA, 
+  0xBF, 0xC1, 0xFF, 0x00, 0xF0, 0xEC, 0x00, 0x04, 0x01, 0x74, 0x00, 0x01, 
+  0x7F, 0xFC, 0xFF, 0x03, 0xFD, 0x55, 0x55, 0x7F, 0xC1, 0xFF, 0x00, 0xF8, 
+  0xEC, 0x00, 0x04, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xFB, 0xFF, 0xFF, 0xAA, 
+  0x00, 0xBF, 0xC0, 0xFF, 0xEC, 0x00, 0x07, 0x17, 0xFF, 0xF0, 0x00, 0x07, 
+  0xFF, 0xFF, 0xD0, 0xF7, 0x00, 0x00, 0x57, 0xC5, 0xFF, 0x00, 0xE0, 0xED, 
+  0x00, 0x06, 0x3F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF5, 0x00, 0xC5, 
+  0xFF, 0x00, 0xFD, 0xF4, 0x55, 0x01, 0x00, 0x01, 0xFD, 0x55, 0x00, 0x57, 
+  0xFE, 0xFF, 0x03, 0x40, 0x01, 0x7F, 0xFC, 0xF5, 0x00, 0x00, 0x7F, 0xC2, 
+  0xFF, 0xFF, 0xBB, 0xFA, 0xFF, 0x02, 0xFE, 0x00, 0x0F, 0xF9, 0xFF, 0x03, 
+  0xF0, 0x00, 0x3F, 0xF0, 0xF5, 0x00, 0x00, 0x3F, 0xC3, 0xFF, 0x03, 0xFD, 
+  0x55, 0x55, 0x7F, 0xFB, 0xFF, 0x02, 0xF0, 0x00, 0x5F, 0xF9, 0xFF, 0x03, 
+  0xFC, 0x00, 0x1F, 0xD0, 0xF5, 0x00, 0x00, 0x07, 0xB9, 0xFF, 0x01, 0xE0, 
+  0x00, 0xF7, 0xFF, 0x03, 0x80, 0x07, 0xC0, 0x0F, 0xF7, 0xFF, 0x01, 0xE0, 
+  0x07, 0xC3, 0xFF, 0x03, 0xF5, 0x55, 0x55, 0x7F, 0xFB, 0xFF, 0x01, 0xC0, 
+  0x07, 0xF7, 0xFF, 0x02, 0xC0, 0x01, 0x00, 0xF6, 0x55, 0x01, 0x54, 0x01, 
+  0xC3, 0xFF, 0x02, 0xFB, 0xBB, 0xBB, 0xFA, 0xFF, 0x01, 0x00, 0x0F, 0xF7, 
+  0xFF, 0x02, 0xF0, 0x00, 0x00, 0xF6, 0xFF, 0x01, 0xFE, 0x01, 0xC3, 0xFF, 
+  0x03, 0xD5, 0x55, 0x55, 0x7F, 0xFC, 0xFF, 0x02, 0xFC, 0x00, 0x5F, 0xF7, 
+  0xFF, 0x02, 0xFC, 0x00, 0x01, 0xF5, 0x55, 0x00, 0x41, 0xEA, 0xFF, 0x00, 
+  0xF7, 0xD2, 0xFF, 0x01, 0xF8, 0x00, 0xF6, 0xFF, 0x02, 0xFE, 0x00, 0x07, 
+  0xF5, 0xFF, 0x00, 0xC0, 0xEA, 0xFF, 0x00, 0xEB, 0xDB, 0xFF, 0xFE, 0x55, 
+  0x00, 0x7F, 0xFC, 0xFF, 0x01, 0xF0, 0x01, 0xF5, 0xFF, 0x01, 0x00, 0x05, 
+  0xF5, 0x55, 0x01, 0x50, 0x7F, 0xEB, 0xFF, 0x01, 0xF5, 0x7F, 0xDC, 0xFF, 
+  0xFE, 0xBB, 0xFB, 0xFF, 0x01, 0xE0, 0x03, 0xF5, 0xFF, 0x01, 0xE0, 0x0F, 
+  0xF5, 0xFF, 0x01, 0xF0, 0x3F, 0xEB, 0xFF, 0x01, 0xE2, 0x3F, 0xDD, 0xFF, 
+  0x00, 0xFD, 0xFE, 0x55, 0x00, 0x7F, 0xFC, 0xFF, 0x01, 0xC0, 0x07, 0xF5, 
+  0xFF, 0x01, 0xF0, 0x15, 0xF5, 0x55, 0x01, 0x50, 0x3F, 0xEB, 0xFF, 0x01, 
+  0xF5, 0x5F, 0xD3, 0xFF, 0x01, 0x80, 0x3F, 0xF5, 0xFF, 0x01, 0xF8, 0x3F, 
+  0xFB, 0xFF, 0x00, 0xBF, 0xFC, 0xFF, 0x01, 0xF8, 0x3F, 0xEB, 0xFF, 0x01, 
+  0xEA, 0xAF, 0xDD, 0xFF, 0x00, 0xF5, 0xFE, 0x55, 0x00, 0x7F, 0xFC, 0xFF, 
+  0x01, 0x00, 0x7F, 0xF5, 0xFF, 0x01, 0xF0, 0x15, 0xFB, 0x55, 0x02, 0x15, 
+  0x55, 0x15, 0xFE, 0x55, 0x01, 0x50, 0x1F, 0xEB, 0xFF, 0x01, 0xF5, 0x55, 
+  0xDF, 0xFF, 0x00, 0xFB, 0xFB, 0xBB, 0x00, 0xBF, 0xFE, 0xFF, 0x01, 0xFE, 
+  0x00, 0xF4, 0xFF, 0x01, 0xF0, 0x3F, 0xFE, 0xFF, 0x05, 0xF8, 0x3F, 0xF8, 
+  0x3F, 0xFE, 0x0F, 0xFE, 0xFF, 0x01, 0xF8, 0x1F, 0xEB, 0xFF, 0x01, 0xE2, 
+  0x22, 0xE0, 0xFF, 0x00, 0xFD, 0xF9, 0x55, 0x04, 0x7F, 0xFF, 0xFF, 0xFC, 
+  0x01, 0xF4, 0xFF, 0x00, 0xF0, 0xFD, 0x55, 0x05, 0x50, 0x15, 0x50, 0x15, 
+  0x54, 0x05, 0xFE, 0x55, 0x01, 0x54, 0x1F, 0xEB, 0xFF, 0x02, 0xF5, 0x55, 
+  0x5F, 0xD5, 0xFF, 0x01, 0xF8, 0x03, 0xF4, 0xFF, 0x01, 0xF0, 0x7F, 0xFE, 
+  0xFF, 0x05, 0xF0, 0xFF, 0xF8, 0x3F, 0xF8, 0x3F, 0xFE, 0xFF, 0x01, 0xFC, 
+  0x1F, 0xEB, 0xFF, 0x02, 0xEA, 0xAA, 0xAF, 0xE1, 0xFF, 0x00, 0xD5, 0xF9, 
+  0x55, 0x04, 0x57, 0xFF, 0xFF, 0xF0, 0x07, 0xF4, 0xFF, 0x00, 0xF0, 0xF4, 
+  0x55, 0x01, 0x54, 0x1F, 0xEB, 0xFF, 0x02, 0xF5, 0x55, 0x57, 0xE1, 0xFF, 
+  0xF7, 0xBB, 0xFF, 0xFF, 0x01, 0xE0, 0x1F, 0xF4, 0xFF, 0x0F, 0xF0, 0x7F, 
+  0xFE, 0x23, 0xFF, 0xA2, 0x2F, 0xE2, 0x23, 0xE2, 0x23, 0xFA, 0x2B, 0xFF, 
+  0xFC, 0x1F, 0xF5, 0xFF, 0x0C, 0xFC, 0x03, 0xF8, 0x0F, 0xF0, 0x07, 0x8F, 
+  0xF3, 0xFF, 0xFF, 0xE2, 0x22, 0x23, 0xE1, 0xFF, 0xF7, 0x55, 0xFF, 0xFF, 
+  0x01, 0xC0, 0x1F, 0xF4, 0xFF, 0x0F, 0xF0, 0x55, 0x54, 0x00, 0x55, 0x40, 
+  0x05, 0x40, 0x05, 0x50, 0x01, 0x50, 0x01, 0x55, 0x54, 0x1F, 0xF5, 0xFF, 
+  0x0D, 0xFC, 0x01, 0xF0, 0x07, 0xF0, 0x07, 0xC7, 0xF7, 0xFF, 0xFF, 0xF5, 
+  0x55, 0x55, 0x7F, 0xD6, 0xFF, 0x01, 0x80, 0x7F, 0xF4, 0xFF, 0x0F, 0xF0, 
+  0x7F, 0xFE, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 
+  0xFF, 0xFC, 0x1F, 0xF5, 0xFF, 0x0D, 0xFC, 0xF9, 0xF9, 0xE3, 0xFB, 0xFF, 
+  0xCF, 0xE3, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xBF, 0xE3, 0xFF, 0x00, 0xF5, 
+  0xF7, 0x55, 0x03, 0x7F, 0xFF, 0x01, 0x7F, 0xF4, 0xFF, 0x0F, 0xF0, 0x55, 
+  0x54, 0x00, 0x15, 0x40, 0x05, 0x40, 0x05, 0x50, 0x01, 0x50, 0x00, 0x55, 
+  0x54, 0x1F, 0xF5, 0xFF, 0x01, 0xFC, 0xFD, 0xFE, 0xF1, 0x08, 0xFF, 0xC7, 
+  0xC7, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x57, 0xE3, 0xFF, 0x00, 0xFB, 0xF7, 
+  0xBB, 0x02, 0xBF, 0xFE, 0x01, 0xF3, 0xFF, 0x0F, 0xF0, 0x7F, 0xFE, 0x00, 
+  0x0F, 0x80, 0x0F, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0x00, 0x3F, 0xFC, 0x1F, 
+  0xF5, 0xFF, 0x0D, 0xFC, 0xF8, 0xFB, 0xF9, 0xF3, 0xFF, 0xE3, 0xE7, 0xFF, 
+  0xFF, 0xE2, 0x22, 0x22, 0x23, 0xE3, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 0x02, 
+  0x5F, 0xFC, 0x01, 0xF3, 0xFF, 0x0F, 0xF0, 0x55, 0x54, 0x04, 0x05, 0x50, 
+  0x55, 0x54, 0x15, 0x54, 0x15, 0x50, 0x50, 0x55, 0x54, 0x1F, 0xF5, 0xFF, 
+  0x01, 0xFC, 0xFD, 0xFE, 0xF1, 0x08, 0x5F, 0xF7, 0xC7, 0xFF, 0xFF, 0xF5, 
+  0x55, 0x55, 0x57, 0xD7, 0xFF, 0x03, 0xF8, 0x03, 0xFF, 0xFE, 0xF5, 0xFF, 
+  0x0F, 0xF0, 0x7F, 0xFE, 0x0E, 0x0F, 0xF0, 0x3F, 0xF8, 0x3F, 0xFC, 0x0F, 
+  0xF0, 0x30, 0x3F, 0xFC, 0x1F, 0xF5, 0xFF, 0x0D, 0xFC, 0xA1, 0xF8, 0xE3, 
+  0xF8, 0x0F, 0xF3, 0xCF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xBF, 0xE3, 0xFF, 
+  0x00, 0xD5, 0xF7, 0x55, 0x05, 0x57, 0xF0, 0x07, 0xFF, 0xFD, 0x7F, 0xF6, 
+  0xFF, 0x0F, 0xF0, 0x55, 0x54, 0x04, 0x05, 0x50, 0x55, 0x50, 0x15, 0x54, 
+  0x15, 0x50, 0x50, 0x55, 0x54, 0x1F, 0xF5, 0xFF, 0x0D, 0xFC, 0x01, 0xF0, 
+  0x07, 0xF1, 0x17, 0xF1, 0xDF, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x7F, 0xE3, 
+  0xFF, 0xF6, 0xBB, 0x05, 0xBF, 0xE0, 0x0F, 0xFF, 0xFE, 0x3F, 0xF6, 0xFF, 
+  0x0F, 0xF0, 0x7F, 0xFE, 0x00, 0x0F, 0xF0, 0x3F, 0xF8, 0x3F, 0xFC, 0x1F, 
+  0xF0, 0x00, 0x3F, 0xFC, 0x1F, 0xF5, 0xFF, 0x0C, 0xFC, 0x2F, 0xF8, 0x0F, 
+  0xF3, 0xFF, 0xF9, 0x9F, 0xFF, 0xFF, 0xE2, 0x22, 0x22, 0xE2, 0xFF, 0xF6, 
+  0x55, 0x05, 0x57, 0xC0, 0x1F, 0xFF, 0xFD, 0x57, 0xF6, 0xFF, 0x0F, 0xF0, 
+  0x55, 0x54, 0x00, 0x15, 0x50, 0x55, 0x54, 0x15, 0x54, 0x15, 0x50, 0x00, 
+  0x55, 0x54, 0x1F, 0xF5, 0xFF, 0x0C, 0xFC, 0xFF, 0xF1, 0xC7, 0xF1, 0xFF, 
+  0xF9, 0x1F, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0xD6, 0xFF, 0x04, 0xC0, 0x3F, 
+  0xFF, 0xF8, 0x03, 0xF6, 0xFF, 0x0F, 0xF0, 0x7F, 0xFE, 0x00, 0x1F, 0xF0, 
+  0x3F, 0xF8, 0x3F, 0xFC, 0x0F, 0xF0, 0x00, 0xFF, 0xFC, 0x1F, 0xF5, 0xFF, 
+  0x0C, 0xFC, 0xFF, 0xF9, 0xE7, 0xFB, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xEA, 
+  0xAA, 0xAF, 0xE2, 0xFF, 0xF5, 0x55, 0x05, 0xC0, 0x7F, 0xFF, 0xFD, 0x55, 
+  0x7F, 0xF7, 0xFF, 0x0F, 0xF0, 0x55, 0x54, 0x00, 0x55, 0x50, 0x55, 0x50, 
+  0x15, 0x54, 0x15, 0x50, 0x01, 0x55, 0x54, 0x1F, 0xF5, 0xFF, 0x0C, 0xFC, 
+  0xFF, 0xF1, 0xF3, 0xF1, 0x77, 0xFC, 0x3F, 0xFF, 0xFF, 0xF5, 0x55, 0x57, 
+  0xE2, 0xFF, 0xF5, 0xBB, 0x05, 0x80, 0xFF, 0xFF, 0xFA, 0x22, 0x3F, 0xF7, 
+  0xFF, 0x0F, 0xF0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x3F, 0xF8, 0x3F, 0xFC, 
+  0x1F, 0xF0, 0x2B, 0xFF, 0xFC, 0x1F, 0xF5, 0xFF, 0x0C, 0xFC, 0xFF, 0xFB, 
+  0xF3, 0xF0, 0x07, 0xFC, 0x3F, 0xFF, 0xFF, 0xE2, 0x22, 0x3F, 0xE2, 0xFF, 
+  0xF5, 0x55, 0x05, 0x01, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0xF7, 0xFF, 0x0F, 
+  0xF0, 0x55, 0x54, 0x05, 0x55, 0x40, 0x05, 0x40, 0x05, 0x50, 0x01, 0x50, 
+  0x55, 0x55, 0x54, 0x1F, 0xF5, 0xFF, 0x0C, 0xFC, 0xFF, 0xF1, 0xF1, 0xF0, 
+  0x07, 0xFC, 0x7F, 0xFF, 0xFF, 0xF5, 0x55, 0x7F, 0xD7, 0xFF, 0x06, 0xFE, 
+  0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF7, 0xFF, 0x0F, 0xF0, 0x7F, 0xFE, 
+  0x0F, 0xFF, 0x80, 0x0F, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x3F, 0xFF, 0xFC, 
+  0x1F, 0xEB, 0xFF, 0x01, 0xEA, 0xAA, 0xE1, 0xFF, 0xF6, 0x55, 0x07, 0x54, 
+  0x03, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x57, 0xF8, 0xFF, 0x0F, 0xF0, 0x55, 
+  0x54, 0x05, 0x55, 0x40, 0x05, 0x40, 0x05, 0x50, 0x01, 0x50, 0x55, 0x55, 
+  0x54, 0x1F, 0xEB, 0xFF, 0x01, 0xF5, 0x55, 0xE1, 0xFF, 0xF6, 0xBB, 0x04, 
+  0xB8, 0x03, 0xFF, 0xFF, 0xFA, 0xFE, 0x22, 0xF8, 0xFF, 0x0F, 0xF0, 0x7F, 
+  0xFE, 0x0F, 0xFF, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x3F, 0xFF, 
+  0xFC, 0x1F, 0xEB, 0xFF, 0x01, 0xE2, 0x27, 0xE2, 0xFF, 0x00, 0xFD, 0xF6, 
+  0x55, 0x04, 0x54, 0x07, 0xFF, 0xFF, 0xFD, 0xFD, 0x55, 0xF9, 0xFF, 0x00, 
+  0xF0, 0xF4, 0x55, 0x01, 0x54, 0x1F, 0xEB, 0xFF, 0x01, 0xF5, 0x5F, 0xD6, 
+  0xFF, 0x04, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0xFD, 0x00, 0x00, 0x2F, 0xFA, 
+  0xFF, 0x01, 0xF0, 0x7F, 0xF5, 0xFF, 0x01, 0xFC, 0x1F, 0xEB, 0xFF, 0x01, 
+  0xEA, 0xBF, 0xE2, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x04, 0xFF, 0x57, 0xF5, 
+  0x57, 0xFF, 0xFE, 0x55, 0x04, 0x50, 0x1F, 0xFF, 0xFF, 0xFD, 0xFB, 0x55, 
+  0x01, 0x57, 0x77, 0xFD, 0xFF, 0x00, 0xF0, 0xF4, 0x55, 0x01, 0x54, 0x1F, 
+  0xEB, 0xFF, 0x01, 0xF5, 0x7F, 0xE1, 0xFF, 0xFE, 0xBB, 0x0C, 0xFF, 0xBF, 
+  0xFB, 0xBF, 0xFF, 0xFB, 0xBB, 0xBB, 0xA0, 0x1F, 0xFF, 0xFF, 0xFE, 0xFD, 
+  0x22, 0x01, 0x2B, 0xBB, 0xFB, 0xFF, 0x01, 0xF0, 0x3F, 0xF5, 0xFF, 0x01, 
+  0xF8, 0x1F, 0xEB, 0xFF, 0x00, 0xE3, 0xE1, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 
+  0x0C, 0x7F, 0x5F, 0xD5, 0x7F, 0xFF, 0xF5, 0x55, 0x55, 0x40, 0x1F, 0xFF, 
+  0xFF, 0xFD, 0xFB, 0x55, 0xFF, 0xDD, 0x00, 0xDF, 0xFE, 0xFF, 0x01, 0xF0, 
+  0x15, 0xF5, 0x55, 0x01, 0x54, 0x1F, 0xEB, 0xFF, 0x00, 0xF5, 0xD5, 0xFF, 
+  0x04, 0xE0, 0x3F, 0xFF, 0xFF, 0xFE, 0xFE, 0x00, 0x02, 0x0A, 0xAA, 0xBF, 
+  0xFB, 0xFF, 0x01, 0xF8, 0x1F, 0xF5, 0xFF, 0x01, 0xF8, 0x3F, 0xEB, 0xFF, 
+  0x00, 0xEF, 0xE1, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x09, 0x7F, 0xFF, 0xD5, 
+  0x7F, 0xFF, 0xF5, 0x55, 0x55, 0x40, 0x7F, 0xFE, 0xFF, 0xFC, 0x55, 0xFD, 
+  0x77, 0x04, 0x7F, 0xFF, 0xFF, 0xFC, 0x15, 0xF5, 0x55, 0x01, 0x50, 0x3F, 
+  0xC9, 0xFF, 0xFE, 0xBB, 0x09, 0xBF, 0xFF, 0xBB, 0xFF, 0xBF, 0xFB, 0xBB, 
+  0xBB, 0x80, 0x7F, 0xFE, 0xFF, 0x04, 0xA2, 0x22, 0x22, 0x3B, 0xBB, 0xFA, 
+  0xFF, 0x01, 0xFC, 0x0F, 0xF5, 0xFF, 0x01, 0xE0, 0x3F, 0xCA, 0xFF, 0x00, 
+  0xFD, 0xFE, 0x55, 0x08, 0x5F, 0xFF, 0x55, 0xFF, 0x55, 0xFD, 0x55, 0x55, 
+  0x00, 0xFD, 0xFF, 0x00, 0xD5, 0xFD, 0x55, 0xFD, 0xDD, 0x04, 0xDF, 0xFF, 
+  0xFF, 0xFC, 0x05, 0xF5, 0x55, 0x01, 0x40, 0x7F, 0xBE, 0xFF, 0x00, 0x80, 
+  0xFD, 0xFF, 0x04, 0xE0, 0x00, 0x02, 0xAA, 0xAF, 0xFA, 0xFF, 0x01, 0xFE, 
+  0x03, 0xF5, 0xFF, 0x00, 0xC0, 0xC9, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x08, 
+  0x57, 0xFF, 0x55, 0xFD, 0x55, 0xFD, 0x55, 0x55, 0x01, 0xFD, 0xFF, 0x00, 
+  0xF5, 0xFE, 0x55, 0x00, 0x57, 0xFC, 0x77, 0xFE, 0xFF, 0x00, 0x01, 0xF5, 
+  0x55, 0x00, 0x01, 0xC8, 0xFF, 0xFE, 0xBB, 0x0A, 0xBF, 0xFF, 0xBB, 0xFF, 
+  0xBB, 0xFF, 0xBB, 0xBA, 0x03, 0xFF, 0xF0, 0xFD, 0x00, 0x02, 0x0B, 0xBB, 
+  0xBF, 0xF9, 0xFF, 0x00, 0x00, 0xF6, 0xFF, 0x01, 0xFE, 0x01, 0xC9, 0xFF, 
+  0x00, 0xFD, 0xFE, 0x55, 0x0A, 0x57, 0xFD, 0x55, 0xFD, 0x55, 0xFD, 0x55, 
+  0x54, 0x01, 0xFF, 0xF0, 0xFD, 0x00, 0xFF, 0x55, 0x00, 0x5D, 0xFC, 0xDD, 
+  0xFE, 0xFF, 0x00, 0xC0, 0xF6, 0x55, 0x01, 0x54, 0x05, 0xBE, 0xFF, 0x03, 
+  0xFE, 0x03, 0xFF, 0xF0, 0xFD, 0x00, 0x01, 0x2A, 0xAA, 0xF8, 0xFF, 0x05, 
+  0xC0, 0x02, 0xAA, 0xBF, 0xFF, 0xFA, 0xFB, 0xAA, 0x01, 0x80, 0x07, 0xC9, 
+  0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x0A, 0x5F, 0xFF, 0x55, 0xFF, 0x57, 0xFD, 
+  0x55, 0x54, 0x07, 0xFF, 0xF0, 0xFE, 0x00, 0x02, 0x01, 0x55, 0x55, 0xFB, 
+  0x77, 0x08, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x15, 0x55, 0x50, 0xFA, 
+  0x00, 0x00, 0x17, 0xC8, 0xFF, 0xFE, 0xBB, 0x0A, 0xBF, 0xFF, 0xBB, 0xFF, 
+  0xBF, 0xFF, 0xBB, 0xB8, 0x07, 0xFF, 0xF0, 0xFD, 0x00, 0xFF, 0xBB, 0xF8, 
+  0xFF, 0x05, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0xFA, 0x00, 0x00, 0x3F, 
+  0xC9, 0xFF, 0x00, 0xFD, 0xFE, 0x55, 0x0A, 0x5F, 0xFF, 0xD5, 0xFF, 0xDF, 
+  0xFD, 0x55, 0x54, 0x07, 0xFF, 0xF0, 0xFE, 0x00, 0x02, 0x05, 0x55, 0x55, 
+  0xFB, 0xDD, 0x07, 0xD5, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x15, 0x55, 0xF9, 
+  0x00, 0x00, 0x7F, 0xBE, 0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0xF8, 0xFE, 0x00, 
+  0x02, 0x02, 0xAA, 0xAF, 0xFB, 0xFF, 0x07, 0xFA, 0xBF, 0xFF, 0xFF, 0x80, 
+  0x00, 0x3F, 0xFE, 0xFA, 0x00, 0x00, 0x03, 0xC8, 0xFF, 0x00, 0xFD, 0xFE, 
+  0x55, 0x0A, 0x7F, 0x5F, 0xF5, 0x7F, 0xFF, 0xF5, 0x55, 0x50, 0x1F, 0xFF, 
+  0xF0, 0xFE, 0x00, 0x02, 0x05, 0x55, 0x57, 0xFB, 0x77, 0x08, 0x75, 0x57, 
+  0xFF, 0xFF, 0xF5, 0x50, 0x15, 0x54, 0x01, 0xFB, 0x55, 0x00, 0x57, 0xC7, 
+  0xFF, 0xFE, 0xBB, 0x0A, 0xFF, 0xBF, 0xFB, 0xBF, 0xFF, 0xFB, 0xBB, 0xB0, 
+  0x1F, 0xFF, 0xF8, 0xFE, 0x00, 0x02, 0x0B, 0xBB, 0xBF, 0xFB, 0xFF, 0x01, 
+  0xFA, 0x22, 0xFE, 0xFF, 0x03, 0xF8, 0x3F, 0xF8, 0x07, 0xC1, 0xFF, 0x00, 
+  0xFD, 0xFE, 0x55, 0x0A, 0xFF, 0x5F, 0xF5, 0x5F, 0xFF, 0xD5, 0x55, 0x50, 
+  0x1F, 0xFF, 0xFC, 0xFE, 0x00, 0x02, 0x15, 0x55, 0x55, 0xFA, 0xDD, 0x07, 
+  0x55, 0x5F, 0xFF, 0xFF, 0xF8, 0x15, 0x50, 0x1F, 0xB6, 0xFF, 0x03, 0xE0, 
+  0x1F, 0xFF, 0xFC, 0xFE, 0x00, 0x02, 0x2A, 0xAA, 0xBF, 0xFB, 0xFF, 0x08, 
+  0xFE, 0xAA, 0xBF, 0xFF, 0xFF, 0xF8, 0x3F, 0xE0, 0x1F, 0xC1, 0xFF, 0x00, 
+  0xFD, 0xFA, 0x55, 0x06, 0x75, 0x55, 0x55, 0x50, 0x1F, 0xFF, 0xFC, 0xFE, 
+  0x00, 0xFF, 0x55, 0x00, 0x57, 0xFA, 0x77, 0x07, 0x55, 0x57, 0xFF, 0xFF, 
+  0xF8, 0x15, 0x40, 0x7F, 0xC0, 0xFF, 0xF7, 0xBB, 0x03, 0xA0, 0x3F, 0xFF, 
+  0xFE, 0xFE, 0x00, 0x02, 0x3B, 0xBB, 0xBF, 0xFA, 0xFF, 0x07, 0x22, 0x23, 
+  0xFF, 0xFF, 0xF8, 0x3F, 0x80, 0x7F, 0xC1, 0xFF, 0x00, 0xFD, 0xF7, 0x55, 
+  0x03, 0x40, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0x55, 0x00, 0x5D, 0xFA, 
+  0xDD, 0xFF, 0x55, 0xFF, 0xFF, 0x02, 0xF8, 0x15, 0x01, 0xB5, 0xFF, 0x09, 
+  0xE0, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xAA, 0xAA, 0xBF, 0xFA, 0xFF, 
+  0xFF, 0xAA, 0xFF, 0xFF, 0x02, 0xF8, 0x3E, 0x03, 0xC0, 0xFF, 0x00, 0xFD, 
+  0xF7, 0x55, 0x08, 0x40, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0x55, 0x55, 
+  0xF9, 0x77, 0xFF, 0x55, 0x04, 0x7F, 0xFF, 0xF8, 0x14, 0x07, 0xBF, 0xFF, 
+  0xF7, 0xBB, 0x09, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xBB, 0xBB, 
+  0xBF, 0xFA, 0xFF, 0x06, 0xA2, 0x22, 0x3F, 0xFF, 0xF8, 0x38, 0x03, 0xC0, 
+  0xFF, 0x00, 0xFD, 0xF7, 0x55, 0x09, 0x40, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 
+  0x01, 0x55, 0x55, 0x5D, 0xFE, 0xDD, 0x0A, 0xFF, 0xFD, 0xDD, 0xDD, 0x55, 
+  0x55, 0x5F, 0xFF, 0xF8, 0x10, 0x07, 0xB5, 0xFF, 0x00, 0xC0, 0xFE, 0xFF, 
+  0x04, 0xF8, 0x00, 0x02, 0xAA, 0xAA, 0xF9, 0xFF, 0xFF, 0xAA, 0x04, 0xAF, 
+  0xFF, 0xF8, 0x20, 0x03, 0xBF, 0xFF, 0xF7, 0x55, 0x01, 0x40, 0x7F, 0xFE, 
+  0xFF, 0x03, 0x00, 0x05, 0x55, 0x55, 0xFD, 0x77, 0x0A, 0x7F, 0xFF, 0x77, 
+  0x77, 0x55, 0x55, 0x57, 0xFF, 0xF8, 0x00, 0x01, 0xBF, 0xFF, 0xF7, 0xBB, 
+  0x00, 0x80, 0xFD, 0xFF, 0x03, 0xE0, 0x03, 0xBB, 0xBB, 0xFD, 0xFF, 0x0A, 
+  0xF8, 0x3F, 0xFF, 0xFF, 0xA2, 0x22, 0x23, 0xFF, 0xF8, 0x00, 0x03, 0xBF, 
+  0xFF, 0xF7, 0x55, 0x00, 0x41, 0xFD, 0xFF, 0x04, 0xFD, 0x45, 0x55, 0x55, 
+  0x5D, 0xFE, 0xDD, 0x0A, 0xF0, 0x1F, 0xDD, 0xDD, 0xD5, 0x55, 0x55, 0xFF, 
+  0xF8, 0x01, 0x01, 0xB5, 0xFF, 0x00, 0x80, 0xFC, 0xFF, 0x02, 0xFA, 0xAA, 
+  0xAA, 0xFD, 0xFF, 0x0A, 0xE0, 0x1F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xFF, 
+  0xF8, 0x03, 0x81, 0xBF, 0xFF, 0x00, 0xD5, 0xF8, 0x55, 0x00, 0x01, 0xFC, 
+  0xFF, 0x02, 0xF5, 0x55, 0x55, 0xFD, 0x77, 0x03, 0xF0, 0x1F, 0x77, 0x77, 
+  0xFE, 0x55, 0x03, 0x7F, 0xF8, 0x07, 0x01, 0xBF, 0xFF, 0x00, 0xFB, 0xF8, 
+  0xBB, 0x00, 0x81, 0xFC, 0xFF, 0x02, 0xFB, 0xBB, 0xBB, 0xFD, 0xFF, 0x0A, 
+  0xE0, 0x1F, 0xFF, 0xFF, 0xA2, 0x22, 0x22, 0xFF, 0xF8, 0x0F, 0x81, 0xBF, 
+  0xFF, 0x00, 0xD5, 0xF8, 0x55, 0x00, 0x01, 0xFC, 0xFF, 0x03, 0xF5, 0x55, 
+  0x55, 0x5D, 0xFE, 0xDD, 0x0A, 0xF0, 0x1F, 0xDD, 0xDD, 0xD5, 0x55, 0x55, 
+  0x7F, 0xF8, 0x1F, 0x81, 0xB5, 0xFF, 0x00, 0x01, 0xFC, 0xFF, 0x02, 0xFA, 
+  0xAA, 0xAA, 0xFD, 0xFF, 0x0A, 0xF0, 0x3F, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 
+  0xBF, 0xF8, 0x3F, 0x80, 0xBF, 0xFF, 0x00, 0xF5, 0xF8, 0x55, 0x00, 0x01, 
+  0xFC, 0xFF, 0x02, 0xF5, 0x55, 0x55, 0xFD, 0x77, 0x03, 0xF4, 0x7F, 0x77, 
+  0x77, 0xFE, 0x55, 0x03, 0x5F, 0xF8, 0x7F, 0xC1, 0xBF, 0xFF, 0x00, 0xFB, 
+  0xF8, 0xBB, 0x00, 0x03, 0xFC, 0xFF, 0x02, 0xFB, 0xBB, 0xBB, 0xF9, 0xFF, 
+  0x06, 0xA2, 0x22, 0x22, 0x3F, 0xF8, 0xFF, 0x80, 0xBF, 0xFF, 0x00, 0xFD, 
+  0xF8, 0x55, 0x00, 0x01, 0xFC, 0xFF, 0x03, 0xF5, 0x55, 0x55, 0x5D, 0xFE, 
+  0xDD, 0x0A, 0xFF, 0xFD, 0xDD, 0xDD, 0xD5, 0x55, 0x55, 0x5F, 0xF9, 0xFF, 
+  0xC0, 0xB5, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x02, 0xEA, 0xAA, 0xAA, 0xF9, 
+  0xFF, 0x06, 0xEA, 0xAA, 0xAA, 0xAF, 0xFB, 0xFF, 0xC0, 0xBE, 0xFF, 0xF8, 
+  0x55, 0x00, 0x01, 0xFC, 0xFF, 0x02, 0xF5, 0x55, 0x55, 0xFD, 0x77, 0x03, 
+  0x7F, 0xF7, 0x77, 0x77, 0xFE, 0x55, 0x03, 0x57, 0xFF, 0xFF, 0xC0, 0xBE, 
+  0xFF, 0x00, 0xFB, 0xF9, 0xBB, 0x00, 0x03, 0xFC, 0xFF, 0x03, 0xFB, 0xBB, 
+  0xBB, 0xBF, 0xFA, 0xFF, 0x06, 0xA2, 0x22, 0x22, 0x2F, 0xFF, 0xFF, 0xC0, 
+  0xBE, 0xFF, 0x00, 0xF5, 0xF9, 0x55, 0x00, 0x01, 0xFC, 0xFF, 0x03, 0xD5, 
+  0x55, 0x55, 0x5D, 0xFA, 0xDD, 0x06, 0xD5, 0x55, 0x55, 0x57, 0xFF, 0xFF, 
+  0xC0, 0xB6, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0xFF, 0x03, 0xEA, 0xAA, 0xAA, 
+  0xBF, 0xFA, 0xFF, 0x06, 0xEA, 0xAA, 0xAA, 0xAF, 0xFF, 0xFF, 0xC0, 0xBD, 
+  0xFF, 0xFA, 0x55, 0x01, 0x57, 0x03, 0xFC, 0xFF, 0x03, 0xF5, 0x55, 0x55, 
+  0x57, 0xFA, 0x77, 0xFE, 0x55, 0x04, 0x57, 0xFF, 0xFF, 0xC0, 0x7F, 0xB6, 
+  0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x03, 0xFB, 0xBB, 0xBB, 0xBF, 0xFA, 0xFF, 
+  0x06, 0x80, 0x22, 0x22, 0x23, 0xFF, 0xFF, 0xC0, 0xB5, 0xFF, 0x00, 0x03, 
+  0xFC, 0xFF, 0x03, 0xD5, 0x55, 0x55, 0x5D, 0xFA, 0xDD, 0x00, 0xC4, 0xFE, 
+  0x55, 0xFF, 0xFF, 0x01, 0xC0, 0x7F, 0xB6, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 
+  0x03, 0xEA, 0xAA, 0xAA, 0xAF, 0xFA, 0xFF, 0x06, 0x80, 0x00, 0xAA, 0xAB, 
+  0xFF, 0xFF, 0xC0, 0xB5, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x03, 0xF5, 0x55, 
+  0x55, 0x57, 0xFA, 0x77, 0x06, 0x51, 0x11, 0x55, 0x55, 0xFF, 0xFF, 0xC0, 
+  0xFB, 0x55, 0x00, 0x7F, 0xBC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0xFB, 
+  0xFE, 0xBB, 0xFA, 0xFF, 0x06, 0x80, 0x00, 0x22, 0x23, 0xFF, 0xFF, 0xC0, 
+  0xFB, 0xBB, 0x00, 0xBF, 0xBC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0xD5, 
+  0xFE, 0x55, 0xFA, 0xDD, 0x06, 0xC4, 0x44, 0x55, 0x55, 0xFF, 0xFF, 0xC0, 
+  0xFA, 0x55, 0xBC, 0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x03, 0xEA, 0xAA, 0xAA, 
+  0xAB, 0xFA, 0xFF, 0x06, 0x80, 0x00, 0x00, 0xAA, 0xFF, 0xFF, 0xC0, 0xB5, 
+  0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0xF5, 0xFE, 0x55, 0xFA, 0x77, 0xFE, 
+  0x11, 0x03, 0x55, 0xFF, 0xFF, 0xC0, 0xFA, 0x55, 0x00, 0x7F, 0xBD, 0xFF, 
+  0x00, 0x03, 0xFC, 0xFF, 0x00, 0xFB, 0xFE, 0xBB, 0xFA, 0xFF, 0x06, 0x80, 
+  0x00, 0x00, 0x22, 0xFF, 0xFF, 0xC0, 0xFA, 0xBB, 0x00, 0xBF, 0xBD, 0xFF, 
+  0x00, 0x01, 0xFC, 0xFF, 0x00, 0xD5, 0xFE, 0x55, 0x00, 0x5D, 0xFB, 0xDD, 
+  0xFE, 0x44, 0x03, 0x55, 0xFF, 0xFF, 0xC0, 0xFA, 0x55, 0x00, 0x5F, 0xBD, 
+  0xFF, 0x00, 0x03, 0xFC, 0xFF, 0x00, 0xEA, 0xFE, 0xAA, 0x00, 0xBF, 0xFB, 
+  0xFF, 0x06, 0x80, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xC0, 0xB5, 0xFF, 0x00, 
+  0x01, 0xFC, 0xFF, 0x00, 0xF5, 0xFE, 0x55, 0x00, 0x57, 0xFB, 0x77, 0xFD, 
+  0x55, 0x02, 0x7F, 0xFF, 0xC0, 0xFA, 0x55, 0x00, 0x57, 0xBD, 0xFF, 0x00, 
+  0x03, 0xFC, 0xFF, 0x00, 0xFB, 0xFE, 0xBB, 0x00, 0xBF, 0xF8, 0xFF, 0x03, 
+  0xFE, 0xFF, 0xFF, 0x80, 0xFA, 0xBB, 0x00, 0xBF, 0xBD, 0xFF, 0x00, 0x01, 
+  0xFC, 0xFF, 0x00, 0xD5, 0xFD, 0x55, 0xFB, 0xDD, 0x00, 0x7F, 0xFE, 0xFF, 
+  0x02, 0x7F, 0xFF, 0xC0, 0xFA, 0x55, 0x00, 0x57, 0xBD, 0xFF, 0x00, 0x81, 
+  0xFC, 0xFF, 0x00, 0xEA, 0xFE, 0xAA, 0x00, 0xAB, 0xFC, 0xFF, 0x00, 0xFE, 
+  0xFB, 0xFF, 0x00, 0x80, 0xE1, 0xFF, 0x00, 0xEF, 0xD6, 0xFF, 0x00, 0x01, 
+  0xFC, 0xFF, 0x00, 0xF5, 0xFD, 0x55, 0xFC, 0x77, 0x01, 0x75, 0x7F, 0xFC, 
+  0xFF, 0x00, 0x81, 0xFA, 0x55, 0x00, 0x57, 0xE9, 0xFF, 0x00, 0xF5, 0xD6, 
+  0xFF, 0x00, 0x81, 0xFC, 0xFF, 0x00, 0xFB, 0xFD, 0xBB, 0x00, 0xBF, 0xFD, 
+  0xFF, 0x00, 0xFB, 0xFB, 0xFF, 0x00, 0x80, 0xF9, 0xBB, 0xE9, 0xFF, 0x00, 
+  0xE2, 0xD6, 0xFF, 0x00, 0x01, 0xFC, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0xFD, 
+  0xDD, 0x01, 0xD5, 0x7F, 0xFC, 0xFF, 0x00, 0x01, 0xF9, 0x55, 0xE9, 0xFF, 
+  0x01, 0xF5, 0x5F, 0xD7, 0xFF, 0x00, 0x80, 0xFC, 0xFF, 0x00, 0xEA, 0xFD, 
+  0xAA, 0x00, 0xAB, 0xFD, 0xFF, 0x00, 0xEA, 0xFB, 0xFF, 0x00, 0x80, 0xE1, 
+  0xFF, 0x01, 0xEA, 0xAF, 0xD7, 0xFF, 0x00, 0x81, 0xFC, 0xFF, 0x00, 0xF5, 
+  0xFC, 0x55, 0x05, 0x57, 0x77, 0x77, 0x75, 0x55, 0x7F, 0xFC, 0xFF, 0x00, 
+  0x01, 0xF9, 0x55, 0xE9, 0xFF, 0x01, 0xF5, 0x57, 0xD7, 0xFF, 0x00, 0x80, 
+  0xFC, 0xFF, 0x00, 0xFB, 0xF7, 0xBB, 0xFB, 0xFF, 0x00, 0x01, 0xF9, 0xBB, 
+  0xE9, 0xFF, 0x01, 0xE2, 0x23, 0xD7, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 
+  0xD5, 0xF7, 0x55, 0x00, 0x7F, 0xFC, 0xFF, 0x00, 0x01, 0xF9, 0x55, 0xE9, 
+  0xFF, 0x02, 0xF5, 0x55, 0x7F, 0xD8, 0xFF, 0x00, 0xC0, 0xFC, 0xFF, 0x00, 
+  0xEA, 0xF7, 0xAA, 0xFB, 0xFF, 0x00, 0x03, 0xE1, 0xFF, 0x02, 0xEA, 0xAA, 
+  0xBF, 0xD8, 0xFF, 0x01, 0xC0, 0x7F, 0xFD, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 
+  0x00, 0x7F, 0xFC, 0xFF, 0x00, 0x01, 0xF9, 0x55, 0xE9, 0xFF, 0x02, 0xF5, 
+  0x55, 0x57, 0xD8, 0xFF, 0x01, 0xC0, 0x7F, 0xFD, 0xFF, 0x00, 0xFB, 0xF7, 
+  0xBB, 0xFC, 0xFF, 0x01, 0xFE, 0x03, 0xF9, 0xBB, 0xE9, 0xFF, 0x02, 0xE2, 
+  0x22, 0x23, 0xD8, 0xFF, 0x01, 0xC0, 0x7F, 0xFD, 0xFF, 0x00, 0xD5, 0xF7, 
+  0x55, 0x00, 0x7F, 0xFD, 0xFF, 0x01, 0xFE, 0x05, 0xF9, 0x55, 0xF8, 0xFF, 
+  0x11, 0xF0, 0x1F, 0xFC, 0x7F, 0xF7, 0xF9, 0xFC, 0x07, 0xFF, 0x41, 0xFF, 
+  0x1F, 0xC7, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0xD8, 0xFF, 0x01, 0xE0, 0x7F, 
+  0xFD, 0xFF, 0x00, 0xEA, 0xF7, 0xAA, 0xFC, 0xFF, 0x01, 0xFE, 0x03, 0xF0, 
+  0xFF, 0x11, 0xE0, 0x0F, 0xFE, 0x3F, 0xE3, 0xF9, 0xF8, 0x01, 0xFE, 0x00, 
+  0xFE, 0x1F, 0xC7, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xDF, 0xFF, 0x00, 0xF5, 
+  0xFB, 0x55, 0x01, 0x40, 0x7F, 0xFD, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 0x00, 
+  0x7F, 0xFD, 0xFF, 0x01, 0xFC, 0x05, 0xF9, 0x55, 0xF8, 0xFF, 0x12, 0xF7, 
+  0x47, 0xFC, 0x1F, 0xF1, 0xF9, 0xF9, 0x71, 0xFC, 0x7C, 0x7F, 0x1F, 0xC7, 
+  0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x5F, 0xE0, 0xFF, 0x00, 0xA2, 0xFB, 0x22, 
+  0x01, 0x20, 0x3F, 0xFD, 0xFF, 0x00, 0xFB, 0xF7, 0xBB, 0xFC, 0xFF, 0x01, 
+  0xFE, 0x03, 0xF9, 0xBB, 0xF8, 0xFF, 0xFF, 0xE3, 0x10, 0xFC, 0x9F, 0xE0, 
+  0xF9, 0xF9, 0xFC, 0xFC, 0xFE, 0x3F, 0x0F, 0x87, 0xFF, 0xFF, 0xE2, 0x22, 
+  0x22, 0x2F, 0xE1, 0xFF, 0x00, 0xFD, 0xFA, 0x55, 0x01, 0x40, 0x3F, 0xFD, 
+  0xFF, 0x00, 0xD5, 0xF7, 0x55, 0x00, 0x7F, 0xFD, 0xFF, 0x01, 0xFC, 0x05, 
+  0xF9, 0x55, 0xF8, 0xFF, 0xFF, 0xF7, 0x10, 0xFD, 0x9F, 0xF4, 0x79, 0xFD, 
+  0xFC, 0x7D, 0xFF, 0x1F, 0x47, 0x07, 0xFF, 0xFF, 0xF5, 0x55, 0x55, 0x57, 
+  0xE1, 0xFF, 0x00, 0xF8, 0xFA, 0x88, 0x01, 0x80, 0x3F, 0xFD, 0xFF, 0x00, 
+  0xEA, 0xF7, 0xAA, 0xFC, 0xFF, 0x01, 0xFC, 0x0F, 0xF0, 0xFF, 0xFF, 0xE3, 
+  0x10, 0xF9, 0x8F, 0xE6, 0x79, 0xF9, 0xFE, 0x78, 0xFF, 0x9E, 0x26, 0x27, 
+  0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xAF, 0xE1, 0xFF, 0x00, 0xD5, 0xFA, 0x55, 
+  0x01, 0x50, 0x1F, 0xFD, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 0x00, 0x7F, 0xFD, 
+  0xFF, 0x01, 0xFC, 0x05, 0xF9, 0x55, 0xF8, 0xFF, 0x12, 0xF5, 0x47, 0xF1, 
+  0xDF, 0xF7, 0x39, 0xF9, 0xFE, 0x79, 0xFF, 0x1F, 0x37, 0x67, 0xFF, 0xFF, 
+  0xF5, 0x55, 0x55, 0x5F, 0xE1, 0xFF, 0x00, 0xA2, 0xFA, 0x22, 0x01, 0x20, 
+  0x1F, 0xFD, 0xFF, 0x04, 0xFB, 0xBB, 0xBB, 0xA2, 0x2B, 0xFB, 0xBB, 0xFC, 
+  0xFF, 0x01, 0xF8, 0x0B, 0xF9, 0xBB, 0xF8, 0xFF, 0x12, 0xE0, 0x0F, 0xF3, 
+  0xCF, 0xE3, 0x19, 0xF9, 0xFE, 0x79, 0xFF, 0x9F, 0x30, 0x67, 0xFF, 0xFF, 
+  0xE2, 0x22, 0x22, 0x3F, 0xE2, 0xFF, 0x00, 0xFD, 0xF9, 0x55, 0x01, 0x50, 
+  0x1F, 0xFD, 0xFF, 0x00, 0xD5, 0xF7, 0x55, 0x00, 0x7F, 0xFD, 0xFF, 0x01, 
+  0xF0, 0x15, 0xF9, 0x55, 0xF8, 0xFF, 0x12, 0xF5, 0x1F, 0xF1, 0x47, 0xF7, 
+  0x99, 0xFD, 0xFC, 0x7D, 0xFF, 0x1F, 0x70, 0xC7, 0xFF, 0xFF, 0xF5, 0x55, 
+  0x55, 0x7F, 0xE2, 0xFF, 0x00, 0xFC, 0xF9, 0x88, 0x01, 0x80, 0x0F, 0xFD, 
+  0xFF, 0x05, 0xEA, 0xAA, 0xA8, 0x00, 0x00, 0x0A, 0xFC, 0xAA, 0xFC, 0xFF, 
+  0x01, 0xF0, 0x0F, 0xF0, 0xFF, 0x11, 0xE3, 0x8F, 0xE0, 0x07, 0xE7, 0xC9, 
+  0xF9, 0xFC, 0x78, 0xFF, 0x3E, 0x38, 0xE7, 0xFF, 0xFF, 0xEA, 0xAA, 0xAB, 
+  0xE1, 0xFF, 0x00, 0xF5, 0xF9, 0x55, 0x01, 0x50, 0x07, 0xFD, 0xFF, 0x00, 
+  0xF5, 0xF7, 0x55, 0x00, 0x7F, 0xFD, 0xFF, 0x01, 0xF0, 0x15, 0xF9, 0x55, 
+  0xF8, 0xFF, 0x11, 0xF7, 0xC7, 0xF5, 0x47, 0xF7, 0xC1, 0xF9, 0xFC, 0x7C, 
+  0x7F, 0x3F, 0x3F, 0xE7, 0xFF, 0xFF, 0xF5, 0x55, 0x57, 0xE1, 0xFF, 0x00, 
+  0xF2, 0xF9, 0x22, 0x01, 0x20, 0x0F, 0xFD, 0xFF, 0x01, 0xFB, 0xBA, 0xFD, 
+  0x00, 0xFC, 0xBB, 0xFC, 0xFF, 0x06, 0xF0, 0x3B, 0xBB, 0xBF, 0xBB, 0xFB, 
+  0xFB, 0xFE, 0xBB, 0xF8, 0xFF, 0x11, 0xE3, 0xC7, 0xE7, 0xE3, 0xE3, 0xE1, 
+  0xF9, 0xF8, 0xFE, 0x3C, 0x3F, 0x3F, 0xE7, 0xFF, 0xFF, 0xE2, 0x22, 0x2F, 
+  0xE1, 0xFF, 0x00, 0xD5, 0xF9, 0x55, 0x01, 0x54, 0x07, 0xFD, 0xFF, 0x00, 
+  0xD5, 0xF7, 0x55, 0x00, 0x7F, 0xFD, 0xFF, 0x06, 0xE0, 0x15, 0x55, 0x7F, 
+  0x57, 0xD5, 0xFD, 0xFE, 0x55, 0xF8, 0xFF, 0x11, 0xF7, 0xC7, 0xC7, 0xF1, 
+  0xF7, 0xF1, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0x7F, 0xC7, 0xFF, 0xFF, 0xF5, 
+  0x55, 0x5F, 0xE1, 0xFF, 0x00, 0xC8, 0xF8, 0x88, 0x00, 0x07, 0xFD, 0xFF, 
+  0x01, 0xEA, 0xA8, 0xFD, 0x00, 0x00, 0x0A, 0xFD, 0xAA, 0xFC, 0xFF, 0x01, 
+  0xE0, 0x3F, 0xF0, 0xFF, 0xFF, 0xE3, 0x0E, 0xCF, 0xF3, 0xE7, 0xF9, 0xF8, 
+  0x07, 0xFF, 0x81, 0xFE, 0x3F, 0xE7, 0xFF, 0xFF, 0xEA, 0xAA, 0xE0, 0xFF, 
+  0xF8, 0x55, 0x01, 0x54, 0x07, 0xFD, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 0x00, 
+  0x7F, 0xFD, 0xFF, 0x06, 0xC0, 0x55, 0x55, 0x7F, 0x57, 0xF5, 0xFD, 0xFE, 
+  0x55, 0xEF, 0xFF, 0x00, 0xF7, 0xFC, 0xFF, 0x02, 0xF5, 0x55, 0x7F, 0xE1, 
+  0xFF, 0xF7, 0x22, 0x00, 0x03, 0xFD, 0xFF, 0x01, 0xFB, 0xA0, 0xFD, 0x00, 
+  0x00, 0x03, 0xFD, 0xBB, 0xFC, 0xFF, 0x06, 0xC0, 0x3B, 0xBB, 0xBF, 0xBF, 
+  0xFB, 0xFF, 0xFE, 0xBB, 0xE9, 0xFF, 0x01, 0xE2, 0x23, 0xE0, 0xFF, 0xF7, 
+  0x55, 0x00, 0x01, 0xFD, 0xFF, 0x00, 0xD5, 0xF7, 0x55, 0x00, 0x7F, 0xFD, 
+  0xFF, 0x06, 0xC0, 0x55, 0x55, 0x5D, 0x55, 0xD5, 0x75, 0xFE, 0x55, 0xE9, 
+  0xFF, 0x01, 0xF5, 0x57, 0xE1, 0xFF, 0x00, 0xFE, 0xF7, 0x88, 0x00, 0x01, 
+  0xFD, 0xFF, 0x00, 0xEA, 0xFB, 0x00, 0xFD, 0xAA, 0xFC, 0xFF, 0x00, 0x80, 
+  0xE0, 0xFF, 0x01, 0xEA, 0xAF, 0xE1, 0xFF, 0x00, 0xFD, 0xF7, 0x55, 0x00, 
+  0x01, 0xFD, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 0x00, 0x7F, 0xFD, 0xFF, 0x00, 
+  0x01, 0xF8, 0x55, 0xE9, 0xFF, 0x01, 0xF5, 0x5F, 0xE1, 0xFF, 0x00, 0xFE, 
+  0xF7, 0x22, 0x00, 0x00, 0xFD, 0xFF, 0x00, 0xFA, 0xFB, 0x00, 0x00, 0x3B, 
+  0xFE, 0xBB, 0xFC, 0xFF, 0x00, 0x01, 0xF8, 0xBB, 0xE9, 0xFF, 0x01, 0xE2, 
+  0x7F, 0xE1, 0xFF, 0x00, 0xFD, 0xF7, 0x55, 0x01, 0x40, 0x7F, 0xFE, 0xFF, 
+  0x00, 0xD5, 0xFB, 0x55, 0x00, 0x15, 0xFE, 0x55, 0x00, 0x7F, 0xFD, 0xFF, 
+  0x00, 0x01, 0xF9, 0x55, 0x00, 0x57, 0xE9, 0xFF, 0x00, 0xF5, 0xE0, 0xFF, 
+  0x00, 0xF8, 0xF7, 0x88, 0x01, 0x80, 0x7F, 0xFE, 0xFF, 0x00, 0xE8, 0xFB, 
+  0x00, 0x00, 0x0A, 0xFE, 0xAA, 0xFD, 0xFF, 0x01, 0xFE, 0x03, 0xE0, 0xFF, 
+  0x00, 0xEB, 0xE0, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 0x01, 0x40, 0x7F, 0xFE, 
+  0xFF, 0x00, 0xF5, 0xFB, 0x55, 0x00, 0x05, 0xFE, 0x55, 0x00, 0x7F, 0xFE, 
+  0xFF, 0x01, 0xFC, 0x05, 0xF9, 0x55, 0x00, 0x57, 0xE9, 0xFF, 0x00, 0xF7, 
+  0xE0, 0xFF, 0x00, 0xF2, 0xF7, 0x22, 0x01, 0x20, 0x3F, 0xFE, 0xFF, 0x00, 
+  0xE0, 0xFB, 0x00, 0x00, 0x03, 0xFE, 0xBB, 0xFD, 0xFF, 0x01, 0xF8, 0x03, 
+  0xF9, 0xBB, 0x00, 0xBF, 0xC7, 0xFF, 0x00, 0xF5, 0xF7, 0x55, 0x01, 0x50, 
+  0x1F, 0xFE, 0xFF, 0x00, 0xD5, 0xFB, 0x55, 0x00, 0x05, 0xFE, 0x55, 0x00, 
+  0x7F, 0xFE, 0xFF, 0x01, 0xFC, 0x05, 0xF9, 0x55, 0x00, 0x5F, 0xC7, 0xFF, 
+  0x00, 0xE8, 0xFD, 0x88, 0x07, 0x8A, 0xA8, 0x8A, 0x88, 0x8A, 0xA8, 0x80, 
+  0x0F, 0xFE, 0xFF, 0x00, 0xC0, 0xFB, 0x00, 0x00, 0x02, 0xFE, 0xAA, 0xFD, 
+  0xFF, 0x01, 0xF8, 0x0F, 0xBE, 0xFF, 0x00, 0xF5, 0xFC, 0x55, 0x06, 0xFD, 
+  0x5F, 0xD5, 0x57, 0xF5, 0x50, 0x07, 0xFE, 0xFF, 0x00, 0xD5, 0xFB, 0x55, 
+  0x00, 0x01, 0xFE, 0x55, 0x00, 0x7F, 0xFE, 0xFF, 0x01, 0xF0, 0x1D, 0xF9, 
+  0x55, 0x00, 0x7F, 0xC7, 0xFF, 0x00, 0xE2, 0xFD, 0x22, 0x07, 0x23, 0xFA, 
+  0x3F, 0xA2, 0x23, 0xFA, 0x20, 0x07, 0xFE, 0xFF, 0x00, 0x80, 0xFB, 0x00, 
+  0x00, 0x01, 0xFE, 0xBB, 0xFD, 0xFF, 0x01, 0xE0, 0x3F, 0xF9, 0xBB, 0xC6, 
+  0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x06, 0xFD, 0x5F, 0xD5, 0x57, 0xFD, 0x54, 
+  0x07, 0xFE, 0xFF, 0xFA, 0x55, 0x00, 0x41, 0xFE, 0x55, 0x00, 0x7F, 0xFE, 
+  0xFF, 0x01, 0xC0, 0x5F, 0xF9, 0x55, 0xC6, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 
+  0x07, 0x8B, 0xF8, 0x9F, 0xC8, 0x8F, 0xF8, 0x88, 0x03, 0xFE, 0xFF, 0x00, 
+  0x80, 0xFA, 0x00, 0xFE, 0xAA, 0xFD, 0xFF, 0x01, 0xC0, 0x7F, 0xBE, 0xFF, 
+  0x00, 0xD5, 0xFC, 0x55, 0x06, 0xFD, 0x5F, 0xD5, 0x57, 0xFD, 0x55, 0x01, 
+  0xFE, 0xFF, 0xFA, 0x55, 0x00, 0x00, 0xFE, 0x55, 0x00, 0x7F, 0xFE, 0xFF, 
+  0x02, 0x00, 0x7F, 0xF5, 0xFB, 0x55, 0x00, 0x57, 0xC6, 0xFF, 0x00, 0xE2, 
+  0xFD, 0x22, 0x0A, 0x23, 0xFA, 0x3F, 0xA2, 0x2F, 0xFE, 0x22, 0x00, 0xFF, 
+  0xFF, 0xFE, 0xF9, 0x00, 0x02, 0x3B, 0xBB, 0xBB, 0xFD, 0xFF, 0x02, 0x00, 
+  0xFF, 0xFF, 0xFB, 0xBB, 0xC5, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x09, 0xFD, 
+  0x5F, 0xD5, 0x5F, 0xFD, 0x55, 0x00, 0x7F, 0xFF, 0xFD, 0xFA, 0x55, 0x00, 
+  0x00, 0xFE, 0x55, 0x00, 0x7F, 0xFE, 0xFF, 0x00, 0x01, 0xFE, 0xFF, 0x00, 
+  0xFD, 0xFE, 0x55, 0xC4, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x0A, 0x8B, 0xFF, 
+  0xFF, 0xC8, 0x9F, 0xFE, 0x88, 0x80, 0x7F, 0xFF, 0xFC, 0xF9, 0x00, 0x02, 
+  0x2A, 0xAA, 0xAA, 0xFE, 0xFF, 0x01, 0xFE, 0x01, 0xBD, 0xFF, 0x00, 0xD5, 
+  0xFC, 0x55, 0xFF, 0xFF, 0x07, 0xD5, 0x5F, 0x7F, 0x55, 0x40, 0x3F, 0xFF, 
+  0xFD, 0xFA, 0x55, 0x00, 0x00, 0xFE, 0x55, 0x04, 0x7F, 0xFF, 0xFF, 0xFC, 
+  0x03, 0xFD, 0xFF, 0xFF, 0x55, 0x00, 0x57, 0xC4, 0xFF, 0x00, 0xE2, 0xFD, 
+  0x22, 0x0A, 0x23, 0xFF, 0xFF, 0xA2, 0x3F, 0xBF, 0x22, 0x00, 0x1F, 0xFF, 
+  0xF8, 0xF9, 0x00, 0x02, 0x3B, 0xBB, 0xBB, 0xFE, 0xFF, 0x01, 0xF8, 0x07, 
+  0xFD, 0xFF, 0x02, 0xFB, 0xBB, 0xBB, 0xC4, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 
+  0xFF, 0xFF, 0x07, 0xD5, 0x5F, 0x7F, 0x55, 0x50, 0x1F, 0xFF, 0xF5, 0xFA, 
+  0x55, 0x00, 0x00, 0xFE, 0x55, 0x04, 0x7F, 0xFF, 0xFF, 0xF0, 0x07, 0xFD, 
+  0xFF, 0x02, 0xD5, 0x55, 0x55, 0xC4, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x0A, 
+  0x8B, 0xFF, 0xFF, 0xC8, 0xBF, 0xBF, 0x88, 0x80, 0x0F, 0xFF, 0xF8, 0xF9, 
+  0x00, 0x02, 0x2A, 0xAA, 0xAA, 0xFE, 0xFF, 0x01, 0xE0, 0x0F, 0xBD, 0xFF, 
+  0x00, 0xD5, 0xFC, 0x55, 0x09, 0xFF, 0x7F, 0xD5, 0x7F, 0x5F, 0x55, 0x50, 
+  0x07, 0xFF, 0xF5, 0xFA, 0x55, 0x08, 0x00, 0x15, 0x55, 0x55, 0x7F, 0xFF, 
+  0xFF, 0xC0, 0x1F, 0xFD, 0xFF, 0x02, 0xF5, 0x55, 0x57, 0xC4, 0xFF, 0x00, 
+  0xE2, 0xFD, 0x22, 0x0A, 0x23, 0xFA, 0x3F, 0xA2, 0x7F, 0xFF, 0xA2, 0x20, 
+  0x03, 0xFF, 0xF0, 0xF9, 0x00, 0x02, 0x3B, 0xBB, 0xBB, 0xFE, 0xFF, 0x01, 
+  0x80, 0x3F, 0xFC, 0xFF, 0xFF, 0xBB, 0xC4, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 
+  0x09, 0xFD, 0x5F, 0xD5, 0x7F, 0xFF, 0xD5, 0x54, 0x01, 0xFF, 0xF5, 0xFB, 
+  0x55, 0x09, 0x54, 0x00, 0x15, 0x55, 0x55, 0x7F, 0xFF, 0xFF, 0x00, 0x7F, 
+  0xFD, 0xFF, 0x02, 0xFD, 0x55, 0x55, 0xC4, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 
+  0x0A, 0x8B, 0xF8, 0x9F, 0xC8, 0xFF, 0xFF, 0xC8, 0x88, 0x00, 0xFF, 0xE0, 
+  0xF9, 0x00, 0x02, 0x2A, 0xAA, 0xAA, 0xFE, 0xFF, 0x00, 0x00, 0xBC, 0xFF, 
+  0x00, 0xD5, 0xFC, 0x55, 0x09, 0xFD, 0x5F, 0xD5, 0xFF, 0xFF, 0xD5, 0x55, 
+  0x00, 0x7F, 0xD5, 0xFB, 0x55, 0x08, 0x50, 0x00, 0x15, 0x55, 0x55, 0x7F, 
+  0xFF, 0xFE, 0x01, 0xFB, 0xFF, 0x01, 0x55, 0x57, 0xC4, 0xFF, 0x00, 0xE2, 
+  0xFD, 0x22, 0x0A, 0x23, 0xFA, 0x3F, 0xA3, 0xFF, 0xBF, 0xE2, 0x22, 0x00, 
+  0x3F, 0x80, 0xF9, 0x00, 0x06, 0x3B, 0xBB, 0xBB, 0xFF, 0xFF, 0xF8, 0x03, 
+  0xFB, 0xFF, 0x01, 0xFB, 0xBB, 0xC4, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x09, 
+  0xFD, 0x5F, 0xD5, 0xFD, 0x57, 0xF5, 0x55, 0x40, 0x1F, 0xD5, 0xFB, 0x55, 
+  0x01, 0x50, 0x00, 0xFE, 0x55, 0x03, 0x7F, 0xFF, 0xF0, 0x07, 0xFB, 0xFF, 
+  0x01, 0xF5, 0x55, 0xC4, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x0A, 0x8B, 0xF8, 
+  0x9F, 0xCB, 0xF8, 0x8F, 0xF8, 0x88, 0x80, 0x0F, 0x80, 0xF9, 0x00, 0x06, 
+  0x2A, 0xAA, 0xAA, 0xFF, 0xFF, 0xE0, 0x0F, 0xBC, 0xFF, 0x00, 0xD5, 0xF5, 
+  0x55, 0x01, 0x50, 0x07, 0xFA, 0x55, 0x01, 0x40, 0x00, 0xFE, 0x55, 0x03, 
+  0x7F, 0xFF, 0xC0, 0x1F, 0xFB, 0xFF, 0x01, 0xFD, 0x57, 0xC4, 0xFF, 0x00, 
+  0xE2, 0xF5, 0x22, 0x01, 0x20, 0x01, 0xF8, 0x00, 0x06, 0x3B, 0xBB, 0xBB, 
+  0xFF, 0xFF, 0x80, 0x3F, 0xFA, 0xFF, 0x00, 0xBB, 0xC4, 0xFF, 0x00, 0xD5, 
+  0xF5, 0x55, 0x01, 0x54, 0x00, 0xFA, 0x55, 0xFF, 0x00, 0xFE, 0x55, 0x03, 
+  0x7F, 0xFF, 0x00, 0x7F, 0xFA, 0xFF, 0x00, 0x55, 0xC4, 0xFF, 0x00, 0xE8, 
+  0xF4, 0x88, 0xF7, 0x00, 0x05, 0x2A, 0xAA, 0xAA, 0xFF, 0xFE, 0x00, 0xBB, 
+  0xFF, 0x00, 0xD5, 0xF4, 0x55, 0x01, 0x00, 0x15, 0xFC, 0x55, 0x02, 0x54, 
+  0x00, 0x00, 0xFE, 0x55, 0x02, 0x7F, 0xF4, 0x01, 0xF9, 0xFF, 0x00, 0xD7, 
+  0xC4, 0xFF, 0x00, 0xE2, 0xF4, 0x22, 0xF7, 0x00, 0x05, 0x3B, 0xBB, 0xBB, 
+  0xFF, 0xF0, 0x03, 0xF9, 0xFF, 0x00, 0xFB, 0xC4, 0xFF, 0x00, 0xD5, 0xF4, 
+  0x55, 0x01, 0x40, 0x05, 0xFC, 0x55, 0x02, 0x40, 0x00, 0x00, 0xFE, 0x55, 
+  0x02, 0xFF, 0xC0, 0x07, 0xF9, 0xFF, 0x00, 0xF5, 0xC4, 0xFF, 0x00, 0xE8, 
+  0xF4, 0x88, 0x00, 0x80, 0xF8, 0x00, 0xFF, 0xAA, 0x03, 0xAB, 0xFF, 0x80, 
+  0x0F, 0xBB, 0xFF, 0x00, 0xD5, 0xF4, 0x55, 0x01, 0x50, 0x00, 0xFC, 0x55, 
+  0xFF, 0x00, 0x00, 0x01, 0xFE, 0x55, 0x02, 0xFF, 0x00, 0x1F, 0xBB, 0xFF, 
+  0x00, 0xE2, 0xF3, 0x22, 0xF9, 0x00, 0x00, 0x01, 0xFE, 0xBB, 0x02, 0xF8, 
+  0x00, 0x7F, 0xBB, 0xFF, 0x00, 0xD5, 0xF3, 0x55, 0x01, 0x00, 0x05, 0xFE, 
+  0x55, 0x03, 0x54, 0x00, 0x00, 0x01, 0xFE, 0x55, 0x01, 0xF0, 0x01, 0xBA, 
+  0xFF, 0x00, 0xE8, 0xF3, 0x88, 0x00, 0x80, 0xFA, 0x00, 0x05, 0x02, 0xAA, 
+  0xAA, 0xAB, 0xC0, 0x03, 0xBA, 0xFF, 0x00, 0xD5, 0xF3, 0x55, 0x01, 0x50, 
+  0x01, 0xFE, 0x55, 0x08, 0x40, 0x00, 0x00, 0x05, 0x55, 0x55, 0x57, 0x00, 
+  0x07, 0xBA, 0xFF, 0x00, 0xE2, 0xF3, 0x22, 0x00, 0x20, 0xFA, 0x00, 0x05, 
+  0x03, 0xBB, 0xBB, 0xBA, 0x00, 0x1F, 0xBA, 0xFF, 0x00, 0xD5, 0xF3, 0x55, 
+  0x04, 0x54, 0x00, 0x05, 0x55, 0x54, 0xFE, 0x00, 0x05, 0x05, 0x55, 0x55, 
+  0x50, 0x00, 0x5D, 0xF7, 0xDD, 0xC4, 0xFF, 0x00, 0xE8, 0xF3, 0x88, 0xE9, 
+  0x00, 0x00, 0x0F, 0xC5, 0xFF, 0x00, 0xD5, 0xF4, 0x55, 0x00, 0x54, 0xE9, 
+  0x00, 0x01, 0x01, 0x7F, 0xC6, 0xFF, 0x00, 0xE2, 0xFD, 0x22, 0x05, 0x23, 
+  0xFA, 0x3F, 0xA2, 0x23, 0xF2, 0xFE, 0x22, 0x00, 0x20, 0xE8, 0x00, 0x00, 
+  0x3F, 0xC6, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x04, 0xFD, 0x5F, 0xD5, 0x57, 
+  0xF5, 0xFE, 0x55, 0x00, 0x40, 0xE8, 0x00, 0x00, 0x1F, 0xC6, 0xFF, 0x00, 
+  0xE8, 0xFD, 0x88, 0x05, 0x8B, 0xF8, 0x9F, 0xC8, 0x8F, 0xF8, 0xFE, 0x88, 
+  0xE7, 0x00, 0x00, 0x07, 0xC6, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x04, 0xFD, 
+  0x5F, 0xD5, 0x57, 0xFD, 0xFE, 0x55, 0xE7, 0x00, 0x00, 0x01, 0xC6, 0xFF, 
+  0x00, 0xE2, 0xFD, 0x22, 0x05, 0x23, 0xFA, 0x3F, 0xA2, 0x2F, 0xFA, 0xFE, 
+  0x22, 0xE7, 0x00, 0x00, 0x01, 0xC6, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x07, 
+  0xFD, 0x5F, 0xD5, 0x57, 0xFD, 0x55, 0x55, 0x54, 0xE6, 0x00, 0x00, 0x7F, 
+  0xC7, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x05, 0x8B, 0xF8, 0x9F, 0xC8, 0x8F, 
+  0xFE, 0xFE, 0x88, 0xE6, 0x00, 0x00, 0x7F, 0xC7, 0xFF, 0x00, 0xD5, 0xFC, 
+  0x55, 0x07, 0xFD, 0x5F, 0xD5, 0x5F, 0xFF, 0x55, 0x55, 0x50, 0xE6, 0x00, 
+  0x00, 0x7F, 0xC7, 0xFF, 0x00, 0xE2, 0xFD, 0x22, 0x08, 0x23, 0xFF, 0xFF, 
+  0xA2, 0x3F, 0xFE, 0x22, 0x22, 0x20, 0xE6, 0x00, 0x00, 0x3F, 0xC7, 0xFF, 
+  0x00, 0xD5, 0xFC, 0x55, 0xFF, 0xFF, 0x05, 0xD5, 0x5F, 0x7F, 0x55, 0x55, 
+  0x40, 0xE6, 0x00, 0x00, 0x1F, 0xC7, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x08, 
+  0x8B, 0xFF, 0xFF, 0xC8, 0xBF, 0xBF, 0x88, 0x88, 0x80, 0xE6, 0x00, 0x00, 
+  0x0F, 0xC7, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0xFF, 0xFF, 0x05, 0xD5, 0x7F, 
+  0x7F, 0x55, 0x55, 0x40, 0xE6, 0x00, 0x00, 0x0F, 0xC7, 0xFF, 0x00, 0xE2, 
+  0xFD, 0x22, 0x07, 0x23, 0xFF, 0xFF, 0xA2, 0x7F, 0x3F, 0xA2, 0x22, 0xE5, 
+  0x00, 0x00, 0x0F, 0xC7, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x07, 0xFD, 0x5F, 
+  0xD5, 0x7F, 0xFF, 0xD5, 0x55, 0x40, 0xF3, 0x00, 0x00, 0x01, 0xF5, 0x00, 
+  0x00, 0x07, 0xC7, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x08, 0x8B, 0xF8, 0x9F, 
+  0xC8, 0xFF, 0xFF, 0xC8, 0x88, 0x80, 0xFC, 0x00, 0x01, 0x40, 0x80, 0xFA, 
+  0x00, 0x01, 0x03, 0x80, 0xFD, 0x00, 0x01, 0x08, 0x30, 0xFC, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xD5, 0xFC, 0x55, 0x06, 0xFD, 0x5F, 0xD5, 0x7F, 
+  0xFF, 0xD5, 0x55, 0xFC, 0x00, 0x02, 0x01, 0x75, 0xC0, 0xFA, 0x00, 0x00, 
+  0x17, 0xFC, 0x00, 0x01, 0x1D, 0x70, 0xFC, 0x00, 0x00, 0x07, 0xC7, 0xFF, 
+  0x00, 0xE2, 0xFD, 0x22, 0x07, 0x23, 0xFA, 0x3F, 0xA2, 0xFF, 0xFF, 0xE2, 
+  0x22, 0xFB, 0x00, 0x01, 0x7F, 0x80, 0xFA, 0x00, 0x01, 0x3F, 0x80, 0xFD, 
+  0x00, 0x01, 0x1F, 0xF0, 0xFC, 0x00, 0x00, 0x07, 0xC7, 0xFF, 0x00, 0xD5, 
+  0xFC, 0x55, 0x06, 0xFD, 0x5F, 0xD5, 0xFD, 0x57, 0xD5, 0x55, 0xFB, 0x00, 
+  0x00, 0x5F, 0xF9, 0x00, 0x00, 0x3D, 0xFC, 0x00, 0x01, 0x07, 0xC0, 0xFC, 
+  0x00, 0x00, 0x07, 0xC7, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x07, 0x8B, 0xF8, 
+  0x9F, 0xC9, 0xF8, 0x8F, 0xE8, 0x88, 0xFB, 0x00, 0x00, 0x0E, 0xF9, 0x00, 
+  0x00, 0x38, 0xFC, 0x00, 0x01, 0x03, 0x80, 0xFC, 0x00, 0x00, 0x07, 0xC7, 
+  0xFF, 0x00, 0xF5, 0xFC, 0x55, 0x06, 0xFD, 0x5F, 0xD5, 0xF5, 0x57, 0xF5, 
+  0x55, 0xE5, 0x00, 0x00, 0x07, 0xC7, 0xFF, 0x00, 0xE2, 0xFD, 0x22, 0x07, 
+  0x23, 0xBA, 0x3B, 0xA3, 0xBA, 0x23, 0xB2, 0x22, 0xFE, 0x00, 0x19, 0xAA, 
+  0x80, 0x02, 0xAA, 0x00, 0x02, 0xAA, 0xA0, 0x0A, 0x00, 0x28, 0x00, 0x0A, 
+  0x00, 0x02, 0x80, 0x0A, 0x00, 0x2A, 0xAA, 0x00, 0x2A, 0xA8, 0x00, 0x00, 
+  0x03, 0xC7, 0xFF, 0x00, 0xF5, 0xF5, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 
+  0xF0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0x1F, 
+  0x00, 0x07, 0xC0, 0x1F, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xE8, 0xF5, 0x88, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 
+  0xF8, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x0F, 0x80, 0xFC, 0x00, 0x1F, 
+  0x80, 0x07, 0xE0, 0x1F, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xF5, 0xF5, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 
+  0xFC, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x1F, 0x00, 0x7C, 0x00, 0x3F, 
+  0x00, 0x07, 0xF0, 0x1F, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xF2, 0xF5, 0x22, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 
+  0xFE, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x0F, 0x80, 0xF8, 0x00, 0x3F, 
+  0x80, 0x07, 0xF8, 0x1F, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xF8, 0x00, 0x00, 
+  0x03, 0xC7, 0xFF, 0x00, 0xF5, 0xF5, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xF0, 
+  0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x7F, 
+  0xC0, 0x07, 0xFC, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xF8, 0xF5, 0x88, 0xFF, 0x00, 0x1A, 0x01, 0xF0, 
+  0x3E, 0x03, 0xE0, 0x7C, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0xFC, 0x00, 0x7F, 
+  0xC0, 0x07, 0xFC, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xFD, 0xF5, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xF0, 
+  0x3E, 0x03, 0xC0, 0x7C, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x7F, 
+  0xC0, 0x07, 0xFE, 0x1F, 0x00, 0x78, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xFE, 0xF5, 0x22, 0xFF, 0x00, 0x1A, 0x01, 0xF0, 
+  0x3E, 0x03, 0xE0, 0x7C, 0x03, 0xE2, 0x00, 0x0F, 0xA2, 0xF8, 0x00, 0xFB, 
+  0xE0, 0x07, 0xFF, 0x1F, 0x00, 0xFA, 0x20, 0x00, 0x07, 0xC0, 0x00, 0x00, 
+  0x03, 0xC7, 0xFF, 0x00, 0xFD, 0xF5, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xF4, 
+  0x7C, 0x07, 0xC0, 0x7C, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x01, 0xF1, 
+  0xE0, 0x07, 0xDF, 0x1F, 0x00, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x00, 
+  0x07, 0xC7, 0xFF, 0x00, 0xFE, 0xF5, 0x88, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 
+  0xFC, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x00, 0xF1, 
+  0xE0, 0x07, 0xCF, 0x9F, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 
+  0x07, 0xC6, 0xFF, 0xF5, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 0xFC, 0x03, 
+  0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFC, 0x01, 0xF1, 0xF0, 0x07, 
+  0xC7, 0xDF, 0x00, 0x7F, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC6, 
+  0xFF, 0x00, 0xA2, 0xF6, 0x22, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 0xF8, 0x03, 
+  0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x03, 0xE1, 0xF0, 0x07, 
+  0xC7, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x03, 0xC6, 
+  0xFF, 0x00, 0xD5, 0xF6, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xFF, 0xF0, 0x07, 
+  0xFF, 0xC0, 0x07, 0xC0, 0x00, 0x1F, 0x44, 0x7C, 0x01, 0xF5, 0xF0, 0x07, 
+  0xC7, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC6, 
+  0xFF, 0x00, 0xC8, 0xF6, 0x88, 0xFF, 0x00, 0x1A, 0x01, 0xF8, 0x80, 0x03, 
+  0xE3, 0xE0, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0xFC, 0x03, 0xFF, 0xF8, 0x07, 
+  0xC3, 0xFF, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC6, 
+  0xFF, 0x00, 0xD5, 0xF6, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xF0, 0x00, 0x03, 
+  0xC3, 0xF0, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x7C, 0x07, 0xFF, 0xFC, 0x07, 
+  0xC1, 0xFF, 0x00, 0x78, 0x00, 0x01, 0x07, 0xC0, 0x00, 0x00, 0x07, 0xC6, 
+  0xFF, 0x00, 0xF2, 0xF6, 0x22, 0xFF, 0x00, 0x1A, 0x01, 0xF0, 0x00, 0x03, 
+  0xE1, 0xF0, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0xF8, 0x07, 0xFF, 0xFC, 0x07, 
+  0xC0, 0xFF, 0x00, 0xF8, 0x00, 0x03, 0x8F, 0x80, 0x00, 0x00, 0x03, 0xC6, 
+  0xFF, 0x00, 0xF5, 0xF6, 0x55, 0xFF, 0x00, 0x1A, 0x01, 0xF0, 0x00, 0x07, 
+  0xC1, 0xF8, 0x07, 0xFF, 0xF0, 0x1F, 0x00, 0x7C, 0x07, 0xD5, 0x7C, 0x07, 
+  0xC0, 0x7F, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xC6, 
+  0xFF, 0x00, 0xFE, 0xF6, 0x88, 0xFF, 0x00, 0x1A, 0x01, 0xF8, 0x00, 0x03, 
+  0xE0, 0xF8, 0x03, 0xFF, 0xF8, 0x0F, 0x80, 0xFC, 0x0F, 0x80, 0x3E, 0x07, 
+  0xC0, 0x3F, 0x00, 0xFF, 0xFE, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xC5, 
+  0xFF, 0xF6, 0x55, 0xFF, 0x00, 0x16, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x7C, 
+  0x07, 0xFF, 0xF0, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x07, 0xC0, 0x3F, 
+  0x00, 0x7F, 0xFE, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xC5, 0xFF, 0x00, 
+  0xA2, 0xF7, 0x22, 0xFF, 0x00, 0x16, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x7E, 
+  0x03, 0xFF, 0xF0, 0x0F, 0x80, 0xF8, 0x1F, 0x00, 0x3E, 0x07, 0xC0, 0x1F, 
+  0x00, 0xFF, 0xFE, 0x01, 0xFE, 0xFE, 0x00, 0x00, 0x03, 0xC5, 0xFF, 0x00, 
+  0xD5, 0xF7, 0x55, 0xFF, 0x00, 0x16, 0x01, 0x50, 0x00, 0x01, 0x40, 0x54, 
+  0x05, 0x55, 0x50, 0x05, 0x00, 0x54, 0x15, 0x00, 0x14, 0x05, 0x40, 0x15, 
+  0x00, 0x55, 0x54, 0x00, 0x54, 0xFE, 0x00, 0x00, 0x07, 0xC5, 0xFF, 0x00, 
+  0xF8, 0xF7, 0x88, 0x00, 0x80, 0xE6, 0x00, 0x00, 0x07, 0xC5, 0xFF, 0x00, 
+  0xFD, 0xF7, 0x55, 0xE5, 0x00, 0x00, 0x07, 0xC4, 0xFF, 0x00, 0xA2, 0xF8, 
+  0x22, 0xE5, 0x00, 0x00, 0x07, 0xC4, 0xFF, 0x00, 0xFD, 0xF8, 0x55, 0x00, 
+  0x40, 0xE6, 0x00, 0x00, 0x07, 0xC2, 0xFF, 0x00, 0xE8, 0xFD, 0x88, 0x03, 
+  0xBF, 0xFF, 0xFF, 0xC0, 0xE6, 0x00, 0x00, 0x0F, 0xC2, 0xFF, 0x00, 0xF5, 
+  0xFD, 0x55, 0x03, 0x7F, 0xFF, 0xFF, 0xC0, 0xE6, 0x00, 0x00, 0x07, 0xC2, 
+  0xFF, 0x00, 0xE2, 0xFD, 0x22, 0xFE, 0xFF, 0x00, 0xE0, 0xE6, 0x00, 0x00, 
+  0x0F, 0xC2, 0xFF, 0x00, 0xD5, 0xFD, 0x55, 0xFE, 0xFF, 0x00, 0xE0, 0xE6, 
+  0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x00, 0xE8, 0xFE, 0x88, 0x00, 0x8F, 0xFE, 
+  0xFF, 0x00, 0xF0, 0xE6, 0x00, 0x00, 0x1F, 0xC2, 0xFF, 0x00, 0xF5, 0xFE, 
+  0x55, 0x00, 0x57, 0xFE, 0xFF, 0x00, 0xF0, 0xE6, 0x00, 0x00, 0x3F, 0xC2, 
+  0xFF, 0x00, 0xE2, 0xFE, 0x22, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0xF8, 0xE6, 
+  0x00, 0x00, 0x3F, 0xC2, 0xFF, 0x00, 0xD5, 0xFE, 0x55, 0x00, 0x5F, 0xFE, 
+  0xFF, 0x00, 0xFC, 0xE6, 0x00, 0x00, 0x7F, 0xC2, 0xFF, 0x00, 0xE8, 0xFE, 
+  0x88, 0xFD, 0xFF, 0x00, 0xFE, 0xE6, 0x00, 0xC1, 0xFF, 0x00, 0xF5, 0xFE, 
+  0x55, 0x00, 0x7F, 0xFD, 0xFF, 0xE7, 0x00, 0x00, 0x01, 0xC1, 0xFF, 0x03, 
+  0xE2, 0x22, 0x22, 0x23, 0xFC, 0xFF, 0x00, 0x80, 0xE8, 0x00, 0x00, 0x03, 
+  0xC1, 0xFF, 0x00, 0xD5, 0xFE, 0x55, 0xFC, 0xFF, 0x00, 0xC0, 0xE8, 0x00, 
+  0x00, 0x07, 0xC1, 0xFF, 0x03, 0xE8, 0x88, 0x88, 0x8F, 0xFC, 0xFF, 0x00, 
+  0xE0, 0xE8, 0x00, 0x00, 0x1F, 0xC1, 0xFF, 0x03, 0xF5, 0x55, 0x55, 0x57, 
+  0xFC, 0xFF, 0x00, 0xF4, 0xE8, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0x03, 0xE2, 
+  0x22, 0x22, 0x3F, 0xFB, 0xFF, 0xE9, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0x03, 
+  0xD5, 0x55, 0x55, 0x7F, 0xFB, 0xFF, 0x00, 0xF5, 0xF2, 0x55, 0x00, 0x50, 
+  0xFE, 0x00, 0x00, 0x05, 0xFE, 0x55, 0x00, 0x5F, 0xC0, 0xFF, 0x02, 0xE8, 
+  0x88, 0x88, 0xEA, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x0F, 0xBC, 0xFF, 
+  0x03, 0xF5, 0x55, 0x55, 0x7F, 0xEA, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xBC, 
+  0xFF, 0x02, 0xE2, 0x22, 0x23, 0xE9, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xBC, 
+  0xFF, 0x02, 0xD5, 0x55, 0x57, 0xE9, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x0F, 
+  0xBC, 0xFF, 0x02, 0xE8, 0x88, 0x8F, 0xE9, 0xFF, 0x03, 0xC0, 0x00, 0x00, 
+  0x0F, 0xBC, 0xFF, 0x02, 0xF5, 0x55, 0x5F, 0xE9, 0xFF, 0x03, 0xF0, 0x00, 
+  0x00, 0x0F, 0xBC, 0xFF, 0x02, 0xE2, 0x22, 0x3F, 0xE9, 0xFF, 0x03, 0xF0, 
+  0x00, 0x00, 0x0F, 0xBC, 0xFF, 0x02, 0xD5, 0x55, 0x7F, 0xE9, 0xFF, 0x03, 
+  0xFC, 0x00, 0x00, 0x0F, 0xBC, 0xFF, 0x01, 0xE8, 0x88, 0xE8, 0xFF, 0x03, 
+  0xFE, 0x00, 0x00, 0x0F, 0xBC, 0xFF, 0x01, 0xF5, 0x55, 0xE7, 0xFF, 0xFF, 
+  0x00, 0x00, 0x0F, 0xBC, 0xFF, 0x01, 0xE2, 0x23, 0xE7, 0xFF, 0x02, 0x80, 
+  0x00, 0x0F, 0xBC, 0xFF, 0x01, 0xD5, 0x57, 0xE7, 0xFF, 0x02, 0xC0, 0x00, 
+  0x0F, 0xBC, 0xFF, 0x01, 0xE8, 0x8F, 0xE7, 0xFF, 0x02, 0xE0, 0x00, 0x0F, 
+  0xBC, 0xFF, 0x01, 0xF5, 0x5F, 0xE7, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xBC, 
+  0xFF, 0x01, 0xE2, 0x3F, 0xE7, 0xFF, 0x02, 0xF8, 0x00, 0x0F, 0xBC, 0xFF, 
+  0x01, 0xD5, 0x7F, 0xE7, 0xFF, 0x02, 0xFC, 0x00, 0x0F, 0xBC, 0xFF, 0x00, 
+  0xE8, 0xE6, 0xFF, 0x02, 0xFE, 0x00, 0x0F, 0xBC, 0xFF, 0x00, 0xF5, 0xE5, 
+  0xFF, 0x01, 0x00, 0x0F, 0xBC, 0xFF, 0x00, 0xE3, 0xE5, 0xFF, 0x01, 0x80, 
+  0x0F, 0xBC, 0xFF, 0x00, 0xD7, 0xE5, 0xFF, 0x01, 0xC0, 0x0F, 0xBC, 0xFF, 
+  0x00, 0xEF, 0xE5, 0xFF, 0x01, 0xE0, 0x0F, 0x9F, 0xFF, 0x01, 0xF0, 0x0F, 
+  0x9F, 0xFF, 0x01, 0xFC, 0x0F, 0x9F, 0xFF, 0x01, 0xFC, 0x0F, 0x9E, 0xFF, 
+  0x00, 0x0F, 0x9E, 0xFF, 0x00, 0x0F, 0x9E, 0xFF, 0x00, 0xCF, 0x81, 0xFF, 
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0xE5, 0xFF
+ };
+
+const PackedImage LOGO_IMAGE = {800, 480, LOGO_PACKED, sizeof(LOGO_PACKED)};
+
+// image.h 'dr_mario', 263x280: 9240 -> 3843 bytes
+const uint8_t DR_MARIO_PACKED[] PROGMEM = {
+  0x81, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0xE9, 0xFF, 0x01, 0xFE, 0xD9, 0xE2, 
+  0xFF, 0x02, 0xF7, 0xB7, 0xBF, 0xE3, 0xFF, 0x02, 0xFD, 0x6F, 0xEF, 0xE3, 
+  0xFF, 0x02, 0xFB, 0x6B, 0x77, 0xE3, 0xFF, 0x01, 0xCE, 0xDB, 0xE3, 0xFF, 
+  0x03, 0xFE, 0xF5, 0xB6, 0xFB, 0xE3, 0xFF, 0x02, 0xF7, 0x6F, 0xFD, 0xE3, 
+  0xFF, 0x02, 0xDB, 0x6B, 0x6F, 0xE6, 0xFF, 0x05, 0xF0, 0x7F, 0xFF, 0xFB, 
+  0x7B, 0xBE, 0xE6, 0xFF, 0x05, 0xE0, 0x1F, 0xFE, 0xED, 0x9E, 0xD6, 0xE6, 
+  0xFF, 0x05, 0xC4, 0x87, 0xFB, 0x3D, 0xE6, 0xDB, 0xE6, 0xFF, 0x06, 0xC0, 
+  0x20, 0xED, 0xF6, 0x7B, 0x6E, 0x7F, 0xE7, 0xFF, 0x05, 0xC9, 0x08, 0x3D, 
+  0x9B, 0x9D, 0xB7, 0xE6, 0xFF, 0x05, 0xC0, 0x41, 0x36, 0xEE, 0xD6, 0xD9, 
+  0xE6, 0xFF, 0x06, 0xC2, 0x10, 0x76, 0xEC, 0x1B, 0x6F, 0x7F, 0xE7, 0xFF, 
+  0x06, 0xE0, 0x04, 0x7B, 0x36, 0x0D, 0xBF, 0x4F, 0xE7, 0xFF, 0x06, 0xE0, 
+  0x41, 0x4D, 0xDA, 0x0F, 0xF3, 0x80, 0xE7, 0xFF, 0x07, 0xF1, 0x00, 0x76, 
+  0xDE, 0x1B, 0x7E, 0x80, 0x0F, 0xE8, 0xFF, 0x07, 0xF0, 0x08, 0xFB, 0xB6, 
+  0x5F, 0xDE, 0x91, 0x00, 0xE8, 0xFF, 0x02, 0xF0, 0x00, 0x5F, 0xFE, 0xFF, 
+  0x02, 0x84, 0x10, 0x3F, 0xE9, 0xFF, 0x08, 0xF8, 0x40, 0x76, 0xFF, 0xFF, 
+  0xFE, 0x00, 0x41, 0x1F, 0xE9, 0xFF, 0x02, 0xF8, 0x02, 0x7F, 0xFE, 0xFF, 
+  0x02, 0x10, 0x04, 0x0F, 0xE9, 0xFF, 0x08, 0xF8, 0x80, 0x5F, 0xFF, 0x7F, 
+  0xFD, 0x02, 0x10, 0x43, 0xE9, 0xFF, 0x08, 0xF8, 0x08, 0x7F, 0xFF, 0xFF, 
+  0xFC, 0x20, 0x81, 0x03, 0xE9, 0xFF, 0x08, 0xF8, 0x00, 0x3F, 0xFF, 0xEF, 
+  0xFC, 0x08, 0x20, 0x20, 0xE9, 0xFF, 0x09, 0xF8, 0x90, 0x2F, 0xFF, 0x7F, 
+  0xF8, 0x00, 0x08, 0x88, 0x7F, 0xEA, 0xFF, 0x09, 0xF8, 0x01, 0x1F, 0xFF, 
+  0xFF, 0xF0, 0x00, 0x42, 0x00, 0x3F, 0xEA, 0xFF, 0x09, 0xFC, 0x00, 0x17, 
+  0xFF, 0xFF, 0xF0, 0x42, 0x00, 0x44, 0x8F, 0xEA, 0xFF, 0x09, 0xFC, 0x44, 
+  0x0F, 0xFF, 0xFF, 0xC1, 0x08, 0x00, 0x10, 0x0F, 0xEA, 0xFF, 0x09, 0xFE, 
+  0x00, 0x47, 0xFE, 0xEF, 0x00, 0x01, 0x22, 0x02, 0x07, 0xEA, 0xFF, 0x09, 
+  0xFE, 0x08, 0x03, 0xFF, 0xFD, 0x82, 0x10, 0x08, 0x00, 0x97, 0xEA, 0xFF, 
+  0x09, 0xFE, 0x20, 0x00, 0xFF, 0xBC, 0x80, 0x00, 0x01, 0x20, 0x03, 0xEA, 
+  0xFF, 0x09, 0xFC, 0x01, 0x20, 0x6D, 0xE2, 0x00, 0x00, 0x40, 0x08, 0x23, 
+  0xEA, 0xFF, 0x09, 0xF8, 0x40, 0x00, 0x0D, 0x2B, 0x00, 0x84, 0x02, 0x42, 
+  0x03, 0xEA, 0xFF, 0x05, 0xF8, 0x04, 0x04, 0x62, 0x09, 0xFC, 0xFE, 0x00, 
+  0x00, 0x81, 0xEA, 0xFF, 0x09, 0xF9, 0x01, 0x00, 0x1A, 0xF6, 0x6E, 0x11, 
+  0x90, 0x00, 0x10, 0xEA, 0xFF, 0x09, 0xFC, 0x10, 0x11, 0xDB, 0xB7, 0xB0, 
+  0x80, 0x64, 0x02, 0x40, 0xEA, 0xFF, 0x0A, 0xFC, 0x04, 0x07, 0x6D, 0xBD, 
+  0xE0, 0x00, 0x3F, 0x20, 0x08, 0x3F, 0xEB, 0xFF, 0x0A, 0xFE, 0x40, 0x03, 
+  0xFF, 0x6F, 0x40, 0x00, 0x1B, 0x80, 0x02, 0x3F, 0xEA, 0xFF, 0x09, 0x00, 
+  0x81, 0xB6, 0xFB, 0xC0, 0x00, 0x0C, 0xE0, 0x00, 0x1F, 0xEA, 0xFF, 0x09, 
+  0x84, 0x08, 0xEF, 0xBE, 0x80, 0x00, 0x0F, 0x79, 0x01, 0x0F, 0xEA, 0xFF, 
+  0x09, 0xE0, 0x00, 0xFB, 0xE7, 0x00, 0xFF, 0x87, 0x5C, 0x20, 0x0F, 0xEA, 
+  0xFF, 0x09, 0xE4, 0x00, 0x5E, 0x7D, 0x03, 0xBF, 0xF5, 0xD6, 0x00, 0x4F, 
+  0xEA, 0xFF, 0x09, 0xE0, 0x00, 0x77, 0xDE, 0x0F, 0xE6, 0xFD, 0xF6, 0x04, 
+  0x0F, 0xEA, 0xFF, 0x09, 0xE1, 0xB0, 0x3D, 0xF6, 0x3F, 0xFD, 0xBB, 0x3B, 
+  0x00, 0x0F, 0xEA, 0xFF, 0x09, 0xE3, 0xFC, 0x3B, 0x78, 0x31, 0xFD, 0xEF, 
+  0xCD, 0x10, 0x07, 0xEA, 0xFF, 0x09, 0xE6, 0xDE, 0x1F, 0xCC, 0xC4, 0x7E, 
+  0xED, 0xFD, 0x01, 0x07, 0xEA, 0xFF, 0x09, 0xF7, 0xBE, 0x16, 0xFC, 0x92, 
+  0x7E, 0xFD, 0x37, 0x08, 0x27, 0xEA, 0xFF, 0x09, 0xE7, 0x79, 0x9F, 0xB5, 
+  0x91, 0x3F, 0x9F, 0xF6, 0x20, 0x0F, 0xEA, 0xFF, 0x09, 0xF7, 0x70, 0x4D, 
+  0xFF, 0x04, 0x9E, 0xF3, 0xBB, 0x04, 0x07, 0xEA, 0xFF, 0x09, 0xF7, 0xF4, 
+  0x5D, 0xCC, 0x4C, 0x5F, 0xFE, 0xCE, 0x10, 0x8F, 0xEA, 0xFF, 0x09, 0xF6, 
+  0xF3, 0x37, 0x7F, 0x00, 0x5E, 0x6E, 0xFD, 0x00, 0x0F, 0xEA, 0xFF, 0x09, 
+  0xF7, 0x6F, 0xEF, 0x73, 0x00, 0x1F, 0xEF, 0xB6, 0x44, 0x0F, 0xEA, 0xFF, 
+  0x09, 0xF7, 0x7D, 0xFB, 0xDE, 0x40, 0x4F, 0x79, 0xF6, 0x10, 0x8F, 0xEA, 
+  0xFF, 0x09, 0xE7, 0xDF, 0x5E, 0xFD, 0x00, 0x5F, 0x77, 0x58, 0x02, 0x0F, 
+  0xEA, 0xFF, 0x09, 0xFD, 0xF6, 0xF7, 0xA7, 0x04, 0x1E, 0xDF, 0xD8, 0x88, 
+  0x37, 0xEA, 0xFF, 0x0A, 0xE7, 0x7D, 0xBD, 0xBE, 0x40, 0x5E, 0xFA, 0xE2, 
+  0x20, 0x36, 0x7F, 0xEB, 0xFF, 0x0A, 0xEF, 0xCF, 0xEE, 0xFB, 0x00, 0x1F, 
+  0xAF, 0xB8, 0x01, 0x3B, 0x37, 0xEB, 0xFF, 0x0A, 0xEC, 0xFB, 0x7B, 0xDB, 
+  0x81, 0x3D, 0xBD, 0xB0, 0x90, 0xC9, 0x9F, 0xEA, 0xFF, 0x09, 0xBF, 0x77, 
+  0x6E, 0x90, 0x7D, 0xF6, 0xE0, 0x04, 0xF4, 0xCB, 0xEB, 0xFF, 0x0A, 0xDB, 
+  0xED, 0xDD, 0xED, 0xC4, 0xDD, 0x6F, 0xD8, 0x41, 0x96, 0x67, 0xEB, 0xFF, 
+  0x0A, 0xDE, 0xDB, 0xDE, 0xDD, 0x61, 0xF7, 0x69, 0x70, 0x00, 0xDB, 0xB5, 
+  0xEB, 0xFF, 0x0A, 0xF7, 0x7E, 0xF3, 0xB7, 0xB3, 0x76, 0xC3, 0xDC, 0x09, 
+  0x6D, 0xB3, 0xEB, 0xFF, 0x0A, 0xB9, 0xE7, 0x3F, 0x7A, 0xDF, 0xDB, 0x83, 
+  0x6C, 0x01, 0x2F, 0x6E, 0xEB, 0xFF, 0x0A, 0xAF, 0xBD, 0xED, 0xDB, 0x6C, 
+  0xCC, 0x01, 0xBB, 0x04, 0xDB, 0xD9, 0xEB, 0xFF, 0x0A, 0xBE, 0xDD, 0xDB, 
+  0x6D, 0xBB, 0x70, 0x01, 0xDB, 0x81, 0x96, 0xDB, 0xEB, 0xFF, 0x0A, 0xD6, 
+  0xF7, 0x76, 0xED, 0xB7, 0x00, 0x01, 0x76, 0x81, 0x35, 0xB6, 0xEB, 0xFF, 
+  0x0A, 0xDB, 0xB6, 0xDD, 0xB6, 0xCC, 0x00, 0x11, 0xDE, 0x89, 0xED, 0xF7, 
+  0xEB, 0xFF, 0x0A, 0x9B, 0x6D, 0xB7, 0x76, 0xC0, 0x00, 0x01, 0xB3, 0x80, 
+  0xBB, 0x5B, 0xEB, 0xFF, 0x0A, 0x8F, 0x6D, 0xB6, 0xDB, 0x00, 0x00, 0x21, 
+  0xBD, 0x84, 0xDB, 0x7C, 0xEB, 0xFF, 0x0A, 0x8D, 0xBB, 0xDB, 0xA9, 0x80, 
+  0x00, 0x03, 0x6D, 0x81, 0x6F, 0xE7, 0xEB, 0xFF, 0x0A, 0x86, 0xDA, 0x6D, 
+  0xAC, 0x00, 0x00, 0x03, 0x6E, 0xC3, 0x6C, 0xBF, 0xEB, 0xFF, 0x0A, 0x83, 
+  0x6F, 0xB6, 0x76, 0x00, 0x20, 0x06, 0xDB, 0x6E, 0xDF, 0xDB, 0xEB, 0xFF, 
+  0x0A, 0x81, 0xB5, 0xB3, 0x92, 0x01, 0x00, 0x16, 0xDB, 0x69, 0xB6, 0xDB, 
+  0xEB, 0xFF, 0x0A, 0x80, 0xD6, 0x6C, 0xD8, 0x00, 0x01, 0xBD, 0xED, 0xB6, 
+  0xFB, 0xB7, 0xEB, 0xFF, 0x0A, 0xC0, 0x5B, 0x9B, 0x48, 0x04, 0x83, 0xED, 
+  0xB6, 0xDA, 0x5B, 0x6F, 0xEB, 0xFF, 0x0A, 0xE4, 0x09, 0xB3, 0x20, 0x00, 
+  0x01, 0x6F, 0x76, 0xDB, 0x77, 0x6F, 0xEB, 0xFF, 0x0A, 0xF0, 0x06, 0x64, 
+  0x80, 0x00, 0x01, 0xFB, 0x5B, 0x6D, 0x9D, 0xBF, 0xEB, 0xFF, 0x0A, 0xF0, 
+  0x00, 0x00, 0x08, 0x00, 0x07, 0x9B, 0xDB, 0x64, 0xCA, 0xDF, 0xEB, 0xFF, 
+  0x0A, 0xE1, 0x00, 0x80, 0x20, 0x00, 0x06, 0xFC, 0xED, 0x9B, 0x6B, 0x7F, 
+  0xEB, 0xFF, 0x09, 0xF8, 0x04, 0x00, 0x00, 0x30, 0x1F, 0xE7, 0x35, 0xBB, 
+  0x35, 0xEA, 0xFF, 0x09, 0xF8, 0x10, 0x00, 0x00, 0x3F, 0xF9, 0xBF, 0xD6, 
+  0x64, 0x95, 0xEA, 0xFF, 0x09, 0xEC, 0x38, 0x04, 0x00, 0x6D, 0xAF, 0x69, 
+  0x6E, 0xD2, 0xDF, 0xE9, 0xFF, 0x07, 0xE8, 0x0E, 0x43, 0x4E, 0xFF, 0x7F, 
+  0x39, 0x93, 0xE9, 0xFF, 0x08, 0xF7, 0xDE, 0x73, 0xDB, 0x73, 0xD3, 0x96, 
+  0xD6, 0x61, 0xE9, 0xFF, 0x08, 0xFD, 0x77, 0x9D, 0xBD, 0xBF, 0x7C, 0xF4, 
+  0xD6, 0xC1, 0xE9, 0xFF, 0x08, 0xFB, 0xED, 0xED, 0xA6, 0xED, 0xAF, 0xDB, 
+  0x69, 0x00, 0xE9, 0xFF, 0x08, 0xFE, 0xBB, 0x6E, 0x7B, 0xDB, 0xBB, 0x6B, 
+  0x2D, 0x21, 0xE9, 0xFF, 0x08, 0xFB, 0xBE, 0xDB, 0xDF, 0x7B, 0xED, 0xAC, 
+  0xD2, 0x81, 0xE9, 0xFF, 0x08, 0xFD, 0xE7, 0xDB, 0x65, 0xAE, 0x6D, 0xB6, 
+  0xD2, 0x01, 0xE8, 0xFF, 0x07, 0x7D, 0xF6, 0xFF, 0xFB, 0xDB, 0x53, 0x2C, 
+  0x07, 0xFB, 0xFF, 0x00, 0x7F, 0xF0, 0xFF, 0x08, 0xFE, 0xDB, 0x3D, 0x9B, 
+  0x5D, 0xB6, 0x59, 0x20, 0x03, 0xFB, 0xFF, 0x00, 0x3F, 0xEF, 0xFF, 0x07, 
+  0xB7, 0xEF, 0xFE, 0xF7, 0x6D, 0xAC, 0xC8, 0x0F, 0xFD, 0xFF, 0x04, 0xFD, 
+  0xB6, 0xFF, 0xED, 0xB6, 0xF1, 0xFF, 0x07, 0xB5, 0xFB, 0x6E, 0xED, 0xD9, 
+  0xA6, 0x18, 0x5F, 0xFE, 0xFF, 0x09, 0xFD, 0xB7, 0xFE, 0xDB, 0x7F, 0xFF, 
+  0xB7, 0xFF, 0xBF, 0xBF, 0xF5, 0xFF, 0x14, 0xEE, 0x6F, 0xF3, 0xBB, 0x36, 
+  0x51, 0x27, 0xFD, 0xFF, 0xFF, 0x77, 0xEF, 0xBE, 0xDB, 0x7F, 0xDB, 0x6D, 
+  0xFD, 0xB6, 0xED, 0xEF, 0xF5, 0xFF, 0x14, 0xFB, 0xBC, 0xDF, 0x6E, 0xC9, 
+  0x40, 0xF7, 0xB7, 0x6D, 0xF7, 0xDF, 0xFA, 0xEF, 0xFF, 0x66, 0xFF, 0xFF, 
+  0x6E, 0xFF, 0xEF, 0x7F, 0xF5, 0xFF, 0x14, 0xFD, 0xB7, 0x6D, 0xD9, 0xB3, 
+  0x06, 0xDC, 0xFF, 0xFF, 0xF9, 0xFF, 0x7F, 0xF9, 0xB6, 0xDE, 0xE6, 0xDB, 
+  0xFB, 0xDB, 0x3B, 0xDF, 0xFA, 0xFF, 0x01, 0xED, 0xBF, 0xFE, 0xFF, 0x14, 
+  0xFC, 0xDB, 0x6D, 0xB6, 0x64, 0x27, 0xDF, 0xDB, 0xB7, 0xCF, 0x6D, 0xD7, 
+  0x5F, 0xFE, 0xDB, 0xBF, 0xBE, 0xDF, 0x7F, 0xFE, 0xF7, 0xFB, 0xFF, 0x1A, 
+  0x7E, 0xFF, 0xEF, 0x6D, 0xBF, 0xFE, 0xD0, 0x5B, 0xB6, 0x66, 0x98, 0x8D, 
+  0xF3, 0xFE, 0xFF, 0xFD, 0xFF, 0xFD, 0xF6, 0xDD, 0xBB, 0xFB, 0xE7, 0xF5, 
+  0xED, 0xD7, 0xBF, 0xFC, 0xFF, 0x1B, 0xDB, 0xB7, 0x9A, 0xFD, 0xED, 0xFB, 
+  0x6F, 0xB2, 0x66, 0xB3, 0x59, 0xA2, 0x3F, 0x6F, 0x6F, 0xDF, 0xF6, 0xF7, 
+  0xED, 0xBF, 0xF6, 0x6E, 0xDE, 0xFD, 0xBF, 0x7E, 0x7D, 0xBF, 0xFD, 0xFF, 
+  0x1C, 0xFD, 0xFA, 0xFD, 0xFB, 0xBF, 0xB7, 0x7F, 0xF3, 0x78, 0xB4, 0xCD, 
+  0x98, 0xC0, 0x7B, 0xDF, 0xFD, 0xFE, 0xF3, 0xDF, 0xBF, 0xDB, 0x7E, 0xDB, 
+  0xF7, 0xBB, 0x6D, 0xDB, 0xEF, 0x7F, 0xFD, 0xFF, 0x1B, 0x6F, 0x3F, 0x6F, 
+  0x6F, 0xFB, 0xDB, 0xDC, 0xDF, 0xE4, 0x93, 0x28, 0xA6, 0x11, 0xFF, 0xF6, 
+  0xFF, 0xFF, 0xDF, 0xCF, 0xF6, 0xF7, 0xDD, 0xB7, 0x7D, 0xCF, 0x77, 0xBF, 
+  0xBB, 0xFE, 0xFF, 0x1C, 0xFE, 0xDB, 0xFB, 0xE5, 0xFB, 0xFD, 0xDB, 0x6D, 
+  0xFF, 0xFD, 0xF0, 0xC9, 0x26, 0x30, 0x87, 0xFF, 0xBF, 0xF7, 0xF7, 0x7B, 
+  0xED, 0xDE, 0xED, 0xF5, 0x35, 0xDF, 0x7D, 0xDE, 0xED, 0xFD, 0xFF, 0x1C, 
+  0xFB, 0xEE, 0xDE, 0xFD, 0xDE, 0xD7, 0x7F, 0xEF, 0x77, 0x6F, 0xF2, 0x61, 
+  0x81, 0x48, 0x0F, 0xFE, 0xDB, 0xDF, 0x7D, 0xEF, 0x67, 0xFB, 0xBF, 0x7D, 
+  0xDF, 0xF6, 0xF6, 0xDB, 0x6D, 0xFC, 0xFF, 0x1A, 0x7F, 0xDF, 0xB7, 0xF7, 
+  0xBF, 0xE6, 0xDB, 0xDF, 0xFB, 0xF8, 0x26, 0x49, 0x42, 0x37, 0xFF, 0xDF, 
+  0xFF, 0xEF, 0xFD, 0xDF, 0xEF, 0xB7, 0xDE, 0x6E, 0xBF, 0x9B, 0x6F, 0xFC, 
+  0xFF, 0x17, 0xF5, 0xD5, 0xB7, 0xDA, 0xFD, 0xED, 0xF7, 0xDF, 0xFE, 0xDF, 
+  0xF8, 0x92, 0x60, 0x10, 0xB7, 0xFF, 0x77, 0xFF, 0xBA, 0xF7, 0x93, 0xFD, 
+  0xFD, 0xFC, 0xFE, 0xED, 0xF9, 0xFF, 0x0C, 0x7C, 0xFB, 0xBF, 0x7F, 0xDB, 
+  0xED, 0x3F, 0xFF, 0xFC, 0x01, 0x86, 0x81, 0x6F, 0xFE, 0xFF, 0x08, 0xF6, 
+  0xFF, 0xB7, 0xB7, 0x6F, 0x6D, 0xBF, 0x7D, 0x67, 0xFB, 0xFF, 0x1A, 0xFE, 
+  0xEB, 0x6F, 0xAD, 0xEB, 0xDB, 0xCB, 0xBF, 0xED, 0xFB, 0xEE, 0x4C, 0x10, 
+  0x87, 0x5F, 0xFE, 0xDB, 0xBE, 0xDF, 0xDF, 0xAD, 0xFF, 0xDB, 0xFF, 0x77, 
+  0xDF, 0xBF, 0xF9, 0xFF, 0x0C, 0xEF, 0xED, 0xFE, 0xFF, 0xED, 0xF6, 0xDF, 
+  0xBF, 0xFA, 0x02, 0x48, 0x16, 0x7F, 0xFE, 0xFF, 0x08, 0xD9, 0xFD, 0xA7, 
+  0xEC, 0xFE, 0xDC, 0xDD, 0xF6, 0xFB, 0xF9, 0xFF, 0x18, 0xFB, 0x7B, 0xB7, 
+  0xB6, 0xCD, 0xDE, 0xDB, 0xEF, 0xFF, 0xB0, 0x03, 0x4D, 0xBF, 0xF7, 0x37, 
+  0xFD, 0xEF, 0x7F, 0x73, 0xFF, 0xB7, 0xF7, 0xFF, 0x7F, 0xDF, 0xF8, 0xFF, 
+  0x17, 0xDE, 0xFD, 0xDF, 0xD3, 0xFB, 0x6F, 0xFF, 0xFD, 0x3C, 0x99, 0x0C, 
+  0xFF, 0xDC, 0xFD, 0xFF, 0x3E, 0xDB, 0x5B, 0xDB, 0xDD, 0xBD, 0x6F, 0xDB, 
+  0x76, 0xF9, 0xFF, 0x19, 0xF6, 0xF7, 0xDE, 0xFB, 0xDB, 0x7F, 0x77, 0xDD, 
+  0xF6, 0xCC, 0x06, 0x33, 0x7B, 0x73, 0xDF, 0xFB, 0xF3, 0xFF, 0x9B, 0xFE, 
+  0xFF, 0xED, 0xBB, 0xFF, 0xFF, 0xBF, 0xF9, 0xFF, 0x18, 0xB9, 0xF3, 0xBF, 
+  0x69, 0xED, 0x9D, 0xF7, 0x7E, 0xC9, 0x00, 0x9B, 0xDD, 0xCF, 0x77, 0xEE, 
+  0xDF, 0x7E, 0xE6, 0xEF, 0xB3, 0x7E, 0xFE, 0xED, 0xBB, 0xEF, 0xFB, 0xFF, 
+  0x19, 0xFE, 0xDB, 0xEF, 0xBF, 0xDD, 0xAD, 0xFD, 0xEF, 0x7B, 0xEF, 0x3C, 
+  0x28, 0x35, 0xFE, 0x2D, 0xFD, 0xFE, 0xDD, 0xDE, 0xBD, 0xFB, 0x7F, 0x76, 
+  0xDF, 0xBF, 0xEE, 0xFA, 0xFF, 0x1A, 0xFB, 0xFE, 0xFD, 0xED, 0x77, 0xB6, 
+  0xDF, 0x73, 0xEC, 0xFB, 0x46, 0x02, 0x67, 0xFE, 0x7F, 0xDD, 0xFB, 0x77, 
+  0xF7, 0xB3, 0xDF, 0xDD, 0xDD, 0xED, 0xF6, 0xFF, 0xBF, 0xFA, 0xFF, 0x19, 
+  0x6F, 0xB7, 0x7F, 0xFF, 0xD6, 0xF6, 0xDD, 0xFF, 0xFF, 0xD2, 0x10, 0x9B, 
+  0xFE, 0xDB, 0xF7, 0xEF, 0x7E, 0xFF, 0x6E, 0xF6, 0xE7, 0xFD, 0x3F, 0x7F, 
+  0xB7, 0xEF, 0xFB, 0xFF, 0x19, 0xED, 0xFB, 0xED, 0xDA, 0xDB, 0x79, 0xFD, 
+  0xED, 0xDF, 0xFE, 0xB8, 0x84, 0xDF, 0xFF, 0x3F, 0x7E, 0xFD, 0xDB, 0xBB, 
+  0x6D, 0xFE, 0xFE, 0xB7, 0xF3, 0xDB, 0xFD, 0xF9, 0xFF, 0x19, 0xBE, 0xFB, 
+  0xF7, 0xDF, 0xAF, 0x6F, 0x7B, 0x7B, 0xFF, 0xAC, 0x01, 0xEF, 0xFF, 0xBD, 
+  0xDB, 0xDB, 0x7F, 0xEF, 0xB7, 0xDB, 0x9B, 0xDC, 0xDE, 0xFE, 0xDB, 0x77, 
+  0xFB, 0xFF, 0x1A, 0xF6, 0xEF, 0x9B, 0x77, 0x77, 0xB6, 0xFB, 0xDB, 0xEF, 
+  0xFF, 0x6C, 0x13, 0x3F, 0xFF, 0xB7, 0xF6, 0xFB, 0xED, 0xFE, 0xF6, 0xFF, 
+  0xFD, 0x7F, 0x7F, 0xB7, 0xFF, 0xDF, 0xFA, 0xFF, 0x18, 0xFB, 0xFD, 0xDD, 
+  0xFD, 0xDB, 0xBE, 0xEC, 0xFF, 0xFF, 0xD8, 0x4F, 0xDF, 0xFF, 0xDF, 0xBF, 
+  0xEC, 0xBF, 0x77, 0x5B, 0xB6, 0x67, 0xED, 0xAD, 0xFD, 0xB6, 0xFA, 0xFF, 
+  0x1A, 0xED, 0xBE, 0xE7, 0xDD, 0xAF, 0x6D, 0xEF, 0x3F, 0xBF, 0xFF, 0x99, 
+  0x02, 0xFF, 0xFB, 0xDE, 0xED, 0x6F, 0xEF, 0xDD, 0xFB, 0xFD, 0xFE, 0xBD, 
+  0xBB, 0x6F, 0xEF, 0xBF, 0xFA, 0xFF, 0x18, 0xEF, 0x7E, 0x77, 0xBB, 0xBD, 
+  0xF9, 0xF3, 0xE7, 0xFF, 0xC8, 0x32, 0x3F, 0xFF, 0x3F, 0xFB, 0xF3, 0x73, 
+  0xBF, 0xAC, 0xDD, 0xB6, 0xE6, 0xF7, 0xEE, 0x7B, 0xFA, 0xFF, 0x18, 0xFB, 
+  0x79, 0xDB, 0xF6, 0xF6, 0xD6, 0xDF, 0xDC, 0xFD, 0xFF, 0x68, 0x8B, 0xFF, 
+  0xF6, 0x6D, 0xB6, 0xBD, 0x9E, 0xEE, 0xFF, 0x77, 0xB7, 0xBE, 0xDD, 0xBB, 
+  0xF8, 0xFF, 0x16, 0xDF, 0xB6, 0xDE, 0xDF, 0xDB, 0xE6, 0xDF, 0x7B, 0xFF, 
+  0xA4, 0x08, 0xFF, 0xFC, 0xFF, 0xED, 0xAC, 0xFE, 0xEB, 0xD3, 0x7B, 0x6D, 
+  0xBB, 0x6D, 0xF5, 0xFF, 0x14, 0x7B, 0x6B, 0x6D, 0x3D, 0xB3, 0x6E, 0xFF, 
+  0xB0, 0x43, 0xFF, 0xB3, 0xDB, 0xEF, 0xE7, 0x67, 0xBB, 0x7D, 0xBB, 0x7B, 
+  0x6E, 0x3F, 0xF5, 0xFF, 0x14, 0xFB, 0x6D, 0xE7, 0xFB, 0x6E, 0xFD, 0x6D, 
+  0xC8, 0x13, 0xFE, 0xE7, 0x7E, 0xFA, 0x79, 0xB9, 0xB7, 0xED, 0xAE, 0xDB, 
+  0x76, 0x1F, 0xF5, 0xFF, 0x13, 0xFE, 0xDD, 0xBA, 0xDA, 0xDB, 0xDF, 0x3F, 
+  0xC9, 0x03, 0xB7, 0xCD, 0xF7, 0xBB, 0xCE, 0xBE, 0xDC, 0xB6, 0x7B, 0xB6, 
+  0xDE, 0xF3, 0xFF, 0x13, 0xF6, 0xDA, 0x6E, 0x99, 0x7B, 0xDB, 0x60, 0x4E, 
+  0xFD, 0x9F, 0xDD, 0xFE, 0xF2, 0xC6, 0xCB, 0x3E, 0xDB, 0x6D, 0xDB, 0x3F, 
+  0xF4, 0xFF, 0x02, 0xF7, 0x77, 0xBF, 0xFE, 0xEF, 0x0C, 0x60, 0x1F, 0xDE, 
+  0x7E, 0xFF, 0x6E, 0xBB, 0x73, 0x3B, 0x6B, 0xAF, 0x6D, 0xBB, 0xEF, 0xFF, 
+  0x09, 0xFE, 0xE9, 0xC8, 0x33, 0x73, 0x6F, 0xBB, 0xFB, 0xB9, 0x3D, 0xEA, 
+  0xFF, 0x09, 0xDF, 0xBC, 0xE0, 0xDD, 0xBC, 0xBB, 0xEE, 0xDF, 0xCF, 0x9F, 
+  0xEA, 0xFF, 0x08, 0xF7, 0xF6, 0x22, 0x6D, 0xA5, 0xFE, 0xFF, 0xFD, 0xFE, 
+  0xE9, 0xFF, 0x08, 0xFD, 0xC3, 0x9B, 0x66, 0xCD, 0xDF, 0xBB, 0x6F, 0x66, 
+  0xE9, 0xFF, 0x09, 0xDF, 0x19, 0xC1, 0x9A, 0x37, 0x77, 0xEF, 0xFB, 0xF9, 
+  0xBF, 0xEA, 0xFF, 0x09, 0xFB, 0xB6, 0x77, 0xA9, 0xB7, 0xFD, 0xFD, 0xBE, 
+  0xDF, 0x7F, 0xEA, 0xFF, 0x09, 0xEE, 0x66, 0x9B, 0xE9, 0xDD, 0xBF, 0x77, 
+  0xB7, 0xF6, 0x5F, 0xEA, 0xFF, 0x09, 0xFE, 0x5B, 0xE9, 0xDC, 0x7F, 0xEF, 
+  0xDE, 0xFD, 0xBB, 0xDF, 0xEA, 0xFF, 0x09, 0xB6, 0xDF, 0x6B, 0x76, 0xCE, 
+  0xFB, 0xFB, 0xDF, 0xED, 0xBF, 0xEA, 0xFF, 0x09, 0xFC, 0xFF, 0xD9, 0xB6, 
+  0x7B, 0xBE, 0xEF, 0x76, 0xDE, 0xBF, 0xEA, 0xFF, 0x09, 0xDC, 0xFF, 0xF3, 
+  0xB9, 0x3F, 0xEF, 0xBD, 0xEF, 0xF6, 0xDF, 0xEA, 0xFF, 0x09, 0xF6, 0xFF, 
+  0xA6, 0x6D, 0x36, 0xFB, 0xF7, 0xBF, 0x6D, 0xDF, 0xEA, 0xFF, 0x09, 0xBE, 
+  0x7F, 0xE1, 0x96, 0x77, 0xBE, 0xDE, 0xF7, 0xDF, 0x7F, 0xEA, 0xFF, 0x09, 
+  0xFE, 0x7F, 0x89, 0xB2, 0x5D, 0xEF, 0xFB, 0xBD, 0xF3, 0x6F, 0xEA, 0xFF, 
+  0x09, 0xF4, 0x9C, 0x24, 0x6D, 0x3F, 0x7B, 0x6F, 0xEF, 0x6F, 0xBF, 0xEA, 
+  0xFF, 0x08, 0xFC, 0x81, 0x13, 0x09, 0x27, 0xDF, 0xFE, 0xFB, 0xFC, 0xE9, 
+  0xFF, 0x09, 0xCC, 0xC4, 0xC8, 0xD2, 0x79, 0xF6, 0xF7, 0xBE, 0xDB, 0x9F, 
+  0xEA, 0xFF, 0x08, 0xF9, 0x32, 0x24, 0x96, 0x5E, 0xFF, 0xBD, 0xEF, 0xFB, 
+  0xE9, 0xFF, 0x09, 0xF9, 0x29, 0x26, 0x64, 0xD7, 0x3B, 0xEF, 0x7B, 0xBE, 
+  0x6F, 0xEA, 0xFF, 0x09, 0xBC, 0xCD, 0x59, 0x29, 0x35, 0xEE, 0xFB, 0xDF, 
+  0xE7, 0xBF, 0xEA, 0xFF, 0x09, 0xEC, 0x92, 0x53, 0x99, 0xFF, 0xEF, 0xBE, 
+  0xF7, 0x7D, 0xBF, 0xEA, 0xFF, 0x09, 0xF9, 0x36, 0xDC, 0xC4, 0xCE, 0x7B, 
+  0xEF, 0xBD, 0xFD, 0xCF, 0xEA, 0xFF, 0x09, 0xBC, 0xCD, 0xB6, 0x65, 0x7B, 
+  0xDE, 0xFB, 0xEF, 0xDE, 0x7F, 0xEA, 0xFF, 0x09, 0xFC, 0xDB, 0xED, 0xB3, 
+  0x7F, 0xF7, 0xBE, 0xFB, 0x77, 0xEF, 0xEA, 0xFF, 0x09, 0x7E, 0x76, 0xFB, 
+  0x93, 0x96, 0xFD, 0xEF, 0xBF, 0xFD, 0xBF, 0xEA, 0xFF, 0x09, 0xEF, 0x3F, 
+  0xBE, 0xCD, 0xF7, 0xBF, 0x7B, 0xED, 0xBE, 0xDF, 0xE9, 0xFF, 0x08, 0x9B, 
+  0xEE, 0x6E, 0x6D, 0xEF, 0xDE, 0xFB, 0xEE, 0xDF, 0xEA, 0xFF, 0x09, 0x7B, 
+  0xDF, 0xFB, 0x3B, 0xBF, 0x7B, 0xFF, 0xBE, 0xDB, 0xB7, 0xE9, 0xFF, 0x08, 
+  0x65, 0xB5, 0xFF, 0xB3, 0xFE, 0xF7, 0xEF, 0x7F, 0xBF, 0xEA, 0xFF, 0x09, 
+  0xDF, 0xFC, 0xDD, 0xDC, 0xEE, 0xDF, 0xBE, 0xFB, 0xE6, 0xEF, 0xEA, 0xFF, 
+  0x09, 0x7D, 0xBF, 0x6F, 0x77, 0xDB, 0xF7, 0xFB, 0xBE, 0xDF, 0xEF, 0xE9, 
+  0xFF, 0x08, 0xEF, 0x7B, 0xFF, 0x7D, 0xBD, 0xFF, 0xEF, 0xD9, 0xB7, 0xEB, 
+  0xFF, 0x0A, 0xFE, 0xF6, 0xFB, 0xDE, 0xDB, 0xA7, 0x6F, 0xDF, 0x7B, 0x7F, 
+  0xF7, 0xE9, 0xFF, 0x01, 0xBE, 0x77, 0xFE, 0xFE, 0x03, 0xFB, 0xFF, 0xE6, 
+  0x7D, 0xEA, 0xFF, 0x09, 0x6F, 0xED, 0xF7, 0x6F, 0xDB, 0xB7, 0xEF, 0xB6, 
+  0xFD, 0xDF, 0xEA, 0xFF, 0x09, 0xFB, 0x7F, 0x5F, 0xBB, 0x7B, 0x7D, 0xFF, 
+  0xFF, 0x3D, 0xDB, 0xE9, 0xFF, 0x08, 0xF6, 0xD9, 0xBF, 0xEE, 0xDF, 0x76, 
+  0xC9, 0xEF, 0x7F, 0xEB, 0xFF, 0x0A, 0xFE, 0xDD, 0xBD, 0xCE, 0xDD, 0xBD, 
+  0xEF, 0xDD, 0xFF, 0xDB, 0x6D, 0xEA, 0xFF, 0x09, 0xF7, 0xEF, 0x76, 0xD7, 
+  0xF7, 0x6D, 0xFF, 0xFF, 0xDD, 0xB7, 0xEA, 0xFF, 0x09, 0x7E, 0xFB, 0x57, 
+  0x6E, 0xDE, 0xFF, 0x6F, 0xFD, 0xF7, 0xBE, 0xEA, 0xFF, 0x09, 0xDB, 0xBD, 
+  0xD9, 0x6F, 0xFB, 0xB3, 0xBF, 0xFF, 0xFE, 0xEB, 0xEB, 0xFF, 0x0B, 0xFD, 
+  0xFF, 0xEE, 0xCD, 0x9D, 0xBF, 0x7F, 0xFF, 0xEF, 0x6E, 0xDF, 0x7F, 0xEB, 
+  0xFF, 0x09, 0x6D, 0xFB, 0xF7, 0xBF, 0xED, 0xDD, 0xDB, 0x7D, 0xFB, 0xD7, 
+  0xE9, 0xFF, 0x08, 0x7D, 0xB6, 0x7B, 0x7F, 0xDB, 0x7F, 0xF7, 0xDF, 0x79, 
+  0xEB, 0xFF, 0x0B, 0xFD, 0xB7, 0xDE, 0xFD, 0xFF, 0xF6, 0xFB, 0xEE, 0xFF, 
+  0x77, 0x6F, 0x7F, 0xEB, 0xFF, 0x0A, 0xFD, 0xF6, 0xDF, 0xDD, 0xDF, 0x6F, 
+  0xBB, 0xDD, 0xFD, 0xF7, 0x7F, 0xEC, 0xFF, 0x0A, 0xFB, 0xDF, 0x7D, 0xFB, 
+  0xF7, 0xFB, 0xED, 0xFF, 0xF7, 0xBF, 0x9D, 0xEB, 0xFF, 0x0B, 0xFE, 0xF7, 
+  0xDF, 0xBF, 0x7F, 0xBE, 0xFF, 0xDD, 0xBE, 0xEE, 0xFB, 0xBF, 0xEB, 0xFF, 
+  0x09, 0xBD, 0xF6, 0xEF, 0xDE, 0xF7, 0x9B, 0xF7, 0xEF, 0xFB, 0xEE, 0xEB, 
+  0xFF, 0x0B, 0xFB, 0x6F, 0x7B, 0xFB, 0xFB, 0xFF, 0xFE, 0xDE, 0xFB, 0x77, 
+  0xBD, 0xBF, 0xEB, 0xFF, 0x0A, 0xFB, 0xDE, 0xDE, 0xFF, 0xDD, 0xED, 0xFB, 
+  0xBF, 0xDD, 0xF7, 0xBF, 0xEC, 0xFF, 0x0A, 0xFC, 0xDE, 0xF6, 0xFF, 0xDF, 
+  0x7F, 0x7B, 0x6F, 0xED, 0xB7, 0x76, 0xEB, 0xFF, 0xFF, 0xF7, 0x09, 0xBE, 
+  0xED, 0xFB, 0xFB, 0xDF, 0xFD, 0xFF, 0xF7, 0xDE, 0xDF, 0xEC, 0xFF, 0x0B, 
+  0xF7, 0x7D, 0xED, 0xBF, 0xBF, 0xEF, 0xF6, 0xB7, 0x76, 0xDF, 0xFB, 0xDF, 
+  0xEC, 0xFF, 0x0B, 0xFB, 0xDF, 0x7D, 0xFB, 0xFD, 0xBE, 0xFF, 0xBF, 0xDF, 
+  0x6E, 0xEF, 0x7F, 0xEB, 0xFF, 0x0A, 0xF7, 0xDE, 0xFF, 0xEF, 0xFF, 0xB9, 
+  0xEC, 0xFB, 0xEF, 0xBD, 0xBF, 0xEC, 0xFF, 0x0B, 0xFD, 0xBD, 0xF2, 0xEE, 
+  0xFF, 0xF7, 0xEF, 0x6F, 0xBE, 0xBD, 0xF6, 0xEF, 0xEB, 0xFF, 0x0A, 0xEF, 
+  0x7F, 0xFB, 0xDD, 0xBE, 0xFF, 0xF3, 0xEF, 0xBF, 0xDF, 0xDF, 0xEC, 0xFF, 
+  0x0B, 0xFE, 0xFB, 0xDC, 0xDF, 0xFF, 0xEF, 0xB6, 0xDC, 0xF9, 0xF7, 0xFB, 
+  0x7F, 0xEC, 0xFF, 0x0B, 0xFB, 0xBE, 0xF6, 0xFF, 0x7B, 0xFD, 0xFF, 0xFF, 
+  0x36, 0x7D, 0xBE, 0xCF, 0xEB, 0xFF, 0x0A, 0xEF, 0xBD, 0xED, 0xFF, 0x7F, 
+  0xDB, 0x6F, 0xDB, 0xEF, 0xEF, 0xBF, 0xEC, 0xFF, 0x0B, 0xEF, 0x7B, 0xED, 
+  0xFF, 0xEF, 0xEF, 0x7F, 0xFB, 0xFB, 0xFE, 0xFB, 0x6F, 0xEC, 0xFF, 0x08, 
+  0xFB, 0xDE, 0xFC, 0xF7, 0xBE, 0xFD, 0xF6, 0xDE, 0xEF, 0xFE, 0xDF, 0xEC, 
+  0xFF, 0x0B, 0xFE, 0xF7, 0xB5, 0xDE, 0xFF, 0xDF, 0xFF, 0xF7, 0xBD, 0xFB, 
+  0x7C, 0xDF, 0xEB, 0xFF, 0x0A, 0x7D, 0xFD, 0xFF, 0xF7, 0xFB, 0xBB, 0x7D, 
+  0xFD, 0xEF, 0xEF, 0x7F, 0xEB, 0xFF, 0x09, 0xCF, 0x6D, 0xBB, 0xDE, 0xFF, 
+  0xEF, 0xDF, 0xF7, 0xBF, 0xEB, 0xEA, 0xFF, 0x09, 0xFB, 0x7D, 0xFE, 0xFF, 
+  0xDF, 0x7D, 0xF7, 0x7D, 0xFB, 0x3E, 0xE9, 0xFF, 0x08, 0xDC, 0xF7, 0xBB, 
+  0xFB, 0xF7, 0x7D, 0xDD, 0xDB, 0xF7, 0xEA, 0xFF, 0x08, 0xF0, 0xF9, 0xDD, 
+  0xEE, 0xEF, 0xBF, 0xDF, 0xF7, 0x7F, 0xE9, 0xFF, 0x08, 0xF0, 0x0D, 0xFF, 
+  0x7D, 0xBD, 0xEC, 0xD3, 0x3F, 0xEC, 0xE9, 0xFF, 0x08, 0xF3, 0x01, 0xB7, 
+  0xDF, 0xF7, 0x7F, 0xFF, 0xFA, 0x80, 0xE9, 0xFF, 0x08, 0xF0, 0x62, 0x00, 
+  0x46, 0x7F, 0xDB, 0x6C, 0x80, 0x12, 0xE9, 0xFF, 0x08, 0xE4, 0x08, 0x48, 
+  0x00, 0x00, 0x48, 0x00, 0x04, 0x40, 0xE9, 0xFF, 0x08, 0xE0, 0x01, 0x13, 
+  0x20, 0x00, 0x20, 0x93, 0x21, 0x08, 0xE9, 0xFF, 0x09, 0xE3, 0x64, 0x00, 
+  0x09, 0x03, 0x06, 0x00, 0x48, 0x20, 0x7F, 0xEA, 0xFF, 0x09, 0xCC, 0x9B, 
+  0xEC, 0x90, 0x00, 0x50, 0x64, 0x42, 0x04, 0x7F, 0xEA, 0xFF, 0x09, 0xE4, 
+  0x92, 0x22, 0x44, 0x88, 0x81, 0x00, 0x10, 0x91, 0x7F, 0xEA, 0xFF, 0x09, 
+  0xD7, 0x6C, 0x99, 0x20, 0x02, 0x2C, 0x01, 0x04, 0x00, 0x7F, 0xEA, 0xFF, 
+  0x09, 0xD9, 0x6B, 0xD9, 0x22, 0x02, 0x66, 0xF4, 0x41, 0x48, 0xBF, 0xEA, 
+  0xFF, 0x09, 0xED, 0x9A, 0x67, 0x88, 0x89, 0x92, 0x16, 0x58, 0x24, 0x3F, 
+  0xEA, 0xFF, 0x09, 0xEE, 0xEF, 0xBC, 0xE0, 0x01, 0x99, 0x93, 0x06, 0x04, 
+  0x7F, 0xEA, 0xFF, 0x09, 0xE0, 0x00, 0xCE, 0x74, 0x16, 0x6D, 0xE8, 0xE1, 
+  0x90, 0x7F, 0xEA, 0xFF, 0x09, 0x91, 0x10, 0x03, 0x96, 0x47, 0xE6, 0x6E, 
+  0xB8, 0x49, 0x3F, 0xEA, 0xFF, 0x09, 0x96, 0x4D, 0x20, 0xC9, 0x09, 0xBB, 
+  0x33, 0x2E, 0x4C, 0x3F, 0xEA, 0xFF, 0x09, 0xC9, 0xA1, 0x24, 0x69, 0x2C, 
+  0x19, 0xDB, 0x67, 0xB2, 0x9F, 0xEA, 0xFF, 0x09, 0x29, 0x36, 0x49, 0x16, 
+  0x44, 0x40, 0x0C, 0xD9, 0xA2, 0xBF, 0xEA, 0xFF, 0x09, 0x36, 0x49, 0x12, 
+  0x04, 0x91, 0x0C, 0x20, 0x9E, 0x6C, 0xBF, 0xEB, 0xFF, 0x0A, 0xFC, 0xC4, 
+  0xC9, 0x90, 0xA1, 0x89, 0x33, 0x92, 0x27, 0xDD, 0x3F, 0xEB, 0xFF, 0x0A, 
+  0xFC, 0xD9, 0xB6, 0x4C, 0x88, 0x62, 0xC8, 0xD6, 0x41, 0xB7, 0x7F, 0xEB, 
+  0xFF, 0x0A, 0xF3, 0x26, 0x24, 0x42, 0x42, 0x06, 0x4C, 0x49, 0x98, 0x6D, 
+  0xBF, 0xEB, 0xFF, 0x0A, 0xEB, 0x33, 0x49, 0x92, 0x10, 0x11, 0x33, 0x29, 
+  0x26, 0x0D, 0xBF, 0xEB, 0xFF, 0x0A, 0xE8, 0xCC, 0xDA, 0x49, 0x24, 0x99, 
+  0x93, 0x26, 0x49, 0x93, 0x7F, 0xEB, 0xFF, 0x0A, 0xCD, 0x99, 0x26, 0x49, 
+  0x20, 0x8C, 0xCC, 0xD9, 0x98, 0x40, 0x5F, 0xEB, 0xFF, 0x0A, 0xD4, 0x66, 
+  0x61, 0x92, 0x08, 0x66, 0x69, 0x92, 0x66, 0x69, 0x3F, 0xEB, 0xFF, 0x0A, 
+  0x93, 0x25, 0x98, 0x92, 0x83, 0x33, 0x26, 0x66, 0x43, 0x09, 0x3F, 0xEB, 
+  0xFF, 0x0A, 0xAA, 0xB1, 0x26, 0x48, 0x60, 0x99, 0x99, 0x2D, 0x98, 0xC4, 
+  0x9F, 0xEB, 0xFF, 0x0A, 0x28, 0xCC, 0xC9, 0x49, 0x08, 0xC4, 0xD6, 0xC9, 
+  0x26, 0x34, 0x9F, 0xEB, 0xFF, 0x0A, 0x26, 0x4A, 0x52, 0x44, 0x82, 0x56, 
+  0x52, 0x52, 0x64, 0x82, 0x5F, 0xEC, 0xFF, 0x0B, 0xFE, 0x53, 0x33, 0x14, 
+  0x92, 0x23, 0x13, 0x29, 0x9C, 0x99, 0xB2, 0x5F, 0xEC, 0xFF, 0x0B, 0xFE, 
+  0x51, 0x91, 0x25, 0x22, 0x08, 0xC9, 0xAD, 0x25, 0x92, 0x11, 0x0F, 0xEC, 
+  0xFF, 0x0B, 0xFC, 0x8C, 0x4C, 0xC9, 0x28, 0x84, 0xAC, 0x93, 0x64, 0x66, 
+  0x4C, 0xBF, 0xEC, 0xFF, 0x0B, 0xFD, 0xA2, 0x42, 0x12, 0x48, 0x93, 0x24, 
+  0xD2, 0x5B, 0x09, 0x62, 0x1F, 0xEC, 0xFF, 0x0B, 0xFC, 0x24, 0x99, 0x24, 
+  0xC4, 0x08, 0x53, 0x2C, 0x91, 0x69, 0x12, 0x4F, 0xEC, 0xFF, 0x0B, 0xFE, 
+  0x4C, 0xA4, 0xA4, 0x24, 0x49, 0x92, 0x65, 0x8C, 0x46, 0x49, 0x3F, 0xEC, 
+  0xFF, 0x0B, 0xFC, 0xC2, 0x24, 0x93, 0x22, 0x44, 0x24, 0x92, 0x63, 0x11, 
+  0x24, 0x9F, 0xEC, 0xFF, 0x0B, 0xFD, 0x32, 0x49, 0x10, 0x90, 0x12, 0x49, 
+  0x98, 0x92, 0x6C, 0x92, 0x5F, 0xEC, 0xFF, 0x0B, 0xFD, 0x09, 0x12, 0x4C, 
+  0x85, 0x0A, 0xC8, 0x46, 0x4C, 0x82, 0x92, 0x1F, 0xEC, 0xFF, 0x0B, 0xFC, 
+  0xC9, 0x92, 0x62, 0x60, 0x48, 0x26, 0x51, 0x21, 0x32, 0x49, 0x9F, 0xEC, 
+  0xFF, 0x0B, 0xFC, 0x24, 0x64, 0x92, 0x12, 0x13, 0x21, 0x11, 0x99, 0x12, 
+  0x48, 0x3F, 0xEC, 0xFF, 0x0A, 0xFD, 0x92, 0x09, 0x11, 0x88, 0x84, 0x99, 
+  0x26, 0x44, 0xC9, 0x24, 0xEB, 0xFF, 0x0B, 0xFE, 0x52, 0xC9, 0x4C, 0x62, 
+  0x24, 0x84, 0x98, 0x46, 0x24, 0x92, 0x7F, 0xEC, 0xFF, 0x0B, 0xFE, 0x49, 
+  0x24, 0x42, 0x10, 0x12, 0x64, 0x83, 0x31, 0x24, 0x92, 0x7F, 0xEB, 0xFF, 
+  0xFF, 0x24, 0x07, 0x92, 0x84, 0x89, 0x12, 0x64, 0x89, 0x12, 0x49, 0xEA, 
+  0xFF, 0x09, 0x84, 0x92, 0x24, 0xA0, 0x24, 0x92, 0x14, 0x92, 0xC9, 0x20, 
+  0xEA, 0xFF, 0x09, 0xC0, 0x82, 0x48, 0x09, 0x24, 0x89, 0x92, 0x52, 0x24, 
+  0x89, 0xEA, 0xFF, 0x09, 0xB2, 0x20, 0x42, 0x41, 0x12, 0x64, 0x49, 0x0C, 
+  0x92, 0x45, 0xEA, 0xFF, 0x09, 0xA4, 0x89, 0x00, 0x14, 0xD9, 0x12, 0x49, 
+  0x61, 0x12, 0x17, 0xEA, 0xFF, 0x09, 0xCD, 0x99, 0x2D, 0x92, 0x4C, 0x49, 
+  0x24, 0x4C, 0x64, 0x87, 0xEA, 0xFF, 0x09, 0xD9, 0x66, 0x62, 0x66, 0x7E, 
+  0x09, 0x25, 0x12, 0x88, 0x2F, 0xEA, 0xFF, 0x09, 0xE6, 0x49, 0x9A, 0x49, 
+  0xFE, 0x20, 0x91, 0x22, 0x21, 0x2F, 0xEA, 0xFF, 0x09, 0xFB, 0xBA, 0x4D, 
+  0x9B, 0xFF, 0x84, 0x00, 0x89, 0x04, 0xCF, 0xEA, 0xFF, 0x09, 0xFE, 0xA6, 
+  0xE5, 0xBF, 0xFE, 0x52, 0x48, 0x00, 0x4A, 0x5F, 0xE8, 0xFF, 0x07, 0x3B, 
+  0x7F, 0xFE, 0xDA, 0x4A, 0x48, 0x9B, 0x3F, 0xE5, 0xFF, 0x03, 0x25, 0xB2, 
+  0x4E, 0xA4, 0xE4, 0xFF, 0x03, 0x65, 0x25, 0xB2, 0x65, 0xE4, 0xFF, 0x03, 
+  0xDB, 0x5C, 0x93, 0x5B, 0xE4, 0xFF, 0x03, 0xF2, 0xD3, 0x6D, 0x4F, 0xE3, 
+  0xFF, 0x02, 0xB6, 0x6D, 0xBF, 0xE2, 0xFF, 0x00, 0xB7, 0x81, 0xFF, 0x81, 
+  0xFF, 0xA7, 0xFF };
+
+const PackedImage DR_MARIO_IMAGE = {263, 280, DR_MARIO_PACKED, sizeof(DR_MARIO_PACKED)};
+
+#endif // IMAGES_H
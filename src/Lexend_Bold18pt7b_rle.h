@@ -0,0 +1,147 @@
+#ifndef LEXEND_BOLD18PT7B_RLE_H
+#define LEXEND_BOLD18PT7B_RLE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Bold18pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES,
+// glyph bitmaps run-length encoded
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Bold18pt7b_rleBitmaps[] PROGMEM = {
+  0x10, 0x41, 0x43, 0x23, 0x23, 0x33, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 
+  0x33, 0x43, 0x33, 0x44, 0x32, 0x10, 0x11, 0x43, 0x43, 0x43, 0x43, 0x33, 
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x33, 0x14, 0x32, 0x30, 0x06, 
+  0x12, 0x14, 0x11, 0x20, 0x0F, 0x30, 0x09, 0x83, 0x73, 0x82, 0x83, 0x82, 
+  0x83, 0x83, 0x73, 0x83, 0x73, 0x83, 0x73, 0x83, 0x73, 0x83, 0x73, 0x80, 
+  0x34, 0x57, 0x28, 0x13, 0x46, 0x46, 0x46, 0x55, 0x46, 0x46, 0x43, 0x13, 
+  0x24, 0x18, 0x36, 0x20, 0x33, 0x35, 0x26, 0x35, 0x21, 0x23, 0x53, 0x53, 
+  0x53, 0x53, 0x53, 0x2F, 0x90, 0x18, 0x29, 0x18, 0x63, 0x63, 0x65, 0x56, 
+  0x41, 0x33, 0x73, 0x21, 0x47, 0x24, 0x18, 0x36, 0x20, 0x34, 0x37, 0x19, 
+  0x12, 0x33, 0x21, 0x33, 0x53, 0x45, 0x43, 0x62, 0xF1, 0x36, 0x36, 0x33, 
+  0x53, 0xA3, 0x94, 0x95, 0x76, 0x73, 0x13, 0x62, 0x23, 0x53, 0x23, 0x59, 
+  0x3A, 0x3B, 0x23, 0x53, 0x13, 0x64, 0x06, 0x48, 0x29, 0x12, 0x43, 0x12, 
+  0x43, 0x18, 0x28, 0x29, 0x12, 0x55, 0x5F, 0x71, 0x82, 0x45, 0x48, 0x2A, 
+  0x14, 0x32, 0x14, 0x73, 0x83, 0x83, 0x83, 0x84, 0x51, 0x29, 0x39, 0x36, 
+  0x20, 0x06, 0x59, 0x2A, 0x13, 0x34, 0x13, 0x47, 0x56, 0x56, 0x56, 0x56, 
+  0x4E, 0x19, 0x27, 0x40, 0x08, 0x18, 0x18, 0x13, 0x63, 0x68, 0x18, 0x18, 
+  0x13, 0x63, 0x6F, 0xC0, 0x0F, 0xC5, 0x35, 0x35, 0xF4, 0x53, 0x53, 0x53, 
+  0x53, 0x50, 0x45, 0x59, 0x2B, 0x13, 0x51, 0x24, 0x83, 0x93, 0x39, 0x39, 
+  0x67, 0x53, 0x1B, 0x29, 0x46, 0x30, 0x03, 0x46, 0x46, 0x46, 0x46, 0x4F, 
+  0xF6, 0x46, 0x46, 0x46, 0x46, 0x43, 0x0F, 0x92, 0x44, 0x44, 0x44, 0x44, 
+  0x44, 0x44, 0x42, 0xF9, 0x37, 0x37, 0x37, 0x53, 0x73, 0x73, 0x73, 0x73, 
+  0x73, 0x31, 0x33, 0x28, 0x27, 0x45, 0x40, 0x03, 0x47, 0x34, 0x13, 0x24, 
+  0x23, 0x14, 0x37, 0x46, 0x56, 0x57, 0x43, 0x14, 0x33, 0x24, 0x23, 0x33, 
+  0x23, 0x43, 0x13, 0x44, 0x03, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 
+  0x53, 0x53, 0x5F, 0x90, 0x02, 0x85, 0x67, 0x48, 0x49, 0x2A, 0x18, 0x1C, 
+  0x14, 0x16, 0x13, 0x26, 0x22, 0x26, 0x66, 0x66, 0x63, 0x02, 0x66, 0x57, 
+  0x48, 0x38, 0x35, 0x13, 0x25, 0x14, 0x16, 0x1A, 0x29, 0x38, 0x38, 0x47, 
+  0x53, 0x45, 0x68, 0x4A, 0x33, 0x44, 0x13, 0x67, 0x76, 0x76, 0x76, 0x68, 
+  0x53, 0x2B, 0x39, 0x56, 0x40, 0x06, 0x38, 0x1C, 0x36, 0x36, 0x3F, 0x51, 
+  0x72, 0x36, 0x36, 0x36, 0x36, 0x06, 0x48, 0x29, 0x13, 0x33, 0x13, 0x46, 
+  0x33, 0x19, 0x18, 0x27, 0x33, 0x23, 0x23, 0x24, 0x13, 0x33, 0x13, 0x34, 
+  0x44, 0x58, 0x2A, 0x13, 0x41, 0x33, 0x87, 0x57, 0x66, 0x84, 0x12, 0x58, 
+  0x23, 0x29, 0x46, 0x20, 0x0F, 0xF0, 0x33, 0x73, 0x73, 0x73, 0x73, 0x73, 
+  0x73, 0x73, 0x73, 0x73, 0x40, 0x04, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 
+  0x47, 0x43, 0x13, 0x43, 0x13, 0x43, 0x1A, 0x28, 0x46, 0x20, 0x03, 0x73, 
+  0x13, 0x53, 0x23, 0x53, 0x23, 0x44, 0x33, 0x33, 0x43, 0x33, 0x53, 0x13, 
+  0x63, 0x13, 0x63, 0x12, 0x85, 0x85, 0x93, 0xA3, 0x50, 0x03, 0x64, 0x13, 
+  0x44, 0x24, 0x33, 0x44, 0x13, 0x63, 0x13, 0x66, 0x85, 0x93, 0xA3, 0xA3, 
+  0xA3, 0xA3, 0xA3, 0x50, 0x19, 0x19, 0x19, 0x63, 0x63, 0x64, 0x54, 0x63, 
+  0x64, 0x54, 0x5F, 0xF0, 0x71, 0xA4, 0x84, 0x91, 0xD3, 0xA3, 0x94, 0x95, 
+  0x76, 0x73, 0x13, 0x62, 0x23, 0x53, 0x23, 0x59, 0x3A, 0x3B, 0x23, 0x53, 
+  0x13, 0x64, 0x51, 0x64, 0x44, 0x51, 0x68, 0x18, 0x18, 0x13, 0x63, 0x68, 
+  0x18, 0x18, 0x13, 0x63, 0x6F, 0xC0, 0x51, 0x53, 0x43, 0x51, 0x5F, 0x92, 
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0xF9, 0x71, 0xA4, 0x84, 0x91, 
+  0xC5, 0x68, 0x4A, 0x33, 0x44, 0x13, 0x67, 0x76, 0x76, 0x76, 0x68, 0x53, 
+  0x2B, 0x39, 0x56, 0x40, 0x71, 0x83, 0x73, 0x81, 0x64, 0x47, 0x47, 0x47, 
+  0x47, 0x47, 0x47, 0x47, 0x43, 0x13, 0x43, 0x13, 0x43, 0x1A, 0x28, 0x46, 
+  0x20, 0x71, 0xA4, 0x84, 0x91, 0x83, 0x64, 0x13, 0x44, 0x24, 0x33, 0x44, 
+  0x13, 0x63, 0x13, 0x66, 0x85, 0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x50, 
+  0x41, 0x31, 0x53, 0x13, 0x54, 0xF3, 0x54, 0x82, 0xA1, 0x43, 0x21, 0x47, 
+  0x38, 0x38, 0x38, 0x38, 0x45, 0x12, 0x93, 0x93, 0x62, 0x21, 0x41, 0x56, 
+  0x64, 0xF0, 0x65, 0x92, 0xA1, 0x33, 0x41, 0x34, 0x75, 0x65, 0x65, 0x65, 
+  0x64, 0xE1, 0x92, 0x74, 0x11, 0x41, 0x36, 0x44, 0xC8, 0x18, 0x18, 0x13, 
+  0x63, 0x68, 0x18, 0x18, 0x13, 0x63, 0x6F, 0xC0, 0x21, 0x41, 0x57, 0x54, 
+  0xF0, 0x26, 0x65, 0x74, 0x83, 0x83, 0x51, 0x32, 0x51, 0x41, 0x61, 0xA2, 
+  0x93, 0x83, 0x84, 0x75, 0x30, 0x11, 0x41, 0x46, 0x54, 0xE6, 0x48, 0x29, 
+  0x13, 0x33, 0x13, 0x46, 0x33, 0x19, 0x18, 0x27, 0x33, 0x23, 0x23, 0x24, 
+  0x13, 0x33, 0x13, 0x34, 0x31, 0x41, 0x56, 0x64, 0xF3, 0x45, 0x82, 0xA1, 
+  0x34, 0x13, 0x38, 0x75, 0x76, 0x68, 0x41, 0x25, 0x82, 0x32, 0x94, 0x62, 
+  0x21, 0x41, 0x46, 0x54, 0xDF, 0xF0, 0x33, 0x73, 0x73, 0x73, 0x73, 0x73, 
+  0x73, 0x73, 0x73, 0x73, 0x40, 0x52, 0x84, 0x62, 0x21, 0x74, 0x34, 0x12, 
+  0x17, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x43, 0x13, 0x43, 0x13, 0x43, 
+  0x1A, 0x28, 0x46, 0x20, 0x21, 0x41, 0x46, 0x54, 0xE9, 0x19, 0x19, 0x63, 
+  0x63, 0x64, 0x54, 0x63, 0x64, 0x54, 0x5F, 0xF0, 0x03, 0x16, 0x15, 0x25, 
+  0x22, 0x12, 0x22, 0x10 };
+
+const GFXglyph Lexend_Bold18pt7b_rleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   6,  16,   7,    1,  -12 },   // 0x28 '('
+  {    18,   6,  16,   7,    0,  -12 },   // 0x29 ')'
+  {    35,   3,   6,   5,    1,   -1 },   // 0x2C ','
+  {    40,   6,   3,   8,    1,   -6 },   // 0x2D '-'
+  {    42,   3,   3,   5,    1,   -2 },   // 0x2E '.'
+  {    43,  11,  16,  11,    0,  -12 },   // 0x2F '/'
+  {    60,  10,  13,  12,    1,  -12 },   // 0x30 '0'
+  {    76,   8,  13,  10,    1,  -12 },   // 0x31 '1'
+  {    89,  10,  13,  11,    0,  -12 },   // 0x33 '3'
+  {   105,   9,  13,  10,    0,  -12 },   // 0x3F '?'
+  {   120,  13,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   138,  10,  13,  13,    2,  -12 },   // 0x42 'B'
+  {   153,  11,  13,  12,    1,  -12 },   // 0x43 'C'
+  {   169,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {   184,   9,  13,  12,    2,  -12 },   // 0x45 'E'
+  {   196,   8,  13,  11,    2,  -12 },   // 0x46 'F'
+  {   206,  12,  13,  14,    1,  -12 },   // 0x47 'G'
+  {   222,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {   234,   8,  13,  10,    1,  -12 },   // 0x49 'I'
+  {   244,  10,  13,  12,    1,  -12 },   // 0x4A 'J'
+  {   259,  11,  13,  13,    2,  -12 },   // 0x4B 'K'
+  {   280,   8,  13,  11,    2,  -12 },   // 0x4C 'L'
+  {   292,  12,  13,  16,    2,  -12 },   // 0x4D 'M'
+  {   309,  11,  13,  15,    2,  -12 },   // 0x4E 'N'
+  {   325,  13,  13,  15,    1,  -12 },   // 0x4F 'O'
+  {   341,   9,  13,  12,    2,  -12 },   // 0x50 'P'
+  {   353,  10,  13,  13,    2,  -12 },   // 0x52 'R'
+  {   372,  11,  13,  11,    0,  -12 },   // 0x53 'S'
+  {   388,  10,  13,  12,    1,  -12 },   // 0x54 'T'
+  {   401,  11,  13,  14,    1,  -12 },   // 0x55 'U'
+  {   418,  13,  13,  13,    0,  -12 },   // 0x56 'V'
+  {   441,  13,  13,  12,    0,  -12 },   // 0x59 'Y'
+  {   460,  10,  13,  12,    1,  -12 },   // 0x5A 'Z'
+  {   472,  13,  17,  12,    0,  -16 },   // 0xC1
+  {   494,   9,  17,  12,    2,  -16 },   // 0xC9
+  {   510,   8,  17,  10,    1,  -16 },   // 0xCD
+  {   524,  13,  17,  15,    1,  -16 },   // 0xD3
+  {   544,  11,  17,  14,    1,  -16 },   // 0xDA
+  {   565,  13,  17,  12,    0,  -16 },   // 0xDD
+  {   588,  11,  17,  12,    1,  -16 },   // 0x10C
+  {   609,  11,  17,  14,    2,  -16 },   // 0x10E
+  {   628,   9,  17,  12,    2,  -16 },   // 0x11A
+  {   644,  11,  17,  15,    2,  -16 },   // 0x147
+  {   665,  10,  17,  13,    2,  -16 },   // 0x158
+  {   688,  11,  17,  11,    0,  -16 },   // 0x160
+  {   708,  10,  17,  12,    1,  -16 },   // 0x164
+  {   725,  11,  17,  14,    1,  -16 },   // 0x16E
+  {   748,  10,  17,  12,    1,  -16 },   // 0x17D
+  {   764,   7,   5,   9,    1,  -12 },   // 0x201C
+  {   764,   7,   5,   9,    1,  -12 }   // 0x201D
+};
+
+const uint16_t Lexend_Bold18pt7b_rleCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Bold18pt7b_rle PROGMEM = {
+  { (uint8_t  *)Lexend_Bold18pt7b_rleBitmaps,
+    (GFXglyph *)Lexend_Bold18pt7b_rleGlyphs,
+    SPARSE_RLE_FONT_FIRST, 50, 23 },
+  Lexend_Bold18pt7b_rleCodepoints };
+
+// Approx. 1302 bytes
+
+#endif // LEXEND_BOLD18PT7B_RLE_H
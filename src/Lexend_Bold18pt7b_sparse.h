@@ -0,0 +1,155 @@
+#ifndef LEXEND_BOLD18PT7B_SPARSE_H
+#define LEXEND_BOLD18PT7B_SPARSE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Bold18pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Bold18pt7b_sparseBitmaps[] PROGMEM = {
+  0x00, 0x08, 0x73, 0x9C, 0x73, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 
+  0xC6, 0x43, 0x87, 0x0E, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xEF, 
+  0x18, 0xFD, 0xBD, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x00, 0xE0, 0x38, 
+  0x06, 0x01, 0xC0, 0x30, 0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0x70, 
+  0x1C, 0x03, 0x80, 0xE0, 0x1C, 0x07, 0x00, 0x1E, 0x0F, 0xE7, 0xFB, 0x87, 
+  0xE1, 0xF8, 0x7E, 0x0F, 0x87, 0xE1, 0xF8, 0x77, 0x3D, 0xFE, 0x3F, 0x00, 
+  0x1C, 0x7C, 0xFC, 0x7C, 0x9C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 
+  0xFF, 0x7F, 0x9F, 0xF7, 0xF8, 0x1C, 0x0E, 0x07, 0xC1, 0xF8, 0x47, 0x01, 
+  0xC8, 0x7F, 0x3D, 0xFE, 0x3F, 0x00, 0x1E, 0x3F, 0xBF, 0xEC, 0x72, 0x38, 
+  0x38, 0x7C, 0x38, 0x18, 0x00, 0x07, 0x03, 0x81, 0xC0, 0x07, 0x00, 0x38, 
+  0x03, 0xC0, 0x1F, 0x01, 0xF8, 0x0E, 0xE0, 0x67, 0x07, 0x38, 0x3F, 0xE3, 
+  0xFF, 0x1F, 0xFC, 0xE0, 0xEE, 0x07, 0x80, 0xFC, 0x3F, 0xCF, 0xFB, 0x0E, 
+  0xC3, 0xBF, 0xCF, 0xF3, 0xFE, 0xC1, 0xF0, 0x7F, 0xFF, 0xFE, 0xFF, 0x00, 
+  0x0F, 0x87, 0xF9, 0xFF, 0xBC, 0x6F, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 
+  0x1E, 0x09, 0xFF, 0x1F, 0xF1, 0xF8, 0xFC, 0x1F, 0xF3, 0xFF, 0x71, 0xEE, 
+  0x1F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x3F, 0xFF, 0x7F, 0xCF, 0xE0, 
+  0xFF, 0x7F, 0xBF, 0xDC, 0x0E, 0x07, 0xFB, 0xFD, 0xFE, 0xE0, 0x70, 0x3F, 
+  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE0, 
+  0xE0, 0xE0, 0xE0, 0xE0, 0x0F, 0x83, 0xFE, 0x7F, 0xF7, 0x04, 0xF0, 0x0E, 
+  0x00, 0xE3, 0xFE, 0x3F, 0xE0, 0x7F, 0x07, 0x7F, 0xF3, 0xFE, 0x1F, 0x80, 
+  0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xF8, 
+  0x7E, 0x1F, 0x87, 0xE1, 0xC0, 0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x3C, 0x3C, 
+  0x3C, 0x3C, 0x3C, 0xFF, 0xFF, 0xFF, 0x1F, 0xC7, 0xF1, 0xFC, 0x1C, 0x07, 
+  0x01, 0xC0, 0x70, 0x1C, 0x07, 0x11, 0xCF, 0xF3, 0xF8, 0x7C, 0x00, 0xE1, 
+  0xFC, 0x7B, 0x9E, 0x77, 0x8F, 0xE1, 0xF8, 0x3F, 0x07, 0xF0, 0xEF, 0x1C, 
+  0xF3, 0x8E, 0x70, 0xEE, 0x1E, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 
+  0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xC0, 0x3E, 0x07, 0xF0, 0xFF, 0x0F, 
+  0xF9, 0xFF, 0xBF, 0xDF, 0xFE, 0xF7, 0xEE, 0x7E, 0x67, 0xE0, 0x7E, 0x07, 
+  0xE0, 0x70, 0xC0, 0xFC, 0x1F, 0xC3, 0xFC, 0x7F, 0x8F, 0xB9, 0xF7, 0xBF, 
+  0x7F, 0xE7, 0xFC, 0x7F, 0x8F, 0xF0, 0xFE, 0x0E, 0x0F, 0x81, 0xFE, 0x1F, 
+  0xF8, 0xE1, 0xEE, 0x07, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x7F, 0x83, 
+  0x9F, 0xFC, 0x7F, 0xC1, 0xF8, 0x00, 0xFC, 0x7F, 0xBF, 0xFC, 0x7E, 0x3F, 
+  0x1F, 0xFF, 0xFE, 0xFE, 0x70, 0x38, 0x1C, 0x0E, 0x00, 0xFC, 0x3F, 0xCF, 
+  0xFB, 0x8E, 0xE1, 0xF8, 0xEF, 0xFB, 0xFC, 0xFE, 0x39, 0xCE, 0x7B, 0x8E, 
+  0xE3, 0xC0, 0x0F, 0x07, 0xF9, 0xFF, 0xB8, 0x47, 0x00, 0xFE, 0x0F, 0xE0, 
+  0x7E, 0x01, 0xEC, 0x1F, 0xE7, 0x3F, 0xE1, 0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 
+  0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 
+  0x00, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 
+  0x70, 0xEE, 0x1D, 0xFF, 0x9F, 0xE1, 0xF8, 0xE0, 0x3B, 0x83, 0x9C, 0x1C, 
+  0xE1, 0xE3, 0x8E, 0x1C, 0x70, 0x77, 0x03, 0xB8, 0x1D, 0x80, 0x7C, 0x03, 
+  0xE0, 0x0E, 0x00, 0x70, 0x00, 0xE0, 0x7B, 0x87, 0x9E, 0x38, 0x7B, 0x81, 
+  0xDC, 0x0F, 0xC0, 0x3E, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 
+  0x00, 0x70, 0x00, 0x7F, 0xDF, 0xF7, 0xFC, 0x0E, 0x07, 0x03, 0xC1, 0xE0, 
+  0x70, 0x3C, 0x1E, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x00, 0x3C, 0x03, 
+  0xC0, 0x10, 0x00, 0x70, 0x03, 0x80, 0x3C, 0x01, 0xF0, 0x1F, 0x80, 0xEE, 
+  0x06, 0x70, 0x73, 0x83, 0xFE, 0x3F, 0xF1, 0xFF, 0xCE, 0x0E, 0xE0, 0x78, 
+  0x04, 0x0F, 0x0F, 0x04, 0x0F, 0xF7, 0xFB, 0xFD, 0xC0, 0xE0, 0x7F, 0xBF, 
+  0xDF, 0xEE, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x04, 0x1C, 0x38, 0x20, 
+  0xFF, 0xFF, 0xFF, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xFF, 0xFF, 
+  0xFF, 0x01, 0x00, 0x3C, 0x03, 0xC0, 0x10, 0x00, 0xF8, 0x1F, 0xE1, 0xFF, 
+  0x8E, 0x1E, 0xE0, 0x7F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x07, 0xF8, 0x39, 
+  0xFF, 0xC7, 0xFC, 0x1F, 0x80, 0x01, 0x00, 0xE0, 0x38, 0x04, 0x0F, 0x0F, 
+  0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x77, 0x0E, 0xE1, 
+  0xDF, 0xF9, 0xFE, 0x1F, 0x80, 0x01, 0x00, 0x3C, 0x03, 0xC0, 0x10, 0x0E, 
+  0x07, 0xB8, 0x79, 0xE3, 0x87, 0xB8, 0x1D, 0xC0, 0xFC, 0x03, 0xE0, 0x0E, 
+  0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x08, 0x83, 0xB8, 
+  0x3C, 0x00, 0x00, 0xF8, 0x7F, 0x9F, 0xFB, 0xC6, 0xF0, 0x1C, 0x03, 0x80, 
+  0x70, 0x0E, 0x01, 0xE0, 0x9F, 0xF1, 0xFF, 0x1F, 0x80, 0x21, 0x07, 0xE0, 
+  0x78, 0x00, 0x0F, 0xC1, 0xFF, 0x3F, 0xF7, 0x1E, 0xE1, 0xFC, 0x1F, 0x83, 
+  0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xF7, 0xFC, 0xFE, 0x00, 0x42, 0x3F, 0x0F, 
+  0x00, 0x0F, 0xF7, 0xFB, 0xFD, 0xC0, 0xE0, 0x7F, 0xBF, 0xDF, 0xEE, 0x07, 
+  0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x21, 0x07, 0xF0, 0x78, 0x00, 0x0C, 0x0F, 
+  0xC1, 0xFC, 0x3F, 0xC7, 0xF8, 0xFB, 0x9F, 0x7B, 0xF7, 0xFE, 0x7F, 0xC7, 
+  0xF8, 0xFF, 0x0F, 0xE0, 0xE0, 0x42, 0x1F, 0x83, 0xC0, 0x00, 0xFC, 0x3F, 
+  0xCF, 0xFB, 0x8E, 0xE1, 0xF8, 0xEF, 0xFB, 0xFC, 0xFE, 0x39, 0xCE, 0x7B, 
+  0x8E, 0xE3, 0xC0, 0x10, 0x83, 0xF0, 0x3C, 0x00, 0x00, 0xF0, 0x7F, 0x9F, 
+  0xFB, 0x84, 0x70, 0x0F, 0xE0, 0xFE, 0x07, 0xE0, 0x1E, 0xC1, 0xFE, 0x73, 
+  0xFE, 0x1F, 0x80, 0x21, 0x0F, 0xC1, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 
+  0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 
+  0x00, 0x06, 0x01, 0xE0, 0x64, 0x07, 0x8F, 0x6F, 0xE1, 0xFC, 0x3F, 0x87, 
+  0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x77, 0x0E, 0xE1, 0xDF, 0xF9, 0xFE, 0x1F, 
+  0x80, 0x21, 0x0F, 0xC1, 0xE0, 0x00, 0x7F, 0xDF, 0xF7, 0xFC, 0x0E, 0x07, 
+  0x03, 0xC1, 0xE0, 0x70, 0x3C, 0x1E, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xEF, 
+  0xDF, 0x3E, 0x6C, 0xC0 };
+
+const GFXglyph Lexend_Bold18pt7b_sparseGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   6,  16,   7,    1,  -12 },   // 0x28 '('
+  {    13,   6,  16,   7,    0,  -12 },   // 0x29 ')'
+  {    25,   3,   6,   5,    1,   -1 },   // 0x2C ','
+  {    28,   6,   3,   8,    1,   -6 },   // 0x2D '-'
+  {    31,   3,   3,   5,    1,   -2 },   // 0x2E '.'
+  {    33,  11,  16,  11,    0,  -12 },   // 0x2F '/'
+  {    55,  10,  13,  12,    1,  -12 },   // 0x30 '0'
+  {    72,   8,  13,  10,    1,  -12 },   // 0x31 '1'
+  {    85,  10,  13,  11,    0,  -12 },   // 0x33 '3'
+  {   102,   9,  13,  10,    0,  -12 },   // 0x3F '?'
+  {   117,  13,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   139,  10,  13,  13,    2,  -12 },   // 0x42 'B'
+  {   156,  11,  13,  12,    1,  -12 },   // 0x43 'C'
+  {   174,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {   192,   9,  13,  12,    2,  -12 },   // 0x45 'E'
+  {   207,   8,  13,  11,    2,  -12 },   // 0x46 'F'
+  {   220,  12,  13,  14,    1,  -12 },   // 0x47 'G'
+  {   240,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {   257,   8,  13,  10,    1,  -12 },   // 0x49 'I'
+  {   270,  10,  13,  12,    1,  -12 },   // 0x4A 'J'
+  {   287,  11,  13,  13,    2,  -12 },   // 0x4B 'K'
+  {   305,   8,  13,  11,    2,  -12 },   // 0x4C 'L'
+  {   318,  12,  13,  16,    2,  -12 },   // 0x4D 'M'
+  {   338,  11,  13,  15,    2,  -12 },   // 0x4E 'N'
+  {   356,  13,  13,  15,    1,  -12 },   // 0x4F 'O'
+  {   378,   9,  13,  12,    2,  -12 },   // 0x50 'P'
+  {   393,  10,  13,  13,    2,  -12 },   // 0x52 'R'
+  {   410,  11,  13,  11,    0,  -12 },   // 0x53 'S'
+  {   428,  10,  13,  12,    1,  -12 },   // 0x54 'T'
+  {   445,  11,  13,  14,    1,  -12 },   // 0x55 'U'
+  {   463,  13,  13,  13,    0,  -12 },   // 0x56 'V'
+  {   485,  13,  13,  12,    0,  -12 },   // 0x59 'Y'
+  {   507,  10,  13,  12,    1,  -12 },   // 0x5A 'Z'
+  {   524,  13,  17,  12,    0,  -16 },   // 0xC1
+  {   552,   9,  17,  12,    2,  -16 },   // 0xC9
+  {   572,   8,  17,  10,    1,  -16 },   // 0xCD
+  {   589,  13,  17,  15,    1,  -16 },   // 0xD3
+  {   617,  11,  17,  14,    1,  -16 },   // 0xDA
+  {   641,  13,  17,  12,    0,  -16 },   // 0xDD
+  {   669,  11,  17,  12,    1,  -16 },   // 0x10C
+  {   693,  11,  17,  14,    2,  -16 },   // 0x10E
+  {   717,   9,  17,  12,    2,  -16 },   // 0x11A
+  {   737,  11,  17,  15,    2,  -16 },   // 0x147
+  {   761,  10,  17,  13,    2,  -16 },   // 0x158
+  {   783,  11,  17,  11,    0,  -16 },   // 0x160
+  {   807,  10,  17,  12,    1,  -16 },   // 0x164
+  {   829,  11,  17,  14,    1,  -16 },   // 0x16E
+  {   853,  10,  17,  12,    1,  -16 },   // 0x17D
+  {   875,   7,   5,   9,    1,  -12 },   // 0x201C
+  {   875,   7,   5,   9,    1,  -12 }   // 0x201D
+};
+
+const uint16_t Lexend_Bold18pt7b_sparseCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Bold18pt7b_sparse PROGMEM = {
+  { (uint8_t  *)Lexend_Bold18pt7b_sparseBitmaps,
+    (GFXglyph *)Lexend_Bold18pt7b_sparseGlyphs,
+    SPARSE_FONT_FIRST, 50, 23 },
+  Lexend_Bold18pt7b_sparseCodepoints };
+
+// Approx. 1410 bytes
+
+#endif // LEXEND_BOLD18PT7B_SPARSE_H
@@ -0,0 +1,168 @@
+#ifndef LEXEND_BOLD24PT7B_RLE_H
+#define LEXEND_BOLD24PT7B_RLE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Bold24pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES,
+// glyph bitmaps run-length encoded
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Bold24pt7b_rleBitmaps[] PROGMEM = {
+  0x10, 0x51, 0x63, 0x45, 0x25, 0x34, 0x34, 0x44, 0x34, 0x44, 0x44, 0x44, 
+  0x44, 0x44, 0x44, 0x44, 0x54, 0x44, 0x54, 0x54, 0x45, 0x52, 0x10, 0x21, 
+  0x63, 0x45, 0x54, 0x54, 0x44, 0x54, 0x44, 0x44, 0x44, 0x53, 0x53, 0x44, 
+  0x44, 0x44, 0x44, 0x34, 0x34, 0x35, 0x25, 0x43, 0x40, 0x13, 0x15, 0x14, 
+  0x23, 0x23, 0x13, 0x13, 0x31, 0x30, 0x0F, 0xF6, 0x1F, 0x00, 0xA4, 0xA3, 
+  0xA4, 0xA3, 0xA4, 0xA3, 0xA4, 0xA3, 0xA4, 0xA3, 0xA4, 0xA3, 0xA4, 0xA3, 
+  0xA4, 0xA3, 0xA4, 0xA4, 0x94, 0x95, 0x90, 0x46, 0x79, 0x4B, 0x25, 0x25, 
+  0x24, 0x49, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x45, 0x15, 0x25, 
+  0x2C, 0x3A, 0x66, 0x40, 0x34, 0x46, 0x37, 0x37, 0x37, 0x31, 0x24, 0x64, 
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x3F, 0xFA, 0x1A, 0x2B, 0x1A, 0x38, 
+  0x74, 0x74, 0x76, 0x67, 0x58, 0x41, 0x35, 0x84, 0x93, 0x12, 0x58, 0x3F, 
+  0x12, 0xA4, 0x63, 0x35, 0x49, 0x1A, 0x15, 0x15, 0x12, 0x44, 0x21, 0x44, 
+  0x65, 0x55, 0x46, 0x55, 0x63, 0xFF, 0x03, 0x84, 0x74, 0x74, 0x40, 0x64, 
+  0xD5, 0xC5, 0xB6, 0xB7, 0xA7, 0x94, 0x14, 0x84, 0x14, 0x74, 0x24, 0x74, 
+  0x34, 0x63, 0x44, 0x5D, 0x4D, 0x3E, 0x34, 0x74, 0x24, 0x74, 0x14, 0x85, 
+  0x0A, 0x4C, 0x2C, 0x2D, 0x14, 0x54, 0x14, 0x54, 0x14, 0x44, 0x2B, 0x3C, 
+  0x2D, 0x14, 0x59, 0x68, 0x68, 0x4F, 0x41, 0xC2, 0xB3, 0x57, 0x7A, 0x3D, 
+  0x2C, 0x25, 0x61, 0x34, 0xA5, 0xA4, 0xB4, 0xB4, 0xB5, 0xA5, 0xB5, 0x61, 
+  0x3D, 0x3D, 0x3B, 0x68, 0x20, 0x0A, 0x6C, 0x4D, 0x3E, 0x24, 0x56, 0x14, 
+  0x65, 0x14, 0x74, 0x14, 0x74, 0x14, 0x79, 0x74, 0x14, 0x74, 0x14, 0x74, 
+  0x14, 0x65, 0x1E, 0x2D, 0x3C, 0x4A, 0x60, 0x0F, 0xFF, 0x78, 0x48, 0x48, 
+  0xB1, 0xB1, 0xB1, 0x48, 0x48, 0x48, 0x48, 0xFF, 0x60, 0x0F, 0xFF, 0x78, 
+  0x48, 0x48, 0xB1, 0xB1, 0xB1, 0xB1, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 
+  0x67, 0x8A, 0x5E, 0x3D, 0x35, 0x62, 0x44, 0xC5, 0xC4, 0xD4, 0x5C, 0x5D, 
+  0x4D, 0x84, 0x15, 0x64, 0x28, 0x16, 0x3D, 0x5B, 0x88, 0x40, 0x04, 0x78, 
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x7F, 0xFF, 0x87, 0x87, 0x87, 0x87, 0x87, 
+  0x87, 0x87, 0x40, 0x0F, 0xFA, 0x34, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 
+  0x64, 0x64, 0x64, 0x3F, 0xF0, 0x49, 0x49, 0x49, 0x49, 0x74, 0x94, 0x94, 
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x41, 0x44, 0x33, 0x16, 0x2A, 0x48, 0x66, 
+  0x50, 0x04, 0x65, 0x14, 0x55, 0x24, 0x45, 0x34, 0x35, 0x44, 0x25, 0x54, 
+  0x15, 0x69, 0x78, 0x89, 0x7A, 0x65, 0x15, 0x54, 0x34, 0x54, 0x35, 0x44, 
+  0x45, 0x34, 0x55, 0x24, 0x64, 0x24, 0x75, 0x04, 0x84, 0x84, 0x84, 0x84, 
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8F, 0xFF, 0x30, 0x04, 
+  0x99, 0x89, 0x7B, 0x5C, 0x5D, 0x3F, 0x02, 0xF0, 0x1C, 0x17, 0x18, 0x26, 
+  0x18, 0x25, 0x28, 0x33, 0x38, 0x33, 0x38, 0x98, 0x98, 0x98, 0x94, 0x04, 
+  0x79, 0x69, 0x6A, 0x5B, 0x4C, 0x3C, 0x38, 0x14, 0x28, 0x15, 0x18, 0x2D, 
+  0x34, 0x17, 0x3C, 0x4B, 0x5A, 0x69, 0x69, 0x74, 0x57, 0x8B, 0x5D, 0x3F, 
+  0x02, 0x55, 0xB7, 0xA8, 0x89, 0x89, 0x89, 0x98, 0x97, 0x51, 0x55, 0x61, 
+  0xF0, 0x3D, 0x5B, 0x87, 0x50, 0x09, 0x4B, 0x2C, 0x1C, 0x14, 0x49, 0x58, 
+  0x58, 0x4F, 0x21, 0xC1, 0xA3, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0A, 
+  0x4B, 0x3C, 0x2D, 0x14, 0x54, 0x14, 0x54, 0x14, 0x54, 0x14, 0x54, 0x1D, 
+  0x1C, 0x2A, 0x44, 0x25, 0x34, 0x34, 0x34, 0x35, 0x24, 0x45, 0x14, 0x54, 
+  0x14, 0x55, 0x56, 0x6A, 0x3C, 0x24, 0x34, 0x25, 0x51, 0x35, 0xA6, 0x89, 
+  0x6A, 0x5A, 0x86, 0x21, 0x74, 0x22, 0x6A, 0x35, 0x1D, 0x2B, 0x57, 0x30, 
+  0x0F, 0xFF, 0xB5, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 
+  0x4A, 0x4A, 0x4A, 0x45, 0x04, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 
+  0x68, 0x68, 0x68, 0x68, 0x69, 0x54, 0x1D, 0x1C, 0x3A, 0x66, 0x40, 0x04, 
+  0x94, 0x14, 0x74, 0x24, 0x74, 0x25, 0x64, 0x34, 0x54, 0x44, 0x54, 0x54, 
+  0x43, 0x64, 0x34, 0x64, 0x34, 0x74, 0x14, 0x84, 0x14, 0x97, 0xA7, 0xA7, 
+  0xB5, 0xC5, 0xD3, 0x70, 0x05, 0x75, 0x14, 0x65, 0x25, 0x54, 0x45, 0x35, 
+  0x54, 0x25, 0x74, 0x14, 0x89, 0x97, 0xB5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 
+  0xC5, 0xC5, 0xC5, 0x60, 0x1D, 0x1D, 0x1D, 0x1C, 0x95, 0x85, 0x85, 0x94, 
+  0x95, 0x85, 0x85, 0x94, 0x95, 0x8F, 0xFF, 0xA0, 0xA1, 0xE3, 0xC5, 0xB7, 
+  0xB2, 0xFF, 0x24, 0xD5, 0xC5, 0xB6, 0xB7, 0xA7, 0x94, 0x14, 0x84, 0x14, 
+  0x74, 0x24, 0x74, 0x34, 0x63, 0x44, 0x5D, 0x4D, 0x3E, 0x34, 0x74, 0x24, 
+  0x74, 0x14, 0x85, 0x81, 0x93, 0x75, 0x67, 0x62, 0xF3, 0xFF, 0xF7, 0x84, 
+  0x84, 0x8B, 0x1B, 0x1B, 0x14, 0x84, 0x84, 0x84, 0x8F, 0xF6, 0x61, 0x82, 
+  0x65, 0x45, 0x52, 0xF1, 0xFF, 0xA3, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 
+  0x46, 0x46, 0x46, 0x43, 0xFF, 0x00, 0xA1, 0xF0, 0x2D, 0x5B, 0x5C, 0x2F, 
+  0xF1, 0x78, 0xB5, 0xD3, 0xF0, 0x25, 0x5B, 0x7A, 0x88, 0x98, 0x98, 0x99, 
+  0x89, 0x75, 0x15, 0x56, 0x1F, 0x03, 0xD5, 0xB8, 0x75, 0x91, 0xB3, 0x95, 
+  0x87, 0x82, 0xF6, 0x46, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 
+  0x86, 0x86, 0x86, 0x95, 0x41, 0xD1, 0xC3, 0xA6, 0x64, 0xA1, 0xE3, 0xC5, 
+  0xB7, 0xB2, 0xFB, 0x57, 0x51, 0x46, 0x52, 0x55, 0x44, 0x53, 0x55, 0x42, 
+  0x57, 0x41, 0x48, 0x99, 0x7B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
+  0x5C, 0x56, 0x52, 0x42, 0x69, 0x86, 0xA4, 0xF9, 0x77, 0xA3, 0xD2, 0xC2, 
+  0x56, 0x13, 0x4A, 0x5A, 0x4B, 0x4B, 0x4B, 0x5A, 0x5B, 0x56, 0x13, 0xD3, 
+  0xD3, 0xB6, 0x82, 0x41, 0x42, 0x89, 0x86, 0xC3, 0xF8, 0xA6, 0xC4, 0xD3, 
+  0xE2, 0x45, 0x61, 0x46, 0x51, 0x47, 0x41, 0x47, 0x41, 0x47, 0x97, 0x41, 
+  0x47, 0x41, 0x47, 0x41, 0x46, 0x51, 0xE2, 0xD3, 0xC4, 0xA6, 0x31, 0x42, 
+  0x49, 0x46, 0x83, 0xF1, 0xFF, 0xF7, 0x84, 0x84, 0x8B, 0x1B, 0x1B, 0x14, 
+  0x84, 0x84, 0x84, 0x8F, 0xF6, 0x42, 0x41, 0x79, 0x86, 0xA3, 0xF6, 0x47, 
+  0x96, 0x96, 0xA5, 0xB4, 0xC3, 0xC3, 0x81, 0x42, 0x81, 0x51, 0x82, 0xD3, 
+  0x41, 0x73, 0xC4, 0xB5, 0xA6, 0x96, 0x97, 0x40, 0x22, 0x42, 0x68, 0x76, 
+  0x94, 0xF5, 0xA4, 0xB3, 0xC2, 0xD1, 0x45, 0x41, 0x45, 0x41, 0x45, 0x41, 
+  0x45, 0x41, 0xD1, 0xC2, 0xA4, 0x42, 0x53, 0x43, 0x43, 0x43, 0x52, 0x44, 
+  0x51, 0x45, 0x41, 0x45, 0x50, 0x42, 0x42, 0x68, 0x76, 0x94, 0xF8, 0x66, 
+  0xA3, 0xC2, 0x43, 0x42, 0x55, 0x13, 0x5A, 0x68, 0x96, 0xA5, 0xA8, 0x62, 
+  0x17, 0x42, 0x26, 0xA3, 0x51, 0xD2, 0xB5, 0x73, 0x32, 0x42, 0x59, 0x76, 
+  0x94, 0xF4, 0xFF, 0xFB, 0x54, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x50, 0x54, 0x96, 0x82, 0x22, 0x82, 0x22, 
+  0x95, 0x44, 0x23, 0x18, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 
+  0x68, 0x68, 0x69, 0x54, 0x1D, 0x1C, 0x3A, 0x66, 0x40, 0x41, 0x42, 0x69, 
+  0x66, 0xA3, 0xF5, 0xD1, 0xD1, 0xD1, 0xC9, 0x58, 0x58, 0x59, 0x49, 0x58, 
+  0x58, 0x59, 0x49, 0x58, 0xFF, 0xFA, 0x14, 0x18, 0x23, 0x14, 0x23, 0x13, 
+  0x33, 0x13, 0x33, 0x13, 0x32, 0x23, 0x23, 0x20 };
+
+const GFXglyph Lexend_Bold24pt7b_rleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   8,  21,   9,    1,  -16 },   // 0x28 '('
+  {    23,   8,  21,   9,    0,  -16 },   // 0x29 ')'
+  {    45,   5,   8,   7,    1,   -2 },   // 0x2C ','
+  {    54,   9,   4,  11,    1,   -8 },   // 0x2D '-'
+  {    56,   4,   4,   6,    1,   -3 },   // 0x2E '.'
+  {    58,  14,  20,  14,    0,  -16 },   // 0x2F '/'
+  {    79,  14,  17,  16,    1,  -16 },   // 0x30 '0'
+  {   100,  10,  17,  13,    2,  -16 },   // 0x31 '1'
+  {   116,  12,  17,  14,    1,  -16 },   // 0x33 '3'
+  {   135,  11,  17,  13,    1,  -16 },   // 0x3F '?'
+  {   155,  17,  17,  17,    0,  -16 },   // 0x41 'A'
+  {   180,  14,  17,  17,    2,  -16 },   // 0x42 'B'
+  {   201,  15,  17,  17,    1,  -16 },   // 0x43 'C'
+  {   221,  16,  17,  19,    2,  -16 },   // 0x44 'D'
+  {   247,  12,  17,  15,    2,  -16 },   // 0x45 'E'
+  {   261,  12,  17,  15,    2,  -16 },   // 0x46 'F'
+  {   276,  17,  17,  19,    1,  -16 },   // 0x47 'G'
+  {   298,  15,  17,  19,    2,  -16 },   // 0x48 'H'
+  {   315,  10,  17,  13,    2,  -16 },   // 0x49 'I'
+  {   329,  13,  17,  16,    1,  -16 },   // 0x4A 'J'
+  {   349,  16,  17,  18,    2,  -16 },   // 0x4B 'K'
+  {   379,  12,  17,  15,    2,  -16 },   // 0x4C 'L'
+  {   395,  17,  17,  21,    2,  -16 },   // 0x4D 'M'
+  {   419,  15,  17,  19,    2,  -16 },   // 0x4E 'N'
+  {   440,  17,  17,  19,    1,  -16 },   // 0x4F 'O'
+  {   461,  13,  17,  16,    2,  -16 },   // 0x50 'P'
+  {   479,  14,  17,  17,    2,  -16 },   // 0x52 'R'
+  {   506,  14,  17,  15,    0,  -16 },   // 0x53 'S'
+  {   528,  14,  17,  16,    1,  -16 },   // 0x54 'T'
+  {   544,  14,  17,  18,    2,  -16 },   // 0x55 'U'
+  {   563,  17,  17,  17,    0,  -16 },   // 0x56 'V'
+  {   592,  17,  17,  17,    0,  -16 },   // 0x59 'Y'
+  {   616,  14,  17,  16,    1,  -16 },   // 0x5A 'Z'
+  {   632,  17,  23,  17,    0,  -22 },   // 0xC1
+  {   663,  12,  23,  15,    2,  -22 },   // 0xC9
+  {   682,  10,  23,  13,    2,  -22 },   // 0xCD
+  {   702,  17,  23,  19,    1,  -22 },   // 0xD3
+  {   729,  14,  23,  18,    2,  -22 },   // 0xDA
+  {   753,  17,  23,  17,    0,  -22 },   // 0xDD
+  {   782,  15,  22,  17,    1,  -21 },   // 0x10C
+  {   807,  16,  22,  19,    2,  -21 },   // 0x10E
+  {   838,  12,  22,  15,    2,  -21 },   // 0x11A
+  {   857,  15,  22,  19,    2,  -21 },   // 0x147
+  {   884,  14,  22,  17,    2,  -21 },   // 0x158
+  {   917,  14,  22,  15,    0,  -21 },   // 0x160
+  {   944,  14,  22,  16,    1,  -21 },   // 0x164
+  {   966,  14,  22,  18,    2,  -21 },   // 0x16E
+  {   993,  14,  22,  16,    1,  -21 },   // 0x17D
+  {  1014,  10,   7,  11,    1,  -16 },   // 0x201C
+  {  1014,  10,   7,  11,    1,  -16 }   // 0x201D
+};
+
+const uint16_t Lexend_Bold24pt7b_rleCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Bold24pt7b_rle PROGMEM = {
+  { (uint8_t  *)Lexend_Bold24pt7b_rleBitmaps,
+    (GFXglyph *)Lexend_Bold24pt7b_rleGlyphs,
+    SPARSE_RLE_FONT_FIRST, 50, 30 },
+  Lexend_Bold24pt7b_rleCodepoints };
+
+// Approx. 1558 bytes
+
+#endif // LEXEND_BOLD24PT7B_RLE_H
@@ -0,0 +1,209 @@
+#ifndef LEXEND_BOLD24PT7B_SPARSE_H
+#define LEXEND_BOLD24PT7B_SPARSE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Bold24pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Bold24pt7b_sparseBitmaps[] PROGMEM = {
+  0x00, 0x04, 0x0E, 0x1F, 0x3E, 0x3C, 0x78, 0x78, 0xF0, 0xF0, 0xF0, 0xF0, 
+  0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0x3C, 0x1E, 0x1F, 0x06, 0x20, 0x70, 
+  0xF8, 0x3C, 0x1E, 0x1E, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x0F, 0x0F, 
+  0x0F, 0x0F, 0x1E, 0x3C, 0x7C, 0xF8, 0x70, 0x77, 0xDE, 0x73, 0xBB, 0x88, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0x00, 0x3C, 0x00, 0xE0, 0x07, 
+  0x80, 0x1C, 0x00, 0xF0, 0x03, 0x80, 0x1E, 0x00, 0x70, 0x03, 0xC0, 0x0E, 
+  0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x38, 0x01, 0xE0, 0x07, 0x00, 0x3C, 
+  0x00, 0xF0, 0x07, 0x80, 0x3E, 0x00, 0x0F, 0xC0, 0x7F, 0xC3, 0xFF, 0x9F, 
+  0x3E, 0x78, 0x7F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 
+  0x03, 0xFC, 0x0F, 0xF8, 0x7D, 0xF3, 0xE7, 0xFF, 0x8F, 0xFC, 0x0F, 0xC0, 
+  0x1E, 0x1F, 0x8F, 0xE3, 0xF8, 0xFE, 0x27, 0x81, 0xE0, 0x78, 0x1E, 0x07, 
+  0x81, 0xE0, 0x78, 0x1E, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xE7, 
+  0xFF, 0x7F, 0xE3, 0xFC, 0x07, 0x80, 0xF0, 0x1F, 0x81, 0xFC, 0x1F, 0xE1, 
+  0x1F, 0x00, 0xF0, 0x07, 0x60, 0xFF, 0x1F, 0xFF, 0xE7, 0xFE, 0x1F, 0x80, 
+  0x1F, 0x0F, 0xFB, 0xFF, 0x7D, 0xF6, 0x1E, 0x43, 0xC0, 0xF8, 0x3E, 0x1F, 
+  0x83, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x38, 0x07, 0x80, 0xF0, 0x1E, 0x00, 
+  0x03, 0xC0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x7F, 0x00, 0x3F, 
+  0x80, 0x3D, 0xE0, 0x1E, 0xF0, 0x1E, 0x78, 0x0F, 0x1E, 0x07, 0x0F, 0x07, 
+  0xFF, 0xC3, 0xFF, 0xE3, 0xFF, 0xF1, 0xE0, 0x3C, 0xF0, 0x1E, 0xF0, 0x0F, 
+  0x80, 0xFF, 0xC3, 0xFF, 0xCF, 0xFF, 0x3F, 0xFE, 0xF0, 0x7B, 0xC1, 0xEF, 
+  0x0F, 0x3F, 0xF8, 0xFF, 0xF3, 0xFF, 0xEF, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 
+  0xC3, 0xFF, 0xFF, 0xBF, 0xFC, 0xFF, 0xE0, 0x07, 0xF0, 0x1F, 0xF8, 0xFF, 
+  0xF9, 0xFF, 0xE7, 0xC0, 0x8F, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x01, 
+  0xE0, 0x03, 0xE0, 0x07, 0xC0, 0x07, 0xC0, 0x8F, 0xFF, 0x8F, 0xFF, 0x8F, 
+  0xFE, 0x07, 0xF8, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0xFF, 0xFC, 0xF0, 
+  0x7E, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1F, 0xF0, 0x1E, 0xF0, 
+  0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xFF, 0xFC, 0xFF, 0xF8, 0xFF, 0xF0, 0xFF, 
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 
+  0xFE, 0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 
+  0xF0, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0x00, 0xF0, 0x0F, 0x00, 
+  0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x03, 0xF8, 0x07, 0xFE, 0x0F, 0xFF, 0xC7, 
+  0xFF, 0xC7, 0xC0, 0xC3, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x7F, 
+  0xF8, 0x3F, 0xFE, 0x1F, 0xFF, 0x00, 0xF7, 0xC0, 0xF3, 0xFD, 0xF8, 0xFF, 
+  0xF8, 0x3F, 0xF8, 0x07, 0xF8, 0x00, 0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 
+  0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 
+  0xF0, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x07, 0x81, 0xE0, 0x78, 
+  0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x8F, 0xFF, 0xFF, 0xFF, 0xC0, 
+  0x0F, 0xF8, 0x7F, 0xC3, 0xFE, 0x1F, 0xF0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC2, 0x1E, 0x3B, 0xF3, 0xFF, 
+  0x0F, 0xF0, 0x3F, 0x00, 0xF0, 0x3E, 0xF0, 0x7C, 0xF0, 0xF8, 0xF1, 0xF0, 
+  0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0xFF, 0xC0, 
+  0xFB, 0xE0, 0xF1, 0xE0, 0xF1, 0xF0, 0xF0, 0xF8, 0xF0, 0x7C, 0xF0, 0x3C, 
+  0xF0, 0x1F, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x07, 0xFC, 0x03, 0xFE, 0x03, 0xFF, 0x83, 
+  0xFF, 0xC1, 0xFF, 0xF1, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xF7, 0xF7, 0xF9, 
+  0xFB, 0xFC, 0xF9, 0xFE, 0x38, 0xFF, 0x1C, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 
+  0xE0, 0x0F, 0xF0, 0x07, 0x80, 0xF0, 0x1F, 0xF0, 0x3F, 0xE0, 0x7F, 0xE0, 
+  0xFF, 0xE1, 0xFF, 0xE3, 0xFF, 0xC7, 0xFB, 0xCF, 0xF7, 0xDF, 0xE7, 0xFF, 
+  0xC7, 0xBF, 0x8F, 0xFF, 0x0F, 0xFE, 0x0F, 0xFC, 0x0F, 0xF8, 0x1F, 0xF0, 
+  0x1E, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0xE7, 0xC1, 0xFF, 
+  0xC0, 0x7F, 0xE0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFE, 0x01, 
+  0xFF, 0x01, 0xF7, 0xC1, 0xFB, 0xFF, 0xF8, 0xFF, 0xF8, 0x3F, 0xF8, 0x07, 
+  0xF0, 0x00, 0xFF, 0x87, 0xFF, 0x3F, 0xFD, 0xFF, 0xEF, 0x0F, 0xF8, 0x3F, 
+  0xC1, 0xFE, 0x1F, 0xFF, 0xF7, 0xFF, 0xBF, 0xF1, 0xE0, 0x0F, 0x00, 0x78, 
+  0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x00, 0xFF, 0xC3, 0xFF, 0x8F, 0xFF, 0x3F, 
+  0xFE, 0xF0, 0x7B, 0xC1, 0xEF, 0x07, 0xBC, 0x1E, 0xFF, 0xFB, 0xFF, 0xCF, 
+  0xFC, 0x3C, 0xF8, 0xF1, 0xE3, 0xC7, 0xCF, 0x0F, 0xBC, 0x1E, 0xF0, 0x7C, 
+  0x07, 0xE0, 0x7F, 0xE3, 0xFF, 0xCF, 0x1E, 0x7C, 0x11, 0xF0, 0x03, 0xF0, 
+  0x0F, 0xF8, 0x1F, 0xF8, 0x3F, 0xF0, 0x0F, 0xC8, 0x0F, 0x30, 0x3F, 0xF1, 
+  0xF7, 0xFF, 0xCF, 0xFE, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 
+  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 
+  0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 
+  0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF8, 0x3D, 0xFF, 
+  0xF7, 0xFF, 0x8F, 0xFC, 0x0F, 0xC0, 0xF0, 0x07, 0xBC, 0x07, 0x9E, 0x03, 
+  0xCF, 0x81, 0xE3, 0xC1, 0xE1, 0xE0, 0xF0, 0x78, 0x70, 0x3C, 0x78, 0x1E, 
+  0x3C, 0x07, 0xBC, 0x03, 0xDE, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 
+  0x0F, 0x80, 0x07, 0xC0, 0x01, 0xC0, 0x00, 0xF8, 0x0F, 0xBC, 0x0F, 0x9F, 
+  0x07, 0x87, 0xC7, 0xC1, 0xE7, 0xC0, 0x7B, 0xC0, 0x3F, 0xE0, 0x0F, 0xE0, 
+  0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 
+  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x7F, 0xFD, 0xFF, 0xF7, 
+  0xFF, 0xDF, 0xFE, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x00, 0xF0, 0x07, 0xC0, 
+  0x3E, 0x01, 0xF0, 0x07, 0x80, 0x3E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFC, 0x00, 0x20, 0x00, 0x70, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0x30, 
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x03, 0xF0, 0x01, 
+  0xFC, 0x00, 0xFE, 0x00, 0xF7, 0x80, 0x7B, 0xC0, 0x79, 0xE0, 0x3C, 0x78, 
+  0x1C, 0x3C, 0x1F, 0xFF, 0x0F, 0xFF, 0x8F, 0xFF, 0xC7, 0x80, 0xF3, 0xC0, 
+  0x7B, 0xC0, 0x3E, 0x00, 0x80, 0x38, 0x0F, 0x81, 0xFC, 0x0C, 0x00, 0x00, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFE, 
+  0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xF0, 0x02, 0x01, 0x81, 0xF0, 0xF8, 0x30, 0x00, 0x0F, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xF1, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 
+  0x81, 0xE0, 0x78, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x20, 0x00, 0x30, 0x00, 
+  0x7C, 0x00, 0x7C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x3F, 0xF8, 
+  0x3F, 0xFE, 0x3F, 0xFF, 0x9F, 0x07, 0xFF, 0x01, 0xFF, 0x80, 0x7F, 0x80, 
+  0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF8, 0x07, 0xFC, 0x07, 0xDF, 0x07, 0xEF, 
+  0xFF, 0xE3, 0xFF, 0xE0, 0xFF, 0xE0, 0x1F, 0xC0, 0x00, 0x40, 0x07, 0x00, 
+  0x7C, 0x03, 0xF8, 0x06, 0x00, 0x00, 0x0F, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 
+  0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 
+  0xF0, 0x3F, 0xC0, 0xFF, 0x83, 0xDF, 0xFF, 0x7F, 0xF8, 0xFF, 0xC0, 0xFC, 
+  0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0x30, 0x00, 
+  0x00, 0x03, 0xE0, 0x3E, 0xF0, 0x3E, 0x7C, 0x1E, 0x1F, 0x1F, 0x07, 0x9F, 
+  0x01, 0xEF, 0x00, 0xFF, 0x80, 0x3F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 
+  0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 
+  0x0F, 0x80, 0x06, 0x18, 0x1F, 0xF0, 0x0F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 
+  0xFE, 0x03, 0xFF, 0x1F, 0xFF, 0x3F, 0xFC, 0xF8, 0x11, 0xE0, 0x07, 0xC0, 
+  0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x11, 
+  0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 0xC0, 0xFF, 0x00, 0x08, 0x60, 0x1F, 0xF0, 
+  0x0F, 0xC0, 0x03, 0x80, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 
+  0xFF, 0xFC, 0xF0, 0x7E, 0xF0, 0x3E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1F, 
+  0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x1E, 0xF0, 0x3E, 0xFF, 0xFC, 0xFF, 0xF8, 
+  0xFF, 0xF0, 0xFF, 0xC0, 0x10, 0xC3, 0xFE, 0x1F, 0x80, 0x70, 0x00, 0x0F, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0xEF, 
+  0xFE, 0xFF, 0xEF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0x0C, 0x20, 0x3F, 0xE0, 0x1F, 0x80, 0x1C, 0x00, 0x00, 0x1E, 0x03, 
+  0xFE, 0x07, 0xFC, 0x0F, 0xFC, 0x1F, 0xFC, 0x3F, 0xFC, 0x7F, 0xF8, 0xFF, 
+  0x79, 0xFE, 0xFB, 0xFC, 0xFF, 0xF8, 0xF7, 0xF1, 0xFF, 0xE1, 0xFF, 0xC1, 
+  0xFF, 0x81, 0xFF, 0x03, 0xFE, 0x03, 0xC0, 0x30, 0xC0, 0xFF, 0x01, 0xF8, 
+  0x03, 0xC0, 0x00, 0x03, 0xFF, 0x0F, 0xFE, 0x3F, 0xFC, 0xFF, 0xFB, 0xC1, 
+  0xEF, 0x07, 0xBC, 0x1E, 0xF0, 0x7B, 0xFF, 0xEF, 0xFF, 0x3F, 0xF0, 0xF3, 
+  0xE3, 0xC7, 0x8F, 0x1F, 0x3C, 0x3E, 0xF0, 0x7B, 0xC1, 0xF0, 0x0C, 0x30, 
+  0x3F, 0xC0, 0x7E, 0x00, 0xF0, 0x00, 0x00, 0x1F, 0x81, 0xFF, 0x8F, 0xFF, 
+  0x3C, 0x79, 0xF0, 0x47, 0xC0, 0x0F, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0xFF, 
+  0xC0, 0x3F, 0x20, 0x3C, 0xC0, 0xFF, 0xC7, 0xDF, 0xFF, 0x3F, 0xF8, 0x3F, 
+  0x80, 0x18, 0x60, 0xFF, 0x80, 0xFC, 0x01, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 
+  0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 
+  0x07, 0x80, 0x1E, 0x00, 0x07, 0x80, 0x3F, 0x00, 0xCC, 0x03, 0x30, 0x07, 
+  0xC3, 0xCE, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 
+  0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xE0, 0xF7, 
+  0xFF, 0xDF, 0xFE, 0x3F, 0xF0, 0x3F, 0x00, 0x08, 0x60, 0x7F, 0xC0, 0xFC, 
+  0x00, 0xE0, 0x00, 0x01, 0xFF, 0xF7, 0xFF, 0xDF, 0xFF, 0x7F, 0xF8, 0x03, 
+  0xE0, 0x1F, 0x00, 0xF8, 0x03, 0xC0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x1E, 
+  0x00, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7B, 0xFC, 
+  0xEF, 0x3B, 0x8E, 0xE3, 0xB8, 0xCE, 0x70 };
+
+const GFXglyph Lexend_Bold24pt7b_sparseGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   8,  21,   9,    1,  -16 },   // 0x28 '('
+  {    22,   8,  21,   9,    0,  -16 },   // 0x29 ')'
+  {    43,   5,   8,   7,    1,   -2 },   // 0x2C ','
+  {    48,   9,   4,  11,    1,   -8 },   // 0x2D '-'
+  {    53,   4,   4,   6,    1,   -3 },   // 0x2E '.'
+  {    55,  14,  20,  14,    0,  -16 },   // 0x2F '/'
+  {    90,  14,  17,  16,    1,  -16 },   // 0x30 '0'
+  {   120,  10,  17,  13,    2,  -16 },   // 0x31 '1'
+  {   142,  12,  17,  14,    1,  -16 },   // 0x33 '3'
+  {   168,  11,  17,  13,    1,  -16 },   // 0x3F '?'
+  {   192,  17,  17,  17,    0,  -16 },   // 0x41 'A'
+  {   229,  14,  17,  17,    2,  -16 },   // 0x42 'B'
+  {   259,  15,  17,  17,    1,  -16 },   // 0x43 'C'
+  {   291,  16,  17,  19,    2,  -16 },   // 0x44 'D'
+  {   325,  12,  17,  15,    2,  -16 },   // 0x45 'E'
+  {   351,  12,  17,  15,    2,  -16 },   // 0x46 'F'
+  {   377,  17,  17,  19,    1,  -16 },   // 0x47 'G'
+  {   414,  15,  17,  19,    2,  -16 },   // 0x48 'H'
+  {   446,  10,  17,  13,    2,  -16 },   // 0x49 'I'
+  {   468,  13,  17,  16,    1,  -16 },   // 0x4A 'J'
+  {   496,  16,  17,  18,    2,  -16 },   // 0x4B 'K'
+  {   530,  12,  17,  15,    2,  -16 },   // 0x4C 'L'
+  {   556,  17,  17,  21,    2,  -16 },   // 0x4D 'M'
+  {   593,  15,  17,  19,    2,  -16 },   // 0x4E 'N'
+  {   625,  17,  17,  19,    1,  -16 },   // 0x4F 'O'
+  {   662,  13,  17,  16,    2,  -16 },   // 0x50 'P'
+  {   690,  14,  17,  17,    2,  -16 },   // 0x52 'R'
+  {   720,  14,  17,  15,    0,  -16 },   // 0x53 'S'
+  {   750,  14,  17,  16,    1,  -16 },   // 0x54 'T'
+  {   780,  14,  17,  18,    2,  -16 },   // 0x55 'U'
+  {   810,  17,  17,  17,    0,  -16 },   // 0x56 'V'
+  {   847,  17,  17,  17,    0,  -16 },   // 0x59 'Y'
+  {   884,  14,  17,  16,    1,  -16 },   // 0x5A 'Z'
+  {   914,  17,  23,  17,    0,  -22 },   // 0xC1
+  {   963,  12,  23,  15,    2,  -22 },   // 0xC9
+  {   998,  10,  23,  13,    2,  -22 },   // 0xCD
+  {  1027,  17,  23,  19,    1,  -22 },   // 0xD3
+  {  1076,  14,  23,  18,    2,  -22 },   // 0xDA
+  {  1117,  17,  23,  17,    0,  -22 },   // 0xDD
+  {  1166,  15,  22,  17,    1,  -21 },   // 0x10C
+  {  1208,  16,  22,  19,    2,  -21 },   // 0x10E
+  {  1252,  12,  22,  15,    2,  -21 },   // 0x11A
+  {  1285,  15,  22,  19,    2,  -21 },   // 0x147
+  {  1327,  14,  22,  17,    2,  -21 },   // 0x158
+  {  1366,  14,  22,  15,    0,  -21 },   // 0x160
+  {  1405,  14,  22,  16,    1,  -21 },   // 0x164
+  {  1444,  14,  22,  18,    2,  -21 },   // 0x16E
+  {  1483,  14,  22,  16,    1,  -21 },   // 0x17D
+  {  1522,  10,   7,  11,    1,  -16 },   // 0x201C
+  {  1522,  10,   7,  11,    1,  -16 }   // 0x201D
+};
+
+const uint16_t Lexend_Bold24pt7b_sparseCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Bold24pt7b_sparse PROGMEM = {
+  { (uint8_t  *)Lexend_Bold24pt7b_sparseBitmaps,
+    (GFXglyph *)Lexend_Bold24pt7b_sparseGlyphs,
+    SPARSE_FONT_FIRST, 50, 30 },
+  Lexend_Bold24pt7b_sparseCodepoints };
+
+// Approx. 2061 bytes
+
+#endif // LEXEND_BOLD24PT7B_SPARSE_H
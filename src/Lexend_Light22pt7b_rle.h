@@ -0,0 +1,166 @@
+#ifndef LEXEND_LIGHT22PT7B_RLE_H
+#define LEXEND_LIGHT22PT7B_RLE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Light22pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES,
+// glyph bitmaps run-length encoded
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Light22pt7b_rleBitmaps[] PROGMEM = {
+  0x10, 0x42, 0x32, 0x32, 0x32, 0x41, 0x42, 0x42, 0x41, 0x51, 0x51, 0x51, 
+  0x51, 0x52, 0x42, 0x52, 0x42, 0x52, 0x52, 0x52, 0x02, 0x52, 0x52, 0x52, 
+  0x42, 0x52, 0x42, 0x42, 0x51, 0x51, 0x51, 0x42, 0x42, 0x41, 0x42, 0x41, 
+  0x42, 0x32, 0x32, 0x40, 0x12, 0x12, 0x21, 0x21, 0x11, 0x11, 0x20, 0x0C, 
+  0x11, 0x16, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 
+  0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x80, 0x43, 0x67, 0x42, 
+  0x42, 0x22, 0x62, 0x11, 0x74, 0x74, 0x83, 0x83, 0x83, 0x83, 0x83, 0x72, 
+  0x12, 0x62, 0x12, 0x52, 0x33, 0x23, 0x45, 0x30, 0x31, 0x52, 0x34, 0x31, 
+  0x21, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x3E, 
+  0x28, 0x82, 0x82, 0x82, 0x92, 0x84, 0x66, 0x51, 0x42, 0xA2, 0x92, 0x92, 
+  0x11, 0x75, 0x52, 0x33, 0x23, 0x45, 0x30, 0x41, 0x57, 0x13, 0x32, 0x12, 
+  0x52, 0x72, 0x72, 0x72, 0x62, 0x44, 0x52, 0x72, 0xFB, 0x17, 0x27, 0x24, 
+  0x53, 0xA3, 0x92, 0x12, 0x82, 0x12, 0x81, 0x22, 0x72, 0x32, 0x62, 0x32, 
+  0x52, 0x51, 0x52, 0x52, 0x49, 0x3B, 0x22, 0x72, 0x21, 0x82, 0x12, 0x94, 
+  0x92, 0x0A, 0x22, 0x62, 0x22, 0x72, 0x12, 0x72, 0x12, 0x72, 0x12, 0x62, 
+  0x29, 0x3A, 0x22, 0x72, 0x12, 0x84, 0x84, 0x84, 0x72, 0x1B, 0x19, 0x30, 
+  0x71, 0x97, 0x44, 0x34, 0x22, 0x72, 0x12, 0xB1, 0xB2, 0xB2, 0xB2, 0xB2, 
+  0xB2, 0xC2, 0xB2, 0xC2, 0x72, 0x3A, 0x47, 0x20, 0x0A, 0x32, 0x63, 0x22, 
+  0x73, 0x12, 0x82, 0x12, 0x94, 0x94, 0x94, 0xA3, 0x94, 0x94, 0x94, 0x82, 
+  0x12, 0x73, 0x1B, 0x29, 0x40, 0x0C, 0x82, 0x82, 0x82, 0x82, 0x88, 0x28, 
+  0x22, 0x82, 0x82, 0x82, 0x82, 0x8F, 0x50, 0x0C, 0x82, 0x82, 0x82, 0x82, 
+  0x89, 0x19, 0x12, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x80, 0x71, 0xB8, 
+  0x63, 0x43, 0x42, 0x82, 0x22, 0xD1, 0xD2, 0xD2, 0xD2, 0x69, 0x69, 0xB2, 
+  0x12, 0xA2, 0x12, 0x92, 0x33, 0x63, 0x44, 0x24, 0x76, 0x40, 0x02, 0x93, 
+  0x93, 0x93, 0x93, 0x93, 0x9F, 0xC9, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 
+  0x10, 0x06, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 
+  0x42, 0x42, 0x2C, 0x57, 0x82, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
+  0xA2, 0xA2, 0x31, 0x61, 0x32, 0x52, 0x43, 0x14, 0x55, 0x50, 0x02, 0x76, 
+  0x63, 0x22, 0x53, 0x32, 0x43, 0x42, 0x32, 0x62, 0x22, 0x72, 0x13, 0x74, 
+  0x12, 0x63, 0x32, 0x52, 0x43, 0x42, 0x52, 0x42, 0x62, 0x32, 0x72, 0x22, 
+  0x73, 0x12, 0x83, 0x02, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 
+  0x72, 0x72, 0x72, 0x72, 0x7F, 0x30, 0x02, 0xA6, 0x97, 0x78, 0x71, 0x14, 
+  0x12, 0x52, 0x14, 0x22, 0x32, 0x24, 0x22, 0x32, 0x24, 0x32, 0x12, 0x34, 
+  0x43, 0x44, 0x43, 0x44, 0x51, 0x54, 0xB4, 0xB4, 0xB4, 0xB2, 0x03, 0x85, 
+  0x86, 0x74, 0x12, 0x64, 0x13, 0x54, 0x22, 0x54, 0x32, 0x44, 0x42, 0x34, 
+  0x43, 0x24, 0x52, 0x24, 0x62, 0x14, 0x76, 0x85, 0x85, 0x92, 0x72, 0xA8, 
+  0x54, 0x43, 0x42, 0x73, 0x22, 0x92, 0x21, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 
+  0xB2, 0x12, 0xA2, 0x12, 0x92, 0x32, 0x72, 0x54, 0x15, 0x67, 0x40, 0x09, 
+  0x22, 0x53, 0x12, 0x62, 0x12, 0x74, 0x74, 0x74, 0x62, 0x19, 0x28, 0x32, 
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x90, 0x09, 0x32, 0x53, 0x22, 0x72, 0x12, 
+  0x72, 0x12, 0x72, 0x12, 0x72, 0x12, 0x72, 0x1A, 0x28, 0x42, 0x52, 0x32, 
+  0x52, 0x32, 0x62, 0x22, 0x62, 0x22, 0x72, 0x12, 0x73, 0x52, 0x76, 0x42, 
+  0x42, 0x22, 0x62, 0x12, 0x92, 0x93, 0x95, 0x85, 0x93, 0xA2, 0x92, 0x11, 
+  0x75, 0x62, 0x14, 0x23, 0x46, 0x20, 0x0A, 0x42, 0x82, 0x82, 0x82, 0x82, 
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x40, 0x02, 0x93, 
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x82, 0x12, 0x72, 
+  0x12, 0x62, 0x38, 0x56, 0x30, 0x02, 0x94, 0x92, 0x12, 0x72, 0x22, 0x72, 
+  0x22, 0x71, 0x42, 0x52, 0x42, 0x52, 0x52, 0x32, 0x62, 0x32, 0x62, 0x31, 
+  0x82, 0x12, 0x82, 0x12, 0x91, 0x11, 0xA3, 0xA2, 0x60, 0x03, 0x83, 0x22, 
+  0x72, 0x33, 0x52, 0x52, 0x42, 0x72, 0x32, 0x82, 0x12, 0x94, 0xB3, 0xB2, 
+  0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x60, 0x1B, 0x92, 0xA2, 0x92, 0x92, 
+  0x92, 0xA2, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x9F, 0x90, 0x81, 0xA3, 
+  0x92, 0xFF, 0x73, 0xA3, 0x92, 0x12, 0x82, 0x12, 0x81, 0x22, 0x72, 0x32, 
+  0x62, 0x32, 0x52, 0x51, 0x52, 0x52, 0x49, 0x3B, 0x22, 0x72, 0x21, 0x82, 
+  0x12, 0x94, 0x92, 0x61, 0x83, 0x53, 0xF9, 0xC8, 0x28, 0x28, 0x28, 0x28, 
+  0x82, 0x82, 0x28, 0x28, 0x28, 0x28, 0x28, 0xF5, 0x41, 0x34, 0x13, 0xE6, 
+  0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 
+  0x2C, 0x91, 0xC3, 0xB2, 0xFE, 0x2A, 0x85, 0x44, 0x34, 0x27, 0x32, 0x29, 
+  0x22, 0x1B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x21, 0x2A, 0x21, 0x29, 0x23, 
+  0x27, 0x25, 0x41, 0x56, 0x74, 0x71, 0xA3, 0x73, 0xFE, 0x29, 0x39, 0x39, 
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x38, 0x21, 0x27, 0x21, 0x26, 
+  0x23, 0x85, 0x63, 0x81, 0xC3, 0x93, 0xF5, 0x1C, 0x11, 0x28, 0x23, 0x27, 
+  0x23, 0x35, 0x25, 0x24, 0x27, 0x23, 0x28, 0x21, 0x29, 0x4B, 0x3B, 0x2C, 
+  0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x26, 0x51, 0x41, 0x63, 0x12, 0x93, 0xF9, 
+  0x19, 0x74, 0x43, 0x42, 0x27, 0x21, 0x2B, 0x1B, 0x2B, 0x2B, 0x2B, 0x2B, 
+  0x2C, 0x2B, 0x2C, 0x27, 0x23, 0xA4, 0x72, 0x31, 0x41, 0x72, 0x23, 0x74, 
+  0xFF, 0x1A, 0x32, 0x63, 0x22, 0x73, 0x12, 0x82, 0x12, 0x94, 0x94, 0x94, 
+  0xA3, 0x94, 0x94, 0x94, 0x82, 0x12, 0x73, 0x1B, 0x29, 0x40, 0x21, 0x41, 
+  0x42, 0x22, 0x54, 0xF8, 0xC8, 0x28, 0x28, 0x28, 0x28, 0x82, 0x82, 0x28, 
+  0x28, 0x28, 0x28, 0x28, 0xF5, 0x41, 0x41, 0x63, 0x13, 0x83, 0xFF, 0x13, 
+  0x85, 0x86, 0x74, 0x12, 0x64, 0x13, 0x54, 0x22, 0x54, 0x32, 0x44, 0x42, 
+  0x34, 0x43, 0x24, 0x52, 0x24, 0x62, 0x14, 0x76, 0x85, 0x85, 0x92, 0x21, 
+  0x41, 0x62, 0x22, 0x74, 0xFE, 0x93, 0x25, 0x32, 0x27, 0x21, 0x27, 0x21, 
+  0x27, 0x21, 0x27, 0x21, 0x27, 0x21, 0xA2, 0x84, 0x25, 0x23, 0x25, 0x23, 
+  0x26, 0x22, 0x26, 0x22, 0x27, 0x21, 0x27, 0x30, 0x31, 0x41, 0x52, 0x22, 
+  0x64, 0xF4, 0x27, 0x64, 0x24, 0x22, 0x26, 0x21, 0x29, 0x29, 0x39, 0x58, 
+  0x59, 0x3A, 0x29, 0x21, 0x17, 0x56, 0x21, 0x42, 0x34, 0x62, 0x21, 0x41, 
+  0x42, 0x22, 0x54, 0xF8, 0xA4, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 
+  0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x24, 0x52, 0x92, 0x11, 0x81, 0x31, 
+  0x71, 0x21, 0x93, 0x42, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
+  0x93, 0x93, 0x82, 0x12, 0x72, 0x12, 0x62, 0x38, 0x56, 0x30, 0x31, 0x41, 
+  0x62, 0x22, 0x74, 0xFE, 0xB9, 0x2A, 0x29, 0x29, 0x29, 0x2A, 0x29, 0x29, 
+  0x29, 0x39, 0x29, 0x29, 0x29, 0xF9, 0x03, 0x24, 0x31, 0x12, 0x31, 0x12, 
+  0x22, 0x11, 0x31, 0x20 };
+
+const GFXglyph Lexend_Light22pt7b_rleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   6,  19,   8,    1,  -14 },   // 0x28 '('
+  {    20,   6,  19,   8,    1,  -14 },   // 0x29 ')'
+  {    40,   3,   6,   5,    1,   -1 },   // 0x2C ','
+  {    47,   6,   2,   9,    1,   -6 },   // 0x2D '-'
+  {    48,   3,   3,   5,    1,   -2 },   // 0x2E '.'
+  {    50,  10,  18,  12,    1,  -14 },   // 0x2F '/'
+  {    69,  11,  16,  13,    1,  -15 },   // 0x30 '0'
+  {    92,   7,  16,  10,    2,  -15 },   // 0x31 '1'
+  {   108,  11,  15,  12,    0,  -14 },   // 0x33 '3'
+  {   127,   9,  16,  11,    1,  -15 },   // 0x3F '?'
+  {   144,  13,  15,  15,    1,  -14 },   // 0x41 'A'
+  {   169,  12,  15,  15,    2,  -14 },   // 0x42 'B'
+  {   192,  13,  16,  15,    1,  -15 },   // 0x43 'C'
+  {   212,  13,  15,  16,    2,  -14 },   // 0x44 'D'
+  {   233,  10,  15,  13,    2,  -14 },   // 0x45 'E'
+  {   247,  10,  15,  13,    2,  -14 },   // 0x46 'F'
+  {   262,  15,  16,  17,    1,  -15 },   // 0x47 'G'
+  {   286,  12,  15,  17,    2,  -14 },   // 0x48 'H'
+  {   301,   6,  15,  10,    2,  -14 },   // 0x49 'I'
+  {   315,  12,  15,  14,    1,  -14 },   // 0x4A 'J'
+  {   334,  13,  15,  15,    2,  -14 },   // 0x4B 'K'
+  {   363,   9,  15,  12,    2,  -14 },   // 0x4C 'L'
+  {   378,  15,  15,  19,    2,  -14 },   // 0x4D 'M'
+  {   406,  13,  15,  17,    2,  -14 },   // 0x4E 'N'
+  {   430,  15,  16,  17,    1,  -15 },   // 0x4F 'O'
+  {   455,  11,  15,  14,    2,  -14 },   // 0x50 'P'
+  {   474,  12,  15,  15,    2,  -14 },   // 0x52 'R'
+  {   501,  11,  16,  13,    1,  -15 },   // 0x53 'S'
+  {   522,  10,  15,  12,    1,  -14 },   // 0x54 'T'
+  {   538,  12,  15,  16,    2,  -14 },   // 0x55 'U'
+  {   557,  13,  15,  15,    1,  -14 },   // 0x56 'V'
+  {   585,  14,  15,  14,    0,  -14 },   // 0x59 'Y'
+  {   607,  12,  15,  14,    1,  -14 },   // 0x5A 'Z'
+  {   622,  13,  20,  15,    1,  -19 },   // 0xC1
+  {   651,  10,  20,  13,    2,  -19 },   // 0xC9
+  {   668,   6,  20,  10,    2,  -19 },   // 0xCD
+  {   685,  15,  20,  17,    1,  -19 },   // 0xD3
+  {   713,  12,  20,  16,    2,  -19 },   // 0xDA
+  {   735,  14,  20,  14,    0,  -19 },   // 0xDD
+  {   762,  13,  20,  15,    1,  -19 },   // 0x10C
+  {   787,  13,  20,  16,    2,  -19 },   // 0x10E
+  {   814,  10,  20,  13,    2,  -19 },   // 0x11A
+  {   833,  13,  20,  17,    2,  -19 },   // 0x147
+  {   863,  12,  20,  15,    2,  -19 },   // 0x158
+  {   896,  11,  20,  13,    1,  -19 },   // 0x160
+  {   922,  10,  20,  12,    1,  -19 },   // 0x164
+  {   943,  12,  20,  16,    2,  -19 },   // 0x16E
+  {   970,  12,  20,  14,    1,  -19 },   // 0x17D
+  {   990,   7,   5,   9,    1,  -14 },   // 0x201C
+  {   990,   7,   5,   9,    1,  -14 }   // 0x201D
+};
+
+const uint16_t Lexend_Light22pt7b_rleCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Light22pt7b_rle PROGMEM = {
+  { (uint8_t  *)Lexend_Light22pt7b_rleBitmaps,
+    (GFXglyph *)Lexend_Light22pt7b_rleGlyphs,
+    SPARSE_RLE_FONT_FIRST, 50, 28 },
+  Lexend_Light22pt7b_rleCodepoints };
+
+// Approx. 1530 bytes
+
+#endif // LEXEND_LIGHT22PT7B_RLE_H
@@ -0,0 +1,175 @@
+#ifndef LEXEND_LIGHT22PT7B_SPARSE_H
+#define LEXEND_LIGHT22PT7B_SPARSE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Light22pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Light22pt7b_sparseBitmaps[] PROGMEM = {
+  0x00, 0x0C, 0x63, 0x18, 0x43, 0x0C, 0x20, 0x82, 0x08, 0x20, 0xC3, 0x06, 
+  0x18, 0x30, 0x60, 0xC0, 0xC1, 0x83, 0x06, 0x18, 0x30, 0xC3, 0x04, 0x10, 
+  0x43, 0x0C, 0x21, 0x84, 0x31, 0x8C, 0x00, 0x6C, 0x95, 0x00, 0xFF, 0xF0, 
+  0x5F, 0x80, 0x00, 0xC0, 0x20, 0x18, 0x04, 0x03, 0x00, 0x80, 0x60, 0x10, 
+  0x0C, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0C, 0x06, 0x01, 0x80, 0xC0, 0x30, 
+  0x00, 0x0E, 0x07, 0xF0, 0xC3, 0x30, 0x34, 0x07, 0x80, 0xF0, 0x0E, 0x01, 
+  0xC0, 0x38, 0x07, 0x00, 0xE0, 0x36, 0x06, 0xC1, 0x8E, 0x70, 0xF8, 0x10, 
+  0x63, 0xC4, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x3F, 
+  0xFF, 0x3F, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x60, 0x1E, 0x07, 0xE0, 0x86, 
+  0x00, 0x60, 0x0C, 0x01, 0xA0, 0x3E, 0x0C, 0x73, 0x87, 0xC0, 0x08, 0x3F, 
+  0xB8, 0xD8, 0x30, 0x18, 0x0C, 0x06, 0x06, 0x1E, 0x0C, 0x06, 0x00, 0x00, 
+  0x00, 0x40, 0x60, 0x30, 0x07, 0x00, 0x38, 0x03, 0x60, 0x1B, 0x00, 0x98, 
+  0x0C, 0x60, 0x63, 0x06, 0x08, 0x30, 0x61, 0xFF, 0x1F, 0xFC, 0xC0, 0x64, 
+  0x03, 0x60, 0x0F, 0x00, 0x60, 0xFF, 0xCC, 0x0C, 0xC0, 0x6C, 0x06, 0xC0, 
+  0x6C, 0x0C, 0xFF, 0x8F, 0xFC, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 
+  0x6F, 0xFE, 0xFF, 0x80, 0x01, 0x00, 0x7F, 0x0F, 0x1E, 0x60, 0x36, 0x00, 
+  0x20, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x06, 
+  0x00, 0x18, 0x0C, 0x7F, 0xE1, 0xFC, 0xFF, 0xC6, 0x07, 0x30, 0x1D, 0x80, 
+  0x6C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x01, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 
+  0x80, 0x6C, 0x07, 0x7F, 0xF3, 0xFE, 0x00, 0xFF, 0xF0, 0x0C, 0x03, 0x00, 
+  0xC0, 0x30, 0x0F, 0xF3, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 
+  0xFF, 0xFC, 0xFF, 0xF0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFB, 0xFE, 
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x01, 0x00, 0x1F, 
+  0xE0, 0x70, 0xE1, 0x80, 0x66, 0x00, 0x08, 0x00, 0x30, 0x00, 0x60, 0x00, 
+  0xC0, 0xFF, 0x81, 0xFF, 0x00, 0x1B, 0x00, 0x36, 0x00, 0xC7, 0x03, 0x87, 
+  0x9E, 0x03, 0xF0, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 
+  0xFF, 0xFF, 0xFF, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 
+  0xC0, 0x10, 0xFC, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x33, 
+  0xFF, 0xC0, 0x07, 0xF0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 
+  0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC4, 0x08, 0xC1, 0x87, 0x78, 0x3E, 
+  0x00, 0xC0, 0x7E, 0x07, 0x30, 0x71, 0x87, 0x0C, 0x60, 0x66, 0x03, 0x70, 
+  0x1E, 0xC0, 0xE3, 0x06, 0x1C, 0x30, 0x61, 0x81, 0x8C, 0x06, 0x60, 0x3B, 
+  0x00, 0xE0, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 
+  0x60, 0x30, 0x18, 0x0C, 0x07, 0xFF, 0xFE, 0xC0, 0x0F, 0xC0, 0x1F, 0xC0, 
+  0x7F, 0x80, 0xBD, 0x83, 0x79, 0x8C, 0xF3, 0x19, 0xE3, 0x63, 0xC3, 0x87, 
+  0x87, 0x0F, 0x04, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0x80, 
+  0xE0, 0x1F, 0x00, 0xFC, 0x07, 0xB0, 0x3D, 0xC1, 0xE6, 0x0F, 0x18, 0x78, 
+  0x63, 0xC3, 0x9E, 0x0C, 0xF0, 0x37, 0x80, 0xFC, 0x03, 0xE0, 0x1F, 0x00, 
+  0x60, 0x01, 0x80, 0x1F, 0xE0, 0xF0, 0xE1, 0x80, 0xE6, 0x00, 0xC8, 0x00, 
+  0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1B, 0x00, 0x36, 
+  0x00, 0xC6, 0x03, 0x07, 0xBE, 0x07, 0xF0, 0xFF, 0x98, 0x3B, 0x03, 0x60, 
+  0x3C, 0x07, 0x80, 0xF0, 0x37, 0xFC, 0xFF, 0x18, 0x03, 0x00, 0x60, 0x0C, 
+  0x01, 0x80, 0x30, 0x00, 0xFF, 0x8C, 0x1C, 0xC0, 0x6C, 0x06, 0xC0, 0x6C, 
+  0x06, 0xC0, 0x6F, 0xFC, 0xFF, 0x0C, 0x18, 0xC1, 0x8C, 0x0C, 0xC0, 0xCC, 
+  0x06, 0xC0, 0x70, 0x06, 0x03, 0xF0, 0xC3, 0x30, 0x36, 0x00, 0xC0, 0x1C, 
+  0x01, 0xF0, 0x0F, 0x80, 0x38, 0x01, 0x80, 0x34, 0x07, 0xC0, 0xDE, 0x70, 
+  0xFC, 0xFF, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xC0, 0x1C, 0x01, 0xC0, 
+  0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 
+  0x36, 0x03, 0x60, 0x63, 0xFC, 0x1F, 0x80, 0xC0, 0x1E, 0x00, 0xD8, 0x0C, 
+  0xC0, 0x66, 0x02, 0x18, 0x30, 0xC1, 0x83, 0x18, 0x18, 0xC0, 0xC4, 0x03, 
+  0x60, 0x1B, 0x00, 0x50, 0x03, 0x80, 0x18, 0x00, 0xE0, 0x1C, 0xC0, 0x63, 
+  0x83, 0x06, 0x18, 0x0C, 0x60, 0x1B, 0x00, 0x78, 0x00, 0xE0, 0x03, 0x00, 
+  0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x7F, 
+  0xF0, 0x06, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x03, 0x00, 0x60, 0x0C, 
+  0x01, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x80, 
+  0x1C, 0x01, 0x80, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1C, 0x01, 0xB0, 0x0D, 
+  0x80, 0x4C, 0x06, 0x30, 0x31, 0x83, 0x04, 0x18, 0x30, 0xFF, 0x8F, 0xFE, 
+  0x60, 0x32, 0x01, 0xB0, 0x07, 0x80, 0x30, 0x02, 0x01, 0xC1, 0xC0, 0x00, 
+  0x00, 0x3F, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFC, 0xFF, 0x30, 
+  0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFF, 0xFF, 0x08, 0xF7, 0x00, 0x03, 
+  0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xCF, 0xFF, 0x00, 
+  0x40, 0x03, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x18, 0x01, 0xFE, 0x0F, 0x0E, 
+  0x18, 0x0E, 0x60, 0x0C, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 
+  0x00, 0xF0, 0x01, 0xB0, 0x03, 0x60, 0x0C, 0x60, 0x30, 0x7B, 0xE0, 0x7F, 
+  0x00, 0x01, 0x00, 0x38, 0x0E, 0x00, 0x00, 0x00, 0x0C, 0x01, 0xC0, 0x1C, 
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 
+  0x03, 0x60, 0x36, 0x06, 0x3F, 0xC1, 0xF8, 0x00, 0x80, 0x07, 0x00, 0x70, 
+  0x00, 0x00, 0x80, 0x05, 0x80, 0x63, 0x01, 0x8E, 0x0C, 0x18, 0x60, 0x31, 
+  0x80, 0x6C, 0x01, 0xE0, 0x03, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 
+  0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x04, 0x20, 0x76, 0x00, 0xE0, 0x00, 
+  0x00, 0x10, 0x07, 0xF0, 0xF1, 0xE6, 0x03, 0x60, 0x02, 0x00, 0x30, 0x01, 
+  0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01, 0x80, 0xC7, 
+  0xFE, 0x1F, 0xC0, 0x10, 0x80, 0xCE, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x7F, 
+  0xE3, 0x03, 0x98, 0x0E, 0xC0, 0x36, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 
+  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x36, 0x03, 0xBF, 0xF9, 0xFF, 0x00, 
+  0x21, 0x0C, 0xC1, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x03, 0x00, 0xC0, 0x30, 
+  0x0C, 0x03, 0xFC, 0xFF, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFF, 
+  0xFF, 0x08, 0x40, 0xEE, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x70, 0x0F, 0x80, 
+  0x7E, 0x03, 0xD8, 0x1E, 0xE0, 0xF3, 0x07, 0x8C, 0x3C, 0x31, 0xE1, 0xCF, 
+  0x06, 0x78, 0x1B, 0xC0, 0x7E, 0x01, 0xF0, 0x0F, 0x80, 0x30, 0x21, 0x03, 
+  0x30, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0xC1, 0xCC, 0x06, 0xC0, 0x6C, 
+  0x06, 0xC0, 0x6C, 0x06, 0xFF, 0xCF, 0xF0, 0xC1, 0x8C, 0x18, 0xC0, 0xCC, 
+  0x0C, 0xC0, 0x6C, 0x07, 0x10, 0x83, 0x30, 0x3C, 0x00, 0x00, 0x60, 0x3F, 
+  0x0C, 0x33, 0x03, 0x60, 0x0C, 0x01, 0xC0, 0x1F, 0x00, 0xF8, 0x03, 0x80, 
+  0x18, 0x03, 0x40, 0x7C, 0x0D, 0xE7, 0x0F, 0xC0, 0x21, 0x0C, 0xC1, 0xE0, 
+  0x00, 0x00, 0x3F, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x06, 0x00, 0xD0, 
+  0x08, 0x80, 0x90, 0x07, 0x0C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 
+  0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x60, 0x36, 0x06, 
+  0x3F, 0xC1, 0xF8, 0x10, 0x81, 0x98, 0x0F, 0x00, 0x00, 0x00, 0x07, 0xFF, 
+  0x00, 0x60, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0xC0, 
+  0x1C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0xE7, 0x8B, 0x16, 
+  0x68, 0x80 };
+
+const GFXglyph Lexend_Light22pt7b_sparseGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
+  {     1,   6,  19,   8,    1,  -14 },   // 0x28 '('
+  {    16,   6,  19,   8,    1,  -14 },   // 0x29 ')'
+  {    31,   3,   6,   5,    1,   -1 },   // 0x2C ','
+  {    34,   6,   2,   9,    1,   -6 },   // 0x2D '-'
+  {    36,   3,   3,   5,    1,   -2 },   // 0x2E '.'
+  {    38,  10,  18,  12,    1,  -14 },   // 0x2F '/'
+  {    61,  11,  16,  13,    1,  -15 },   // 0x30 '0'
+  {    83,   7,  16,  10,    2,  -15 },   // 0x31 '1'
+  {    97,  11,  15,  12,    0,  -14 },   // 0x33 '3'
+  {   118,   9,  16,  11,    1,  -15 },   // 0x3F '?'
+  {   136,  13,  15,  15,    1,  -14 },   // 0x41 'A'
+  {   161,  12,  15,  15,    2,  -14 },   // 0x42 'B'
+  {   184,  13,  16,  15,    1,  -15 },   // 0x43 'C'
+  {   210,  13,  15,  16,    2,  -14 },   // 0x44 'D'
+  {   235,  10,  15,  13,    2,  -14 },   // 0x45 'E'
+  {   254,  10,  15,  13,    2,  -14 },   // 0x46 'F'
+  {   273,  15,  16,  17,    1,  -15 },   // 0x47 'G'
+  {   303,  12,  15,  17,    2,  -14 },   // 0x48 'H'
+  {   326,   6,  15,  10,    2,  -14 },   // 0x49 'I'
+  {   338,  12,  15,  14,    1,  -14 },   // 0x4A 'J'
+  {   361,  13,  15,  15,    2,  -14 },   // 0x4B 'K'
+  {   386,   9,  15,  12,    2,  -14 },   // 0x4C 'L'
+  {   403,  15,  15,  19,    2,  -14 },   // 0x4D 'M'
+  {   432,  13,  15,  17,    2,  -14 },   // 0x4E 'N'
+  {   457,  15,  16,  17,    1,  -15 },   // 0x4F 'O'
+  {   487,  11,  15,  14,    2,  -14 },   // 0x50 'P'
+  {   508,  12,  15,  15,    2,  -14 },   // 0x52 'R'
+  {   531,  11,  16,  13,    1,  -15 },   // 0x53 'S'
+  {   553,  10,  15,  12,    1,  -14 },   // 0x54 'T'
+  {   572,  12,  15,  16,    2,  -14 },   // 0x55 'U'
+  {   595,  13,  15,  15,    1,  -14 },   // 0x56 'V'
+  {   620,  14,  15,  14,    0,  -14 },   // 0x59 'Y'
+  {   647,  12,  15,  14,    1,  -14 },   // 0x5A 'Z'
+  {   670,  13,  20,  15,    1,  -19 },   // 0xC1
+  {   703,  10,  20,  13,    2,  -19 },   // 0xC9
+  {   728,   6,  20,  10,    2,  -19 },   // 0xCD
+  {   743,  15,  20,  17,    1,  -19 },   // 0xD3
+  {   781,  12,  20,  16,    2,  -19 },   // 0xDA
+  {   811,  14,  20,  14,    0,  -19 },   // 0xDD
+  {   846,  13,  20,  15,    1,  -19 },   // 0x10C
+  {   879,  13,  20,  16,    2,  -19 },   // 0x10E
+  {   912,  10,  20,  13,    2,  -19 },   // 0x11A
+  {   937,  13,  20,  17,    2,  -19 },   // 0x147
+  {   970,  12,  20,  15,    2,  -19 },   // 0x158
+  {  1000,  11,  20,  13,    1,  -19 },   // 0x160
+  {  1028,  10,  20,  12,    1,  -19 },   // 0x164
+  {  1053,  12,  20,  16,    2,  -19 },   // 0x16E
+  {  1083,  12,  20,  14,    1,  -19 },   // 0x17D
+  {  1113,   7,   5,   9,    1,  -14 },   // 0x201C
+  {  1113,   7,   5,   9,    1,  -14 }   // 0x201D
+};
+
+const uint16_t Lexend_Light22pt7b_sparseCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Light22pt7b_sparse PROGMEM = {
+  { (uint8_t  *)Lexend_Light22pt7b_sparseBitmaps,
+    (GFXglyph *)Lexend_Light22pt7b_sparseGlyphs,
+    SPARSE_FONT_FIRST, 50, 28 },
+  Lexend_Light22pt7b_sparseCodepoints };
+
+// Approx. 1648 bytes
+
+#endif // LEXEND_LIGHT22PT7B_SPARSE_H
@@ -0,0 +1,192 @@
+#ifndef LEXEND_LIGHT28PT7B_RLE_H
+#define LEXEND_LIGHT28PT7B_RLE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Light28pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES,
+// glyph bitmaps run-length encoded
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Light28pt7b_rleBitmaps[] PROGMEM = {
+  0x10, 0x61, 0x63, 0x43, 0x43, 0x43, 0x52, 0x53, 0x52, 0x53, 0x52, 0x62, 
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x72, 0x62, 0x63, 0x62, 0x72, 0x72, 
+  0x73, 0x61, 0x10, 0x11, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x52, 0x62, 0x53, 0x52, 
+  0x52, 0x52, 0x43, 0x61, 0x60, 0x11, 0x23, 0x14, 0x13, 0x12, 0x22, 0x12, 
+  0x21, 0x30, 0x0E, 0x09, 0xB3, 0xB2, 0xB2, 0xC2, 0xB2, 0xC2, 0xB3, 0xB2, 
+  0xB3, 0xB2, 0xB3, 0xB2, 0xB3, 0xB2, 0xB3, 0xB2, 0xB3, 0xB2, 0xB3, 0xB2, 
+  0xB3, 0xB2, 0xB3, 0xB0, 0x55, 0x89, 0x54, 0x34, 0x42, 0x72, 0x33, 0x73, 
+  0x22, 0x92, 0x22, 0x92, 0x13, 0x96, 0x96, 0xA5, 0xA5, 0xA5, 0x93, 0x12, 
+  0x93, 0x12, 0x92, 0x22, 0x92, 0x32, 0x73, 0x33, 0x53, 0x59, 0x77, 0x40, 
+  0x51, 0x63, 0x45, 0x33, 0x12, 0x41, 0x22, 0x72, 0x72, 0x72, 0x72, 0x72, 
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x48, 0x18, 0x1B, 0x2B, 
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA7, 0x59, 0x51, 0x53, 0xB2, 0xB3, 
+  0xB2, 0xB2, 0x11, 0x85, 0x82, 0x14, 0x53, 0x2A, 0x56, 0x40, 0x44, 0x68, 
+  0x33, 0x34, 0x13, 0x62, 0x12, 0x73, 0xA2, 0x93, 0x93, 0x83, 0x83, 0x65, 
+  0x73, 0x93, 0xA1, 0xFF, 0xF1, 0x39, 0x39, 0x35, 0x73, 0xE3, 0xD5, 0xC2, 
+  0x12, 0xC2, 0x12, 0xB2, 0x23, 0xA2, 0x32, 0x93, 0x32, 0x92, 0x43, 0x82, 
+  0x52, 0x73, 0x53, 0x62, 0x72, 0x6B, 0x5D, 0x4D, 0x33, 0x92, 0x32, 0xA3, 
+  0x22, 0xB2, 0x13, 0xB5, 0xD2, 0x09, 0x5C, 0x2D, 0x12, 0x83, 0x12, 0x92, 
+  0x12, 0x92, 0x12, 0x92, 0x12, 0x92, 0x12, 0x73, 0x2B, 0x3D, 0x12, 0x86, 
+  0xA4, 0xA4, 0xA4, 0xA4, 0x95, 0x83, 0x1D, 0x1B, 0x30, 0x83, 0xBA, 0x65, 
+  0x16, 0x43, 0x83, 0x23, 0xA1, 0x23, 0xE2, 0xF0, 0x2E, 0x3E, 0x3E, 0x3E, 
+  0x3F, 0x02, 0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xA1, 0x44, 0x64, 0x4C, 
+  0x78, 0x30, 0x08, 0x8C, 0x4D, 0x32, 0x93, 0x22, 0xA3, 0x12, 0xB2, 0x12, 
+  0xB5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB5, 0xA3, 0x12, 0x94, 
+  0x12, 0x75, 0x2C, 0x4A, 0x60, 0x0F, 0xF8, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 
+  0xAA, 0x2A, 0x22, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAF, 0x90, 0x0F, 
+  0xF8, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xAB, 0x1B, 0x12, 0xA2, 0xA2, 0xA2, 
+  0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0x85, 0xBA, 0x85, 0x26, 0x53, 0x84, 
+  0x33, 0xB1, 0x33, 0xF1, 0x2F, 0x22, 0xF1, 0x3F, 0x13, 0xF1, 0x38, 0xB8, 
+  0x81, 0x28, 0x81, 0x2E, 0x21, 0x3D, 0x22, 0x3B, 0x32, 0x49, 0x34, 0x47, 
+  0x37, 0xB9, 0x85, 0x02, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 
+  0xBF, 0xF4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB2, 0x0F, 
+  0x13, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 
+  0x26, 0x26, 0x26, 0x26, 0x23, 0xF1, 0x68, 0x68, 0x93, 0xB3, 0xB3, 0xB3, 
+  0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2, 0x41, 0x72, 0x32, 
+  0x63, 0x33, 0x44, 0x49, 0x66, 0x60, 0x02, 0xA3, 0x12, 0x93, 0x22, 0x83, 
+  0x32, 0x73, 0x42, 0x63, 0x52, 0x53, 0x62, 0x43, 0x72, 0x33, 0x82, 0x23, 
+  0x92, 0x15, 0x85, 0x13, 0x74, 0x32, 0x73, 0x43, 0x62, 0x63, 0x52, 0x73, 
+  0x42, 0x82, 0x42, 0x83, 0x32, 0x93, 0x22, 0xA3, 0x12, 0xB3, 0x02, 0x92, 
+  0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 
+  0x92, 0x92, 0x92, 0x92, 0x9F, 0x70, 0x02, 0xE5, 0xC6, 0xC7, 0xA9, 0x96, 
+  0x12, 0x82, 0x14, 0x13, 0x63, 0x14, 0x22, 0x62, 0x24, 0x32, 0x42, 0x34, 
+  0x33, 0x23, 0x34, 0x42, 0x22, 0x44, 0x46, 0x44, 0x54, 0x54, 0x62, 0x64, 
+  0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE2, 0x02, 0xC5, 0xB5, 0xB6, 0xA7, 0x94, 
+  0x13, 0x84, 0x22, 0x84, 0x32, 0x74, 0x33, 0x64, 0x43, 0x54, 0x53, 0x44, 
+  0x62, 0x44, 0x63, 0x34, 0x73, 0x24, 0x83, 0x14, 0x92, 0x14, 0x97, 0xA6, 
+  0xB5, 0xC2, 0x76, 0xCA, 0x94, 0x44, 0x73, 0x83, 0x53, 0xA3, 0x33, 0xC3, 
+  0x22, 0xE2, 0x22, 0xE2, 0x13, 0xE2, 0x13, 0xE6, 0xE6, 0xE3, 0x12, 0xE2, 
+  0x22, 0xE2, 0x23, 0xC3, 0x32, 0xC2, 0x43, 0xA3, 0x54, 0x64, 0x7C, 0xA8, 
+  0x60, 0x08, 0x5B, 0x2C, 0x12, 0x82, 0x12, 0x85, 0x94, 0x94, 0x94, 0x85, 
+  0x73, 0x1C, 0x1A, 0x32, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB0, 
+  0x08, 0x6B, 0x3C, 0x22, 0x83, 0x12, 0x92, 0x12, 0x95, 0x95, 0x95, 0x92, 
+  0x12, 0x83, 0x1C, 0x2B, 0x32, 0x62, 0x42, 0x63, 0x32, 0x72, 0x32, 0x73, 
+  0x22, 0x82, 0x22, 0x83, 0x12, 0x95, 0xA2, 0x64, 0x98, 0x54, 0x34, 0x42, 
+  0x73, 0x23, 0x81, 0x33, 0xC3, 0xD2, 0xD4, 0xC7, 0xA7, 0xC4, 0xD3, 0xD2, 
+  0xD3, 0x11, 0xA2, 0x13, 0x92, 0x24, 0x63, 0x3B, 0x67, 0x40, 0x0F, 0xF9, 
+  0x53, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x50, 0x02, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB5, 0x93, 0x13, 
+  0x73, 0x24, 0x53, 0x4A, 0x77, 0x40, 0x02, 0xD5, 0xB3, 0x12, 0xB3, 0x12, 
+  0xB2, 0x23, 0x93, 0x32, 0x92, 0x42, 0x92, 0x43, 0x73, 0x52, 0x72, 0x63, 
+  0x53, 0x72, 0x52, 0x82, 0x52, 0x83, 0x33, 0x92, 0x32, 0xA3, 0x13, 0xB2, 
+  0x12, 0xC2, 0x12, 0xC5, 0xD3, 0xE3, 0x70, 0x03, 0xC3, 0x13, 0xA3, 0x33, 
+  0x92, 0x52, 0x83, 0x53, 0x63, 0x73, 0x52, 0x92, 0x43, 0xA2, 0x23, 0xB3, 
+  0x12, 0xD5, 0xE3, 0xF0, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 
+  0xF1, 0x2F, 0x12, 0xF1, 0x28, 0x0E, 0x1E, 0x1E, 0xC2, 0xC3, 0xB3, 0xB3, 
+  0xC2, 0xC3, 0xB3, 0xB3, 0xC2, 0xC3, 0xB3, 0xB3, 0xC2, 0xC3, 0xB3, 0xCF, 
+  0xF0, 0x92, 0xE4, 0xB4, 0xD1, 0xFF, 0x43, 0xE3, 0xD5, 0xC2, 0x12, 0xC2, 
+  0x12, 0xB2, 0x23, 0xA2, 0x32, 0x93, 0x32, 0x92, 0x43, 0x82, 0x52, 0x73, 
+  0x53, 0x62, 0x72, 0x6B, 0x5D, 0x4D, 0x33, 0x92, 0x32, 0xA3, 0x22, 0xB2, 
+  0x13, 0xB5, 0xD2, 0x72, 0x85, 0x63, 0x91, 0xF4, 0xFF, 0x8A, 0x2A, 0x2A, 
+  0x2A, 0x2A, 0x2A, 0xA2, 0xA2, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 
+  0xF9, 0x52, 0x54, 0x24, 0x41, 0xDF, 0x13, 0x26, 0x26, 0x26, 0x26, 0x26, 
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0xF1, 
+  0xB2, 0xF1, 0x4F, 0x03, 0xF2, 0x1F, 0xF8, 0x6C, 0xA9, 0x44, 0x47, 0x38, 
+  0x35, 0x3A, 0x33, 0x3C, 0x32, 0x2E, 0x22, 0x2E, 0x21, 0x3E, 0x21, 0x3E, 
+  0x6E, 0x6E, 0x31, 0x2E, 0x22, 0x2E, 0x22, 0x3C, 0x33, 0x2C, 0x24, 0x3A, 
+  0x35, 0x46, 0x47, 0xCA, 0x86, 0x82, 0xC4, 0x94, 0xC1, 0xF8, 0x2B, 0x4B, 
+  0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 
+  0x4B, 0x59, 0x31, 0x37, 0x32, 0x45, 0x34, 0xA7, 0x74, 0xA2, 0xE4, 0xD3, 
+  0xF0, 0x1F, 0xD3, 0xC3, 0x13, 0xA3, 0x33, 0x92, 0x52, 0x83, 0x53, 0x63, 
+  0x73, 0x52, 0x92, 0x43, 0xA2, 0x23, 0xB3, 0x12, 0xD5, 0xE3, 0xF0, 0x2F, 
+  0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x28, 
+  0x61, 0x61, 0x93, 0x23, 0xB4, 0xE2, 0xFF, 0x13, 0xBA, 0x65, 0x16, 0x43, 
+  0x83, 0x23, 0xA1, 0x23, 0xE2, 0xF0, 0x2E, 0x3E, 0x3E, 0x3E, 0x3F, 0x02, 
+  0xF0, 0x2F, 0x03, 0xF0, 0x2F, 0x03, 0xA1, 0x44, 0x64, 0x4C, 0x78, 0x30, 
+  0x32, 0x52, 0x83, 0x13, 0xA5, 0xC3, 0xF8, 0x88, 0xC4, 0xD3, 0x29, 0x32, 
+  0x2A, 0x31, 0x2B, 0x21, 0x2B, 0x5C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 
+  0x4B, 0x5A, 0x31, 0x29, 0x41, 0x27, 0x52, 0xC4, 0xA6, 0x21, 0x61, 0x43, 
+  0x23, 0x65, 0x82, 0xF2, 0xFF, 0x8A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xA2, 
+  0xA2, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0xF9, 0x41, 0x61, 0x83, 
+  0x23, 0xA4, 0xD2, 0xF8, 0x2C, 0x5B, 0x5B, 0x6A, 0x79, 0x41, 0x38, 0x42, 
+  0x28, 0x43, 0x27, 0x43, 0x36, 0x44, 0x35, 0x45, 0x34, 0x46, 0x24, 0x46, 
+  0x33, 0x47, 0x32, 0x48, 0x31, 0x49, 0x21, 0x49, 0x7A, 0x6B, 0x5C, 0x20, 
+  0x12, 0x52, 0x63, 0x22, 0x85, 0xA3, 0xF6, 0x86, 0xB3, 0xC2, 0x28, 0x31, 
+  0x29, 0x21, 0x29, 0x59, 0x59, 0x59, 0x21, 0x28, 0x31, 0xC2, 0xB3, 0x26, 
+  0x24, 0x26, 0x33, 0x27, 0x23, 0x27, 0x32, 0x28, 0x22, 0x28, 0x31, 0x29, 
+  0x5A, 0x20, 0x41, 0x61, 0x73, 0x23, 0x94, 0xC2, 0xFC, 0x49, 0x85, 0x43, 
+  0x44, 0x27, 0x32, 0x38, 0x13, 0x3C, 0x3D, 0x2D, 0x4C, 0x7A, 0x7C, 0x4D, 
+  0x3D, 0x2D, 0x31, 0x1A, 0x21, 0x39, 0x22, 0x46, 0x33, 0xB6, 0x74, 0x22, 
+  0x52, 0x53, 0x22, 0x75, 0x93, 0xF3, 0xFF, 0x95, 0x3A, 0x3A, 0x3A, 0x3A, 
+  0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 
+  0x35, 0x63, 0xB2, 0x12, 0x92, 0x32, 0x82, 0x31, 0xA5, 0x52, 0x43, 0x44, 
+  0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 
+  0xB4, 0xB5, 0x93, 0x13, 0x73, 0x24, 0x53, 0x4A, 0x77, 0x40, 0x31, 0x61, 
+  0x73, 0x23, 0x94, 0xC2, 0xF7, 0xE1, 0xE1, 0xEC, 0x2C, 0x3B, 0x3B, 0x3C, 
+  0x2C, 0x3B, 0x3B, 0x3C, 0x2C, 0x3B, 0x3B, 0x3C, 0x2C, 0x3B, 0x3C, 0xFF, 
+  0x00, 0x13, 0x23, 0x12, 0x33, 0x12, 0x32, 0x22, 0x32, 0x21, 0x42, 0x12, 
+  0x42, 0x12, 0x41, 0x22, 0x41, 0x20 };
+
+const GFXglyph Lexend_Light28pt7b_rleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   8,  25,  10,    1,  -19 },   // 0x28 '('
+  {    27,   8,  25,  10,    1,  -19 },   // 0x29 ')'
+  {    53,   4,   8,   7,    2,   -2 },   // 0x2C ','
+  {    62,   7,   2,  11,    2,   -8 },   // 0x2D '-'
+  {    63,   3,   3,   6,    2,   -2 },   // 0x2E '.'
+  {    64,  14,  23,  16,    1,  -19 },   // 0x2F '/'
+  {    88,  15,  20,  17,    1,  -19 },   // 0x30 '0'
+  {   120,   9,  20,  13,    2,  -19 },   // 0x31 '1'
+  {   142,  13,  20,  15,    1,  -19 },   // 0x33 '3'
+  {   166,  12,  20,  14,    1,  -19 },   // 0x3F '?'
+  {   188,  17,  20,  19,    1,  -19 },   // 0x41 'A'
+  {   221,  14,  20,  19,    3,  -19 },   // 0x42 'B'
+  {   249,  17,  20,  19,    1,  -19 },   // 0x43 'C'
+  {   278,  16,  20,  21,    3,  -19 },   // 0x44 'D'
+  {   305,  12,  20,  17,    3,  -19 },   // 0x45 'E'
+  {   323,  12,  20,  17,    3,  -19 },   // 0x46 'F'
+  {   342,  19,  20,  21,    1,  -19 },   // 0x47 'G'
+  {   375,  15,  20,  21,    3,  -19 },   // 0x48 'H'
+  {   395,   8,  20,  12,    2,  -19 },   // 0x49 'I'
+  {   414,  14,  20,  18,    2,  -19 },   // 0x4A 'J'
+  {   438,  16,  20,  20,    3,  -19 },   // 0x4B 'K'
+  {   478,  11,  20,  16,    3,  -19 },   // 0x4C 'L'
+  {   498,  18,  20,  24,    3,  -19 },   // 0x4D 'M'
+  {   534,  16,  20,  22,    3,  -19 },   // 0x4E 'N'
+  {   566,  20,  20,  22,    1,  -19 },   // 0x4F 'O'
+  {   601,  13,  20,  17,    3,  -19 },   // 0x50 'P'
+  {   624,  14,  20,  18,    3,  -19 },   // 0x52 'R'
+  {   655,  15,  20,  17,    1,  -19 },   // 0x53 'S'
+  {   682,  13,  20,  15,    1,  -19 },   // 0x54 'T'
+  {   702,  15,  20,  21,    3,  -19 },   // 0x55 'U'
+  {   726,  17,  20,  19,    1,  -19 },   // 0x56 'V'
+  {   763,  18,  20,  18,    0,  -19 },   // 0x59 'Y'
+  {   797,  15,  20,  18,    2,  -19 },   // 0x5A 'Z'
+  {   817,  17,  25,  19,    1,  -24 },   // 0xC1
+  {   855,  12,  25,  17,    3,  -24 },   // 0xC9
+  {   877,   8,  25,  12,    2,  -24 },   // 0xCD
+  {   900,  20,  25,  22,    1,  -24 },   // 0xD3
+  {   941,  15,  25,  21,    3,  -24 },   // 0xDA
+  {   969,  18,  25,  18,    0,  -24 },   // 0xDD
+  {  1008,  17,  25,  19,    1,  -24 },   // 0x10C
+  {  1044,  16,  25,  21,    3,  -24 },   // 0x10E
+  {  1077,  12,  25,  17,    3,  -24 },   // 0x11A
+  {  1101,  16,  25,  22,    3,  -24 },   // 0x147
+  {  1140,  14,  25,  18,    3,  -24 },   // 0x158
+  {  1178,  15,  25,  17,    1,  -24 },   // 0x160
+  {  1211,  13,  25,  15,    1,  -24 },   // 0x164
+  {  1237,  15,  25,  21,    3,  -24 },   // 0x16E
+  {  1270,  15,  25,  18,    2,  -24 },   // 0x17D
+  {  1297,   9,   8,  11,    1,  -19 },   // 0x201C
+  {  1297,   9,   8,  11,    1,  -19 }   // 0x201D
+};
+
+const uint16_t Lexend_Light28pt7b_rleCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Light28pt7b_rle PROGMEM = {
+  { (uint8_t  *)Lexend_Light28pt7b_rleBitmaps,
+    (GFXglyph *)Lexend_Light28pt7b_rleGlyphs,
+    SPARSE_RLE_FONT_FIRST, 50, 35 },
+  Lexend_Light28pt7b_rleCodepoints };
+
+// Approx. 1844 bytes
+
+#endif // LEXEND_LIGHT28PT7B_RLE_H
@@ -0,0 +1,232 @@
+#ifndef LEXEND_LIGHT28PT7B_SPARSE_H
+#define LEXEND_LIGHT28PT7B_SPARSE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Light28pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Light28pt7b_sparseBitmaps[] PROGMEM = {
+  0x00, 0x02, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x70, 0x60, 0xE0, 0xC0, 0xC0, 
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x70, 0x30, 0x18, 0x0C, 
+  0x07, 0x02, 0x40, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0E, 0x06, 0x07, 0x03, 
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x0E, 0x0C, 0x18, 
+  0x30, 0xE0, 0x40, 0x4E, 0xF7, 0x66, 0xC8, 0xFF, 0xFC, 0xFF, 0x80, 0x00, 
+  0x1C, 0x00, 0x60, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01, 0x80, 0x0E, 0x00, 
+  0x30, 0x01, 0xC0, 0x06, 0x00, 0x38, 0x00, 0xC0, 0x07, 0x00, 0x18, 0x00, 
+  0xE0, 0x03, 0x00, 0x1C, 0x00, 0x60, 0x03, 0x80, 0x0C, 0x00, 0x70, 0x01, 
+  0x80, 0x0E, 0x00, 0x00, 0x07, 0xC0, 0x3F, 0xE0, 0xF1, 0xE1, 0x80, 0xC7, 
+  0x01, 0xCC, 0x01, 0x98, 0x03, 0x70, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 
+  0x1F, 0x00, 0x3E, 0x00, 0xEC, 0x01, 0xD8, 0x03, 0x30, 0x06, 0x30, 0x1C, 
+  0x70, 0x70, 0x7F, 0xC0, 0x7F, 0x00, 0x04, 0x0E, 0x1F, 0x1D, 0x84, 0xC0, 
+  0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 
+  0x0C, 0x06, 0x1F, 0xEF, 0xF0, 0x7F, 0xF3, 0xFF, 0x80, 0x18, 0x01, 0x80, 
+  0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xC1, 0xFF, 0x04, 0x1C, 0x00, 
+  0x60, 0x03, 0x80, 0x0C, 0x00, 0x68, 0x07, 0xC0, 0x37, 0x83, 0x9F, 0xF8, 
+  0x3F, 0x00, 0x0F, 0x03, 0xFC, 0x71, 0xEE, 0x06, 0xC0, 0x70, 0x03, 0x00, 
+  0x70, 0x07, 0x00, 0xE0, 0x1C, 0x0F, 0x80, 0xE0, 0x0E, 0x00, 0x40, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x01, 0xC0, 0x00, 0xE0, 
+  0x00, 0xF8, 0x00, 0x6C, 0x00, 0x36, 0x00, 0x33, 0x80, 0x18, 0xC0, 0x1C, 
+  0x60, 0x0C, 0x38, 0x06, 0x0C, 0x07, 0x07, 0x03, 0x01, 0x81, 0xFF, 0xC1, 
+  0xFF, 0xF0, 0xFF, 0xF8, 0xE0, 0x0C, 0x60, 0x07, 0x30, 0x01, 0xB8, 0x00, 
+  0xF8, 0x00, 0x30, 0xFF, 0x83, 0xFF, 0xCF, 0xFF, 0xB0, 0x0E, 0xC0, 0x1B, 
+  0x00, 0x6C, 0x01, 0xB0, 0x06, 0xC0, 0x73, 0xFF, 0x8F, 0xFF, 0xB0, 0x0F, 
+  0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x1F, 0x00, 0xEF, 0xFF, 
+  0xBF, 0xF8, 0x00, 0xE0, 0x03, 0xFF, 0x03, 0xEF, 0xC3, 0x80, 0x73, 0x80, 
+  0x13, 0x80, 0x01, 0x80, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 
+  0x00, 0x1C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0xC0, 0x00, 0x60, 0x00, 
+  0x38, 0x01, 0x0F, 0x03, 0xC3, 0xFF, 0xC0, 0x7F, 0x80, 0xFF, 0x00, 0xFF, 
+  0xF0, 0xFF, 0xF8, 0xC0, 0x1C, 0xC0, 0x0E, 0xC0, 0x06, 0xC0, 0x07, 0xC0, 
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 
+  0x03, 0xC0, 0x07, 0xC0, 0x0E, 0xC0, 0x1E, 0xC0, 0x7C, 0xFF, 0xF0, 0xFF, 
+  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 
+  0x00, 0xC0, 0x0F, 0xFC, 0xFF, 0xCC, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 
+  0x00, 0xC0, 0x0C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFE, 0xFF, 0xEC, 
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 
+  0x00, 0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x3E, 0x7E, 0x0E, 0x01, 0xE3, 0x80, 
+  0x08, 0xE0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 
+  0x03, 0x80, 0x7F, 0xF0, 0x0F, 0xF6, 0x01, 0xFE, 0xC0, 0x00, 0xDC, 0x00, 
+  0x19, 0xC0, 0x07, 0x3C, 0x01, 0xC3, 0xC0, 0x70, 0x1F, 0xFC, 0x01, 0xFE, 
+  0x00, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 
+  0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3C, 
+  0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 
+  0x1E, 0x00, 0x30, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x03, 
+  0xFC, 0x0F, 0xF0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 
+  0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 
+  0x06, 0x10, 0x18, 0xC0, 0xE3, 0x87, 0x87, 0xFC, 0x0F, 0xC0, 0xC0, 0x0E, 
+  0xC0, 0x1C, 0xC0, 0x38, 0xC0, 0x70, 0xC0, 0xE0, 0xC1, 0xC0, 0xC3, 0x80, 
+  0xC7, 0x00, 0xCE, 0x00, 0xDF, 0x00, 0xFB, 0x80, 0xF1, 0x80, 0xE1, 0xC0, 
+  0xC0, 0xE0, 0xC0, 0x70, 0xC0, 0x30, 0xC0, 0x38, 0xC0, 0x1C, 0xC0, 0x0E, 
+  0xC0, 0x07, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 
+  0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 
+  0xC0, 0x18, 0x03, 0xFF, 0xFF, 0xF0, 0xC0, 0x00, 0xF8, 0x00, 0x7E, 0x00, 
+  0x1F, 0xC0, 0x0F, 0xF8, 0x03, 0xF6, 0x01, 0xBD, 0xC0, 0xEF, 0x30, 0x33, 
+  0xC6, 0x18, 0xF1, 0xCE, 0x3C, 0x33, 0x0F, 0x0F, 0xC3, 0xC1, 0xE0, 0xF0, 
+  0x30, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 
+  0x0F, 0x00, 0x03, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0x03, 0xF8, 
+  0x03, 0xDC, 0x03, 0xCC, 0x03, 0xC6, 0x03, 0xC7, 0x03, 0xC3, 0x83, 0xC1, 
+  0xC3, 0xC0, 0xC3, 0xC0, 0xE3, 0xC0, 0x73, 0xC0, 0x3B, 0xC0, 0x1B, 0xC0, 
+  0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x03, 0x01, 0xF8, 0x00, 0x7F, 0xE0, 
+  0x0F, 0x0F, 0x01, 0xC0, 0x38, 0x38, 0x01, 0xC7, 0x00, 0x0E, 0x60, 0x00, 
+  0x66, 0x00, 0x06, 0xE0, 0x00, 0x6E, 0x00, 0x07, 0xE0, 0x00, 0x7E, 0x00, 
+  0x07, 0x60, 0x00, 0x66, 0x00, 0x06, 0x70, 0x00, 0xE3, 0x00, 0x0C, 0x38, 
+  0x01, 0xC1, 0xE0, 0x78, 0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0xFF, 0x07, 0xFF, 
+  0x3F, 0xFD, 0x80, 0x6C, 0x03, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x3E, 
+  0x03, 0xBF, 0xFD, 0xFF, 0x8C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 
+  0x06, 0x00, 0x30, 0x01, 0x80, 0x00, 0xFF, 0x03, 0xFF, 0x8F, 0xFF, 0x30, 
+  0x0E, 0xC0, 0x1B, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1B, 0x00, 0xEF, 
+  0xFF, 0x3F, 0xF8, 0xC0, 0xC3, 0x03, 0x8C, 0x06, 0x30, 0x1C, 0xC0, 0x33, 
+  0x00, 0xEC, 0x01, 0xF0, 0x03, 0x03, 0xC0, 0x1F, 0xE0, 0xF1, 0xE1, 0x80, 
+  0xE7, 0x00, 0x8E, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x3F, 0x80, 
+  0x1F, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01, 0x80, 0x03, 0xA0, 0x06, 0xE0, 
+  0x0C, 0xF0, 0x38, 0xFF, 0xE0, 0x7F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
+  0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 
+  0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 
+  0x01, 0xC0, 0x0E, 0x00, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 
+  0x00, 0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 
+  0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xF0, 0x07, 0x70, 0x1C, 
+  0xF0, 0x70, 0xFF, 0xC0, 0x7F, 0x00, 0xC0, 0x01, 0xF0, 0x01, 0xD8, 0x00, 
+  0xEC, 0x00, 0x67, 0x00, 0x71, 0x80, 0x30, 0xC0, 0x18, 0x70, 0x1C, 0x18, 
+  0x0C, 0x0E, 0x0E, 0x03, 0x06, 0x01, 0x83, 0x00, 0xE3, 0x80, 0x31, 0x80, 
+  0x1D, 0xC0, 0x06, 0xC0, 0x03, 0x60, 0x01, 0xF0, 0x00, 0x70, 0x00, 0x38, 
+  0x00, 0xE0, 0x01, 0xDC, 0x00, 0xE3, 0x80, 0x30, 0x60, 0x1C, 0x1C, 0x0E, 
+  0x03, 0x83, 0x00, 0x61, 0xC0, 0x0C, 0xE0, 0x03, 0xB0, 0x00, 0x7C, 0x00, 
+  0x0E, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 
+  0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0xFF, 0xFD, 
+  0xFF, 0xFB, 0xFF, 0xF0, 0x00, 0xC0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 
+  0x60, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x30, 0x00, 0xE0, 0x03, 0x80, 
+  0x0E, 0x00, 0x18, 0x00, 0x70, 0x01, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 
+  0x00, 0x60, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0E, 
+  0x00, 0x07, 0x00, 0x07, 0xC0, 0x03, 0x60, 0x01, 0xB0, 0x01, 0x9C, 0x00, 
+  0xC6, 0x00, 0xE3, 0x00, 0x61, 0xC0, 0x30, 0x60, 0x38, 0x38, 0x18, 0x0C, 
+  0x0F, 0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0xC7, 0x00, 0x63, 0x00, 0x39, 0x80, 
+  0x0D, 0xC0, 0x07, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x7C, 0x0E, 0x00, 0x80, 
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 
+  0xC0, 0x0C, 0x00, 0xFF, 0xCF, 0xFC, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 
+  0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x06, 0x0F, 0x3C, 0x20, 
+  0x00, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x18, 0x00, 
+  0x07, 0x80, 0x00, 0xE0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 
+  0x07, 0xFE, 0x00, 0xF0, 0xF0, 0x1C, 0x03, 0x83, 0x80, 0x1C, 0x70, 0x00, 
+  0xE6, 0x00, 0x06, 0x60, 0x00, 0x6E, 0x00, 0x06, 0xE0, 0x00, 0x7E, 0x00, 
+  0x07, 0xE0, 0x00, 0x76, 0x00, 0x06, 0x60, 0x00, 0x67, 0x00, 0x0E, 0x30, 
+  0x00, 0xC3, 0x80, 0x1C, 0x1E, 0x07, 0x80, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 
+  0x00, 0xC0, 0x03, 0xC0, 0x1E, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0xF0, 
+  0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 
+  0x78, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 
+  0x00, 0x3E, 0x00, 0xEE, 0x03, 0x9E, 0x0E, 0x1F, 0xF8, 0x0F, 0xE0, 0x00, 
+  0x30, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x38, 0x00, 
+  0x77, 0x00, 0x38, 0xE0, 0x0C, 0x18, 0x07, 0x07, 0x03, 0x80, 0xE0, 0xC0, 
+  0x18, 0x70, 0x03, 0x38, 0x00, 0xEC, 0x00, 0x1F, 0x00, 0x03, 0x80, 0x00, 
+  0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 
+  0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x02, 0x04, 0x01, 0xCE, 
+  0x00, 0x3C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1F, 0xF8, 0x1F, 
+  0x7E, 0x1C, 0x03, 0x9C, 0x00, 0x9C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x07, 
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x30, 0x00, 0x18, 0x00, 
+  0x0E, 0x00, 0x03, 0x00, 0x01, 0xC0, 0x08, 0x78, 0x1E, 0x1F, 0xFE, 0x03, 
+  0xFC, 0x00, 0x18, 0x30, 0x0E, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 
+  0xFF, 0x00, 0xFF, 0xF0, 0xFF, 0xF8, 0xC0, 0x1C, 0xC0, 0x0E, 0xC0, 0x06, 
+  0xC0, 0x07, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x07, 0xC0, 0x0E, 0xC0, 0x1E, 0xC0, 0x7C, 
+  0xFF, 0xF0, 0xFF, 0xC0, 0x20, 0x43, 0x9C, 0x0F, 0x80, 0x60, 0x00, 0x0F, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 
+  0x00, 0xFF, 0xCF, 0xFC, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 
+  0x00, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x08, 0x10, 0x0E, 0x70, 0x03, 0xC0, 
+  0x01, 0x80, 0x00, 0x00, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xF0, 0x03, 
+  0xF8, 0x03, 0xDC, 0x03, 0xCC, 0x03, 0xC6, 0x03, 0xC7, 0x03, 0xC3, 0x83, 
+  0xC1, 0xC3, 0xC0, 0xC3, 0xC0, 0xE3, 0xC0, 0x73, 0xC0, 0x3B, 0xC0, 0x1B, 
+  0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x07, 0xC0, 0x03, 0x60, 0xC0, 0xE6, 0x01, 
+  0xF0, 0x03, 0x80, 0x00, 0x03, 0xFC, 0x0F, 0xFE, 0x3F, 0xFC, 0xC0, 0x3B, 
+  0x00, 0x6C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x6C, 0x03, 0xBF, 0xFC, 
+  0xFF, 0xE3, 0x03, 0x0C, 0x0E, 0x30, 0x18, 0xC0, 0x73, 0x00, 0xCC, 0x03, 
+  0xB0, 0x07, 0xC0, 0x0C, 0x08, 0x10, 0x1C, 0xE0, 0x0F, 0x00, 0x0C, 0x00, 
+  0x00, 0x00, 0x78, 0x03, 0xFC, 0x1E, 0x3C, 0x30, 0x1C, 0xE0, 0x11, 0xC0, 
+  0x03, 0x80, 0x03, 0x00, 0x07, 0x80, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x78, 
+  0x00, 0x38, 0x00, 0x30, 0x00, 0x74, 0x00, 0xDC, 0x01, 0x9E, 0x07, 0x1F, 
+  0xFC, 0x0F, 0xE0, 0x30, 0x60, 0xE6, 0x03, 0xE0, 0x0E, 0x00, 0x00, 0x7F, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 
+  0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 
+  0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x03, 0x80, 0x0D, 0x80, 
+  0x31, 0x80, 0x62, 0x00, 0x7C, 0x18, 0x70, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 
+  0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 
+  0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xEE, 
+  0x03, 0x9E, 0x0E, 0x1F, 0xF8, 0x0F, 0xE0, 0x10, 0x20, 0x39, 0xC0, 0x1E, 
+  0x00, 0x18, 0x00, 0x00, 0x1F, 0xFF, 0xBF, 0xFF, 0x7F, 0xFE, 0x00, 0x18, 
+  0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x0C, 0x00, 0x38, 0x00, 0xE0, 0x03, 
+  0x80, 0x06, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x03, 0x00, 0x0E, 0x00, 
+  0x38, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x73, 0xB1, 0xD8, 0xCC, 0x64, 0x36, 
+  0x1B, 0x09, 0x84 };
+
+const GFXglyph Lexend_Light28pt7b_sparseGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   8,  25,  10,    1,  -19 },   // 0x28 '('
+  {    26,   8,  25,  10,    1,  -19 },   // 0x29 ')'
+  {    51,   4,   8,   7,    2,   -2 },   // 0x2C ','
+  {    55,   7,   2,  11,    2,   -8 },   // 0x2D '-'
+  {    57,   3,   3,   6,    2,   -2 },   // 0x2E '.'
+  {    59,  14,  23,  16,    1,  -19 },   // 0x2F '/'
+  {   100,  15,  20,  17,    1,  -19 },   // 0x30 '0'
+  {   138,   9,  20,  13,    2,  -19 },   // 0x31 '1'
+  {   161,  13,  20,  15,    1,  -19 },   // 0x33 '3'
+  {   194,  12,  20,  14,    1,  -19 },   // 0x3F '?'
+  {   224,  17,  20,  19,    1,  -19 },   // 0x41 'A'
+  {   267,  14,  20,  19,    3,  -19 },   // 0x42 'B'
+  {   302,  17,  20,  19,    1,  -19 },   // 0x43 'C'
+  {   345,  16,  20,  21,    3,  -19 },   // 0x44 'D'
+  {   385,  12,  20,  17,    3,  -19 },   // 0x45 'E'
+  {   415,  12,  20,  17,    3,  -19 },   // 0x46 'F'
+  {   445,  19,  20,  21,    1,  -19 },   // 0x47 'G'
+  {   493,  15,  20,  21,    3,  -19 },   // 0x48 'H'
+  {   531,   8,  20,  12,    2,  -19 },   // 0x49 'I'
+  {   551,  14,  20,  18,    2,  -19 },   // 0x4A 'J'
+  {   586,  16,  20,  20,    3,  -19 },   // 0x4B 'K'
+  {   626,  11,  20,  16,    3,  -19 },   // 0x4C 'L'
+  {   654,  18,  20,  24,    3,  -19 },   // 0x4D 'M'
+  {   699,  16,  20,  22,    3,  -19 },   // 0x4E 'N'
+  {   739,  20,  20,  22,    1,  -19 },   // 0x4F 'O'
+  {   789,  13,  20,  17,    3,  -19 },   // 0x50 'P'
+  {   822,  14,  20,  18,    3,  -19 },   // 0x52 'R'
+  {   857,  15,  20,  17,    1,  -19 },   // 0x53 'S'
+  {   895,  13,  20,  15,    1,  -19 },   // 0x54 'T'
+  {   928,  15,  20,  21,    3,  -19 },   // 0x55 'U'
+  {   966,  17,  20,  19,    1,  -19 },   // 0x56 'V'
+  {  1009,  18,  20,  18,    0,  -19 },   // 0x59 'Y'
+  {  1054,  15,  20,  18,    2,  -19 },   // 0x5A 'Z'
+  {  1092,  17,  25,  19,    1,  -24 },   // 0xC1
+  {  1146,  12,  25,  17,    3,  -24 },   // 0xC9
+  {  1184,   8,  25,  12,    2,  -24 },   // 0xCD
+  {  1209,  20,  25,  22,    1,  -24 },   // 0xD3
+  {  1272,  15,  25,  21,    3,  -24 },   // 0xDA
+  {  1319,  18,  25,  18,    0,  -24 },   // 0xDD
+  {  1376,  17,  25,  19,    1,  -24 },   // 0x10C
+  {  1430,  16,  25,  21,    3,  -24 },   // 0x10E
+  {  1480,  12,  25,  17,    3,  -24 },   // 0x11A
+  {  1518,  16,  25,  22,    3,  -24 },   // 0x147
+  {  1568,  14,  25,  18,    3,  -24 },   // 0x158
+  {  1612,  15,  25,  17,    1,  -24 },   // 0x160
+  {  1659,  13,  25,  15,    1,  -24 },   // 0x164
+  {  1700,  15,  25,  21,    3,  -24 },   // 0x16E
+  {  1747,  15,  25,  18,    2,  -24 },   // 0x17D
+  {  1794,   9,   8,  11,    1,  -19 },   // 0x201C
+  {  1794,   9,   8,  11,    1,  -19 }   // 0x201D
+};
+
+const uint16_t Lexend_Light28pt7b_sparseCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Light28pt7b_sparse PROGMEM = {
+  { (uint8_t  *)Lexend_Light28pt7b_sparseBitmaps,
+    (GFXglyph *)Lexend_Light28pt7b_sparseGlyphs,
+    SPARSE_FONT_FIRST, 50, 35 },
+  Lexend_Light28pt7b_sparseCodepoints };
+
+// Approx. 2333 bytes
+
+#endif // LEXEND_LIGHT28PT7B_SPARSE_H
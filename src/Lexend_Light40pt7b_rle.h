@@ -0,0 +1,263 @@
+#ifndef LEXEND_LIGHT40PT7B_RLE_H
+#define LEXEND_LIGHT40PT7B_RLE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Light40pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES,
+// glyph bitmaps run-length encoded
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Light40pt7b_rleBitmaps[] PROGMEM = {
+  0x10, 0x92, 0x94, 0x74, 0x74, 0x74, 0x74, 0x74, 0x83, 0x84, 0x83, 0x84, 
+  0x83, 0x93, 0x93, 0x83, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xA3, 
+  0x93, 0x93, 0xA3, 0x93, 0xA3, 0x94, 0x93, 0xA3, 0x94, 0x94, 0x95, 0x92, 
+  0x10, 0x21, 0x94, 0x95, 0x94, 0x93, 0xA3, 0x94, 0x94, 0x93, 0x94, 0x93, 
+  0x93, 0x94, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
+  0x83, 0x93, 0x84, 0x83, 0x84, 0x83, 0x83, 0x84, 0x74, 0x74, 0x65, 0x83, 
+  0x80, 0x22, 0x34, 0x25, 0x15, 0x24, 0x33, 0x32, 0x33, 0x23, 0x23, 0x41, 
+  0x40, 0x0F, 0xF6, 0x21, 0x33, 0x1A, 0x13, 0x10, 0xF1, 0x4F, 0x13, 0xF1, 
+  0x3F, 0x23, 0xF1, 0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 0x4F, 0x13, 0xF1, 
+  0x4F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 
+  0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 
+  0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF2, 0x3F, 0x13, 0xF1, 0x4F, 0x10, 0x68, 
+  0xBC, 0x8E, 0x74, 0x74, 0x54, 0x94, 0x34, 0xB3, 0x33, 0xC3, 0x33, 0xC4, 
+  0x14, 0xD3, 0x13, 0xE3, 0x13, 0xE3, 0x13, 0xE3, 0x13, 0xE7, 0xE7, 0xE7, 
+  0xE7, 0xE3, 0x13, 0xE3, 0x13, 0xE3, 0x14, 0xD3, 0x23, 0xC4, 0x23, 0xC3, 
+  0x34, 0xB3, 0x44, 0x94, 0x54, 0x74, 0x6E, 0x8C, 0xB9, 0x60, 0x62, 0x94, 
+  0x76, 0x58, 0x67, 0x62, 0x23, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
+  0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 
+  0x6C, 0x1C, 0x1C, 0x2F, 0x04, 0xF1, 0x3F, 0x0E, 0x4E, 0x4E, 0x4E, 0x4F, 
+  0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x6C, 0x99, 0xC7, 0x44, 0x57, 0x17, 0x4F, 
+  0x14, 0xF1, 0x3F, 0x14, 0xF1, 0x3F, 0x13, 0xF1, 0x31, 0x2C, 0x31, 0x4B, 
+  0x31, 0x4A, 0x42, 0x57, 0x44, 0x71, 0x66, 0xC9, 0x95, 0x58, 0x8A, 0x5D, 
+  0x35, 0x64, 0x23, 0x97, 0xB3, 0x21, 0xB3, 0xE3, 0xE3, 0xE3, 0xD4, 0xC4, 
+  0xC4, 0xB5, 0x97, 0xB4, 0xD3, 0xE3, 0xE3, 0xE2, 0xFF, 0xFF, 0x71, 0xE4, 
+  0xD4, 0xD4, 0xD4, 0x70, 0xB3, 0xF6, 0x5F, 0x55, 0xF4, 0x7F, 0x33, 0x13, 
+  0xF3, 0x31, 0x3F, 0x23, 0x33, 0xF1, 0x33, 0x3F, 0x04, 0x34, 0xE3, 0x53, 
+  0xE3, 0x53, 0xD3, 0x64, 0xC3, 0x73, 0xC3, 0x73, 0xB3, 0x84, 0xA3, 0x93, 
+  0x94, 0x94, 0x8F, 0x28, 0xF2, 0x7F, 0x46, 0x3D, 0x35, 0x4D, 0x35, 0x3E, 
+  0x44, 0x3F, 0x03, 0x34, 0xF0, 0x42, 0x3F, 0x23, 0x23, 0xF2, 0x31, 0x3F, 
+  0x34, 0x0F, 0x06, 0xF2, 0x4F, 0x33, 0x3A, 0x62, 0x3C, 0x42, 0x3D, 0x32, 
+  0x3D, 0x32, 0x3D, 0x32, 0x3D, 0x32, 0x3D, 0x32, 0x3C, 0x33, 0x3B, 0x43, 
+  0xF1, 0x5F, 0x24, 0xF4, 0x23, 0xB5, 0x23, 0xD4, 0x13, 0xE7, 0xE7, 0xF0, 
+  0x6F, 0x06, 0xE7, 0xE3, 0x13, 0xD4, 0x13, 0xB6, 0x1F, 0x42, 0xF3, 0x3F, 
+  0x06, 0x99, 0xDD, 0x9F, 0x26, 0x67, 0x64, 0x5B, 0x52, 0x5D, 0x33, 0x4F, 
+  0x01, 0x34, 0xF5, 0x3F, 0x63, 0xF5, 0x4F, 0x53, 0xF6, 0x3F, 0x63, 0xF6, 
+  0x3F, 0x63, 0xF6, 0x3F, 0x64, 0xF6, 0x3F, 0x63, 0xF6, 0x4F, 0x64, 0xF5, 
+  0x5E, 0x15, 0x5C, 0x35, 0x68, 0x56, 0xF2, 0x9E, 0xCA, 0x50, 0x0E, 0xAF, 
+  0x27, 0xF3, 0x63, 0xB6, 0x43, 0xD5, 0x33, 0xE4, 0x33, 0xF0, 0x42, 0x3F, 
+  0x13, 0x23, 0xF1, 0x41, 0x3F, 0x23, 0x13, 0xF2, 0x31, 0x3F, 0x27, 0xF2, 
+  0x7F, 0x36, 0xF3, 0x6F, 0x27, 0xF2, 0x7F, 0x23, 0x13, 0xF2, 0x31, 0x3F, 
+  0x14, 0x13, 0xF1, 0x32, 0x3F, 0x04, 0x23, 0xE4, 0x33, 0xD5, 0x33, 0xB6, 
+  0x4F, 0x45, 0xF2, 0x7F, 0x09, 0x0F, 0xFF, 0x9E, 0x3E, 0x3E, 0x3E, 0x3E, 
+  0x3E, 0x3E, 0x3E, 0x3E, 0xF0, 0x2F, 0x02, 0xF0, 0x23, 0xE3, 0xE3, 0xE3, 
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0xFF, 0x60, 0x0F, 0xFF, 0xCF, 
+  0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 
+  0x0F, 0x12, 0xF1, 0x2F, 0x12, 0xF1, 0x23, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 
+  0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 
+  0x00, 0xA9, 0xF0, 0xEC, 0xF2, 0x86, 0x86, 0x65, 0xC5, 0x54, 0xF0, 0x25, 
+  0x4F, 0x11, 0x54, 0xF8, 0x4F, 0x83, 0xF8, 0x4F, 0x83, 0xF9, 0x3F, 0x93, 
+  0xF9, 0x3B, 0xF1, 0xBF, 0x1B, 0xF2, 0xF5, 0x31, 0x3F, 0x53, 0x14, 0xF3, 
+  0x41, 0x4F, 0x33, 0x34, 0xF2, 0x34, 0x4F, 0x03, 0x55, 0xD4, 0x66, 0x95, 
+  0x9F, 0x2B, 0xF0, 0xEB, 0x70, 0x03, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 
+  0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 
+  0xF1, 0xFF, 0xFF, 0xCF, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 
+  0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x30, 0x0F, 0xF6, 
+  0x43, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x5F, 0xF6, 
+  0x9C, 0x9C, 0x9C, 0xE3, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 
+  0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 
+  0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x36, 0x1B, 0x35, 0x2A, 0x44, 0x49, 0x36, 
+  0x46, 0x57, 0xD9, 0xBB, 0x98, 0x03, 0xF0, 0x41, 0x3E, 0x42, 0x3D, 0x43, 
+  0x3C, 0x44, 0x3B, 0x45, 0x3A, 0x46, 0x39, 0x47, 0x38, 0x48, 0x37, 0x49, 
+  0x36, 0x4A, 0x35, 0x4B, 0x34, 0x4C, 0x33, 0x5C, 0x32, 0x7B, 0x31, 0x41, 
+  0x4A, 0x72, 0x4A, 0x55, 0x49, 0x47, 0x48, 0x39, 0x47, 0x39, 0x47, 0x3A, 
+  0x46, 0x3B, 0x45, 0x3C, 0x44, 0x3C, 0x44, 0x3D, 0x43, 0x3E, 0x42, 0x3F, 
+  0x04, 0x13, 0xF0, 0x50, 0x03, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0xFF, 0x60, 0x03, 0xF5, 0x7F, 0x39, 
+  0xF2, 0x9F, 0x1B, 0xF0, 0xCD, 0x91, 0x3C, 0xA1, 0x4B, 0x31, 0x62, 0x3A, 
+  0x32, 0x62, 0x48, 0x42, 0x63, 0x47, 0x33, 0x64, 0x36, 0x43, 0x64, 0x45, 
+  0x34, 0x65, 0x34, 0x35, 0x66, 0x32, 0x45, 0x66, 0x41, 0x36, 0x67, 0x67, 
+  0x67, 0x67, 0x68, 0x48, 0x69, 0x29, 0x6F, 0x56, 0xF5, 0x6F, 0x56, 0xF5, 
+  0x6F, 0x56, 0xF5, 0x6F, 0x56, 0xF5, 0x30, 0x03, 0xF2, 0x7F, 0x18, 0xF0, 
+  0x9E, 0x9E, 0xAD, 0x61, 0x4C, 0x62, 0x4B, 0x63, 0x3B, 0x63, 0x4A, 0x64, 
+  0x49, 0x65, 0x48, 0x66, 0x38, 0x66, 0x47, 0x67, 0x46, 0x68, 0x45, 0x69, 
+  0x35, 0x69, 0x44, 0x6A, 0x43, 0x6B, 0x42, 0x6C, 0x32, 0x6C, 0x41, 0x6D, 
+  0x41, 0x5E, 0x9F, 0x08, 0xF1, 0x7F, 0x17, 0xF2, 0x30, 0x99, 0xF1, 0xEB, 
+  0xF2, 0x96, 0x85, 0x75, 0xC4, 0x55, 0xE4, 0x44, 0xF1, 0x42, 0x4F, 0x24, 
+  0x23, 0xF4, 0x32, 0x3F, 0x48, 0xF5, 0x6F, 0x66, 0xF6, 0x6F, 0x66, 0xF6, 
+  0x6F, 0x66, 0xF6, 0x7F, 0x53, 0x13, 0xF4, 0x41, 0x3F, 0x44, 0x14, 0xF2, 
+  0x43, 0x4F, 0x14, 0x34, 0xF0, 0x45, 0x5C, 0x47, 0x59, 0x59, 0xF2, 0xCE, 
+  0xF0, 0xA8, 0x0E, 0x5F, 0x13, 0xF2, 0x23, 0xA5, 0x13, 0xB4, 0x13, 0xC7, 
+  0xC7, 0xD6, 0xD6, 0xD6, 0xC7, 0xC3, 0x13, 0xB4, 0x13, 0xA5, 0x1F, 0x22, 
+  0xF1, 0x3E, 0x53, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 
+  0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x0E, 0x7F, 0x15, 0xF2, 0x43, 
+  0xA5, 0x33, 0xC4, 0x23, 0xD3, 0x23, 0xD4, 0x13, 0xD4, 0x13, 0xE3, 0x13, 
+  0xE3, 0x13, 0xD4, 0x13, 0xD3, 0x23, 0xC4, 0x23, 0xB4, 0x3F, 0x24, 0xF1, 
+  0x5E, 0x73, 0x84, 0x63, 0x93, 0x63, 0x94, 0x53, 0xA4, 0x43, 0xA4, 0x43, 
+  0xB4, 0x33, 0xC3, 0x33, 0xC4, 0x23, 0xD3, 0x23, 0xD4, 0x13, 0xE4, 0x69, 
+  0xAC, 0x6F, 0x05, 0x47, 0x53, 0x4A, 0x42, 0x3C, 0x22, 0x4C, 0x13, 0x4F, 
+  0x14, 0xF2, 0x3F, 0x24, 0xF2, 0x5F, 0x18, 0xDA, 0xCA, 0xE7, 0xF1, 0x5F, 
+  0x15, 0xF1, 0x4F, 0x23, 0xF2, 0x31, 0x2E, 0x31, 0x3D, 0x8B, 0x32, 0x59, 
+  0x43, 0xF1, 0x6D, 0x8A, 0x50, 0x0F, 0xFF, 0xF0, 0x83, 0xF2, 0x3F, 0x23, 
+  0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 
+  0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 
+  0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0x90, 0x03, 0xF1, 
+  0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 
+  0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 
+  0x6F, 0x16, 0xF1, 0x6F, 0x17, 0xE4, 0x13, 0xE3, 0x24, 0xC4, 0x34, 0xA4, 
+  0x46, 0x65, 0x6F, 0x09, 0xCB, 0x97, 0x04, 0xF2, 0x41, 0x3F, 0x24, 0x13, 
+  0xF2, 0x32, 0x4F, 0x04, 0x33, 0xF0, 0x34, 0x4E, 0x35, 0x3D, 0x45, 0x3D, 
+  0x36, 0x4B, 0x47, 0x3B, 0x38, 0x4A, 0x38, 0x49, 0x49, 0x39, 0x3A, 0x48, 
+  0x3B, 0x37, 0x3C, 0x37, 0x3C, 0x45, 0x4D, 0x35, 0x3E, 0x44, 0x3F, 0x03, 
+  0x33, 0xF1, 0x33, 0x3F, 0x14, 0x14, 0xF2, 0x31, 0x3F, 0x33, 0x13, 0xF3, 
+  0x6F, 0x55, 0xF5, 0x5F, 0x63, 0xB0, 0x04, 0xF1, 0x41, 0x4E, 0x42, 0x4E, 
+  0x34, 0x4C, 0x45, 0x4B, 0x37, 0x3A, 0x38, 0x48, 0x49, 0x47, 0x3B, 0x36, 
+  0x3C, 0x44, 0x4D, 0x43, 0x3F, 0x04, 0x14, 0xF1, 0x7F, 0x26, 0xF4, 0x5F, 
+  0x53, 0xF6, 0x3F, 0x63, 0xF6, 0x3F, 0x63, 0xF6, 0x3F, 0x63, 0xF6, 0x3F, 
+  0x63, 0xF6, 0x3F, 0x63, 0xF6, 0x3F, 0x63, 0xA0, 0x1F, 0x52, 0xF5, 0x2F, 
+  0x5F, 0x33, 0xF3, 0x4F, 0x24, 0xF3, 0x3F, 0x34, 0xF2, 0x4F, 0x24, 0xF3, 
+  0x3F, 0x34, 0xF2, 0x4F, 0x24, 0xF3, 0x3F, 0x34, 0xF2, 0x4F, 0x24, 0xF3, 
+  0x3F, 0x34, 0xF2, 0x4F, 0x24, 0xF3, 0x4F, 0x24, 0xF2, 0x4F, 0x2F, 0xFF, 
+  0xF6, 0xF0, 0x1F, 0x74, 0xF5, 0x5F, 0x35, 0xF4, 0x4F, 0x71, 0xFF, 0xFF, 
+  0xF0, 0x3F, 0x65, 0xF5, 0x5F, 0x47, 0xF3, 0x31, 0x3F, 0x33, 0x13, 0xF2, 
+  0x33, 0x3F, 0x13, 0x33, 0xF0, 0x43, 0x4E, 0x35, 0x3E, 0x35, 0x3D, 0x36, 
+  0x4C, 0x37, 0x3C, 0x37, 0x3B, 0x38, 0x4A, 0x39, 0x39, 0x49, 0x48, 0xF2, 
+  0x8F, 0x27, 0xF4, 0x63, 0xD3, 0x54, 0xD3, 0x53, 0xE4, 0x43, 0xF0, 0x33, 
+  0x4F, 0x04, 0x23, 0xF2, 0x32, 0x3F, 0x23, 0x13, 0xF3, 0x40, 0xB2, 0xE3, 
+  0xC6, 0x96, 0xB3, 0xE1, 0xFF, 0xEF, 0xFF, 0x9E, 0x3E, 0x3E, 0x3E, 0x3E, 
+  0x3E, 0x3E, 0x3E, 0x3E, 0xF0, 0x2F, 0x02, 0xF0, 0x23, 0xE3, 0xE3, 0xE3, 
+  0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xEF, 0xFF, 0x60, 0x82, 0x93, 0x76, 
+  0x46, 0x54, 0x91, 0xFF, 0x2F, 0xF6, 0x43, 0x93, 0x93, 0x93, 0x93, 0x93, 
+  0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 
+  0x93, 0x93, 0x93, 0x93, 0x5F, 0xF6, 0xF1, 0x1F, 0x94, 0xF7, 0x6F, 0x46, 
+  0xF5, 0x4F, 0x91, 0xFF, 0xFF, 0xF3, 0x9F, 0x1E, 0xBF, 0x29, 0x68, 0x57, 
+  0x5C, 0x45, 0x5E, 0x44, 0x4F, 0x14, 0x24, 0xF2, 0x42, 0x3F, 0x43, 0x23, 
+  0xF4, 0x8F, 0x56, 0xF6, 0x6F, 0x66, 0xF6, 0x6F, 0x66, 0xF6, 0x6F, 0x67, 
+  0xF5, 0x31, 0x3F, 0x44, 0x13, 0xF4, 0x41, 0x4F, 0x24, 0x34, 0xF1, 0x43, 
+  0x4F, 0x04, 0x55, 0xC4, 0x75, 0x95, 0x9F, 0x2C, 0xEF, 0x0A, 0x80, 0xD2, 
+  0xF4, 0x3F, 0x26, 0xE6, 0xF1, 0x3F, 0x41, 0xFF, 0xFC, 0x3F, 0x16, 0xF1, 
+  0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 
+  0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 
+  0x6F, 0x16, 0xF1, 0x7E, 0x41, 0x3E, 0x32, 0x4C, 0x43, 0x4A, 0x44, 0x66, 
+  0x56, 0xF0, 0x9C, 0xB9, 0x70, 0xE2, 0xF6, 0x3F, 0x46, 0xF1, 0x6F, 0x33, 
+  0xF6, 0x1F, 0xFF, 0xF2, 0x4F, 0x14, 0x14, 0xE4, 0x24, 0xE3, 0x44, 0xC4, 
+  0x54, 0xB3, 0x73, 0xA3, 0x84, 0x84, 0x94, 0x73, 0xB3, 0x63, 0xC4, 0x44, 
+  0xD4, 0x33, 0xF0, 0x41, 0x4F, 0x17, 0xF2, 0x6F, 0x45, 0xF5, 0x3F, 0x63, 
+  0xF6, 0x3F, 0x63, 0xF6, 0x3F, 0x63, 0xF6, 0x3F, 0x63, 0xF6, 0x3F, 0x63, 
+  0xF6, 0x3F, 0x63, 0xF6, 0x3A, 0x83, 0x63, 0xD3, 0x34, 0xF0, 0x8F, 0x25, 
+  0xF5, 0x3F, 0xFF, 0xF6, 0x9D, 0xD9, 0xF2, 0x66, 0x76, 0x45, 0xB5, 0x25, 
+  0xD3, 0x34, 0xF0, 0x13, 0x4F, 0x53, 0xF6, 0x3F, 0x54, 0xF5, 0x3F, 0x63, 
+  0xF6, 0x3F, 0x63, 0xF6, 0x3F, 0x63, 0xF6, 0x4F, 0x63, 0xF6, 0x3F, 0x64, 
+  0xF6, 0x4F, 0x55, 0xE1, 0x55, 0xC3, 0x56, 0x85, 0x6F, 0x29, 0xEC, 0xA5, 
+  0x53, 0x63, 0xD4, 0x24, 0xF0, 0x8F, 0x26, 0xF4, 0x3F, 0xFF, 0xF0, 0xEA, 
+  0xF2, 0x7F, 0x36, 0x3B, 0x64, 0x3D, 0x53, 0x3E, 0x43, 0x3F, 0x04, 0x23, 
+  0xF1, 0x32, 0x3F, 0x14, 0x13, 0xF2, 0x31, 0x3F, 0x23, 0x13, 0xF2, 0x7F, 
+  0x27, 0xF3, 0x6F, 0x36, 0xF2, 0x7F, 0x27, 0xF2, 0x31, 0x3F, 0x23, 0x13, 
+  0xF1, 0x41, 0x3F, 0x13, 0x23, 0xF0, 0x42, 0x3E, 0x43, 0x3D, 0x53, 0x3B, 
+  0x64, 0xF4, 0x5F, 0x27, 0xF0, 0x90, 0x33, 0x63, 0x64, 0x24, 0x88, 0xA6, 
+  0xC4, 0xFF, 0xAF, 0xFF, 0x9E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 
+  0x3E, 0xF0, 0x2F, 0x02, 0xF0, 0x23, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 
+  0xE3, 0xE3, 0xE3, 0xEF, 0xFF, 0x60, 0x63, 0x63, 0xC4, 0x24, 0xE8, 0xF1, 
+  0x5F, 0x43, 0xFF, 0xFB, 0x3F, 0x27, 0xF1, 0x8F, 0x09, 0xE9, 0xEA, 0xD6, 
+  0x14, 0xC6, 0x24, 0xB6, 0x33, 0xB6, 0x34, 0xA6, 0x44, 0x96, 0x54, 0x86, 
+  0x63, 0x86, 0x64, 0x76, 0x74, 0x66, 0x84, 0x56, 0x93, 0x56, 0x94, 0x46, 
+  0xA4, 0x36, 0xB4, 0x26, 0xC3, 0x26, 0xC4, 0x16, 0xD4, 0x15, 0xE9, 0xF0, 
+  0x8F, 0x17, 0xF1, 0x7F, 0x23, 0x23, 0x63, 0xA4, 0x34, 0xC7, 0xF0, 0x5F, 
+  0x23, 0xFF, 0xF8, 0xE7, 0xF1, 0x5F, 0x24, 0x3A, 0x53, 0x3C, 0x42, 0x3D, 
+  0x32, 0x3D, 0x41, 0x3D, 0x41, 0x3E, 0x31, 0x3E, 0x31, 0x3D, 0x41, 0x3D, 
+  0x32, 0x3C, 0x42, 0x3B, 0x43, 0xF2, 0x4F, 0x15, 0xE7, 0x38, 0x46, 0x39, 
+  0x36, 0x39, 0x45, 0x3A, 0x44, 0x3A, 0x44, 0x3B, 0x43, 0x3C, 0x33, 0x3C, 
+  0x42, 0x3D, 0x32, 0x3D, 0x41, 0x3E, 0x40, 0x53, 0x63, 0x94, 0x24, 0xB8, 
+  0xD5, 0xF1, 0x3F, 0xFF, 0x99, 0xAC, 0x6F, 0x05, 0x47, 0x53, 0x4A, 0x42, 
+  0x3C, 0x22, 0x4C, 0x13, 0x4F, 0x14, 0xF2, 0x3F, 0x24, 0xF2, 0x5F, 0x18, 
+  0xDA, 0xCA, 0xE7, 0xF1, 0x5F, 0x15, 0xF1, 0x4F, 0x23, 0xF2, 0x31, 0x2E, 
+  0x31, 0x3D, 0x8B, 0x32, 0x59, 0x43, 0xF1, 0x6D, 0x8A, 0x50, 0x43, 0x63, 
+  0x94, 0x24, 0xB8, 0xD6, 0xF0, 0x3F, 0xFF, 0x4F, 0xFF, 0xF0, 0x83, 0xF2, 
+  0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 
+  0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 
+  0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0x90, 
+  0x94, 0xF2, 0x6F, 0x03, 0x23, 0xE2, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xE3, 
+  0x23, 0xF0, 0x68, 0x37, 0x27, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 
+  0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 
+  0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x17, 0xE4, 0x13, 
+  0xE3, 0x24, 0xC4, 0x34, 0xA4, 0x46, 0x65, 0x6F, 0x09, 0xCB, 0x97, 0x53, 
+  0x63, 0xB4, 0x24, 0xD8, 0xF0, 0x6F, 0x23, 0xFF, 0xFA, 0xF5, 0x2F, 0x52, 
+  0xF5, 0xF3, 0x3F, 0x34, 0xF2, 0x4F, 0x33, 0xF3, 0x4F, 0x24, 0xF2, 0x4F, 
+  0x33, 0xF3, 0x4F, 0x24, 0xF2, 0x4F, 0x33, 0xF3, 0x4F, 0x24, 0xF2, 0x4F, 
+  0x33, 0xF3, 0x4F, 0x24, 0xF2, 0x4F, 0x34, 0xF2, 0x4F, 0x24, 0xF2, 0xFF, 
+  0xFF, 0x60, 0x14, 0x43, 0x13, 0x44, 0x13, 0x48, 0x43, 0x13, 0x53, 0x13, 
+  0x53, 0x13, 0x52, 0x22, 0x62, 0x22, 0x62, 0x22, 0x53, 0x20 };
+
+const GFXglyph Lexend_Light40pt7b_rleGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,  12,  35,  14,    1,  -27 },   // 0x28 '('
+  {    37,  12,  35,  14,    1,  -27 },   // 0x29 ')'
+  {    73,   6,  11,  10,    2,   -3 },   // 0x2C ','
+  {    85,  12,   3,  16,    2,  -12 },   // 0x2D '-'
+  {    87,   5,   5,   9,    2,   -4 },   // 0x2E '.'
+  {    92,  20,  33,  22,    1,  -27 },   // 0x2F '/'
+  {   143,  21,  28,  24,    2,  -27 },   // 0x30 '0'
+  {   190,  13,  28,  18,    3,  -27 },   // 0x31 '1'
+  {   219,  19,  28,  21,    1,  -27 },   // 0x33 '3'
+  {   261,  17,  28,  20,    1,  -27 },   // 0x3F '?'
+  {   292,  25,  28,  27,    1,  -27 },   // 0x41 'A'
+  {   349,  21,  28,  27,    4,  -27 },   // 0x42 'B'
+  {   397,  24,  28,  27,    2,  -27 },   // 0x43 'C'
+  {   442,  24,  28,  30,    4,  -27 },   // 0x44 'D'
+  {   497,  17,  28,  24,    4,  -27 },   // 0x45 'E'
+  {   525,  18,  28,  24,    4,  -27 },   // 0x46 'F'
+  {   565,  27,  28,  31,    2,  -27 },   // 0x47 'G'
+  {   617,  22,  28,  30,    4,  -27 },   // 0x48 'H'
+  {   658,  12,  28,  18,    3,  -27 },   // 0x49 'I'
+  {   684,  21,  28,  25,    2,  -27 },   // 0x4A 'J'
+  {   725,  23,  28,  28,    4,  -27 },   // 0x4B 'K'
+  {   784,  17,  28,  23,    4,  -27 },   // 0x4C 'L'
+  {   812,  26,  28,  34,    4,  -27 },   // 0x4D 'M'
+  {   871,  23,  28,  31,    4,  -27 },   // 0x4E 'N'
+  {   921,  27,  28,  31,    2,  -27 },   // 0x4F 'O'
+  {   974,  19,  28,  25,    4,  -27 },   // 0x50 'P'
+  {  1015,  21,  28,  26,    4,  -27 },   // 0x52 'R'
+  {  1067,  20,  28,  24,    2,  -27 },   // 0x53 'S'
+  {  1109,  20,  28,  22,    1,  -27 },   // 0x54 'T'
+  {  1150,  22,  28,  30,    4,  -27 },   // 0x55 'U'
+  {  1194,  25,  28,  27,    1,  -27 },   // 0x56 'V'
+  {  1254,  24,  28,  26,    1,  -27 },   // 0x59 'Y'
+  {  1304,  22,  28,  26,    2,  -27 },   // 0x5A 'Z'
+  {  1345,  25,  36,  27,    1,  -35 },   // 0xC1
+  {  1414,  17,  36,  24,    4,  -35 },   // 0xC9
+  {  1449,  12,  36,  18,    3,  -35 },   // 0xCD
+  {  1482,  27,  36,  31,    2,  -35 },   // 0xD3
+  {  1547,  22,  36,  30,    4,  -35 },   // 0xDA
+  {  1601,  24,  36,  26,    1,  -35 },   // 0xDD
+  {  1661,  24,  35,  27,    2,  -34 },   // 0x10C
+  {  1716,  24,  35,  30,    4,  -34 },   // 0x10E
+  {  1782,  17,  35,  24,    4,  -34 },   // 0x11A
+  {  1818,  23,  35,  31,    4,  -34 },   // 0x147
+  {  1877,  21,  35,  26,    4,  -34 },   // 0x158
+  {  1939,  20,  35,  24,    2,  -34 },   // 0x160
+  {  1990,  20,  35,  22,    1,  -34 },   // 0x164
+  {  2040,  22,  36,  30,    4,  -35 },   // 0x16E
+  {  2099,  22,  35,  26,    2,  -34 },   // 0x17D
+  {  2150,  12,  10,  16,    2,  -27 },   // 0x201C
+  {  2150,  12,  10,  16,    2,  -27 }   // 0x201D
+};
+
+const uint16_t Lexend_Light40pt7b_rleCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Light40pt7b_rle PROGMEM = {
+  { (uint8_t  *)Lexend_Light40pt7b_rleBitmaps,
+    (GFXglyph *)Lexend_Light40pt7b_rleGlyphs,
+    SPARSE_RLE_FONT_FIRST, 50, 50 },
+  Lexend_Light40pt7b_rleCodepoints };
+
+// Approx. 2700 bytes
+
+#endif // LEXEND_LIGHT40PT7B_RLE_H
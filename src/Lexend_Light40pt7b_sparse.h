@@ -0,0 +1,386 @@
+#ifndef LEXEND_LIGHT40PT7B_SPARSE_H
+#define LEXEND_LIGHT40PT7B_SPARSE_H
+
+#include <Adafruit_GFX.h>
+#include "SparseFont.h"
+
+// Lexend_Light40pt7b subset to the 51 glyphs used by cards.csv and CATEGORY_NAMES
+// Generated by src/subset_font.py, do not edit
+
+const uint8_t Lexend_Light40pt7b_sparseBitmaps[] PROGMEM = {
+  0x00, 0x00, 0x60, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x01, 
+  0xC0, 0x3C, 0x03, 0x80, 0x78, 0x07, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x0E, 
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x70, 0x07, 
+  0x00, 0x70, 0x03, 0x80, 0x38, 0x01, 0xC0, 0x1E, 0x00, 0xE0, 0x07, 0x00, 
+  0x78, 0x03, 0xC0, 0x1F, 0x00, 0x60, 0x20, 0x0F, 0x00, 0x7C, 0x01, 0xE0, 
+  0x0E, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01, 0xC0, 0x1E, 0x00, 0xE0, 0x0E, 
+  0x00, 0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 
+  0x00, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x1E, 0x01, 0xC0, 0x3C, 
+  0x03, 0x80, 0x70, 0x0F, 0x01, 0xE0, 0x3C, 0x0F, 0x80, 0x70, 0x00, 0x31, 
+  0xE7, 0xDF, 0x3C, 0x71, 0x8E, 0x73, 0x84, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xF0, 0x23, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0x01, 
+  0xC0, 0x00, 0x1C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 
+  0x70, 0x00, 0x0F, 0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xC0, 0x00, 
+  0x1C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 
+  0x0E, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x38, 0x00, 
+  0x03, 0x80, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 
+  0x01, 0xC0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x38, 0x00, 0x07, 0x00, 
+  0x00, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xE0, 
+  0x3C, 0x07, 0x83, 0xC0, 0x1E, 0x3C, 0x00, 0x71, 0xC0, 0x03, 0x8E, 0x00, 
+  0x1E, 0xF0, 0x00, 0x77, 0x00, 0x03, 0xB8, 0x00, 0x1D, 0xC0, 0x00, 0xEE, 
+  0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 
+  0x77, 0x00, 0x03, 0xB8, 0x00, 0x1D, 0xE0, 0x00, 0xE7, 0x00, 0x0F, 0x38, 
+  0x00, 0x71, 0xE0, 0x03, 0x87, 0x80, 0x3C, 0x1E, 0x03, 0xC0, 0xFF, 0xFC, 
+  0x03, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0x03, 0x00, 0x78, 0x0F, 0xC1, 0xFE, 
+  0x07, 0xF0, 0x33, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 
+  0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 
+  0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x03, 0xFF, 
+  0xDF, 0xFE, 0xFF, 0xF0, 0x3F, 0xFF, 0x87, 0xFF, 0xF8, 0xFF, 0xFE, 0x00, 
+  0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 
+  0xE0, 0x00, 0x38, 0x00, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0xFF, 0xF0, 0x1E, 
+  0x1F, 0x01, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xC0, 0x00, 0x3C, 0x00, 
+  0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0xC0, 0x03, 0xBC, 0x00, 0x77, 0x80, 
+  0x1E, 0x7C, 0x07, 0x87, 0xF7, 0xE0, 0x7F, 0xF8, 0x03, 0xFE, 0x00, 0x07, 
+  0xF8, 0x07, 0xFE, 0x0F, 0xFF, 0x8F, 0x81, 0xE7, 0x00, 0x7F, 0x00, 0x1C, 
+  0x80, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x01, 
+  0xE0, 0x01, 0xE0, 0x03, 0xE0, 0x0F, 0xE0, 0x03, 0xC0, 0x01, 0xC0, 0x00, 
+  0xE0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00, 
+  0x1C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xE0, 0x00, 
+  0x07, 0x70, 0x00, 0x03, 0xB8, 0x00, 0x03, 0x8E, 0x00, 0x01, 0xC7, 0x00, 
+  0x01, 0xE3, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 0x70, 0x70, 0x00, 0x70, 0x3C, 
+  0x00, 0x38, 0x0E, 0x00, 0x1C, 0x07, 0x00, 0x1C, 0x03, 0xC0, 0x0E, 0x00, 
+  0xE0, 0x0F, 0x00, 0x78, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 
+  0xFF, 0x81, 0xC0, 0x01, 0xC1, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0x78, 0x70, 
+  0x00, 0x1C, 0x78, 0x00, 0x0F, 0x38, 0x00, 0x03, 0x9C, 0x00, 0x01, 0xDC, 
+  0x00, 0x00, 0xF0, 0xFF, 0xFE, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xF1, 0xC0, 
+  0x0F, 0xCE, 0x00, 0x1E, 0x70, 0x00, 0x73, 0x80, 0x03, 0x9C, 0x00, 0x1C, 
+  0xE0, 0x00, 0xE7, 0x00, 0x07, 0x38, 0x00, 0x71, 0xC0, 0x07, 0x8F, 0xFF, 
+  0xF0, 0x7F, 0xFF, 0xC3, 0xFF, 0xFF, 0x9C, 0x00, 0x7C, 0xE0, 0x00, 0xF7, 
+  0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xF0, 0x00, 
+  0x3F, 0x80, 0x01, 0xDC, 0x00, 0x1E, 0xE0, 0x03, 0xF7, 0xFF, 0xFF, 0x3F, 
+  0xFF, 0xF1, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x01, 0xFF, 0xF0, 0x07, 
+  0xFF, 0xFC, 0x0F, 0xC0, 0x7E, 0x1F, 0x00, 0x1F, 0x3E, 0x00, 0x0E, 0x3C, 
+  0x00, 0x04, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xF0, 
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 
+  0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x70, 
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3E, 
+  0x00, 0x04, 0x1F, 0x00, 0x0E, 0x0F, 0xC0, 0x3E, 0x07, 0xFF, 0xFC, 0x01, 
+  0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 
+  0xFF, 0xC0, 0xE0, 0x03, 0xF0, 0xE0, 0x00, 0xF8, 0xE0, 0x00, 0x78, 0xE0, 
+  0x00, 0x3C, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x1E, 0xE0, 0x00, 0x0E, 0xE0, 
+  0x00, 0x0E, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xE0, 
+  0x00, 0x07, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0E, 0xE0, 
+  0x00, 0x0E, 0xE0, 0x00, 0x1E, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x3C, 0xE0, 
+  0x00, 0x78, 0xE0, 0x00, 0xF8, 0xE0, 0x03, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 
+  0xFF, 0x80, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 
+  0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0F, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 
+  0xF9, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x7F, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 
+  0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xFF, 0xFF, 0x3F, 0xFF, 
+  0xCF, 0xFF, 0xF3, 0xFF, 0xFC, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 
+  0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0xE0, 
+  0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x00, 0x00, 0x3F, 0xE0, 0x00, 
+  0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x07, 0xE0, 0x1F, 0x81, 0xF0, 0x00, 
+  0xF8, 0x3C, 0x00, 0x06, 0x0F, 0x00, 0x00, 0x83, 0xC0, 0x00, 0x00, 0x78, 
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 
+  0x0E, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x38, 0x00, 0xFF, 0xFF, 0x00, 
+  0x1F, 0xFF, 0xE0, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0x03, 
+  0xBC, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x1C, 0x78, 0x00, 0x03, 0x87, 0x80, 
+  0x00, 0xE0, 0xF8, 0x00, 0x3C, 0x0F, 0xC0, 0x1F, 0x00, 0x7F, 0xFF, 0xC0, 
+  0x07, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0xE0, 0x00, 0x1F, 0x80, 0x00, 
+  0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 
+  0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 
+  0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 
+  0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 
+  0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 
+  0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 
+  0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 
+  0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 
+  0x1F, 0xFE, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 
+  0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 
+  0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 
+  0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 
+  0x38, 0x10, 0x01, 0xC1, 0x80, 0x1E, 0x1E, 0x00, 0xE0, 0x78, 0x1F, 0x01, 
+  0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0xE0, 0x00, 0x3D, 0xC0, 
+  0x00, 0xF3, 0x80, 0x03, 0xC7, 0x00, 0x0F, 0x0E, 0x00, 0x3C, 0x1C, 0x00, 
+  0xF0, 0x38, 0x03, 0xC0, 0x70, 0x0F, 0x00, 0xE0, 0x3C, 0x01, 0xC0, 0xF0, 
+  0x03, 0x83, 0xC0, 0x07, 0x0F, 0x00, 0x0E, 0x3E, 0x00, 0x1C, 0xFE, 0x00, 
+  0x3B, 0xDE, 0x00, 0x7F, 0x3C, 0x00, 0xF8, 0x3C, 0x01, 0xE0, 0x3C, 0x03, 
+  0x80, 0x3C, 0x07, 0x00, 0x78, 0x0E, 0x00, 0x78, 0x1C, 0x00, 0x78, 0x38, 
+  0x00, 0x78, 0x70, 0x00, 0xF0, 0xE0, 0x00, 0xF1, 0xC0, 0x00, 0xF3, 0x80, 
+  0x00, 0xF7, 0x00, 0x01, 0xF0, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 
+  0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 
+  0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x7F, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFF, 
+  0x80, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x03, 
+  0xFE, 0xE0, 0x01, 0xFF, 0xBC, 0x00, 0x77, 0xE7, 0x00, 0x39, 0xF9, 0xE0, 
+  0x1E, 0x7E, 0x3C, 0x07, 0x1F, 0x87, 0x03, 0xC7, 0xE1, 0xE0, 0xE1, 0xF8, 
+  0x38, 0x70, 0x7E, 0x07, 0x3C, 0x1F, 0x81, 0xEE, 0x07, 0xE0, 0x3F, 0x01, 
+  0xF8, 0x0F, 0xC0, 0x7E, 0x01, 0xE0, 0x1F, 0x80, 0x30, 0x07, 0xE0, 0x00, 
+  0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 0xE0, 
+  0x00, 0x01, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x07, 
+  0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 
+  0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFB, 0xC0, 0x03, 0xF3, 0xC0, 0x07, 0xE3, 
+  0x80, 0x0F, 0xC7, 0x80, 0x1F, 0x87, 0x80, 0x3F, 0x07, 0x80, 0x7E, 0x07, 
+  0x00, 0xFC, 0x0F, 0x01, 0xF8, 0x0F, 0x03, 0xF0, 0x0F, 0x07, 0xE0, 0x0E, 
+  0x0F, 0xC0, 0x1E, 0x1F, 0x80, 0x1E, 0x3F, 0x00, 0x1E, 0x7E, 0x00, 0x1C, 
+  0xFC, 0x00, 0x3D, 0xF8, 0x00, 0x3D, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 
+  0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x7F, 0xC0, 
+  0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xE0, 0x1F, 0x01, 0xF0, 
+  0x00, 0xF0, 0x7C, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF3, 0xC0, 0x00, 0x1E, 
+  0x70, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 
+  0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1D, 0xC0, 0x00, 
+  0x07, 0xB8, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x3C, 0x78, 0x00, 0x07, 0x8F, 
+  0x00, 0x01, 0xE0, 0xF8, 0x00, 0x78, 0x0F, 0x80, 0x3E, 0x00, 0xFF, 0xFF, 
+  0x80, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFC, 0x1F, 0xFF, 
+  0xE3, 0xFF, 0xFE, 0x70, 0x03, 0xEE, 0x00, 0x3D, 0xC0, 0x03, 0xF8, 0x00, 
+  0x7F, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x07, 0xF0, 0x00, 
+  0xEE, 0x00, 0x3D, 0xC0, 0x0F, 0xBF, 0xFF, 0xE7, 0xFF, 0xF8, 0xFF, 0xFC, 
+  0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 
+  0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 
+  0x70, 0x00, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xE1, 0xC0, 
+  0x0F, 0x8E, 0x00, 0x1E, 0x70, 0x00, 0x73, 0x80, 0x03, 0xDC, 0x00, 0x1E, 
+  0xE0, 0x00, 0x77, 0x00, 0x03, 0xB8, 0x00, 0x3D, 0xC0, 0x01, 0xCE, 0x00, 
+  0x1E, 0x70, 0x01, 0xE3, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0xFF, 0xFC, 0x07, 
+  0x00, 0xF0, 0x38, 0x03, 0x81, 0xC0, 0x1E, 0x0E, 0x00, 0x78, 0x70, 0x03, 
+  0xC3, 0x80, 0x0F, 0x1C, 0x00, 0x38, 0xE0, 0x01, 0xE7, 0x00, 0x07, 0x38, 
+  0x00, 0x3D, 0xC0, 0x00, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xF8, 0x1F, 0xFF, 
+  0xC1, 0xE0, 0x3E, 0x3C, 0x00, 0xF3, 0x80, 0x06, 0x78, 0x00, 0x47, 0x80, 
+  0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 
+  0xF0, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x03, 0xE0, 
+  0x00, 0x1F, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x00, 0x00, 0x76, 0x00, 0x07, 
+  0x70, 0x00, 0x7F, 0x80, 0x0E, 0x7C, 0x01, 0xE3, 0xFF, 0xFC, 0x0F, 0xFF, 
+  0x80, 0x7F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0E, 
+  0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 
+  0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 
+  0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 
+  0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 
+  0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 
+  0x00, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 
+  0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 
+  0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 
+  0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 
+  0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x3D, 0xC0, 
+  0x00, 0xE7, 0x80, 0x07, 0x8F, 0x00, 0x3C, 0x3F, 0x03, 0xE0, 0x7F, 0xFF, 
+  0x00, 0x7F, 0xF8, 0x00, 0xFF, 0x80, 0xF0, 0x00, 0x07, 0xB8, 0x00, 0x03, 
+  0xDC, 0x00, 0x01, 0xCF, 0x00, 0x01, 0xE3, 0x80, 0x00, 0xE1, 0xE0, 0x00, 
+  0x70, 0x70, 0x00, 0x78, 0x38, 0x00, 0x38, 0x1E, 0x00, 0x3C, 0x07, 0x00, 
+  0x1C, 0x03, 0xC0, 0x0E, 0x01, 0xE0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x3C, 
+  0x03, 0x80, 0x0E, 0x03, 0x80, 0x07, 0x01, 0xC0, 0x03, 0xC1, 0xE0, 0x00, 
+  0xE0, 0xE0, 0x00, 0x78, 0x70, 0x00, 0x1C, 0x70, 0x00, 0x0E, 0x38, 0x00, 
+  0x07, 0xBC, 0x00, 0x01, 0xDC, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x7E, 0x00, 
+  0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x00, 
+  0x0F, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1C, 0x3C, 0x00, 0x3C, 0x1E, 0x00, 
+  0x38, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x80, 0xE0, 0x03, 0x81, 
+  0xC0, 0x03, 0xC3, 0xC0, 0x01, 0xE3, 0x80, 0x00, 0xF7, 0x80, 0x00, 0x7F, 
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x7F, 0xFF, 
+  0xF9, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xF0, 
+  0x00, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 
+  0x3C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 
+  0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 
+  0x38, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 
+  0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xE0, 
+  0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 
+  0x80, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x03, 0xB8, 0x00, 0x03, 
+  0x8E, 0x00, 0x01, 0xC7, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0xE0, 0xE0, 0x00, 
+  0x70, 0x70, 0x00, 0x70, 0x3C, 0x00, 0x38, 0x0E, 0x00, 0x1C, 0x07, 0x00, 
+  0x1C, 0x03, 0xC0, 0x0E, 0x00, 0xE0, 0x0F, 0x00, 0x78, 0x07, 0xFF, 0xFC, 
+  0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x81, 0xC0, 0x01, 0xC1, 0xE0, 0x00, 
+  0xE0, 0xE0, 0x00, 0x78, 0x70, 0x00, 0x1C, 0x78, 0x00, 0x0F, 0x38, 0x00, 
+  0x03, 0x9C, 0x00, 0x01, 0xDC, 0x00, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x1C, 
+  0x00, 0x3F, 0x00, 0x7E, 0x00, 0x38, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0E, 0x00, 0x07, 
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 
+  0x1C, 0x00, 0x0F, 0xFF, 0xE7, 0xFF, 0xF3, 0xFF, 0xF9, 0xC0, 0x00, 0xE0, 
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 
+  0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xF0, 0x00, 0xC0, 0x1C, 0x07, 0xE1, 0xF8, 0x3C, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 
+  0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 
+  0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 
+  0xE0, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0x00, 0x00, 
+  0x78, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 
+  0xC0, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xE0, 0x1F, 0x01, 
+  0xF0, 0x00, 0xF0, 0x7C, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0xF3, 0xC0, 0x00, 
+  0x1E, 0x70, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x01, 0xF8, 0x00, 0x00, 
+  0x3F, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x1D, 0xC0, 
+  0x00, 0x07, 0xB8, 0x00, 0x00, 0xF7, 0x80, 0x00, 0x3C, 0x78, 0x00, 0x07, 
+  0x8F, 0x00, 0x01, 0xE0, 0xF8, 0x00, 0x78, 0x0F, 0x80, 0x3E, 0x00, 0xFF, 
+  0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x06, 0x00, 
+  0x00, 0x38, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0x00, 0x00, 0xE0, 0x00, 0x02, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x1F, 0x80, 0x00, 
+  0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 
+  0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 
+  0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 
+  0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 
+  0x00, 0x07, 0xF0, 0x00, 0x3D, 0xC0, 0x00, 0xE7, 0x80, 0x07, 0x8F, 0x00, 
+  0x3C, 0x3F, 0x03, 0xE0, 0x7F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0x80, 
+  0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 
+  0x00, 0x70, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xF0, 0x00, 0x0F, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1C, 0x3C, 0x00, 0x3C, 
+  0x1E, 0x00, 0x38, 0x0E, 0x00, 0x70, 0x0F, 0x00, 0xF0, 0x07, 0x80, 0xE0, 
+  0x03, 0x81, 0xC0, 0x03, 0xC3, 0xC0, 0x01, 0xE3, 0x80, 0x00, 0xF7, 0x80, 
+  0x00, 0x7F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1C, 0x00, 
+  0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 
+  0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 
+  0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 
+  0x00, 0xE0, 0x70, 0x00, 0x71, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0x00, 
+  0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 
+  0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFC, 0x0F, 0xC0, 0x7E, 0x1F, 0x00, 0x1F, 
+  0x3E, 0x00, 0x0E, 0x3C, 0x00, 0x04, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 
+  0x70, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 
+  0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 
+  0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 
+  0x3C, 0x00, 0x00, 0x3E, 0x00, 0x04, 0x1F, 0x00, 0x0E, 0x0F, 0xC0, 0x3E, 
+  0x07, 0xFF, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xE0, 0x07, 0x03, 0x80, 
+  0x03, 0xCF, 0x00, 0x01, 0xFE, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x70, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x80, 
+  0xFF, 0xFF, 0xC0, 0xE0, 0x03, 0xF0, 0xE0, 0x00, 0xF8, 0xE0, 0x00, 0x78, 
+  0xE0, 0x00, 0x3C, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x1E, 0xE0, 0x00, 0x0E, 
+  0xE0, 0x00, 0x0E, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 
+  0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0x0E, 
+  0xE0, 0x00, 0x0E, 0xE0, 0x00, 0x1E, 0xE0, 0x00, 0x1C, 0xE0, 0x00, 0x3C, 
+  0xE0, 0x00, 0x78, 0xE0, 0x00, 0xF8, 0xE0, 0x03, 0xF0, 0xFF, 0xFF, 0xE0, 
+  0xFF, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x1C, 0x0E, 0x07, 0x9E, 0x01, 0xFE, 
+  0x00, 0x7E, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 
+  0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1F, 0xFF, 
+  0xCF, 0xFF, 0xE7, 0xFF, 0xF3, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 
+  0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 
+  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0x81, 0xC0, 
+  0x03, 0xCF, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x80, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xF0, 
+  0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0xFD, 0xE0, 
+  0x01, 0xF9, 0xE0, 0x03, 0xF1, 0xC0, 0x07, 0xE3, 0xC0, 0x0F, 0xC3, 0xC0, 
+  0x1F, 0x83, 0xC0, 0x3F, 0x03, 0x80, 0x7E, 0x07, 0x80, 0xFC, 0x07, 0x81, 
+  0xF8, 0x07, 0x83, 0xF0, 0x07, 0x07, 0xE0, 0x0F, 0x0F, 0xC0, 0x0F, 0x1F, 
+  0x80, 0x0F, 0x3F, 0x00, 0x0E, 0x7E, 0x00, 0x1E, 0xFC, 0x00, 0x1E, 0xF8, 
+  0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 
+  0x00, 0x38, 0x38, 0x1C, 0x00, 0xF1, 0xE0, 0x01, 0xFC, 0x00, 0x07, 0xC0, 
+  0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 
+  0xFF, 0x07, 0xFF, 0xFC, 0x38, 0x01, 0xF1, 0xC0, 0x03, 0xCE, 0x00, 0x0E, 
+  0x70, 0x00, 0x7B, 0x80, 0x03, 0xDC, 0x00, 0x0E, 0xE0, 0x00, 0x77, 0x00, 
+  0x07, 0xB8, 0x00, 0x39, 0xC0, 0x03, 0xCE, 0x00, 0x3C, 0x7F, 0xFF, 0xC3, 
+  0xFF, 0xFC, 0x1F, 0xFF, 0x80, 0xE0, 0x1E, 0x07, 0x00, 0x70, 0x38, 0x03, 
+  0xC1, 0xC0, 0x0F, 0x0E, 0x00, 0x78, 0x70, 0x01, 0xE3, 0x80, 0x07, 0x1C, 
+  0x00, 0x3C, 0xE0, 0x00, 0xE7, 0x00, 0x07, 0xB8, 0x00, 0x1E, 0x07, 0x03, 
+  0x80, 0x3C, 0xF0, 0x01, 0xFE, 0x00, 0x0F, 0x80, 0x00, 0x70, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x81, 0xFF, 0xFC, 0x1E, 
+  0x03, 0xE3, 0xC0, 0x0F, 0x38, 0x00, 0x67, 0x80, 0x04, 0x78, 0x00, 0x07, 
+  0x80, 0x00, 0x38, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xFF, 0x00, 
+  0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x3E, 0x00, 0x01, 
+  0xF0, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x07, 0x60, 0x00, 0x77, 0x00, 
+  0x07, 0xF8, 0x00, 0xE7, 0xC0, 0x1E, 0x3F, 0xFF, 0xC0, 0xFF, 0xF8, 0x07, 
+  0xFE, 0x00, 0x0E, 0x07, 0x00, 0x79, 0xE0, 0x03, 0xFC, 0x00, 0x1F, 0x80, 
+  0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 
+  0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 
+  0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 
+  0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 
+  0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0xE0, 
+  0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x03, 0xF0, 0x00, 
+  0x1C, 0xE0, 0x00, 0x61, 0x80, 0x01, 0x86, 0x00, 0x06, 0x18, 0x00, 0x1C, 
+  0xE0, 0x00, 0x3F, 0x00, 0xE0, 0x30, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 
+  0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 
+  0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 
+  0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 
+  0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 
+  0x00, 0x3D, 0xC0, 0x00, 0xE7, 0x80, 0x07, 0x8F, 0x00, 0x3C, 0x3F, 0x03, 
+  0xE0, 0x7F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0x80, 0x07, 0x03, 0x80, 
+  0x0F, 0x3C, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x7F, 0xFF, 0xF9, 0xFF, 0xFF, 
+  0xE0, 0x00, 0x07, 0x00, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x00, 
+  0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x38, 0x00, 0x01, 
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0x00, 
+  0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x03, 
+  0xC0, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00, 
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x77, 
+  0x0F, 0x70, 0xFF, 0x0E, 0xE0, 0xEE, 0x0E, 0xE0, 0xCC, 0x0C, 0xC0, 0xCC, 
+  0x1C };
+
+const GFXglyph Lexend_Light40pt7b_sparseGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,  12,  35,  14,    1,  -27 },   // 0x28 '('
+  {    54,  12,  35,  14,    1,  -27 },   // 0x29 ')'
+  {   107,   6,  11,  10,    2,   -3 },   // 0x2C ','
+  {   116,  12,   3,  16,    2,  -12 },   // 0x2D '-'
+  {   121,   5,   5,   9,    2,   -4 },   // 0x2E '.'
+  {   125,  20,  33,  22,    1,  -27 },   // 0x2F '/'
+  {   208,  21,  28,  24,    2,  -27 },   // 0x30 '0'
+  {   282,  13,  28,  18,    3,  -27 },   // 0x31 '1'
+  {   328,  19,  28,  21,    1,  -27 },   // 0x33 '3'
+  {   395,  17,  28,  20,    1,  -27 },   // 0x3F '?'
+  {   455,  25,  28,  27,    1,  -27 },   // 0x41 'A'
+  {   543,  21,  28,  27,    4,  -27 },   // 0x42 'B'
+  {   617,  24,  28,  27,    2,  -27 },   // 0x43 'C'
+  {   701,  24,  28,  30,    4,  -27 },   // 0x44 'D'
+  {   785,  17,  28,  24,    4,  -27 },   // 0x45 'E'
+  {   845,  18,  28,  24,    4,  -27 },   // 0x46 'F'
+  {   908,  27,  28,  31,    2,  -27 },   // 0x47 'G'
+  {  1003,  22,  28,  30,    4,  -27 },   // 0x48 'H'
+  {  1080,  12,  28,  18,    3,  -27 },   // 0x49 'I'
+  {  1122,  21,  28,  25,    2,  -27 },   // 0x4A 'J'
+  {  1196,  23,  28,  28,    4,  -27 },   // 0x4B 'K'
+  {  1277,  17,  28,  23,    4,  -27 },   // 0x4C 'L'
+  {  1337,  26,  28,  34,    4,  -27 },   // 0x4D 'M'
+  {  1428,  23,  28,  31,    4,  -27 },   // 0x4E 'N'
+  {  1509,  27,  28,  31,    2,  -27 },   // 0x4F 'O'
+  {  1604,  19,  28,  25,    4,  -27 },   // 0x50 'P'
+  {  1671,  21,  28,  26,    4,  -27 },   // 0x52 'R'
+  {  1745,  20,  28,  24,    2,  -27 },   // 0x53 'S'
+  {  1815,  20,  28,  22,    1,  -27 },   // 0x54 'T'
+  {  1885,  22,  28,  30,    4,  -27 },   // 0x55 'U'
+  {  1962,  25,  28,  27,    1,  -27 },   // 0x56 'V'
+  {  2050,  24,  28,  26,    1,  -27 },   // 0x59 'Y'
+  {  2134,  22,  28,  26,    2,  -27 },   // 0x5A 'Z'
+  {  2211,  25,  36,  27,    1,  -35 },   // 0xC1
+  {  2324,  17,  36,  24,    4,  -35 },   // 0xC9
+  {  2401,  12,  36,  18,    3,  -35 },   // 0xCD
+  {  2455,  27,  36,  31,    2,  -35 },   // 0xD3
+  {  2577,  22,  36,  30,    4,  -35 },   // 0xDA
+  {  2676,  24,  36,  26,    1,  -35 },   // 0xDD
+  {  2784,  24,  35,  27,    2,  -34 },   // 0x10C
+  {  2889,  24,  35,  30,    4,  -34 },   // 0x10E
+  {  2994,  17,  35,  24,    4,  -34 },   // 0x11A
+  {  3069,  23,  35,  31,    4,  -34 },   // 0x147
+  {  3170,  21,  35,  26,    4,  -34 },   // 0x158
+  {  3262,  20,  35,  24,    2,  -34 },   // 0x160
+  {  3350,  20,  35,  22,    1,  -34 },   // 0x164
+  {  3438,  22,  36,  30,    4,  -35 },   // 0x16E
+  {  3537,  22,  35,  26,    2,  -34 },   // 0x17D
+  {  3634,  12,  10,  16,    2,  -27 },   // 0x201C
+  {  3634,  12,  10,  16,    2,  -27 }   // 0x201D
+};
+
+const uint16_t Lexend_Light40pt7b_sparseCodepoints[] PROGMEM = {
+  0x020, 0x028, 0x029, 0x02C, 0x02D, 0x02E, 0x02F, 0x030, 0x031, 0x033, 0x03F, 0x041,
+  0x042, 0x043, 0x044, 0x045, 0x046, 0x047, 0x048, 0x049, 0x04A, 0x04B, 0x04C, 0x04D,
+  0x04E, 0x04F, 0x050, 0x052, 0x053, 0x054, 0x055, 0x056, 0x059, 0x05A, 0x0C1, 0x0C9,
+  0x0CD, 0x0D3, 0x0DA, 0x0DD, 0x10C, 0x10E, 0x11A, 0x147, 0x158, 0x160, 0x164, 0x16E,
+  0x17D, 0x201C, 0x201D };
+
+const SparseGFXfont Lexend_Light40pt7b_sparse PROGMEM = {
+  { (uint8_t  *)Lexend_Light40pt7b_sparseBitmaps,
+    (GFXglyph *)Lexend_Light40pt7b_sparseGlyphs,
+    SPARSE_FONT_FIRST, 50, 50 },
+  Lexend_Light40pt7b_sparseCodepoints };
+
+// Approx. 4179 bytes
+
+#endif // LEXEND_LIGHT40PT7B_SPARSE_H
@@ -0,0 +1,130 @@
+#ifndef PACK_BITS_H
+#define PACK_BITS_H
+
+#include <Arduino.h>
+
+/**
+ * PackBits byte run-length coding (the TIFF/MacPaint scheme), used for 1bpp
+ * screen bitmaps, which are mostly long runs of 0xFF (white).
+ *
+ * The stream is a sequence of packets, each starting with a control byte n:
+ *   0..127   n + 1 literal bytes follow
+ *   129..255 the next byte is repeated 257 - n times (2..128)
+ *   128      no-op
+ */
+
+/**
+ * Encode len bytes of src into out.
+ *
+ * @return Encoded size, or 0 if it does not fit into outSize bytes
+ */
+inline uint32_t packBitsEncode(const uint8_t *src, uint32_t len, uint8_t *out, uint32_t outSize)
+{
+  uint32_t o = 0;
+  uint32_t i = 0;
+  while (i < len)
+  {
+    // Repeat packet for 2 or more equal bytes
+    uint32_t run = 1;
+    while (i + run < len && run < 128 && src[i + run] == src[i])
+      run++;
+    if (run >= 2)
+    {
+      if (o + 2 > outSize)
+        return 0;
+      out[o++] = 257 - run;
+      out[o++] = src[i];
+      i += run;
+      continue;
+    }
+
+    // Literal packet up to the next run of 3 (a shorter run is cheaper kept literal)
+    uint32_t start = i++;
+    while (i < len && i - start < 128 && !(i + 2 < len && src[i] == src[i + 1] && src[i] == src[i + 2]))
+      i++;
+    uint32_t n = i - start;
+    if (o + 1 + n > outSize)
+      return 0;
+    out[o++] = n - 1;
+    memcpy(out + o, src + start, n);
+    o += n;
+  }
+  return o;
+}
+
+/**
+ * Sequential decoder for a PackBits stream in RAM or PROGMEM. The caller
+ * knows the decoded size; the reader does not check for the end.
+ */
+class PackBitsReader
+{
+public:
+  PackBitsReader(const uint8_t *data) : _data(data), _count(0), _literal(false), _value(0) {}
+
+  // Decode the next n bytes into dst
+  void read(uint8_t *dst, uint32_t n)
+  {
+    while (n > 0)
+    {
+      if (_count == 0)
+        _nextPacket();
+      uint32_t k = (n < _count) ? n : _count;
+      if (_literal)
+      {
+        memcpy_P(dst, _data, k);
+        _data += k;
+      }
+      else
+      {
+        memset(dst, _value, k);
+      }
+      dst += k;
+      n -= k;
+      _count -= k;
+    }
+  }
+
+  // Skip the next n decoded bytes
+  void skip(uint32_t n)
+  {
+    while (n > 0)
+    {
+      if (_count == 0)
+        _nextPacket();
+      uint32_t k = (n < _count) ? n : _count;
+      if (_literal)
+        _data += k;
+      n -= k;
+      _count -= k;
+    }
+  }
+
+private:
+  const uint8_t *_data;
+  uint8_t _count; // Bytes left in the current packet
+  bool _literal;
+  uint8_t _value;
+
+  void _nextPacket()
+  {
+    uint8_t c;
+    do
+    {
+      c = pgm_read_byte(_data++);
+    } while (c == 128);
+
+    if (c < 128)
+    {
+      _literal = true;
+      _count = c + 1;
+    }
+    else
+    {
+      _literal = false;
+      _count = 257 - c;
+      _value = pgm_read_byte(_data++);
+    }
+  }
+};
+
+#endif // PACK_BITS_H
@@ -0,0 +1,41 @@
+#include "PackedImage.h"
+#include "PackBits.h"
+
+// Widest image row in bytes (a full 800 px line)
+#define PACKED_IMAGE_MAX_STRIDE 100
+
+void drawPackedImage(PagedCanvas &canvas, const PackedImage &image, int16_t x, int16_t y)
+{
+  int16_t cx = x, cy = y, cw = image.w, ch = image.h;
+  if (!canvas.clipToPage(cx, cy, cw, ch))
+    return;
+
+  PackBitsReader reader(image.data);
+  uint16_t stride = (image.w + 7) / 8;
+  if (stride > PACKED_IMAGE_MAX_STRIDE)
+    return;
+  uint8_t row[PACKED_IMAGE_MAX_STRIDE];
+
+  if (canvas.getRotation() != 0 || (x & 7) != 0)
+  {
+    // Slow path: every black pixel through the rotation and clipping of drawPixel()
+    for (int16_t r = 0; r < int16_t(image.h); r++)
+    {
+      reader.read(row, stride);
+      for (int16_t c = 0; c < int16_t(image.w); c++)
+      {
+        if (!(row[c / 8] & (0x80 >> (c & 7))))
+          canvas.drawPixel(x + c, y + r, GxEPD_BLACK);
+      }
+    }
+    return;
+  }
+
+  // Only the rows of the band are decoded into place, the rest are skipped or never reached
+  reader.skip((uint32_t)(cy - y) * stride);
+  for (int16_t yy = cy; yy < cy + ch; yy++)
+  {
+    reader.read(row, stride);
+    canvas.drawRowBytes(x, yy, row, stride);
+  }
+}
@@ -0,0 +1,28 @@
+#ifndef PACKED_IMAGE_H
+#define PACKED_IMAGE_H
+
+#include <Arduino.h>
+#include "PagedDisplay.h"
+
+/**
+ * 1bpp image stored as a single PackBits stream in PROGMEM (see PackBits.h
+ * and pack_images.py). Decoded rows are (w + 7) / 8 bytes, MSB first, bit
+ * set = white (the page buffer's layout); padding bits are white.
+ */
+struct PackedImage
+{
+  uint16_t w, h;
+  const uint8_t *data;
+  uint32_t size; // Bytes of data, for the stats
+};
+
+/**
+ * Draw an image with its top-left corner at (x, y) into the current page
+ * band. Rows are decoded one at a time and ANDed into the band (black pixels
+ * drawn, white ones leave the buffer alone); rows above the band are skipped
+ * and decoding stops after its last row. Rotated canvases and x not on a
+ * byte boundary go through drawPixel().
+ */
+void drawPackedImage(PagedCanvas &canvas, const PackedImage &image, int16_t x, int16_t y);
+
+#endif // PACKED_IMAGE_H
@@ -0,0 +1,710 @@
+#include "PagedDisplay.h"
+#include "GhostingTracker.h"
+#include "SparseFont.h"
+
+PagedCanvas::PagedCanvas(int16_t w, int16_t h, uint8_t *buffer, uint16_t pageHeight)
+    : Adafruit_GFX(w, h), _buffer(buffer), _using_partial_mode(false), _current_page(0),
+      _page_height(pageHeight), _glyph_cache(nullptr), _ghosting(nullptr), _shadow(nullptr), _shadow_valid(false),
+      _shadow_bytes_avoided(0), _shadow_refreshes_skipped(0), _transfer_us(0), _refresh_us(0),
+      _first_refresh_us(0), _timings_start(0)
+{
+  _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+  setFullWindow();
+}
+
+void PagedCanvas::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+    return;
+
+  // Rotate to native panel orientation
+  switch (getRotation())
+  {
+  case 1:
+    _swap_(x, y);
+    x = WIDTH - x - 1;
+    break;
+  case 2:
+    x = WIDTH - x - 1;
+    y = HEIGHT - y - 1;
+    break;
+  case 3:
+    _swap_(x, y);
+    y = HEIGHT - y - 1;
+    break;
+  }
+
+  // Transpose partial window to 0,0 and clip
+  x -= _pw_x;
+  y -= _pw_y;
+  if ((x < 0) || (x >= int16_t(_pw_w)) || (y < 0) || (y >= int16_t(_pw_h)))
+    return;
+
+  // Adjust for current page
+  y -= _current_page * _page_height;
+  if ((y < 0) || (y >= int16_t(_page_height)))
+    return;
+
+  uint16_t i = x / 8 + y * (_pw_w / 8);
+  if (color == GxEPD_BLACK)
+    _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+  else
+    _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
+}
+
+uint16_t PagedCanvas::pageRows() const
+{
+  int16_t rows = int16_t(_pw_h) - _current_page * int16_t(_page_height);
+  if (rows <= 0)
+    return 0;
+  return (rows < int16_t(_page_height)) ? rows : _page_height;
+}
+
+void PagedCanvas::fillScreen(uint16_t color)
+{
+  // Only the window's bytes of the band's rows are in use, no need to clear the whole buffer
+  memset(_buffer, (color == GxEPD_BLACK) ? 0x00 : 0xFF, (uint32_t)(_pw_w / 8) * pageRows());
+}
+
+void PagedCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  fillRect(x, y, w, 1, color);
+}
+
+void PagedCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  fillRect(x, y, 1, h, color);
+}
+
+void PagedCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (!clipToPage(x, y, w, h))
+    return;
+
+  // Whatever the rotation, the rectangle is one span per native row
+  _toNative(x, y, w, h);
+  for (int16_t yy = y; yy < y + h; yy++)
+    _fillSpan(bandRow(yy), x - _pw_x, x + w - _pw_x, color == GxEPD_BLACK);
+}
+
+// Corner profile of Adafruit_GFX::fillCircleHelper(): for rows d = 0..r above the corner centre,
+// the farthest column (from the centre) that is filled
+static void fillCornerProfile(int16_t r, int16_t *reach)
+{
+  // Half-height of the vertical line fillCircleHelper() draws at each column
+  int16_t lineReach[PAGED_MAX_RADIUS + 1];
+  for (int16_t c = 0; c <= r; c++)
+    lineReach[c] = -1;
+  lineReach[0] = r;
+
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+  while (x < y)
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < y + 1 && y > lineReach[x])
+      lineReach[x] = y;
+    if (y != py)
+    {
+      if (px > lineReach[py])
+        lineReach[py] = px;
+      py = y;
+    }
+    px = x;
+  }
+
+  // Lines get shorter away from the centre, so each row reaches the last line still tall enough
+  int16_t c = r;
+  for (int16_t d = 0; d <= r; d++)
+  {
+    while (c > 0 && lineReach[c] < d)
+      c--;
+    reach[d] = c;
+  }
+}
+
+// Corner arc of Adafruit_GFX::drawCircleHelper(): for rows d = 0..r above the corner centre,
+// the nearest and farthest column of the arc (near > far if the row has no arc pixel)
+static void arcCornerProfile(int16_t r, int16_t *nearest, int16_t *farthest)
+{
+  for (int16_t d = 0; d <= r; d++)
+  {
+    nearest[d] = r + 1;
+    farthest[d] = -1;
+  }
+
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  while (x < y)
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    // The octant's two mirror pixels: column x on row y, column y on row x
+    nearest[y] = min(nearest[y], x);
+    farthest[y] = max(farthest[y], x);
+    nearest[x] = min(nearest[x], y);
+    farthest[x] = max(farthest[x], y);
+  }
+}
+
+void PagedCanvas::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+  int16_t maxRadius = ((w < h) ? w : h) / 2;
+  if (r > maxRadius)
+    r = maxRadius;
+  // Square corners (or an empty rectangle) and large radii: nothing to gain from a profile
+  if (r <= 0 || r > PAGED_MAX_RADIUS)
+  {
+    Adafruit_GFX::fillRoundRect(x, y, w, h, r, color);
+    return;
+  }
+
+  // Native rows to draw: the part of the shape in this band and window
+  int16_t cx = x, cy = y, cw = w, ch = h;
+  if (!clipToPage(cx, cy, cw, ch))
+    return;
+  _toNative(cx, cy, cw, ch);
+  _toNative(x, y, w, h);
+
+  // The shape is symmetric, so the profile is the same in every orientation
+  int16_t reach[PAGED_MAX_RADIUS + 1];
+  fillCornerProfile(r, reach);
+
+  int16_t left = x + r;          // Centre column of the left corners
+  int16_t right = x + w - r - 1; // and of the right ones
+  for (int16_t yy = cy; yy < cy + ch; yy++)
+  {
+    int16_t d = (yy < y + r) ? y + r - yy : (yy >= y + h - r) ? yy - (y + h - r - 1) : 0;
+    _fillNativeSpan(bandRow(yy), left - reach[d], right + reach[d] + 1, color == GxEPD_BLACK);
+  }
+}
+
+void PagedCanvas::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+  int16_t maxRadius = ((w < h) ? w : h) / 2;
+  if (r > maxRadius)
+    r = maxRadius;
+  // Square corners (or an empty rectangle) and large radii: nothing to gain from a profile
+  if (r <= 0 || r > PAGED_MAX_RADIUS)
+  {
+    Adafruit_GFX::drawRoundRect(x, y, w, h, r, color);
+    return;
+  }
+
+  int16_t cx = x, cy = y, cw = w, ch = h;
+  if (!clipToPage(cx, cy, cw, ch))
+    return;
+  _toNative(cx, cy, cw, ch);
+  _toNative(x, y, w, h);
+
+  int16_t nearest[PAGED_MAX_RADIUS + 1], farthest[PAGED_MAX_RADIUS + 1];
+  arcCornerProfile(r, nearest, farthest);
+
+  bool black = color == GxEPD_BLACK;
+  int16_t left = x + r;          // Centre column of the left corners
+  int16_t right = x + w - r - 1; // and of the right ones
+  int16_t top = y + r;           // Centre row of the top corners
+  int16_t bottom = y + h - r - 1; // and of the bottom ones
+  for (int16_t yy = cy; yy < cy + ch; yy++)
+  {
+    uint8_t *row = bandRow(yy);
+
+    // Arcs; small corners reach the centre row, and with h = 2r that is the other corners' first row
+    for (int16_t d : {int16_t(top - yy), int16_t(yy - bottom)})
+    {
+      if (d < 0 || d > r || nearest[d] > farthest[d])
+        continue;
+      _fillNativeSpan(row, left - farthest[d], left - nearest[d] + 1, black);
+      _fillNativeSpan(row, right + nearest[d], right + farthest[d] + 1, black);
+    }
+
+    // Straight edges between the corner centres
+    if ((yy == y || yy == y + h - 1) && right >= left)
+      _fillNativeSpan(row, left, right + 1, black);
+    if (yy >= top && yy <= bottom)
+    {
+      _fillNativeSpan(row, x, x + 1, black);
+      _fillNativeSpan(row, x + w - 1, x + w, black);
+    }
+  }
+}
+
+void PagedCanvas::_fillNativeSpan(uint8_t *row, int16_t x0, int16_t x1, bool black)
+{
+  if (x0 < int16_t(_pw_x))
+    x0 = _pw_x;
+  if (x1 > int16_t(_pw_x + _pw_w))
+    x1 = _pw_x + _pw_w;
+  if (row && x0 < x1)
+    _fillSpan(row, x0 - _pw_x, x1 - _pw_x, black);
+}
+
+void PagedCanvas::_toNative(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const
+{
+  int16_t nx = x, ny = y, nw = w, nh = h;
+  switch (getRotation())
+  {
+  case 1:
+    nx = WIDTH - y - h;
+    ny = x;
+    nw = h;
+    nh = w;
+    break;
+  case 2:
+    nx = WIDTH - x - w;
+    ny = HEIGHT - y - h;
+    break;
+  case 3:
+    nx = y;
+    ny = HEIGHT - x - w;
+    nw = h;
+    nh = w;
+    break;
+  }
+  x = nx;
+  y = ny;
+  w = nw;
+  h = nh;
+}
+
+bool PagedCanvas::clipToPage(int16_t &x, int16_t &y, int16_t &w, int16_t &h)
+{
+  if (w <= 0 || h <= 0)
+    return false;
+
+  // Rotate to native panel orientation
+  int16_t nx = x, ny = y, nw = w, nh = h;
+  _toNative(nx, ny, nw, nh);
+
+  // Intersect with the window columns and the current page rows
+  int16_t x0 = max(nx, int16_t(_pw_x));
+  int16_t x1 = min(int16_t(nx + nw), int16_t(_pw_x + _pw_w));
+  int16_t bandTop = _pw_y + _current_page * _page_height;
+  int16_t y0 = max(ny, bandTop);
+  int16_t y1 = min(int16_t(ny + nh), min(int16_t(bandTop + _page_height), int16_t(_pw_y + _pw_h)));
+  if (x0 >= x1 || y0 >= y1)
+    return false;
+
+  // Back to rotated coordinates
+  nx = x0;
+  ny = y0;
+  nw = x1 - x0;
+  nh = y1 - y0;
+  switch (getRotation())
+  {
+  case 0:
+    x = nx;
+    y = ny;
+    w = nw;
+    h = nh;
+    break;
+  case 1:
+    x = ny;
+    y = WIDTH - nx - nw;
+    w = nh;
+    h = nw;
+    break;
+  case 2:
+    x = WIDTH - nx - nw;
+    y = HEIGHT - ny - nh;
+    w = nw;
+    h = nh;
+    break;
+  case 3:
+    x = HEIGHT - ny - nh;
+    y = nx;
+    w = nh;
+    h = nw;
+    break;
+  }
+  return true;
+}
+
+void PagedCanvas::setFullWindow()
+{
+  _using_partial_mode = false;
+  _pw_x = 0;
+  _pw_y = 0;
+  _pw_w = WIDTH;
+  _pw_h = HEIGHT;
+}
+
+void PagedCanvas::setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+  _rotate(x, y, w, h);
+  _using_partial_mode = true;
+  _pw_x = gx_uint16_min(x, WIDTH);
+  _pw_y = gx_uint16_min(y, HEIGHT);
+  _pw_w = gx_uint16_min(w, WIDTH - _pw_x);
+  _pw_h = gx_uint16_min(h, HEIGHT - _pw_y);
+
+  // Make _pw_x, _pw_w multiple of 8 (controller RAM is byte addressed in x)
+  _pw_w += _pw_x % 8;
+  if (_pw_w % 8 > 0)
+    _pw_w += 8 - _pw_w % 8;
+  _pw_x -= _pw_x % 8;
+}
+
+void PagedCanvas::_rotate(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h)
+{
+  switch (getRotation())
+  {
+  case 1:
+    _swap_(x, y);
+    _swap_(w, h);
+    x = WIDTH - x - w;
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    _swap_(x, y);
+    _swap_(w, h);
+    y = HEIGHT - y - h;
+    break;
+  }
+}
+
+// Unaligned 32-bit load for the word-at-a-time row compare
+static inline uint32_t load32(const uint8_t *p)
+{
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+bool PagedCanvas::_shadowDiff(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h)
+{
+  if (!_shadow || !_shadow_valid || _pages != 1)
+    return true;
+
+  uint16_t stride = _pw_w / 8;
+  uint16_t shadowStride = WIDTH / 8;
+  int16_t firstRow = -1, lastRow = -1;
+  uint16_t firstByte = stride, lastByte = 0;
+
+  for (uint16_t r = 0; r < _pw_h; r++)
+  {
+    const uint8_t *a = _buffer + (uint32_t)r * stride;
+    const uint8_t *b = _shadow + (uint32_t)(_pw_y + r) * shadowStride + _pw_x / 8;
+
+    // Leftmost differing byte: skip equal words, then bytes
+    uint16_t i = 0;
+    while (i + 4 <= stride && load32(a + i) == load32(b + i))
+      i += 4;
+    while (i < stride && a[i] == b[i])
+      i++;
+    if (i == stride)
+      continue;
+
+    // One past the rightmost differing byte, scanning back from the end
+    uint16_t j = stride;
+    while (j >= i + 4 && load32(a + j - 4) == load32(b + j - 4))
+      j -= 4;
+    while (j > i && a[j - 1] == b[j - 1])
+      j--;
+
+    if (firstRow < 0)
+      firstRow = r;
+    lastRow = r;
+    if (i < firstByte)
+      firstByte = i;
+    if (j > lastByte)
+      lastByte = j;
+  }
+
+  if (firstRow < 0)
+    return false;
+
+  x = _pw_x + firstByte * 8;
+  y = _pw_y + firstRow;
+  w = (lastByte - firstByte) * 8;
+  h = lastRow - firstRow + 1;
+  return true;
+}
+
+void PagedCanvas::_shadowStore(uint16_t y, uint16_t rows)
+{
+  if (!_shadow)
+    return;
+
+  // Rows of the current band start at the window top plus the page offset
+  uint16_t stride = _pw_w / 8;
+  const uint8_t *src = _buffer + (uint32_t)(y - _pw_y - _current_page * _page_height) * stride;
+  uint8_t *dst = _shadow + (uint32_t)y * (WIDTH / 8) + _pw_x / 8;
+  for (uint16_t r = 0; r < rows; r++)
+  {
+    memcpy(dst, src, stride);
+    src += stride;
+    dst += WIDTH / 8;
+  }
+}
+
+void PagedCanvas::_trackRows(uint16_t y, uint16_t rows)
+{
+  if (!_ghosting)
+    return;
+
+  uint16_t stride = _pw_w / 8;
+  const uint8_t *src = _buffer + (uint32_t)(y - _pw_y - _current_page * _page_height) * stride;
+  if (!_using_partial_mode)
+  {
+    _ghosting->recordFull(src, stride, y, rows);
+    return;
+  }
+
+  // The shadow still holds the outgoing frame, so flips can be counted exactly
+  const uint8_t *previous = (_shadow && _shadow_valid) ? _shadow + (uint32_t)y * (WIDTH / 8) + _pw_x / 8 : nullptr;
+  _ghosting->recordPartial(src, stride, _pw_x, y, _pw_w, rows, previous, WIDTH / 8);
+}
+
+uint8_t *PagedCanvas::bandRow(int16_t y)
+{
+  y -= _pw_y;
+  if ((y < 0) || (y >= int16_t(_pw_h)))
+    return nullptr;
+
+  y -= _current_page * _page_height;
+  if ((y < 0) || (y >= int16_t(_page_height)))
+    return nullptr;
+
+  return _buffer + (uint32_t)y * (_pw_w / 8);
+}
+
+void PagedCanvas::drawRowBytes(int16_t x, int16_t y, const uint8_t *bytes, uint16_t count)
+{
+  uint8_t *row = bandRow(y);
+  if (!row)
+    return;
+
+  // Clip the byte span against the window
+  int16_t first = (x - int16_t(_pw_x)) / 8;
+  int16_t begin = (first < 0) ? -first : 0;
+  int16_t end = count;
+  if (first + end > int16_t(_pw_w / 8))
+    end = int16_t(_pw_w / 8) - first;
+
+  for (int16_t i = begin; i < end; i++)
+    row[first + i] &= bytes[i];
+}
+
+void PagedCanvas::drawPackedBits(int16_t x, int16_t y, const uint8_t *bits, uint32_t bitOffset,
+                                 uint8_t w, uint8_t h, uint16_t color)
+{
+  _drawBits(x, y, bits, bitOffset, w, w, h, color);
+}
+
+void PagedCanvas::drawBitmapRows(int16_t x, int16_t y, const uint8_t *rows, uint8_t stride,
+                                 uint8_t w, uint8_t h, uint16_t color)
+{
+  _drawBits(x, y, rows, 0, (uint16_t)stride * 8, w, h, color);
+}
+
+void PagedCanvas::_drawBits(int16_t x, int16_t y, const uint8_t *bits, uint32_t bitOffset, uint16_t rowBits,
+                            uint8_t w, uint8_t h, uint16_t color)
+{
+  if (getRotation() != 0)
+  {
+    // Rotated output: let drawPixel() transform each set bit
+    for (uint8_t yy = 0; yy < h; yy++)
+    {
+      uint32_t bit = bitOffset + (uint32_t)yy * rowBits;
+      for (uint8_t xx = 0; xx < w; xx++, bit++)
+      {
+        if (pgm_read_byte(&bits[bit >> 3]) & (0x80 >> (bit & 7)))
+          drawPixel(x + xx, y + yy, color);
+      }
+    }
+    return;
+  }
+
+  // Clip columns against the window once, rows against the band per row
+  int16_t wx = x - _pw_x;
+  int16_t c0 = (wx < 0) ? -wx : 0;
+  int16_t c1 = (wx + w > int16_t(_pw_w)) ? int16_t(_pw_w) - wx : w;
+  if (c0 >= c1)
+    return;
+
+  bool black = (color == GxEPD_BLACK);
+
+  for (uint8_t yy = 0; yy < h; yy++)
+  {
+    uint8_t *row = bandRow(y + yy);
+    if (!row)
+      continue;
+
+    uint32_t src = bitOffset + (uint32_t)yy * rowBits + c0;
+    int16_t dst = wx + c0;
+    int16_t n = c1 - c0;
+
+    while (n > 0)
+    {
+      uint8_t k = (n < 8) ? n : 8;
+
+      // Fetch the next k source bits, MSB aligned; avoid reading past the last glyph byte
+      uint8_t sh = src & 7;
+      uint8_t v = pgm_read_byte(&bits[src >> 3]) << sh;
+      if (sh + k > 8)
+        v |= pgm_read_byte(&bits[(src >> 3) + 1]) >> (8 - sh);
+      v &= (uint8_t)(0xFF << (8 - k));
+
+      if (v)
+      {
+        // Spread across at most two destination bytes
+        uint16_t m = (uint16_t)v << (8 - (dst & 7));
+        uint8_t hi = m >> 8;
+        uint8_t lo = m & 0xFF;
+        uint8_t *p = row + (dst >> 3);
+        if (black)
+        {
+          p[0] &= ~hi;
+          if (lo)
+            p[1] &= ~lo;
+        }
+        else
+        {
+          p[0] |= hi;
+          if (lo)
+            p[1] |= lo;
+        }
+      }
+
+      src += k;
+      dst += k;
+      n -= k;
+    }
+  }
+}
+
+void PagedCanvas::drawRleBits(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, uint16_t color)
+{
+  RleGlyphReader rle(data);
+  uint16_t total = (uint16_t)w * h;
+  uint16_t pos = 0;
+  uint16_t col = 0;
+  uint16_t row = 0;
+
+  if (getRotation() != 0)
+  {
+    // Rotated output: let drawPixel() transform each set pixel
+    while (pos < total)
+    {
+      uint16_t run = rle.nextRun();
+      pos += run;
+      col += run % w;
+      row += run / w;
+      if (col >= w)
+      {
+        col -= w;
+        row++;
+      }
+      if (pos >= total)
+        break;
+
+      run = rle.nextRun();
+      pos += run;
+      while (run--)
+      {
+        drawPixel(x + col, y + row, color);
+        if (++col == w)
+        {
+          col = 0;
+          row++;
+        }
+      }
+    }
+    return;
+  }
+
+  // Clip columns against the window once; stop after the last band row
+  int16_t wx = x - _pw_x;
+  int16_t c0 = (wx < 0) ? -wx : 0;
+  int16_t c1 = (wx + w > int16_t(_pw_w)) ? int16_t(_pw_w) - wx : w;
+  if (c0 >= c1)
+    return;
+  int16_t bandEnd = min(int16_t(_pw_y + _pw_h), int16_t(_pw_y + (_current_page + 1) * _page_height));
+
+  bool black = (color == GxEPD_BLACK);
+
+  while (pos < total)
+  {
+    uint16_t run = rle.nextRun();
+    pos += run;
+    col += run % w;
+    row += run / w;
+    if (col >= w)
+    {
+      col -= w;
+      row++;
+    }
+    if (pos >= total || y + row >= bandEnd)
+      break;
+
+    // Fill the set run row by row
+    run = rle.nextRun();
+    pos += run;
+    while (run > 0)
+    {
+      uint16_t n = min(run, uint16_t(w - col));
+      uint8_t *dst = bandRow(y + row);
+      if (dst)
+      {
+        int16_t s0 = max(int16_t(col), c0);
+        int16_t s1 = min(int16_t(col + n), c1);
+        if (s0 < s1)
+          _fillSpan(dst, wx + s0, wx + s1, black);
+      }
+      run -= n;
+      col += n;
+      if (col == w)
+      {
+        col = 0;
+        row++;
+      }
+    }
+  }
+}
+
+void PagedCanvas::_fillSpan(uint8_t *row, int16_t x0, int16_t x1, bool black)
+{
+  uint8_t *p = row + (x0 >> 3);
+  uint8_t *last = row + ((x1 - 1) >> 3);
+  uint8_t headMask = 0xFF >> (x0 & 7);
+  uint8_t tailMask = 0xFF << (7 - ((x1 - 1) & 7));
+
+  if (p == last)
+    headMask &= tailMask;
+
+  if (black)
+    *p &= ~headMask;
+  else
+    *p |= headMask;
+  if (p == last)
+    return;
+
+  p++;
+  if (last > p)
+  {
+    memset(p, black ? 0x00 : 0xFF, last - p);
+  }
+
+  if (black)
+    *last &= ~tailMask;
+  else
+    *last |= tailMask;
+}
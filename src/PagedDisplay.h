@@ -0,0 +1,450 @@
+#ifndef PAGED_DISPLAY_H
+#define PAGED_DISPLAY_H
+
+#include <Adafruit_GFX.h>
+#include <GxEPD2_BW.h>
+
+class GlyphCache;
+class GhostingTracker;
+
+// Largest corner radius PagedCanvas rasterizes as spans (profile tables live on the stack)
+#define PAGED_MAX_RADIUS 64
+
+/**
+ * Paged 1bpp frame buffer with the same drawing/paging model as GxEPD2_BW.
+ *
+ * GxEPD2_BW keeps its page buffer private, so every pixel has to go through
+ * the virtual drawPixel(). PagedCanvas holds the buffer and window/page state
+ * in a non-template base and exposes the current page band in native panel
+ * orientation, so helpers such as the glyph blitter in Utf8GfxHelper.h can
+ * write whole bytes instead of single pixels.
+ *
+ * Buffer layout matches GxEPD2: 1 bit per pixel, MSB first, bit set = white,
+ * row stride = partial window width / 8.
+ */
+class PagedCanvas : public Adafruit_GFX
+{
+public:
+  PagedCanvas(int16_t w, int16_t h, uint8_t *buffer, uint16_t pageHeight);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+
+  // Lines and rects are clipped to the current page band, then filled one native row span at a time
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+  /**
+   * Same pixels as Adafruit_GFX's rounded rectangles, rasterized row by row
+   * in native orientation: the corner profile is worked out once per call,
+   * then each row is one or two byte spans (memset between masked edge
+   * bytes) instead of lines and single pixels. Radii over PAGED_MAX_RADIUS
+   * go through Adafruit_GFX.
+   */
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+
+  // Full screen or partial window in rotated (user) coordinates, same rules as GxEPD2_BW
+  void setFullWindow();
+  void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+  uint16_t pages() const { return _pages; }
+  uint16_t pageHeight() const { return _page_height; }
+
+  // Page band currently being rendered; selectPage() is for off-screen rendering only
+  int16_t currentPage() const { return _current_page; }
+  void selectPage(int16_t page) { _current_page = page; }
+
+  /**
+   * Clip a rectangle (rotated/user coordinates) to the part that lands in the
+   * current page band and window. Returns false if nothing is left, so callers
+   * can skip whole lines, glyphs or shapes on bands they do not touch.
+   */
+  bool clipToPage(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+
+  // Raw access to the current page band (native orientation)
+  uint8_t *pageBuffer() { return _buffer; }
+  uint32_t pageBufferSize() const { return (uint32_t)(_pw_w / 8) * _page_height; }
+
+  // Rows of the current page band inside the window (fewer than pageHeight() on the last band)
+  uint16_t pageRows() const;
+
+  // Buffer row for native y, or nullptr if the row is outside the current page band
+  uint8_t *bandRow(int16_t y);
+
+  /**
+   * AND count bytes of a 1bpp row (bit clear = black) into native row y at
+   * byte-aligned native x, clipped to the window and page band: black bits
+   * are drawn, white bits leave the buffer as it is.
+   */
+  void drawRowBytes(int16_t x, int16_t y, const uint8_t *bytes, uint16_t count);
+
+  /**
+   * Blit a bit-packed (Adafruit GFX glyph layout) bitmap with its top-left
+   * corner at (x, y). Rows are written 8 source bits at a time with OR/AND
+   * masks; falls back to drawPixel() for rotated output.
+   *
+   * @param bits Bitmap base pointer (PROGMEM)
+   * @param bitOffset Bit index of the first pixel within bits
+   */
+  void drawPackedBits(int16_t x, int16_t y, const uint8_t *bits, uint32_t bitOffset,
+                      uint8_t w, uint8_t h, uint16_t color);
+
+  /**
+   * Same as drawPackedBits() for a run-length encoded bitmap (see
+   * RleGlyphReader in SparseFont.h). Runs are decoded on the fly and set
+   * runs are filled as byte spans; decoding stops below the page band.
+   *
+   * @param data First byte of the encoded runs (PROGMEM)
+   */
+  void drawRleBits(int16_t x, int16_t y, const uint8_t *data, uint8_t w, uint8_t h, uint16_t color);
+
+  /**
+   * Same as drawPackedBits() for a RAM bitmap whose rows start on byte
+   * boundaries (stride bytes per row), e.g. a GlyphCache entry.
+   */
+  void drawBitmapRows(int16_t x, int16_t y, const uint8_t *rows, uint8_t stride,
+                      uint8_t w, uint8_t h, uint16_t color);
+
+  // Optional glyph cache used by the text helpers in Utf8GfxHelper.h (nullptr = read fonts from flash)
+  void setGlyphCache(GlyphCache *cache) { _glyph_cache = cache; }
+  GlyphCache *glyphCache() const { return _glyph_cache; }
+
+  // Optional tracker fed with every frame sent to the panel (nullptr = none)
+  void setGhostingTracker(GhostingTracker *tracker) { _ghosting = tracker; }
+  GhostingTracker *ghostingTracker() const { return _ghosting; }
+
+  /**
+   * Shadow framebuffer (-DSHADOW_FRAMEBUFFER): a copy of the frame last sent
+   * to the panel. Single-page partial updates are XOR-diffed against it and
+   * only the changed rows/columns are written and refreshed; unchanged
+   * frames skip the refresh. Full refreshes always go out in full.
+   */
+  bool hasShadow() const { return _shadow != nullptr; }
+  void invalidateShadow() { _shadow_valid = false; }
+  uint32_t shadowBytesAvoided() const { return _shadow_bytes_avoided; }
+  uint32_t shadowRefreshesSkipped() const { return _shadow_refreshes_skipped; }
+
+  // Time the CPU spent sending frame data and in panel refreshes since resetTimings()
+  uint32_t transferMicros() const { return _transfer_us; }
+  uint32_t refreshMicros() const { return _refresh_us; }
+
+  // Time from resetTimings() until the first refresh started, i.e. until pixels begin to change
+  uint32_t firstRefreshMicros() const { return _first_refresh_us; }
+
+  void resetTimings()
+  {
+    _transfer_us = _refresh_us = _first_refresh_us = 0;
+    _timings_start = micros();
+  }
+
+protected:
+  uint8_t *_buffer;
+  bool _using_partial_mode;
+  int16_t _current_page;
+  uint16_t _pages, _page_height;
+  uint16_t _pw_x, _pw_y, _pw_w, _pw_h;
+  GlyphCache *_glyph_cache;
+  GhostingTracker *_ghosting;
+  uint8_t *_shadow; // Full native frame, WIDTH / 8 bytes per row; nullptr if disabled
+  bool _shadow_valid;
+  uint32_t _shadow_bytes_avoided, _shadow_refreshes_skipped;
+  uint32_t _transfer_us, _refresh_us;
+  uint32_t _first_refresh_us, _timings_start;
+
+  void _rotate(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h);
+
+  // Rectangle in rotated (user) coordinates to native panel orientation, unclipped
+  void _toNative(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+
+  // Fill native pixels [x0, x1) of a buffer row (from bandRow()), clipped to the window columns
+  void _fillNativeSpan(uint8_t *row, int16_t x0, int16_t x1, bool black);
+
+  // Set or clear buffer row bits [x0, x1) (window-relative, x0 < x1)
+  static void _fillSpan(uint8_t *row, int16_t x0, int16_t x1, bool black);
+
+  /**
+   * Diff the window (single page) against the shadow. Narrows x/y/w/h from
+   * the window to the changed rectangle, x and w in whole bytes. Returns
+   * false if nothing changed. Without a valid shadow the window is kept.
+   */
+  bool _shadowDiff(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h);
+
+  // Copy rows of the current page band into the shadow (native y, window columns)
+  void _shadowStore(uint16_t y, uint16_t rows);
+
+  // Hand rows of the current page band to the ghosting tracker; call before _shadowStore()
+  void _trackRows(uint16_t y, uint16_t rows);
+
+  // Shared blitter of drawPackedBits()/drawBitmapRows(): row yy starts at bit bitOffset + yy * rowBits
+  void _drawBits(int16_t x, int16_t y, const uint8_t *bits, uint32_t bitOffset, uint16_t rowBits,
+                 uint8_t w, uint8_t h, uint16_t color);
+};
+
+/**
+ * Drop-in replacement for GxEPD2_BW<GxEPD2_Type, page_height> built on PagedCanvas.
+ * Only the panel API used by this project is provided (init, windows, paging,
+ * powerOff/hibernate); the raw driver stays reachable through epd2.
+ *
+ * With -DEPD_SPI_DMA the driver is an EpdDmaPanel whose writes return while
+ * the band is still being sent; with more than one page, bands are rendered
+ * alternately into two page buffers so the next one is drawn meanwhile.
+ */
+template <typename GxEPD2_Type, const uint16_t page_height>
+class PagedDisplay : public PagedCanvas
+{
+public:
+  GxEPD2_Type epd2;
+
+  PagedDisplay(GxEPD2_Type epd2_instance)
+      : PagedCanvas(GxEPD2_Type::WIDTH_VISIBLE, GxEPD2_Type::HEIGHT, _pageStorage, page_height),
+        epd2(epd2_instance), _second_phase(false)
+  {
+#ifdef SHADOW_FRAMEBUFFER
+    _shadow = _shadowStorage;
+#endif
+  }
+
+  void init(uint32_t serial_diag_bitrate = 0)
+  {
+    init(serial_diag_bitrate, true, 10, false);
+  }
+
+  void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10, bool pulldown_rst_mode = false)
+  {
+    epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+    _shadow_valid = false; // Panel content unknown until the first full refresh
+    _using_partial_mode = false;
+    _current_page = 0;
+    setFullWindow();
+  }
+
+  void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration, bool pulldown_rst_mode,
+            SPIClass &spi, SPISettings spi_settings)
+  {
+    epd2.selectSPI(spi, spi_settings);
+    init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+  }
+
+  void firstPage()
+  {
+    finishTransfer();
+    _current_page = 0;
+    _second_phase = false;
+    fillScreen(GxEPD_WHITE);
+  }
+
+  bool nextPage()
+  {
+    if (_pages == 1)
+    {
+      if (_using_partial_mode)
+      {
+        // Only the part that differs from the panel goes out (the whole window without a shadow)
+        uint16_t x = _pw_x, y = _pw_y, w = _pw_w, h = _pw_h;
+        uint8_t writes = epd2.hasFastPartialUpdate ? 2 : 1;
+        if (!_shadowDiff(x, y, w, h))
+        {
+          _shadow_bytes_avoided += (uint32_t)(_pw_w / 8) * _pw_h * writes;
+          _shadow_refreshes_skipped++;
+          return false;
+        }
+        _shadow_bytes_avoided += ((uint32_t)(_pw_w / 8) * _pw_h - (uint32_t)(w / 8) * h) * writes;
+
+        _trackRows(_pw_y, _pw_h);
+        _timed(_transfer_us, [&] { epd2.writeImagePart(_buffer, x - _pw_x, y - _pw_y, _pw_w, _pw_h, x, y, w, h); });
+        _timedRefresh([&] { epd2.refresh(x, y, w, h); });
+        if (epd2.hasFastPartialUpdate)
+        {
+          _timed(_transfer_us,
+                 [&] { epd2.writeImagePartAgain(_buffer, x - _pw_x, y - _pw_y, _pw_w, _pw_h, x, y, w, h); });
+        }
+        _shadowStore(_pw_y, _pw_h);
+        finishTransfer();
+      }
+      else
+      {
+        _timed(_transfer_us, [&] { epd2.writeImageForFullRefresh(_buffer, 0, 0, WIDTH, HEIGHT); });
+        _timedRefresh([&] { epd2.refresh(false); });
+        if (epd2.hasFastPartialUpdate)
+        {
+          _timed(_transfer_us, [&] { epd2.writeImageAgain(_buffer, 0, 0, WIDTH, HEIGHT); });
+        }
+        epd2.powerOff();
+        _trackRows(0, HEIGHT);
+        _shadowStore(0, HEIGHT);
+        _shadow_valid = true;
+      }
+      return false;
+    }
+
+    uint16_t page_ys = _current_page * _page_height;
+    if (_using_partial_mode)
+    {
+      uint16_t dest_ys = _pw_y + page_ys;
+      uint16_t dest_ye = gx_uint16_min(_pw_y + _pw_h, dest_ys + _page_height);
+      if (dest_ye > dest_ys)
+      {
+        if (!_second_phase)
+        {
+          _timed(_transfer_us, [&] { epd2.writeImage(_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys); });
+          _trackRows(dest_ys, dest_ye - dest_ys);
+          _shadowStore(dest_ys, dest_ye - dest_ys);
+        }
+        else
+          _timed(_transfer_us, [&] { epd2.writeImageAgain(_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys); });
+        _flipBuffer();
+      }
+      _current_page++;
+      if (_current_page == int16_t(_pages) || dest_ye >= _pw_y + _pw_h)
+      {
+        _current_page = 0;
+        finishTransfer();
+        if (!_second_phase)
+        {
+          _timedRefresh([&] { epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h); });
+          if (epd2.hasFastPartialUpdate)
+          {
+            _second_phase = true;
+            fillScreen(GxEPD_WHITE);
+            return true;
+          }
+        }
+        return false;
+      }
+      fillScreen(GxEPD_WHITE);
+      return true;
+    }
+
+    uint16_t rows = gx_uint16_min(_page_height, HEIGHT - page_ys);
+    if (!_second_phase)
+    {
+      _timed(_transfer_us, [&] { epd2.writeImageForFullRefresh(_buffer, 0, page_ys, WIDTH, rows); });
+      _trackRows(page_ys, rows);
+      _shadowStore(page_ys, rows);
+    }
+    else
+      _timed(_transfer_us, [&] { epd2.writeImageAgain(_buffer, 0, page_ys, WIDTH, rows); });
+    _flipBuffer();
+    _current_page++;
+    if (_current_page == int16_t(_pages))
+    {
+      _current_page = 0;
+      finishTransfer();
+      if (!_second_phase)
+      {
+        _shadow_valid = true;
+        _timedRefresh([&] { epd2.refresh(false); });
+        if (epd2.hasFastPartialUpdate)
+        {
+          _second_phase = true;
+          fillScreen(GxEPD_WHITE);
+          return true;
+        }
+      }
+      epd2.powerOff();
+      return false;
+    }
+    fillScreen(GxEPD_WHITE);
+    return true;
+  }
+
+  /**
+   * Full refresh of a frame that is already 1bpp rows, e.g. a decompressed
+   * image: fill(rows, y, h) writes h native rows of WIDTH / 8 bytes (bit set =
+   * white) starting at row y into the page buffer, which goes to the
+   * controller band by band. Nothing is drawn, so the rotation does not
+   * apply. With a second write for fast partial updates, fill is called
+   * again from y = 0.
+   */
+  template <typename Fill>
+  void writeFullFrame(Fill fill)
+  {
+    finishTransfer();
+    setFullWindow();
+    _second_phase = false;
+    for (uint8_t pass = 0; pass < (epd2.hasFastPartialUpdate ? 2 : 1); pass++)
+    {
+      for (_current_page = 0; _current_page < int16_t(_pages); _current_page++)
+      {
+        uint16_t y = _current_page * _page_height;
+        uint16_t rows = gx_uint16_min(_page_height, HEIGHT - y);
+        fill(_buffer, y, rows);
+        if (pass == 0)
+        {
+          _timed(_transfer_us, [&] { epd2.writeImageForFullRefresh(_buffer, 0, y, WIDTH, rows); });
+          _trackRows(y, rows);
+          _shadowStore(y, rows);
+        }
+        else
+          _timed(_transfer_us, [&] { epd2.writeImageAgain(_buffer, 0, y, WIDTH, rows); });
+        _flipBuffer();
+      }
+      finishTransfer();
+      if (pass == 0)
+      {
+        _shadow_valid = true;
+        _timedRefresh([&] { epd2.refresh(false); });
+      }
+    }
+    _current_page = 0;
+    epd2.powerOff();
+  }
+
+  void powerOff() { epd2.powerOff(); }
+  void hibernate() { epd2.hibernate(); }
+
+  /**
+   * Wait for a band still in flight. Paging does this before a page buffer
+   * is reused, before a refresh and when a screen is done; call it before
+   * touching another device on the panel's SPI bus (the SD card) from inside
+   * a page loop.
+   */
+  void finishTransfer()
+  {
+#ifdef EPD_SPI_DMA
+    _timed(_transfer_us, [&] { epd2.finishWrite(); });
+#endif
+  }
+
+private:
+  // Word-aligned so that whole bands go to the SPI DMA without a bounce buffer
+  alignas(4) uint8_t _pageStorage[(GxEPD2_Type::WIDTH / 8) * page_height];
+#ifdef EPD_SPI_DMA
+  // Band being sent while the next one is drawn (unused with a single page)
+  alignas(4) uint8_t _pageStorage2[page_height < GxEPD2_Type::HEIGHT ? (GxEPD2_Type::WIDTH / 8) * page_height : 4];
+#endif
+#ifdef SHADOW_FRAMEBUFFER
+  uint8_t _shadowStorage[(GxEPD2_Type::WIDTH / 8) * GxEPD2_Type::HEIGHT];
+#endif
+  bool _second_phase;
+
+  template <typename Call>
+  void _timed(uint32_t &total, Call call)
+  {
+    unsigned long start = micros();
+    call();
+    total += micros() - start;
+  }
+
+  // Panel refresh; the first since resetTimings() also marks the time to first pixel
+  template <typename Call>
+  void _timedRefresh(Call call)
+  {
+    if (_refresh_us == 0)
+      _first_refresh_us = micros() - _timings_start;
+    _timed(_refresh_us, call);
+  }
+
+  // Draw the next band into the other buffer while this one is sent
+  void _flipBuffer()
+  {
+#ifdef EPD_SPI_DMA
+    if (_pages > 1)
+      _buffer = (_buffer == _pageStorage) ? _pageStorage2 : _pageStorage;
+#endif
+  }
+};
+
+#endif // PAGED_DISPLAY_H
@@ -54,11 +54,11 @@ void PowerManager::enterDeepSleep()
 {
   if (displayManager != nullptr)
   {
-    displayManager->setDisplayCommand(DISPLAY_SLEEP);
+    displayManager->drawAndWait(DISPLAY_SLEEP);
   }
 
   Serial.println("Power button released after a long press. Entering deep sleep.");
-  delay(2000); // Allow Serial buffer to empty and display to update
+  delay(2000); // Allow Serial buffer to empty
 
   // Enable Wakeup on LOW (button press)
   esp_deep_sleep_enable_gpio_wakeup(1ULL << BTN_GPIO3, ESP_GPIO_WAKEUP_GPIO_LOW);
@@ -0,0 +1,209 @@
+#include "Prerenderer.h"
+#include "PackBits.h"
+
+Prerenderer::Prerenderer(int16_t width, int16_t height)
+    : _canvas(width, height, _band, PRERENDER_BAND_BYTES / (width / 8)), _layouter(nullptr), _candidateCount(0),
+      _hits(0), _misses(0), _rendered(0), _wasted(0), _tooLarge(0)
+{
+  for (uint8_t i = 0; i < PRERENDER_SLOTS; i++)
+  {
+    _frames[i].question = -1;
+    _frames[i].ready = false;
+  }
+}
+
+PrerenderedFrame *Prerenderer::_slot(int16_t question)
+{
+  for (uint8_t i = 0; i < PRERENDER_SLOTS; i++)
+  {
+    if (_frames[i].question == question)
+      return &_frames[i];
+  }
+  return nullptr;
+}
+
+void Prerenderer::setCandidates(const int16_t *questions, uint8_t count)
+{
+  // Keep each question once (small categories make neighbours coincide)
+  _candidateCount = 0;
+  for (uint8_t i = 0; i < count && _candidateCount < PRERENDER_SLOTS; i++)
+  {
+    bool seen = false;
+    for (uint8_t j = 0; j < _candidateCount; j++)
+      seen = seen || _candidates[j] == questions[i];
+    if (!seen)
+      _candidates[_candidateCount++] = questions[i];
+  }
+
+  // Drop frames that are no longer candidates
+  for (uint8_t i = 0; i < PRERENDER_SLOTS; i++)
+  {
+    PrerenderedFrame &frame = _frames[i];
+    if (frame.question < 0)
+      continue;
+
+    bool keep = false;
+    for (uint8_t j = 0; j < _candidateCount; j++)
+      keep = keep || _candidates[j] == frame.question;
+    if (!keep)
+    {
+      if (frame.ready && !frame.used)
+        _wasted++;
+      frame.question = -1;
+      frame.ready = false;
+    }
+  }
+}
+
+bool Prerenderer::prerenderNext()
+{
+  if (!_layouter)
+    return false;
+
+  for (uint8_t i = 0; i < _candidateCount; i++)
+  {
+    if (_slot(_candidates[i]))
+      continue;
+
+    // Every frame belongs to a candidate, so a free slot is left
+    PrerenderedFrame *frame = _slot(-1);
+    frame->question = _candidates[i];
+    frame->used = false;
+    frame->ready = _render(*frame, _compact());
+    return true;
+  }
+  return false;
+}
+
+uint16_t Prerenderer::_compact()
+{
+  // Move ready frames down in pool order so free space is one block at the end. Empty frames
+  // hold no bytes and are left out: one at offset end would not advance it and be picked forever.
+  uint16_t end = 0;
+  while (true)
+  {
+    PrerenderedFrame *next = nullptr;
+    for (uint8_t i = 0; i < PRERENDER_SLOTS; i++)
+    {
+      PrerenderedFrame &frame = _frames[i];
+      if (frame.ready && frame.size > 0 && frame.offset >= end && (!next || frame.offset < next->offset))
+        next = &frame;
+    }
+    if (!next)
+      return end;
+
+    if (next->offset != end)
+    {
+      memmove(_pool + end, _pool + next->offset, next->size);
+      next->offset = end;
+    }
+    end += next->size;
+  }
+}
+
+bool Prerenderer::_render(PrerenderedFrame &frame, uint16_t offset)
+{
+  _layouter(_layout, frame.question);
+  _rendered++;
+
+  int16_t x, y, w, h;
+  frame.offset = offset;
+  frame.size = 0;
+  if (!getUtf8LayoutBounds(_layout, x, y, w, h))
+  {
+    // Nothing to draw, an empty frame is still a valid one
+    frame.x = frame.y = frame.w = frame.h = 0;
+    return true;
+  }
+
+  // Ink box widened to whole bytes and clipped to the screen
+  int16_t x0 = (x < 0) ? 0 : x & ~7;
+  int16_t x1 = (x + w + 7) & ~7;
+  if (x1 > _canvas.width())
+    x1 = _canvas.width();
+  int16_t y0 = (y < 0) ? 0 : y;
+  int16_t y1 = (y + h > _canvas.height()) ? _canvas.height() : y + h;
+  frame.x = x0;
+  frame.y = y0;
+  frame.w = x1 - x0;
+  frame.h = y1 - y0;
+
+  // Render band by band and encode each row straight into the pool
+  uint16_t stride = frame.w / 8;
+  uint16_t bandRows = _canvas.pageHeight();
+  uint32_t o = offset;
+  _canvas.setPartialWindow(frame.x, frame.y, frame.w, frame.h);
+  for (uint16_t top = 0, page = 0; top < frame.h; top += bandRows, page++)
+  {
+    _canvas.selectPage(page);
+    _canvas.fillScreen(GxEPD_WHITE);
+    drawUtf8Layout(_canvas, _layout, GxEPD_BLACK);
+
+    uint16_t rows = (frame.h - top < bandRows) ? frame.h - top : bandRows;
+    for (uint16_t r = 0; r < rows; r++)
+    {
+      uint32_t n = packBitsEncode(_canvas.pageBuffer() + (uint32_t)r * stride, stride, _pool + o, PRERENDER_BYTES - o);
+      if (n == 0)
+      {
+        _tooLarge++;
+        return false;
+      }
+      o += n;
+    }
+  }
+  _canvas.selectPage(0);
+
+  frame.size = o - offset;
+  return true;
+}
+
+const PrerenderedFrame *Prerenderer::find(int16_t question)
+{
+  PrerenderedFrame *frame = _slot(question);
+  if (!frame || !frame->ready)
+  {
+    _misses++;
+    return nullptr;
+  }
+  _hits++;
+  frame->used = true;
+  return frame;
+}
+
+void Prerenderer::draw(PagedCanvas &canvas, const PrerenderedFrame &frame)
+{
+  int16_t cx = frame.x, cy = frame.y, cw = frame.w, ch = frame.h;
+  if (!frame.ready || !canvas.clipToPage(cx, cy, cw, ch))
+    return;
+
+  // Decode row by row; rows outside the band are skipped without being written
+  PackBitsReader reader(_pool + frame.offset);
+  uint16_t stride = frame.w / 8;
+  uint8_t row[PRERENDER_MAX_STRIDE];
+  for (int16_t r = 0; r < frame.h; r++)
+  {
+    int16_t y = frame.y + r;
+    if (!canvas.bandRow(y))
+    {
+      reader.skip(stride);
+      continue;
+    }
+    reader.read(row, stride);
+    canvas.drawRowBytes(frame.x, y, row, stride);
+  }
+}
+
+void Prerenderer::printStats(Print &out) const
+{
+  uint32_t used = 0;
+  for (uint8_t i = 0; i < PRERENDER_SLOTS; i++)
+  {
+    if (_frames[i].ready)
+      used += _frames[i].size;
+  }
+  uint32_t lookups = _hits + _misses;
+  out.printf("Prerender: %lu/%u B, %lu hits, %lu misses (%.1f%% hit rate), %lu rendered, %lu unused, %lu too large\n",
+             (unsigned long)used, (unsigned)PRERENDER_BYTES, (unsigned long)_hits, (unsigned long)_misses,
+             lookups ? 100.0 * _hits / lookups : 0.0, (unsigned long)_rendered, (unsigned long)_wasted,
+             (unsigned long)_tooLarge);
+}
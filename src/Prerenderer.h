@@ -0,0 +1,95 @@
+#ifndef PRERENDERER_H
+#define PRERENDERER_H
+
+#include <Arduino.h>
+#include "PagedDisplay.h"
+#include "Utf8GfxHelper.h"
+
+// RAM for prerendered question text, shared by all frames (PackBits-compressed rows)
+#ifndef PRERENDER_BYTES
+#define PRERENDER_BYTES 24576
+#endif
+
+// Frame offsets and sizes into the pool are 16-bit
+static_assert(PRERENDER_BYTES <= 65535, "PRERENDER_BYTES must fit the uint16_t offsets of PrerenderedFrame");
+
+// Questions kept ready at a time (next, previous, next and previous category)
+#define PRERENDER_SLOTS 4
+
+// Off-screen band the frames are rendered through, one band at a time
+#define PRERENDER_BAND_BYTES 3200
+
+// Widest frame in bytes (800 pixel panel)
+#define PRERENDER_MAX_STRIDE 100
+
+// Loads the layout of a question (same as the one drawn on screen)
+typedef void (*QuestionLayouter)(Utf8TextLayout &layout, int index);
+
+/**
+ * One prerendered question: the pixels inside the text's ink box, each row
+ * PackBits-encoded (see PackBits.h), white = set bit as in the page buffer.
+ */
+struct PrerenderedFrame
+{
+  int16_t question; // -1 = free slot
+  int16_t x, y;     // Top-left of the ink box in native coordinates, x a multiple of 8
+  int16_t w, h;     // w a multiple of 8
+  uint16_t offset;  // Start of the encoded rows in the pool
+  uint16_t size;    // Encoded bytes
+  bool ready;       // Rows are in the pool (false if they did not fit)
+  bool used;        // Drawn at least once
+};
+
+/**
+ * Renders the questions the user is likely to open next while the display
+ * task is idle, so a page turn only has to copy rows into the page buffer.
+ *
+ * Everything runs on the display task (prerenderNext() from its idle hook,
+ * find()/draw() from the question renderer), so the glyph cache and the
+ * layout buffer are never used concurrently. Native orientation only.
+ */
+class Prerenderer
+{
+public:
+  Prerenderer(int16_t width, int16_t height);
+
+  void setLayouter(QuestionLayouter layouter) { _layouter = layouter; }
+  void setGlyphCache(GlyphCache *cache) { _canvas.setGlyphCache(cache); }
+
+  // Questions worth having ready; frames of other questions are dropped
+  void setCandidates(const int16_t *questions, uint8_t count);
+
+  // Prerender one missing candidate; false once there is nothing left to do
+  bool prerenderNext();
+
+  // Frame of a question, nullptr if it is not ready (counted as hit or miss)
+  const PrerenderedFrame *find(int16_t question);
+
+  // Draw a frame into the current page band of canvas (black ink)
+  void draw(PagedCanvas &canvas, const PrerenderedFrame &frame);
+
+  uint32_t hits() const { return _hits; }
+  uint32_t misses() const { return _misses; }
+
+  // Print RAM use, hit rate and wasted frames, e.g. printStats(Serial)
+  void printStats(Print &out) const;
+
+private:
+  uint8_t _band[PRERENDER_BAND_BYTES];
+  PagedCanvas _canvas;
+  Utf8TextLayout _layout;
+  QuestionLayouter _layouter;
+
+  uint8_t _pool[PRERENDER_BYTES];
+  PrerenderedFrame _frames[PRERENDER_SLOTS];
+  int16_t _candidates[PRERENDER_SLOTS];
+  uint8_t _candidateCount;
+
+  uint32_t _hits, _misses, _rendered, _wasted, _tooLarge;
+
+  PrerenderedFrame *_slot(int16_t question);
+  uint16_t _compact();
+  bool _render(PrerenderedFrame &frame, uint16_t offset);
+};
+
+#endif // PRERENDERER_H
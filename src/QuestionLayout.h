@@ -0,0 +1,134 @@
+#ifndef QUESTION_LAYOUT_H
+#define QUESTION_LAYOUT_H
+
+#include "DeckFonts.h"
+#include "Questions.h"
+#include "Utf8GfxHelper.h"
+
+/**
+ * Question text layout precomputed by convert_csv.py.
+ *
+ * Line breaks, line widths and the font are fixed when Questions.h is
+ * generated (same metrics and rules as layoutUtf8Text()), so turning a page
+ * only copies the lines and positions them in the question box; no text is
+ * measured or wrapped on the device.
+ */
+
+static_assert(sizeof(QUESTION_FONTS) / sizeof(QUESTION_FONTS[0]) == QUESTION_FONT_COUNT,
+              "QUESTION_FONTS (DeckFonts.h) does not match FONT_LADDER in convert_csv.py");
+
+/**
+ * Fill a Utf8TextLayout for a question, ready for drawUtf8Layout().
+ *
+ * @return Number of lines in the layout (0 if index is out of range)
+ */
+inline uint8_t loadQuestionLayout(Utf8TextLayout &layout, int index)
+{
+  layout.font = QUESTION_FONTS[0];
+  layout.text = getQuestionText(index);
+  layout.lineCount = 0;
+
+  const QuestionLayout *q = getQuestionLayout(index);
+  if (!q)
+    return 0;
+
+  uint16_t firstLine = pgm_read_word(&q->firstLine);
+  layout.lineCount = pgm_read_byte(&q->lineCount);
+  layout.font = QUESTION_FONTS[pgm_read_byte(&q->font)];
+
+  for (uint8_t i = 0; i < layout.lineCount; i++)
+  {
+    const QuestionLine *src = &QUESTION_LINES[firstLine + i];
+    Utf8LayoutLine &line = layout.lines[i];
+    line.start = pgm_read_word(&src->start);
+    line.length = pgm_read_word(&src->length);
+    line.width = pgm_read_word(&src->width);
+    line.top = (int8_t)pgm_read_byte(&src->top);
+    line.bottom = (int8_t)pgm_read_byte(&src->bottom);
+  }
+
+  positionUtf8Layout(layout, QUESTION_BOX_CENTER_X, QUESTION_BOX_CENTER_Y);
+  return layout.lineCount;
+}
+
+/**
+ * Layouts found by fitQuestionLayout(), in the form of the precomputed tables:
+ * lines relative to the baseline, lineCount 0 for a question not fitted yet.
+ * The deck wraps to the same lines as in convert_csv.py, so the line pool is
+ * sized to QUESTION_LINES (8 bytes a line, about 6.6 KB for the deck in all).
+ */
+struct FittedQuestionLayouts
+{
+  QuestionLayout questions[QUESTION_COUNT];
+  QuestionLine lines[sizeof(QUESTION_LINES) / sizeof(QUESTION_LINES[0])];
+  uint16_t lineCount;
+};
+
+inline FittedQuestionLayouts &fittedQuestionLayouts()
+{
+  static FittedQuestionLayouts fitted;
+  return fitted;
+}
+
+/**
+ * Lay out a question at runtime in the largest QUESTION_FONTS entry that fits
+ * (fitUtf8Text()). The wrapped lines are kept per question, so a repeat visit
+ * only copies and positions them, like loadQuestionLayout(). Used for
+ * -DRUNTIME_LAYOUT builds, which do not need the precomputed tables.
+ *
+ * @return Number of lines in the layout (0 if index is out of range)
+ */
+inline uint8_t fitQuestionLayout(Utf8TextLayout &layout, int index)
+{
+  const char *text = getQuestionText(index);
+  if (index < 0 || index >= QUESTION_COUNT)
+    return layoutUtf8Text(layout, QUESTION_FONTS[0], text, QUESTION_BOX_CENTER_X, QUESTION_BOX_CENTER_Y,
+                          QUESTION_BOX_WIDTH, QUESTION_BOX_HEIGHT);
+
+  FittedQuestionLayouts &fitted = fittedQuestionLayouts();
+  QuestionLayout &q = fitted.questions[index];
+  if (q.lineCount)
+  {
+    layout.font = QUESTION_FONTS[q.font];
+    layout.text = text;
+    layout.lineCount = q.lineCount;
+    for (uint8_t i = 0; i < layout.lineCount; i++)
+    {
+      const QuestionLine &src = fitted.lines[q.firstLine + i];
+      Utf8LayoutLine &line = layout.lines[i];
+      line.start = src.start;
+      line.length = src.length;
+      line.width = src.width;
+      line.top = src.top;
+      line.bottom = src.bottom;
+    }
+    positionUtf8Layout(layout, QUESTION_BOX_CENTER_X, QUESTION_BOX_CENTER_Y);
+    return layout.lineCount;
+  }
+
+  Utf8TextMetrics metrics; // About 0.5 KB of stack, only while fitting
+  uint8_t font = fitUtf8Text(layout, metrics, QUESTION_FONTS, QUESTION_FONT_COUNT, text, QUESTION_BOX_CENTER_X,
+                             QUESTION_BOX_CENTER_Y, QUESTION_BOX_WIDTH, QUESTION_BOX_HEIGHT);
+
+  // Keep the lines unless the pool is full (a deck changed without running convert_csv.py)
+  uint16_t capacity = sizeof(fitted.lines) / sizeof(fitted.lines[0]);
+  if (layout.lineCount && fitted.lineCount + layout.lineCount <= capacity)
+  {
+    q.firstLine = fitted.lineCount;
+    q.font = font;
+    for (uint8_t i = 0; i < layout.lineCount; i++)
+    {
+      const Utf8LayoutLine &line = layout.lines[i];
+      QuestionLine &dst = fitted.lines[fitted.lineCount++];
+      dst.start = line.start;
+      dst.length = line.length;
+      dst.width = line.width;
+      dst.top = (int8_t)(line.top - line.baseline);
+      dst.bottom = (int8_t)(line.bottom - line.baseline);
+    }
+    q.lineCount = layout.lineCount;
+  }
+  return layout.lineCount;
+}
+
+#endif // QUESTION_LAYOUT_H
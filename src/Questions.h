@@ -360,6 +360,1032 @@ const Question QUESTIONS[] PROGMEM = {
     {"ZA CO JSI V ŽIVOTĚ NEJVÍC VDĚČNÝ/Á?", CAT_SECRETS},
     {"PŘEDSTAV SI, ŽE TVŮJ ŽIVOT JE KNIHA A TY MŮŽEŠ PŘEPSAT NĚKTERÉ STRÁNKY. UDĚLÁŠ TO?", CAT_SECRETS}
 };
+
+// =============================================================================
+// PRECOMPUTED LAYOUT (generated by convert_csv.py, see QuestionLayout.h)
+// =============================================================================
+
+// Question text box: center and size
+const int16_t QUESTION_BOX_CENTER_X = 400;
+const int16_t QUESTION_BOX_CENTER_Y = 210;
+const uint16_t QUESTION_BOX_WIDTH = 640;
+const uint16_t QUESTION_BOX_HEIGHT = 280;
+
+// Number of fonts in the ladder the layout was computed for (Lexend_Light40pt7b, Lexend_Light28pt7b, Lexend_Light22pt7b)
+const uint8_t QUESTION_FONT_COUNT = 3;
+
+// One wrapped line: byte span of the question text, pixel width, and glyph extent around the baseline
+struct QuestionLine
+{
+  uint16_t start;
+  uint16_t length;
+  uint16_t width;
+  int8_t top;
+  int8_t bottom;
+};
+
+// Lines of one question and the index of its font in QUESTION_FONTS
+struct QuestionLayout
+{
+  uint16_t firstLine;
+  uint8_t lineCount;
+  uint8_t font;
+};
+
+const QuestionLine QUESTION_LINES[] PROGMEM = {
+    {0, 26, 552, -34, 8},
+    {0, 23, 464, -34, 1},
+    {0, 28, 585, -35, 6},
+    {0, 24, 474, -35, 1},
+    {0, 23, 484, -35, 1},
+    {0, 21, 477, -27, 6},
+    {22, 19, 364, -35, 6},
+    {0, 29, 595, -35, 1},
+    {30, 17, 355, -35, 1},
+    {0, 26, 533, -34, 6},
+    {27, 10, 224, -34, 1},
+    {0, 28, 626, -35, 1},
+    {29, 8, 167, -34, 1},
+    {0, 27, 550, -35, 1},
+    {28, 4, 105, -27, 1},
+    {0, 28, 505, -35, 1},
+    {0, 26, 536, -35, 1},
+    {27, 19, 372, -35, 1},
+    {0, 27, 548, -35, 1},
+    {0, 28, 576, -35, 1},
+    {29, 7, 184, -27, 1},
+    {0, 30, 601, -35, 6},
+    {0, 28, 619, -35, 1},
+    {29, 19, 391, -35, 1},
+    {0, 24, 520, -34, 1},
+    {0, 24, 455, -35, 1},
+    {0, 22, 412, -35, 1},
+    {0, 23, 552, -27, 6},
+    {24, 31, 592, -35, 1},
+    {0, 28, 598, -35, 1},
+    {29, 30, 589, -35, 1},
+    {0, 30, 551, -35, 8},
+    {0, 25, 499, -35, 1},
+    {26, 16, 346, -35, 8},
+    {43, 12, 293, -27, 6},
+    {0, 27, 566, -35, 6},
+    {28, 13, 326, -35, 1},
+    {0, 30, 613, -35, 8},
+    {31, 14, 245, -35, 6},
+    {0, 32, 609, -35, 1},
+    {0, 34, 625, -35, 1},
+    {35, 6, 124, -35, 1},
+    {0, 23, 482, -34, 8},
+    {24, 18, 438, -34, 1},
+    {0, 30, 562, -35, 8},
+    {31, 9, 176, -35, 1},
+    {0, 27, 521, -35, 8},
+    {28, 7, 176, -27, 1},
+    {0, 24, 448, -35, 1},
+    {25, 28, 591, -35, 1},
+    {0, 29, 587, -35, 1},
+    {0, 18, 319, -35, 1},
+    {0, 27, 624, -35, 1},
+    {28, 28, 621, -34, 8},
+    {57, 15, 308, -35, 1},
+    {0, 32, 628, -35, 8},
+    {33, 17, 361, -35, 1},
+    {0, 28, 553, -35, 8},
+    {29, 7, 180, -27, 1},
+    {0, 27, 541, -35, 8},
+    {28, 11, 235, -35, 1},
+    {0, 27, 502, -35, 1},
+    {0, 32, 626, -35, 1},
+    {0, 22, 505, -35, 1},
+    {23, 36, 602, -35, 1},
+    {0, 24, 535, -34, 8},
+    {25, 16, 313, -35, 6},
+    {0, 27, 568, -35, 1},
+    {28, 5, 114, -35, 1},
+    {0, 30, 594, -35, 6},
+    {31, 5, 95, -35, 1},
+    {0, 22, 516, -35, 1},
+    {23, 22, 439, -35, 6},
+    {0, 18, 394, -35, 1},
+    {19, 30, 636, -35, 6},
+    {0, 27, 568, -35, 1},
+    {28, 12, 257, -35, 1},
+    {0, 22, 480, -35, 6},
+    {23, 24, 573, -35, 1},
+    {48, 24, 564, -35, 1},
+    {73, 8, 141, -34, 1},
+    {0, 30, 592, -35, 6},
+    {31, 17, 388, -35, 1},
+    {0, 26, 502, -35, 1},
+    {0, 28, 550, -35, 1},
+    {29, 6, 129, -34, 1},
+    {0, 27, 557, -35, 6},
+    {28, 14, 323, -35, 1},
+    {0, 23, 502, -34, 8},
+    {24, 17, 383, -35, 1},
+    {0, 24, 493, -35, 1},
+    {25, 18, 398, -35, 1},
+    {44, 12, 280, -34, 1},
+    {0, 28, 602, -35, 8},
+    {29, 14, 293, -34, 1},
+    {0, 20, 455, -35, 1},
+    {21, 21, 494, -35, 1},
+    {0, 28, 628, -34, 8},
+    {29, 25, 561, -34, 1},
+    {0, 20, 455, -35, 1},
+    {21, 21, 457, -35, 1},
+    {0, 26, 569, -34, 8},
+    {27, 28, 630, -35, 6},
+    {0, 29, 628, -34, 8},
+    {30, 28, 625, -35, 6},
+    {0, 26, 575, -35, 6},
+    {27, 13, 273, -35, 1},
+    {0, 20, 455, -35, 1},
+    {21, 27, 552, -35, 1},
+    {0, 27, 607, -35, 8},
+    {28, 15, 360, -27, 6},
+    {44, 12, 295, -34, 1},
+    {0, 25, 572, -34, 6},
+    {26, 20, 467, -35, 1},
+    {47, 27, 596, -35, 1},
+    {0, 20, 455, -35, 1},
+    {21, 17, 394, -35, 1},
+    {0, 23, 515, -34, 8},
+    {24, 28, 603, -35, 6},
+    {53, 9, 220, -27, 1},
+    {0, 21, 507, -27, 1},
+    {22, 17, 382, -35, 1},
+    {0, 31, 640, -35, 1},
+    {0, 21, 507, -27, 1},
+    {22, 17, 384, -35, 1},
+    {0, 22, 529, -27, 8},
+    {23, 26, 542, -35, 1},
+    {50, 24, 526, -35, 6},
+    {75, 12, 269, -35, 1},
+    {0, 21, 407, -34, 8},
+    {22, 27, 604, -35, 8},
+    {50, 10, 262, -27, 1},
+    {0, 23, 515, -34, 8},
+    {24, 15, 366, -27, 6},
+    {40, 16, 343, -35, 6},
+    {0, 22, 556, -27, 6},
+    {23, 25, 523, -35, 1},
+    {49, 22, 483, -27, 1},
+    {0, 28, 619, -35, 1},
+    {29, 25, 571, -35, 6},
+    {0, 20, 455, -35, 1},
+    {21, 29, 607, -35, 1},
+    {0, 20, 443, -35, 1},
+    {21, 19, 438, -35, 1},
+    {0, 20, 479, -27, 6},
+    {21, 24, 542, -35, 8},
+    {46, 26, 548, -35, 1},
+    {0, 23, 425, -35, 8},
+    {24, 26, 611, -35, 8},
+    {51, 9, 185, -34, 6},
+    {0, 27, 609, -34, 1},
+    {28, 18, 351, -35, 1},
+    {0, 23, 539, -27, 1},
+    {24, 18, 351, -35, 1},
+    {0, 26, 478, -35, 8},
+    {27, 28, 577, -35, 8},
+    {56, 19, 379, -35, 6},
+    {0, 23, 469, -35, 1},
+    {24, 12, 296, -35, 6},
+    {0, 27, 592, -35, 6},
+    {0, 30, 621, -35, 6},
+    {0, 18, 366, -35, 6},
+    {19, 21, 458, -34, 6},
+    {0, 18, 366, -35, 6},
+    {19, 18, 384, -35, 6},
+    {0, 25, 498, -35, 1},
+    {26, 13, 269, -34, 8},
+    {40, 16, 343, -35, 6},
+    {0, 19, 440, -35, 1},
+    {20, 26, 567, -35, 8},
+    {0, 29, 604, -35, 1},
+    {0, 23, 501, -34, 1},
+    {24, 30, 620, -35, 8},
+    {0, 30, 639, -35, 6},
+    {0, 31, 612, -35, 6},
+    {0, 20, 375, -35, 6},
+    {21, 21, 478, -34, 6},
+    {0, 22, 505, -35, 1},
+    {23, 14, 258, -35, 1},
+    {0, 23, 498, -34, 6},
+    {24, 10, 201, -35, 1},
+    {0, 26, 483, -35, 1},
+    {0, 28, 601, -34, 1},
+    {29, 8, 197, -35, 1},
+    {0, 32, 610, -35, 8},
+    {33, 5, 103, -35, 1},
+    {0, 24, 560, -34, 1},
+    {25, 22, 482, -35, 1},
+    {0, 27, 548, -35, 1},
+    {28, 8, 217, -27, 1},
+    {0, 25, 521, -35, 1},
+    {26, 28, 593, -35, 6},
+    {0, 22, 450, -35, 6},
+    {23, 27, 575, -35, 8},
+    {0, 23, 468, -35, 8},
+    {24, 16, 329, -35, 1},
+    {0, 21, 528, -34, 6},
+    {22, 27, 571, -35, 8},
+    {0, 32, 609, -35, 1},
+    {0, 31, 621, -35, 1},
+    {32, 3, 78, -27, 1},
+    {0, 25, 546, -34, 6},
+    {26, 19, 447, -35, 6},
+    {0, 34, 634, -35, 1},
+    {0, 27, 541, -35, 8},
+    {28, 8, 187, -35, 1},
+    {0, 21, 488, -34, 6},
+    {22, 21, 467, -35, 8},
+    {44, 10, 226, -34, 6},
+    {0, 21, 426, -35, 1},
+    {22, 15, 331, -34, 8},
+    {38, 15, 314, -35, 6},
+    {0, 23, 426, -35, 1},
+    {24, 30, 635, -35, 6},
+    {0, 26, 521, -35, 6},
+    {27, 29, 638, -35, 1},
+    {0, 14, 280, -35, 1},
+    {15, 24, 481, -35, 1},
+    {40, 10, 245, -35, 1},
+    {0, 24, 480, -35, 1},
+    {25, 21, 455, -35, 1},
+    {0, 25, 619, -27, 6},
+    {26, 21, 557, -27, 1},
+    {0, 20, 402, -35, 1},
+    {21, 10, 234, -35, 1},
+    {0, 25, 498, -35, 1},
+    {26, 25, 524, -34, 1},
+    {0, 32, 617, -35, 1},
+    {33, 17, 399, -35, 1},
+    {0, 25, 524, -35, 1},
+    {26, 15, 318, -35, 1},
+    {0, 28, 618, -35, 6},
+    {29, 23, 564, -27, 1},
+    {53, 29, 640, -35, 8},
+    {0, 31, 602, -35, 1},
+    {32, 11, 250, -34, 1},
+    {0, 25, 490, -35, 1},
+    {26, 15, 287, -35, 1},
+    {0, 23, 471, -35, 1},
+    {24, 8, 172, -35, 1},
+    {0, 26, 515, -35, 1},
+    {0, 21, 442, -34, 1},
+    {0, 23, 492, -35, 6},
+    {24, 12, 253, -35, 1},
+    {0, 31, 578, -35, 1},
+    {0, 14, 281, -35, 1},
+    {15, 26, 535, -35, 1},
+    {0, 29, 575, -35, 6},
+    {0, 30, 621, -35, 6},
+    {0, 23, 463, -35, 1},
+    {0, 22, 485, -35, 1},
+    {0, 22, 390, -35, 8},
+    {23, 11, 251, -34, 1},
+    {0, 27, 547, -35, 1},
+    {28, 18, 383, -34, 1},
+    {0, 24, 511, -34, 8},
+    {25, 22, 471, -35, 1},
+    {0, 22, 432, -35, 1},
+    {0, 32, 612, -35, 1},
+    {33, 13, 267, -34, 1},
+    {0, 24, 487, -34, 8},
+    {25, 15, 308, -35, 6},
+    {0, 25, 526, -35, 1},
+    {26, 14, 338, -35, 1},
+    {0, 28, 576, -35, 1},
+    {29, 14, 341, -35, 1},
+    {0, 29, 599, -35, 8},
+    {30, 18, 367, -35, 1},
+    {0, 17, 368, -35, 1},
+    {18, 23, 463, -35, 1},
+    {0, 28, 627, -35, 1},
+    {0, 27, 541, -35, 1},
+    {28, 13, 267, -34, 1},
+    {0, 26, 535, -35, 1},
+    {0, 26, 543, -35, 1},
+    {0, 31, 582, -35, 8},
+    {32, 13, 264, -34, 1},
+    {0, 26, 497, -35, 1},
+    {27, 19, 411, -35, 1},
+    {0, 30, 546, -35, 1},
+    {31, 8, 172, -35, 1},
+    {0, 22, 455, -35, 1},
+    {23, 24, 566, -35, 8},
+    {48, 8, 187, -27, 1},
+    {0, 32, 565, -35, 1},
+    {0, 24, 519, -35, 6},
+    {25, 11, 258, -34, 1},
+    {0, 32, 611, -35, 1},
+    {33, 11, 243, -35, 1},
+    {0, 22, 446, -35, 1},
+    {23, 9, 199, -35, 1},
+    {0, 29, 589, -35, 1},
+    {0, 32, 623, -35, 1},
+    {0, 28, 562, -34, 6},
+    {0, 25, 492, -35, 6},
+    {26, 17, 416, -27, 1},
+    {0, 31, 625, -35, 6},
+    {32, 5, 134, -27, 1},
+    {0, 25, 471, -35, 1},
+    {26, 18, 360, -35, 1},
+    {0, 15, 358, -27, 1},
+    {16, 21, 454, -35, 6},
+    {38, 13, 289, -35, 1},
+    {0, 15, 287, -35, 1},
+    {16, 30, 637, -35, 6},
+    {0, 27, 577, -35, 6},
+    {28, 19, 372, -35, 1},
+    {0, 14, 230, -35, 1},
+    {15, 21, 454, -35, 6},
+    {37, 11, 228, -34, 1},
+    {0, 22, 449, -35, 1},
+    {23, 31, 624, -35, 6},
+    {55, 8, 167, -34, 1},
+    {0, 26, 535, -35, 1},
+    {27, 10, 245, -35, 1},
+    {0, 24, 550, -34, 1},
+    {25, 22, 474, -35, 6},
+    {0, 18, 359, -35, 6},
+    {19, 22, 474, -35, 6},
+    {0, 29, 598, -35, 6},
+    {30, 19, 415, -34, 1},
+    {0, 12, 261, -27, 1},
+    {13, 30, 631, -35, 6},
+    {0, 15, 309, -35, 1},
+    {16, 28, 609, -35, 8},
+    {45, 22, 471, -34, 6},
+    {68, 8, 175, -34, 1},
+    {0, 26, 589, -35, 1},
+    {27, 16, 364, -34, 6},
+    {0, 26, 550, -35, 1},
+    {27, 21, 447, -35, 6},
+    {0, 14, 297, -34, 1},
+    {15, 21, 454, -35, 6},
+    {37, 11, 266, -35, 1},
+    {0, 26, 560, -34, 6},
+    {27, 26, 479, -35, 6},
+    {0, 29, 597, -35, 6},
+    {30, 10, 205, -34, 1},
+    {0, 34, 602, -35, 8},
+    {35, 7, 143, -35, 1},
+    {43, 23, 588, -27, 6},
+    {0, 27, 568, -35, 6},
+    {28, 17, 343, -35, 6},
+    {0, 27, 552, -35, 6},
+    {28, 4, 104, -27, 1},
+    {0, 29, 602, -35, 6},
+    {30, 7, 146, -34, 1},
+    {0, 15, 308, -35, 1},
+    {16, 25, 508, -35, 1},
+    {42, 8, 177, -34, 1},
+    {0, 28, 607, -35, 1},
+    {29, 12, 259, -35, 1},
+    {0, 13, 278, -35, 1},
+    {14, 21, 454, -35, 6},
+    {36, 18, 383, -34, 1},
+    {0, 31, 553, -35, 8},
+    {32, 26, 512, -35, 6},
+    {59, 7, 143, -35, 1},
+    {0, 23, 505, -34, 6},
+    {24, 21, 454, -35, 6},
+    {46, 12, 270, -35, 1},
+    {0, 31, 626, -35, 6},
+    {32, 22, 474, -35, 6},
+    {0, 29, 579, -34, 6},
+    {0, 23, 452, -34, 1},
+    {24, 11, 276, -35, 1},
+    {0, 18, 379, -35, 6},
+    {19, 29, 568, -35, 1},
+    {0, 27, 567, -35, 6},
+    {28, 27, 601, -35, 6},
+    {0, 31, 617, -35, 6},
+    {32, 10, 226, -35, 1},
+    {0, 22, 471, -34, 1},
+    {23, 22, 474, -35, 6},
+    {0, 26, 565, -35, 6},
+    {27, 24, 476, -35, 1},
+    {0, 18, 379, -35, 6},
+    {19, 29, 590, -35, 1},
+    {49, 11, 250, -34, 1},
+    {0, 16, 376, -35, 1},
+    {17, 27, 566, -34, 8},
+    {0, 20, 386, -35, 1},
+    {21, 17, 404, -34, 6},
+    {0, 14, 299, -27, 1},
+    {15, 27, 578, -35, 6},
+    {43, 10, 228, -35, 1},
+    {0, 30, 624, -35, 1},
+    {31, 9, 201, -34, 1},
+    {0, 30, 580, -35, 8},
+    {31, 22, 484, -35, 1},
+    {0, 21, 456, -35, 1},
+    {22, 27, 609, -34, 6},
+    {50, 5, 127, -27, 1},
+    {0, 32, 611, -35, 1},
+    {33, 20, 383, -35, 1},
+    {0, 24, 528, -35, 6},
+    {25, 12, 235, -35, 1},
+    {0, 27, 594, -35, 6},
+    {28, 12, 235, -35, 1},
+    {0, 23, 535, -34, 6},
+    {24, 29, 594, -35, 6},
+    {0, 22, 468, -35, 6},
+    {0, 27, 572, -34, 8},
+    {28, 9, 210, -35, 1},
+    {0, 28, 546, -35, 1},
+    {29, 19, 388, -35, 6},
+    {0, 29, 575, -35, 8},
+    {30, 30, 593, -35, 6},
+    {0, 24, 473, -35, 1},
+    {25, 9, 197, -34, 1},
+    {0, 25, 491, -35, 1},
+    {0, 25, 470, -35, 1},
+    {26, 13, 292, -35, 1},
+    {0, 25, 498, -35, 1},
+    {26, 16, 328, -35, 1},
+    {0, 22, 431, -35, 1},
+    {23, 9, 210, -34, 1},
+    {0, 24, 479, -35, 1},
+    {25, 9, 201, -35, 1},
+    {0, 27, 548, -35, 1},
+    {28, 19, 368, -35, 1},
+    {0, 20, 445, -35, 1},
+    {21, 27, 544, -35, 1},
+    {0, 30, 590, -35, 1},
+    {0, 30, 587, -35, 1},
+    {0, 23, 457, -35, 1},
+    {24, 8, 214, -27, 1},
+    {0, 30, 590, -35, 1},
+    {0, 30, 621, -35, 1},
+    {31, 10, 202, -35, 1},
+    {0, 28, 497, -35, 1},
+    {29, 16, 330, -35, 1},
+    {0, 23, 535, -34, 6},
+    {24, 27, 581, -34, 6},
+    {52, 10, 271, -27, 1},
+    {0, 23, 535, -34, 6},
+    {24, 27, 595, -35, 6},
+    {0, 23, 535, -34, 6},
+    {24, 25, 499, -35, 1},
+    {50, 6, 136, -27, 1},
+    {0, 26, 586, -34, 6},
+    {27, 9, 210, -34, 1},
+    {0, 14, 281, -35, 1},
+    {15, 25, 520, -35, 1},
+    {0, 25, 499, -35, 1},
+    {26, 15, 331, -35, 1},
+    {0, 29, 580, -35, 8},
+    {30, 5, 140, -27, 1},
+    {0, 31, 626, -35, 8},
+    {32, 19, 420, -34, 6},
+    {0, 31, 626, -35, 8},
+    {32, 24, 532, -34, 6},
+    {0, 31, 608, -35, 6},
+    {0, 34, 632, -35, 8},
+    {0, 25, 547, -35, 6},
+    {26, 13, 243, -35, 1},
+    {0, 25, 499, -35, 1},
+    {26, 5, 136, -27, 1},
+    {0, 27, 527, -35, 6},
+    {28, 6, 129, -34, 1},
+    {0, 20, 455, -35, 1},
+    {21, 19, 432, -35, 1},
+    {41, 10, 202, -35, 1},
+    {0, 24, 504, -35, 8},
+    {25, 13, 275, -34, 1},
+    {0, 33, 554, -35, 8},
+    {34, 8, 146, -35, 1},
+    {0, 25, 512, -35, 1},
+    {26, 19, 408, -34, 1},
+    {0, 28, 613, -34, 8},
+    {29, 20, 459, -34, 1},
+    {0, 23, 515, -34, 8},
+    {24, 22, 479, -35, 6},
+    {0, 17, 351, -34, 1},
+    {18, 26, 572, -34, 8},
+    {45, 25, 518, -35, 6},
+    {71, 8, 170, -34, 6},
+    {0, 24, 545, -34, 8},
+    {25, 17, 396, -34, 6},
+    {0, 23, 515, -34, 8},
+    {24, 20, 461, -34, 6},
+    {0, 23, 515, -34, 8},
+    {24, 27, 526, -35, 6},
+    {0, 22, 543, -27, 1},
+    {23, 22, 475, -34, 8},
+    {46, 26, 619, -34, 1},
+    {0, 26, 574, -34, 8},
+    {27, 26, 605, -35, 6},
+    {0, 20, 502, -27, 6},
+    {21, 27, 577, -34, 8},
+    {49, 8, 191, -27, 1},
+    {0, 22, 556, -27, 6},
+    {23, 26, 585, -35, 8},
+    {50, 5, 123, -27, 1},
+    {0, 22, 485, -35, 6},
+    {23, 24, 559, -34, 8},
+    {48, 11, 198, -35, 1},
+    {0, 27, 591, -35, 8},
+    {28, 24, 563, -34, 1},
+    {0, 24, 479, -35, 6},
+    {25, 26, 543, -35, 8},
+    {0, 28, 607, -35, 6},
+    {29, 21, 441, -34, 8},
+    {0, 24, 542, -34, 8},
+    {25, 8, 205, -27, 1},
+    {0, 23, 532, -35, 6},
+    {24, 19, 444, -27, 8},
+    {44, 12, 267, -34, 6},
+    {0, 23, 558, -27, 6},
+    {24, 29, 558, -35, 8},
+    {54, 23, 491, -35, 1},
+    {0, 22, 485, -35, 6},
+    {23, 21, 481, -34, 8},
+    {45, 12, 285, -35, 6},
+    {0, 25, 580, -34, 6},
+    {26, 28, 629, -34, 8},
+    {55, 15, 329, -34, 1},
+    {0, 24, 600, -27, 6},
+    {25, 28, 536, -35, 8},
+    {54, 5, 122, -27, 1},
+    {0, 27, 575, -35, 8},
+    {28, 27, 586, -35, 8},
+    {56, 12, 319, -27, 6},
+    {0, 27, 529, -35, 8},
+    {28, 31, 629, -35, 1},
+    {0, 23, 515, -34, 8},
+    {24, 15, 346, -34, 6},
+    {0, 20, 457, -35, 6},
+    {21, 27, 557, -35, 8},
+    {49, 7, 146, -34, 1},
+    {0, 28, 595, -35, 8},
+    {29, 20, 424, -35, 1},
+    {0, 29, 624, -34, 6},
+    {30, 24, 544, -35, 6},
+    {55, 19, 422, -35, 1},
+    {0, 21, 509, -27, 1},
+    {22, 29, 620, -35, 8},
+    {52, 19, 369, -35, 6},
+    {0, 24, 536, -27, 8},
+    {25, 20, 468, -34, 1},
+    {0, 23, 515, -34, 8},
+    {24, 24, 561, -35, 1},
+    {0, 25, 597, -27, 6},
+    {26, 31, 529, -35, 1},
+    {58, 5, 130, -27, 1},
+    {0, 24, 546, -35, 6},
+    {25, 27, 628, -27, 8},
+    {53, 15, 365, -27, 1},
+    {0, 22, 554, -27, 6},
+    {23, 24, 525, -34, 8},
+    {48, 21, 460, -35, 1},
+    {0, 26, 620, -34, 6},
+    {27, 29, 610, -35, 8},
+    {57, 16, 349, -34, 1},
+    {0, 23, 567, -34, 6},
+    {24, 14, 308, -35, 8},
+    {39, 12, 301, -27, 6},
+    {0, 25, 550, -34, 8},
+    {26, 26, 612, -34, 1},
+    {53, 15, 297, -35, 1},
+    {0, 23, 515, -34, 8},
+    {24, 19, 477, -27, 6},
+    {44, 18, 370, -35, 1},
+    {0, 20, 502, -27, 6},
+    {21, 29, 611, -35, 8},
+    {51, 21, 516, -27, 6},
+    {0, 23, 478, -35, 6},
+    {24, 27, 566, -35, 8},
+    {52, 13, 281, -34, 1},
+    {0, 22, 516, -35, 6},
+    {23, 27, 567, -35, 1},
+    {51, 26, 594, -27, 8},
+    {78, 14, 299, -34, 1},
+    {0, 21, 492, -35, 1},
+    {22, 24, 525, -34, 8},
+    {47, 7, 147, -34, 1},
+    {0, 13, 230, -35, 1},
+    {14, 21, 397, -35, 6},
+    {0, 27, 567, -34, 1},
+    {28, 24, 519, -35, 8},
+    {53, 13, 319, -34, 6},
+    {0, 28, 599, -35, 1},
+    {29, 25, 564, -27, 1},
+    {55, 7, 145, -35, 1},
+    {0, 28, 542, -35, 1},
+    {29, 15, 248, -35, 1},
+    {0, 14, 307, -35, 1},
+    {15, 29, 610, -35, 1},
+    {45, 17, 363, -35, 1},
+    {0, 29, 562, -35, 8},
+    {30, 9, 219, -27, 1},
+    {0, 32, 569, -35, 8},
+    {33, 31, 624, -35, 8},
+    {0, 32, 611, -35, 8},
+    {33, 24, 562, -34, 1},
+    {0, 22, 435, -35, 1},
+    {23, 28, 588, -35, 8},
+    {52, 22, 448, -34, 1},
+    {0, 24, 526, -34, 1},
+    {25, 27, 557, -35, 8},
+    {53, 17, 361, -34, 6},
+    {0, 27, 563, -34, 1},
+    {28, 19, 485, -34, 1},
+    {48, 11, 303, -27, 1},
+    {0, 21, 443, -35, 8},
+    {22, 33, 620, -35, 8},
+    {0, 20, 417, -35, 8},
+    {21, 29, 579, -34, 8},
+    {51, 12, 198, -35, 1},
+    {0, 29, 543, -35, 8},
+    {30, 28, 640, -35, 1},
+    {0, 30, 571, -35, 1},
+    {31, 32, 606, -35, 1},
+    {64, 13, 296, -35, 1},
+    {0, 21, 528, -34, 6},
+    {22, 24, 506, -34, 8},
+    {47, 21, 458, -27, 8},
+    {0, 29, 620, -35, 8},
+    {30, 25, 554, -34, 1},
+    {0, 27, 546, -35, 1},
+    {28, 17, 344, -35, 6},
+    {0, 26, 515, -35, 8},
+    {27, 8, 173, -34, 1},
+    {0, 26, 506, -35, 1},
+    {27, 17, 346, -35, 1},
+    {0, 33, 604, -35, 8},
+    {34, 10, 239, -35, 6},
+    {0, 21, 442, -35, 1},
+    {22, 23, 481, -34, 8},
+    {46, 7, 192, -27, 1},
+    {0, 28, 535, -35, 1},
+    {29, 9, 147, -35, 1},
+    {0, 25, 541, -35, 1},
+    {26, 21, 406, -35, 1},
+    {0, 20, 473, -27, 1},
+    {21, 27, 547, -35, 6},
+    {0, 20, 473, -27, 1},
+    {21, 28, 596, -35, 6},
+    {0, 25, 559, -35, 6},
+    {26, 22, 471, -34, 8},
+    {49, 9, 201, -35, 6},
+    {0, 31, 618, -35, 8},
+    {32, 15, 266, -35, 1},
+    {0, 26, 524, -35, 1},
+    {27, 7, 176, -27, 1},
+    {0, 25, 529, -35, 1},
+    {26, 16, 342, -34, 1},
+    {0, 17, 303, -35, 1},
+    {0, 20, 473, -27, 1},
+    {21, 25, 542, -35, 6},
+    {0, 29, 627, -34, 1},
+    {30, 19, 350, -35, 1},
+    {0, 30, 591, -35, 8},
+    {31, 19, 477, -35, 1},
+    {0, 26, 587, -35, 6},
+    {27, 21, 493, -35, 6},
+    {0, 32, 626, -35, 8},
+    {33, 16, 386, -35, 6},
+    {0, 27, 524, -35, 1},
+    {28, 10, 236, -34, 1},
+    {0, 23, 482, -35, 1},
+    {24, 21, 447, -35, 6},
+    {46, 9, 168, -35, 1},
+    {0, 28, 560, -35, 1},
+    {29, 13, 234, -35, 6},
+    {0, 30, 579, -35, 8},
+    {31, 31, 624, -35, 1},
+    {63, 33, 636, -35, 1}
+};
+
+const QuestionLayout QUESTION_LAYOUTS[] PROGMEM = {
+    {0, 1, 0},
+    {1, 1, 0},
+    {2, 1, 0},
+    {3, 1, 0},
+    {4, 1, 0},
+    {5, 2, 0},
+    {7, 2, 0},
+    {9, 2, 0},
+    {11, 2, 0},
+    {13, 2, 0},
+    {15, 1, 0},
+    {16, 2, 0},
+    {18, 1, 0},
+    {19, 2, 0},
+    {21, 1, 0},
+    {22, 2, 0},
+    {24, 1, 0},
+    {25, 1, 0},
+    {26, 1, 0},
+    {27, 2, 0},
+    {29, 2, 0},
+    {31, 1, 0},
+    {32, 3, 0},
+    {35, 2, 0},
+    {37, 2, 0},
+    {39, 1, 0},
+    {40, 2, 0},
+    {42, 2, 0},
+    {44, 2, 0},
+    {46, 2, 0},
+    {48, 2, 0},
+    {50, 1, 0},
+    {51, 1, 0},
+    {52, 3, 0},
+    {55, 2, 0},
+    {57, 2, 0},
+    {59, 2, 0},
+    {61, 1, 0},
+    {62, 1, 0},
+    {63, 2, 0},
+    {65, 2, 0},
+    {67, 2, 0},
+    {69, 2, 0},
+    {71, 2, 0},
+    {73, 2, 0},
+    {75, 2, 0},
+    {77, 4, 0},
+    {81, 2, 0},
+    {83, 1, 0},
+    {84, 2, 0},
+    {86, 2, 0},
+    {88, 2, 0},
+    {90, 3, 0},
+    {93, 2, 0},
+    {95, 2, 0},
+    {97, 2, 0},
+    {99, 2, 0},
+    {101, 2, 0},
+    {103, 2, 0},
+    {105, 2, 0},
+    {107, 2, 0},
+    {109, 3, 0},
+    {112, 3, 0},
+    {115, 2, 0},
+    {117, 3, 0},
+    {120, 2, 0},
+    {122, 1, 0},
+    {123, 2, 0},
+    {125, 4, 0},
+    {129, 3, 0},
+    {132, 3, 0},
+    {135, 3, 0},
+    {138, 2, 0},
+    {140, 2, 0},
+    {142, 2, 0},
+    {144, 3, 0},
+    {147, 3, 0},
+    {150, 2, 0},
+    {152, 2, 0},
+    {154, 3, 0},
+    {157, 2, 0},
+    {159, 1, 0},
+    {160, 1, 0},
+    {161, 2, 0},
+    {163, 2, 0},
+    {165, 3, 0},
+    {168, 2, 0},
+    {170, 1, 0},
+    {171, 2, 0},
+    {173, 1, 0},
+    {174, 1, 0},
+    {175, 2, 0},
+    {177, 2, 0},
+    {179, 2, 0},
+    {181, 1, 0},
+    {182, 2, 0},
+    {184, 2, 0},
+    {186, 2, 0},
+    {188, 2, 0},
+    {190, 2, 0},
+    {192, 2, 0},
+    {194, 2, 0},
+    {196, 2, 0},
+    {198, 1, 0},
+    {199, 2, 0},
+    {201, 2, 0},
+    {203, 1, 0},
+    {204, 2, 0},
+    {206, 3, 0},
+    {209, 3, 0},
+    {212, 2, 0},
+    {214, 2, 0},
+    {216, 3, 0},
+    {219, 2, 0},
+    {221, 2, 0},
+    {223, 2, 0},
+    {225, 2, 0},
+    {227, 2, 0},
+    {229, 2, 0},
+    {231, 3, 0},
+    {234, 2, 0},
+    {236, 2, 0},
+    {238, 2, 0},
+    {240, 1, 0},
+    {241, 1, 0},
+    {242, 2, 0},
+    {244, 1, 0},
+    {245, 2, 0},
+    {247, 1, 0},
+    {248, 1, 0},
+    {249, 1, 0},
+    {250, 1, 0},
+    {251, 2, 0},
+    {253, 2, 0},
+    {255, 2, 0},
+    {257, 1, 0},
+    {258, 2, 0},
+    {260, 2, 0},
+    {262, 2, 0},
+    {264, 2, 0},
+    {266, 2, 0},
+    {268, 2, 0},
+    {270, 1, 0},
+    {271, 2, 0},
+    {273, 1, 0},
+    {274, 1, 0},
+    {275, 2, 0},
+    {277, 2, 0},
+    {279, 2, 0},
+    {281, 3, 0},
+    {284, 1, 0},
+    {285, 2, 0},
+    {287, 2, 0},
+    {289, 2, 0},
+    {291, 1, 0},
+    {292, 1, 0},
+    {293, 1, 0},
+    {294, 2, 0},
+    {296, 2, 0},
+    {298, 2, 0},
+    {300, 3, 0},
+    {303, 2, 0},
+    {305, 2, 0},
+    {307, 3, 0},
+    {310, 3, 0},
+    {313, 2, 0},
+    {315, 2, 0},
+    {317, 2, 0},
+    {319, 2, 0},
+    {321, 2, 0},
+    {323, 4, 0},
+    {327, 2, 0},
+    {329, 2, 0},
+    {331, 3, 0},
+    {334, 2, 0},
+    {336, 2, 0},
+    {338, 3, 0},
+    {341, 2, 0},
+    {343, 2, 0},
+    {345, 2, 0},
+    {347, 3, 0},
+    {350, 2, 0},
+    {352, 3, 0},
+    {355, 3, 0},
+    {358, 3, 0},
+    {361, 2, 0},
+    {363, 1, 0},
+    {364, 2, 0},
+    {366, 2, 0},
+    {368, 2, 0},
+    {370, 2, 0},
+    {372, 2, 0},
+    {374, 2, 0},
+    {376, 3, 0},
+    {379, 2, 0},
+    {381, 2, 0},
+    {383, 3, 0},
+    {386, 2, 0},
+    {388, 2, 0},
+    {390, 3, 0},
+    {393, 2, 0},
+    {395, 2, 0},
+    {397, 2, 0},
+    {399, 2, 0},
+    {401, 1, 0},
+    {402, 2, 0},
+    {404, 2, 0},
+    {406, 2, 0},
+    {408, 2, 0},
+    {410, 1, 0},
+    {411, 2, 0},
+    {413, 2, 0},
+    {415, 2, 0},
+    {417, 2, 0},
+    {419, 2, 0},
+    {421, 2, 0},
+    {423, 1, 0},
+    {424, 1, 0},
+    {425, 2, 0},
+    {427, 1, 0},
+    {428, 2, 0},
+    {430, 2, 0},
+    {432, 3, 0},
+    {435, 2, 0},
+    {437, 3, 0},
+    {440, 2, 0},
+    {442, 2, 0},
+    {444, 2, 0},
+    {446, 2, 0},
+    {448, 2, 0},
+    {450, 2, 0},
+    {452, 1, 0},
+    {453, 1, 0},
+    {454, 2, 0},
+    {456, 2, 0},
+    {458, 2, 0},
+    {460, 3, 0},
+    {463, 2, 0},
+    {465, 2, 0},
+    {467, 2, 0},
+    {469, 2, 0},
+    {471, 2, 0},
+    {473, 4, 0},
+    {477, 2, 0},
+    {479, 2, 0},
+    {481, 2, 0},
+    {483, 3, 0},
+    {486, 2, 0},
+    {488, 3, 0},
+    {491, 3, 0},
+    {494, 3, 0},
+    {497, 2, 0},
+    {499, 2, 0},
+    {501, 2, 0},
+    {503, 2, 0},
+    {505, 3, 0},
+    {508, 3, 0},
+    {511, 3, 0},
+    {514, 3, 0},
+    {517, 3, 0},
+    {520, 3, 0},
+    {523, 2, 0},
+    {525, 2, 0},
+    {527, 3, 0},
+    {530, 2, 0},
+    {532, 3, 0},
+    {535, 3, 0},
+    {538, 2, 0},
+    {540, 2, 0},
+    {542, 3, 0},
+    {545, 3, 0},
+    {548, 3, 0},
+    {551, 3, 0},
+    {554, 3, 0},
+    {557, 3, 0},
+    {560, 3, 0},
+    {563, 3, 0},
+    {566, 3, 0},
+    {569, 4, 0},
+    {573, 3, 0},
+    {576, 2, 0},
+    {578, 3, 0},
+    {581, 3, 0},
+    {584, 2, 0},
+    {586, 3, 0},
+    {589, 2, 0},
+    {591, 2, 0},
+    {593, 2, 0},
+    {595, 3, 0},
+    {598, 3, 0},
+    {601, 3, 0},
+    {604, 2, 0},
+    {606, 3, 0},
+    {609, 2, 0},
+    {611, 3, 0},
+    {614, 3, 0},
+    {617, 2, 0},
+    {619, 2, 0},
+    {621, 2, 0},
+    {623, 2, 0},
+    {625, 2, 0},
+    {627, 3, 0},
+    {630, 2, 0},
+    {632, 2, 0},
+    {634, 2, 0},
+    {636, 2, 0},
+    {638, 3, 0},
+    {641, 2, 0},
+    {643, 2, 0},
+    {645, 2, 0},
+    {647, 1, 0},
+    {648, 2, 0},
+    {650, 2, 0},
+    {652, 2, 0},
+    {654, 2, 0},
+    {656, 2, 0},
+    {658, 2, 0},
+    {660, 3, 0},
+    {663, 2, 0},
+    {665, 3, 0}
+};
+
 const int QUESTION_COUNT = sizeof(QUESTIONS) / sizeof(QUESTIONS[0]);
 
 // =============================================================================
@@ -383,6 +1409,14 @@ inline const char *getQuestionCategory(int index)
   return (const char*)pgm_read_ptr(&CATEGORY_NAMES[cat]);
 }
 
+// Get precomputed layout by index (nullptr if out of range)
+inline const QuestionLayout *getQuestionLayout(int index)
+{
+  if (index < 0 || index >= QUESTION_COUNT)
+    return nullptr;
+  return &QUESTION_LAYOUTS[index];
+}
+
 // Get total number of questions
 inline int getQuestionCount()
 {
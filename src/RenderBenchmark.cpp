@@ -0,0 +1,1424 @@
+#ifdef RENDER_BENCHMARK
+
+#include "RenderBenchmark.h"
+#include "config.h"
+#include "Chrome.h"
+#include "DeckFonts.h"
+#include "DirtyRegion.h"
+#include "GhostingTracker.h"
+#include "GlyphCache.h"
+#include "Images.h"
+#include "Lexend_Bold18pt7b_rle.h"
+#include "Lexend_Bold18pt7b_sparse.h"
+#include "Lexend_Bold24pt7b_rle.h"
+#include "Lexend_Bold24pt7b_sparse.h"
+#include "Lexend_Light22pt7b_rle.h"
+#include "Lexend_Light22pt7b_sparse.h"
+#include "Lexend_Light28pt7b_rle.h"
+#include "Lexend_Light28pt7b_sparse.h"
+#include "Lexend_Light40pt7b.h"
+#include "Lexend_Light40pt7b_rle.h"
+#include "Lexend_Light40pt7b_sparse.h"
+#include "image.h"
+#include "logo.h"
+#include "Prerenderer.h"
+#include "QuestionLayout.h"
+#include "Questions.h"
+#include "Utf8GfxHelper.h"
+
+// Band height used to emulate a small page buffer (8 pages for 480 rows)
+static const uint16_t BAND_HEIGHT = 60;
+
+// Every deck font in both bitmap encodings
+struct EncodedFont
+{
+  const char *name;
+  const GFXfont *packed;
+  const GFXfont *rle;
+  uint32_t packedBytes;
+  uint32_t rleBytes;
+};
+
+static const EncodedFont ENCODED_FONTS[] = {
+    {"Lexend_Light40pt7b", &Lexend_Light40pt7b_sparse.font, &Lexend_Light40pt7b_rle.font,
+     sizeof(Lexend_Light40pt7b_sparseBitmaps), sizeof(Lexend_Light40pt7b_rleBitmaps)},
+    {"Lexend_Light28pt7b", &Lexend_Light28pt7b_sparse.font, &Lexend_Light28pt7b_rle.font,
+     sizeof(Lexend_Light28pt7b_sparseBitmaps), sizeof(Lexend_Light28pt7b_rleBitmaps)},
+    {"Lexend_Light22pt7b", &Lexend_Light22pt7b_sparse.font, &Lexend_Light22pt7b_rle.font,
+     sizeof(Lexend_Light22pt7b_sparseBitmaps), sizeof(Lexend_Light22pt7b_rleBitmaps)},
+    {"Lexend_Bold24pt7b", &Lexend_Bold24pt7b_sparse.font, &Lexend_Bold24pt7b_rle.font,
+     sizeof(Lexend_Bold24pt7b_sparseBitmaps), sizeof(Lexend_Bold24pt7b_rleBitmaps)},
+    {"Lexend_Bold18pt7b", &Lexend_Bold18pt7b_sparse.font, &Lexend_Bold18pt7b_rle.font,
+     sizeof(Lexend_Bold18pt7b_sparseBitmaps), sizeof(Lexend_Bold18pt7b_rleBitmaps)},
+};
+
+// FNV-1a over the active page buffer, used to check both paths draw the same pixels.
+// Hashing consecutive bands with the previous result as seed equals hashing the whole frame.
+
+static uint32_t bufferHash(PagedCanvas &canvas, uint32_t hash = 2166136261UL)
+{
+  const uint8_t *p = canvas.pageBuffer();
+  uint32_t bytes = canvas.pageBufferSize() / canvas.pageHeight() * canvas.pageRows();
+  for (uint32_t i = 0; i < bytes; i++)
+  {
+    hash = (hash ^ p[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+// Question text through the per-pixel drawPixel() path vs the byte-wise glyph blitter.
+// The text is laid out once beforehand so that only glyph drawing is timed.
+static void benchmarkGlyphBlitter(PagedCanvas &canvas)
+{
+  uint32_t pixelTime = 0;
+  uint32_t blitTime = 0;
+  int mismatches = 0;
+  static Utf8TextLayout layout;
+
+  for (int i = 0; i < getQuestionCount(); i++)
+  {
+    layoutUtf8Text(layout, QUESTION_FONT, getQuestionText(i), 400, 210, 640, 280);
+
+    canvas.fillScreen(GxEPD_WHITE);
+    unsigned long start = micros();
+    drawUtf8Layout(static_cast<Adafruit_GFX &>(canvas), layout, GxEPD_BLACK);
+    pixelTime += micros() - start;
+    uint32_t expected = bufferHash(canvas);
+
+    canvas.fillScreen(GxEPD_WHITE);
+    start = micros();
+    drawUtf8Layout(canvas, layout, GxEPD_BLACK);
+    blitTime += micros() - start;
+
+    if (bufferHash(canvas) != expected)
+    {
+      mismatches++;
+      Serial.printf("  mismatch at question %d\n", i);
+    }
+  }
+
+  Serial.printf("Glyph blitter, %d questions (question font):\n", getQuestionCount());
+  Serial.printf("  drawPixel path: %lu us total, %lu us/question\n",
+                (unsigned long)pixelTime, (unsigned long)(pixelTime / getQuestionCount()));
+  Serial.printf("  blitter path:   %lu us total, %lu us/question\n",
+                (unsigned long)blitTime, (unsigned long)(blitTime / getQuestionCount()));
+  Serial.printf("  speedup: %.2fx, mismatches: %d\n",
+                blitTime ? (double)pixelTime / blitTime : 0.0, mismatches);
+}
+
+// Wrap + measure + draw on every page pass vs one layoutUtf8Text() replayed per pass.
+// A paged partial refresh runs every page twice (fast partial update), a single page once.
+static void benchmarkTextLayout(PagedCanvas &canvas)
+{
+  const int PAGE_PASSES = (canvas.pages() > 1) ? 2 * canvas.pages() : 1;
+
+  uint32_t wrappedTime = 0;
+  uint32_t layoutTime = 0;
+  uint32_t replayTime = 0;
+  int mismatches = 0;
+  static Utf8TextLayout layout;
+
+  for (int i = 0; i < getQuestionCount(); i++)
+  {
+    const char *text = getQuestionText(i);
+
+    unsigned long start = micros();
+    for (int pass = 0; pass < PAGE_PASSES; pass++)
+    {
+      canvas.selectPage(pass % canvas.pages());
+      canvas.fillScreen(GxEPD_WHITE);
+      drawUtf8MultiLineWrapped(canvas, QUESTION_FONT, text, 400, 210, 640, 280, GxEPD_BLACK);
+    }
+    wrappedTime += micros() - start;
+    uint32_t expected = bufferHash(canvas);
+
+    start = micros();
+    layoutUtf8Text(layout, QUESTION_FONT, text, 400, 210, 640, 280);
+    unsigned long laidOut = micros();
+    for (int pass = 0; pass < PAGE_PASSES; pass++)
+    {
+      canvas.selectPage(pass % canvas.pages());
+      canvas.fillScreen(GxEPD_WHITE);
+      drawUtf8Layout(canvas, layout, GxEPD_BLACK);
+    }
+    layoutTime += laidOut - start;
+    replayTime += micros() - laidOut;
+
+    if (bufferHash(canvas) != expected)
+    {
+      mismatches++;
+      Serial.printf("  layout mismatch at question %d\n", i);
+    }
+  }
+
+  canvas.selectPage(0);
+
+  int n = getQuestionCount();
+  Serial.printf("Text layout, %d questions x %d page passes:\n", n, PAGE_PASSES);
+  Serial.printf("  wrap+draw, all passes:     %lu us/question\n", (unsigned long)(wrappedTime / n));
+  Serial.printf("  layout once:               %lu us/question\n", (unsigned long)(layoutTime / n));
+  Serial.printf("  layout replay, all passes: %lu us/question\n", (unsigned long)(replayTime / n));
+  Serial.printf("  speedup: %.2fx, mismatches: %d\n",
+                (layoutTime + replayTime) ? (double)wrappedTime / (layoutTime + replayTime) : 0.0, mismatches);
+}
+
+// Same shapes and text as the full question screen in main.cpp
+static void drawQuestionScreen(PagedCanvas &canvas, const Utf8TextLayout &layout, const char *category,
+                               bool pixelText)
+{
+  canvas.fillScreen(GxEPD_WHITE);
+  if (utf8AreaVisible(canvas, 50, 50, 700, 320))
+  {
+    for (int i = 0; i < 5; i++)
+    {
+      canvas.drawRoundRect(50 + i, 50 + i, 700 - i * 2, 320 - i * 2, 20, GxEPD_BLACK);
+    }
+  }
+  if (pixelText)
+    drawUtf8Layout(static_cast<Adafruit_GFX &>(canvas), layout, GxEPD_BLACK);
+  else
+    drawUtf8Layout(canvas, layout, GxEPD_BLACK);
+  if (utf8AreaVisible(canvas, 250, 400, 300, 50))
+  {
+    canvas.fillRoundRect(250, 400, 300, 50, 10, GxEPD_BLACK);
+    drawUtf8StringCentered(canvas, BANNER_FONT, category, 400, 435, GxEPD_WHITE);
+  }
+}
+
+// Whole question screen: one full-frame pass vs page bands with and without culling
+static void benchmarkPageBands(PagedCanvas &canvas, PagedCanvas &band)
+{
+  uint32_t frameTime = 0;
+  uint32_t culledTime = 0;
+  uint32_t pixelTime = 0;
+  int mismatches = 0;
+  static Utf8TextLayout layout;
+
+  for (int i = 0; i < getQuestionCount(); i++)
+  {
+    layoutUtf8Text(layout, QUESTION_FONT, getQuestionText(i), 400, 210, 640, 280);
+    const char *category = getQuestionCategory(i);
+
+    unsigned long start = micros();
+    drawQuestionScreen(canvas, layout, category, false);
+    frameTime += micros() - start;
+    uint32_t expected = bufferHash(canvas);
+
+    uint32_t hash = 2166136261UL;
+    start = micros();
+    for (uint16_t page = 0; page < band.pages(); page++)
+    {
+      band.selectPage(page);
+      drawQuestionScreen(band, layout, category, false);
+      hash = bufferHash(band, hash);
+    }
+    culledTime += micros() - start;
+
+    start = micros();
+    for (uint16_t page = 0; page < band.pages(); page++)
+    {
+      band.selectPage(page);
+      drawQuestionScreen(band, layout, category, true);
+    }
+    pixelTime += micros() - start;
+
+    if (hash != expected)
+    {
+      mismatches++;
+      Serial.printf("  band mismatch at question %d\n", i);
+    }
+  }
+
+  int n = getQuestionCount();
+  Serial.printf("Question screen, %d questions, %u-row bands (%u pages):\n", n, band.pageHeight(), band.pages());
+  Serial.printf("  full frame, 1 pass:        %lu us/question\n", (unsigned long)(frameTime / n));
+  Serial.printf("  bands, culled blitter:     %lu us/question\n", (unsigned long)(culledTime / n));
+  Serial.printf("  bands, drawPixel text:     %lu us/question\n", (unsigned long)(pixelTime / n));
+  Serial.printf("  band overhead: %.2fx of full frame, mismatches: %d\n",
+                frameTime ? (double)culledTime / frameTime : 0.0, mismatches);
+}
+
+// Glyph lookup for every character of every question: dense codepoint - first vs sparse binary search
+static void benchmarkGlyphLookup()
+{
+  const GFXfont *dense = &Lexend_Light40pt7b;
+  const GFXfont *sparse = &Lexend_Light40pt7b_sparse.font;
+  uint16_t denseLast = pgm_read_word(&dense->last);
+  uint32_t denseTime = 0;
+  uint32_t sparseTime = 0;
+  uint32_t lookups = 0;
+  uint32_t denseSum = 0;
+  uint32_t sparseSum = 0;
+  int mismatches = 0;
+
+  for (int i = 0; i < getQuestionCount(); i++)
+  {
+    const char *text = getQuestionText(i);
+
+    unsigned long start = micros();
+    for (const char *p = text; *p;)
+    {
+      uint32_t codepoint;
+      p += decodeUtf8Char(p, codepoint);
+      const GFXglyph *glyph = getFontGlyph(dense, codepoint);
+      if (glyph)
+        denseSum += pgm_read_byte(&glyph->xAdvance);
+    }
+    denseTime += micros() - start;
+
+    start = micros();
+    for (const char *p = text; *p;)
+    {
+      uint32_t codepoint;
+      p += decodeUtf8Char(p, codepoint);
+      const GFXglyph *glyph = getFontGlyph(sparse, codepoint);
+      // Stand-ins for characters the dense font lacks (curly quotes) are left out of the comparison
+      if (glyph && codepoint <= denseLast)
+        sparseSum += pgm_read_byte(&glyph->xAdvance);
+      lookups++;
+    }
+    sparseTime += micros() - start;
+  }
+
+  // Both formats must describe the same glyphs
+  for (uint16_t codepoint = 0x20; codepoint <= 0x17F; codepoint++)
+  {
+    const GFXglyph *d = getFontGlyph(dense, codepoint);
+    const GFXglyph *s = getFontGlyph(sparse, codepoint);
+    if (s && (pgm_read_byte(&d->width) != pgm_read_byte(&s->width) ||
+              pgm_read_byte(&d->height) != pgm_read_byte(&s->height) ||
+              pgm_read_byte(&d->xAdvance) != pgm_read_byte(&s->xAdvance)))
+    {
+      mismatches++;
+    }
+  }
+
+  Serial.printf("Glyph lookup, %lu lookups (Lexend_Light40pt7b):\n", (unsigned long)lookups);
+  Serial.printf("  dense:  %lu us\n", (unsigned long)denseTime);
+  Serial.printf("  sparse: %lu us (%.2fx of dense)\n", (unsigned long)sparseTime,
+                denseTime ? (double)sparseTime / denseTime : 0.0);
+  Serial.printf("  width sums %s, glyph mismatches: %d\n", denseSum == sparseSum ? "match" : "DIFFER", mismatches);
+}
+
+// Mixed-script text for the decoder benchmark: 1-4 byte sequences plus a few invalid bytes
+static const char *const DECODE_CORPUS[] = {
+    "Příliš žluťoučký kůň úpěl ďábelské ódy.",
+    "The quick brown fox jumps over the lazy dog 0123456789",
+    "Ξεσκεπάζω την ψυχοφθόρα βδελυγμία.",
+    "Съешь же ещё этих мягких французских булок, да выпей чаю.",
+    "いろはにほへと ちりぬるを 色は匂へど 散りぬるを",
+    "😀 🎲 🃏 ❤️ ✨ 🚀 𝄞 𐍈",
+    "Bad: \xC0\xAF \xED\xA0\x80 \xF5\x80 \xE2\x82 end",
+};
+
+// Decoder before the rewrite: branch chain, 16-bit result, no range checks, 4-byte sequences as '?'
+static uint8_t decodeUtf8CharBranchy(const char *str, uint16_t &codepoint)
+{
+  uint8_t c = (uint8_t)*str;
+  if ((c & 0x80) == 0)
+  {
+    codepoint = c;
+    return 1;
+  }
+  if ((c & 0xE0) == 0xC0)
+  {
+    uint8_t c2 = (uint8_t)str[1];
+    if ((c2 & 0xC0) == 0x80)
+    {
+      codepoint = ((c & 0x1F) << 6) | (c2 & 0x3F);
+      return 2;
+    }
+  }
+  if ((c & 0xF0) == 0xE0)
+  {
+    uint8_t c2 = (uint8_t)str[1];
+    uint8_t c3 = (uint8_t)str[2];
+    if ((c2 & 0xC0) == 0x80 && (c3 & 0xC0) == 0x80)
+    {
+      codepoint = ((c & 0x0F) << 12) | ((c2 & 0x3F) << 6) | (c3 & 0x3F);
+      return 3;
+    }
+  }
+  codepoint = '?';
+  return 1;
+}
+
+// Decode every deck string and the mixed-script corpus: old branch chain vs decodeUtf8Char() vs bulk decode,
+// each timed over whole passes, best of 5
+static void benchmarkUtf8Decode()
+{
+  const int RUNS = 25;
+  const int DECK_PASSES = 20;
+  const int CORPUS_PASSES = 1000;
+  const int CORPUS_SIZE = sizeof(DECODE_CORPUS) / sizeof(DECODE_CORPUS[0]);
+  static uint32_t buffer[128];
+
+  for (int corpus = 0; corpus < 2; corpus++)
+  {
+    int strings = corpus ? CORPUS_SIZE * CORPUS_PASSES : getQuestionCount() * DECK_PASSES;
+    uint32_t branchyTime = UINT32_MAX;
+    uint32_t charTime = UINT32_MAX;
+    uint32_t bulkTime = UINT32_MAX;
+    uint32_t chars = 0;
+    uint32_t branchySum = 0;
+    uint32_t charSum = 0;
+    uint32_t bulkSum = 0;
+
+    for (int run = 0; run < RUNS; run++)
+    {
+      branchySum = charSum = bulkSum = chars = 0;
+
+      unsigned long start = micros();
+      for (int i = 0; i < strings; i++)
+      {
+        const char *text = corpus ? DECODE_CORPUS[i % CORPUS_SIZE] : getQuestionText(i % getQuestionCount());
+        for (const char *p = text; *p;)
+        {
+          uint16_t codepoint;
+          p += decodeUtf8CharBranchy(p, codepoint);
+          branchySum += codepoint;
+        }
+      }
+      branchyTime = min(branchyTime, (uint32_t)(micros() - start));
+
+      start = micros();
+      for (int i = 0; i < strings; i++)
+      {
+        const char *text = corpus ? DECODE_CORPUS[i % CORPUS_SIZE] : getQuestionText(i % getQuestionCount());
+        for (const char *p = text; *p;)
+        {
+          uint32_t codepoint;
+          p += decodeUtf8Char(p, codepoint);
+          charSum += codepoint;
+        }
+      }
+      charTime = min(charTime, (uint32_t)(micros() - start));
+
+      start = micros();
+      for (int i = 0; i < strings; i++)
+      {
+        const char *text = corpus ? DECODE_CORPUS[i % CORPUS_SIZE] : getQuestionText(i % getQuestionCount());
+        for (const char *p = text; *p;)
+        {
+          uint16_t n = decodeUtf8(p, buffer, sizeof(buffer) / sizeof(buffer[0]), &p);
+          for (uint16_t k = 0; k < n; k++)
+            bulkSum += buffer[k];
+          chars += n;
+        }
+      }
+      bulkTime = min(bulkTime, (uint32_t)(micros() - start));
+    }
+
+    Serial.printf("UTF-8 decode, %s (%lu codepoints, best of %d):\n", corpus ? "mixed-script corpus" : "deck",
+                  (unsigned long)chars, RUNS);
+    Serial.printf("  branch chain:   %lu us\n", (unsigned long)branchyTime);
+    Serial.printf("  decodeUtf8Char: %lu us (%.2fx)\n", (unsigned long)charTime,
+                  charTime ? (double)branchyTime / charTime : 0.0);
+    Serial.printf("  decodeUtf8:     %lu us (%.2fx)\n", (unsigned long)bulkTime,
+                  bulkTime ? (double)branchyTime / bulkTime : 0.0);
+    // The deck has no 4-byte or invalid sequences, so all decoders must agree there
+    Serial.printf("  single and bulk %s%s\n", charSum == bulkSum ? "agree" : "DIFFER",
+                  corpus ? "" : (branchySum == charSum ? ", branch chain agrees" : ", branch chain DIFFERS"));
+  }
+}
+
+// Runtime wrap + measure vs loading the layout precomputed by convert_csv.py
+static void benchmarkPrecomputedLayout()
+{
+  static Utf8TextLayout runtime;
+  static Utf8TextLayout precomputed;
+  uint32_t runtimeTime = 0;
+  uint32_t loadTime = 0;
+  int mismatches = 0;
+
+  for (int i = 0; i < getQuestionCount(); i++)
+  {
+    unsigned long start = micros();
+    loadQuestionLayout(precomputed, i);
+    loadTime += micros() - start;
+
+    start = micros();
+    layoutUtf8Text(runtime, precomputed.font, getQuestionText(i), QUESTION_BOX_CENTER_X, QUESTION_BOX_CENTER_Y,
+                   QUESTION_BOX_WIDTH, QUESTION_BOX_HEIGHT);
+    runtimeTime += micros() - start;
+
+    bool same = runtime.lineCount == precomputed.lineCount;
+    for (uint8_t l = 0; same && l < runtime.lineCount; l++)
+    {
+      const Utf8LayoutLine &a = runtime.lines[l];
+      const Utf8LayoutLine &b = precomputed.lines[l];
+      same = a.start == b.start && a.length == b.length && a.width == b.width && a.x == b.x &&
+             a.baseline == b.baseline && a.top == b.top && a.bottom == b.bottom;
+    }
+    if (!same)
+      mismatches++;
+  }
+
+  Serial.printf("Precomputed layout, %d questions:\n", getQuestionCount());
+  Serial.printf("  runtime wrap+measure: %lu us total\n", (unsigned long)runtimeTime);
+  Serial.printf("  load precomputed:     %lu us total\n", (unsigned long)loadTime);
+  Serial.printf("  speedup: %.2fx, mismatches: %d\n", loadTime ? (double)runtimeTime / loadTime : 0.0, mismatches);
+}
+
+// Runtime font fitting: try every size largest first vs binary search with metrics, cold and from the kept lines
+static void benchmarkFontFitting()
+{
+  static Utf8TextLayout layout;
+  static Utf8TextLayout cold;
+  static Utf8TextLayout precomputed;
+  uint32_t linearTime = 0;
+  uint32_t coldTime = 0;
+  uint32_t warmTime = 0;
+  int mismatches = 0;
+
+  memset(&fittedQuestionLayouts(), 0, sizeof(FittedQuestionLayouts));
+
+  for (int i = 0; i < getQuestionCount(); i++)
+  {
+    const char *text = getQuestionText(i);
+
+    unsigned long start = micros();
+    uint8_t linearFont = 0;
+    for (; linearFont < QUESTION_FONT_COUNT; linearFont++)
+    {
+      layoutUtf8Text(layout, QUESTION_FONTS[linearFont], text, QUESTION_BOX_CENTER_X, QUESTION_BOX_CENTER_Y,
+                     QUESTION_BOX_WIDTH, QUESTION_BOX_HEIGHT);
+      if (utf8LayoutComplete(layout))
+        break;
+    }
+    linearTime += micros() - start;
+
+    start = micros();
+    fitQuestionLayout(cold, i);
+    coldTime += micros() - start;
+
+    start = micros();
+    fitQuestionLayout(layout, i);
+    warmTime += micros() - start;
+
+    // A repeat visit must give the layout the first one did
+    if (layout.font != cold.font || layout.lineCount != cold.lineCount ||
+        memcmp(layout.lines, cold.lines, layout.lineCount * sizeof(Utf8LayoutLine)))
+      mismatches++;
+
+    // Must agree with the linear search and with the layout chosen by convert_csv.py
+    loadQuestionLayout(precomputed, i);
+    if (linearFont < QUESTION_FONT_COUNT && layout.font != QUESTION_FONTS[linearFont])
+      mismatches++;
+    if (layout.font != precomputed.font || layout.lineCount != precomputed.lineCount)
+      mismatches++;
+  }
+
+  Serial.printf("Font fitting, %d questions, %d sizes:\n", getQuestionCount(), QUESTION_FONT_COUNT);
+  Serial.printf("  linear, full layouts: %lu us total\n", (unsigned long)linearTime);
+  Serial.printf("  binary search, cold:  %lu us total\n", (unsigned long)coldTime);
+  Serial.printf("  kept lines, warm:     %lu us total\n", (unsigned long)warmTime);
+  Serial.printf("  mismatches: %d\n", mismatches);
+}
+
+// Partial window of a same-category page turn: fixed question area vs union of outgoing and incoming text
+static void benchmarkDirtyRegion()
+{
+  static Utf8TextLayout layout;
+  // Old setPartialWindow(60, 60, 675, 295); x 60..735 is widened to 56..736 for the controller
+  const uint32_t fixedBytes = (uint32_t)(680 / 8) * 295;
+  uint32_t dirtyBytes = 0;
+  uint32_t maxBytes = 0;
+  unsigned long measureTime = 0;
+
+  DirtyRegion previous;
+  for (int i = 0; i <= getQuestionCount(); i++)
+  {
+    loadQuestionLayout(layout, i % getQuestionCount());
+    unsigned long start = micros();
+    DirtyRegion incoming;
+    int16_t x, y, w, h;
+    if (getUtf8LayoutBounds(layout, x, y, w, h))
+      incoming.add(x, y, w, h);
+    DirtyRegion dirty = previous;
+    dirty.add(incoming);
+    dirty.alignX(8);
+    measureTime += micros() - start;
+
+    if (i > 0)
+    {
+      uint32_t bytes = (uint32_t)(dirty.width() / 8) * dirty.height();
+      dirtyBytes += bytes;
+      if (bytes > maxBytes)
+        maxBytes = bytes;
+    }
+    previous = incoming;
+  }
+
+  Serial.printf("Dirty region, %d page turns:\n", getQuestionCount());
+  Serial.printf("  fixed window: %lu B per refresh\n", (unsigned long)fixedBytes);
+  Serial.printf("  dirty window: %lu B average, %lu B max (%.2fx less), %lu us to measure\n",
+                (unsigned long)(dirtyBytes / getQuestionCount()), (unsigned long)maxBytes,
+                dirtyBytes ? (double)fixedBytes * getQuestionCount() / dirtyBytes : 0.0, (unsigned long)measureTime);
+}
+
+// Packed vs run-length encoded glyph bitmaps: flash size against blit time, per font
+static void benchmarkRleGlyphs(PagedCanvas &canvas, PagedCanvas &band)
+{
+  static Utf8TextLayout packedLayout;
+  static Utf8TextLayout rleLayout;
+
+  Serial.printf("Glyph encoding, %d questions per font:\n", getQuestionCount());
+  Serial.printf("  %-20s %8s %8s %10s %10s %6s %6s\n", "font", "packed B", "RLE B", "packed us", "RLE us",
+                "cost", "diff");
+
+  for (const EncodedFont &f : ENCODED_FONTS)
+  {
+    uint32_t packedTime = 0;
+    uint32_t rleTime = 0;
+    int mismatches = 0;
+
+    for (int i = 0; i < getQuestionCount(); i++)
+    {
+      layoutUtf8Text(packedLayout, f.packed, getQuestionText(i), 400, 210, 640, 280);
+      layoutUtf8Text(rleLayout, f.rle, getQuestionText(i), 400, 210, 640, 280);
+
+      canvas.fillScreen(GxEPD_WHITE);
+      unsigned long start = micros();
+      drawUtf8Layout(canvas, packedLayout, GxEPD_BLACK);
+      packedTime += micros() - start;
+      uint32_t packedHash = bufferHash(canvas);
+
+      canvas.fillScreen(GxEPD_WHITE);
+      start = micros();
+      drawUtf8Layout(canvas, rleLayout, GxEPD_BLACK);
+      rleTime += micros() - start;
+      if (bufferHash(canvas) != packedHash)
+        mismatches++;
+
+      // Band rendering stops decoding below the band; it must still match
+      uint32_t bandHash = 2166136261UL;
+      for (uint16_t page = 0; page < band.pages(); page++)
+      {
+        band.selectPage(page);
+        band.fillScreen(GxEPD_WHITE);
+        drawUtf8Layout(band, rleLayout, GxEPD_BLACK);
+        bandHash = bufferHash(band, bandHash);
+      }
+      band.selectPage(0);
+      if (bandHash != packedHash)
+        mismatches++;
+    }
+
+    Serial.printf("  %-20s %8lu %8lu %10lu %10lu %5.2fx %6d\n", f.name, (unsigned long)f.packedBytes,
+                  (unsigned long)f.rleBytes, (unsigned long)packedTime, (unsigned long)rleTime,
+                  packedTime ? (double)rleTime / packedTime : 0.0, mismatches);
+  }
+}
+
+// Render every question band by band from flash vs from a GlyphCache (cold at the start of each font)
+static void benchmarkGlyphCache(PagedCanvas &band)
+{
+  static GlyphCache cache;
+  static Utf8TextLayout layout;
+
+  Serial.printf("Glyph cache (%u entries, %u B of rows), %d questions in %u bands:\n",
+                (unsigned)GLYPH_CACHE_ENTRIES, (unsigned)GLYPH_CACHE_BYTES, getQuestionCount(), band.pages());
+  Serial.printf("  %-24s %10s %10s %8s %8s %8s %8s %8s %6s\n", "font", "flash us", "cache us", "speedup", "hits",
+                "misses", "hit rate", "unpacks", "diff");
+
+  for (int e = 0; e < 2; e++)
+  {
+    const EncodedFont &f = ENCODED_FONTS[0];
+    const GFXfont *font = e ? f.rle : f.packed;
+    uint32_t flashTime = 0;
+    uint32_t cacheTime = 0;
+    int mismatches = 0;
+    cache.clear();
+    cache.resetStats();
+
+    for (int i = 0; i < getQuestionCount(); i++)
+    {
+      layoutUtf8Text(layout, font, getQuestionText(i), 400, 210, 640, 280);
+
+      uint32_t flashHash = 2166136261UL;
+      uint32_t cacheHash = 2166136261UL;
+      for (uint16_t page = 0; page < band.pages(); page++)
+      {
+        band.selectPage(page);
+        band.setGlyphCache(nullptr);
+        band.fillScreen(GxEPD_WHITE);
+        unsigned long start = micros();
+        drawUtf8Layout(band, layout, GxEPD_BLACK);
+        flashTime += micros() - start;
+        flashHash = bufferHash(band, flashHash);
+
+        band.setGlyphCache(&cache);
+        band.fillScreen(GxEPD_WHITE);
+        start = micros();
+        drawUtf8Layout(band, layout, GxEPD_BLACK);
+        cacheTime += micros() - start;
+        cacheHash = bufferHash(band, cacheHash);
+      }
+      if (cacheHash != flashHash)
+        mismatches++;
+    }
+    band.setGlyphCache(nullptr);
+    band.selectPage(0);
+
+    char name[32];
+    snprintf(name, sizeof(name), "%s %s", f.name, e ? "RLE" : "packed");
+    uint32_t lookups = cache.hits() + cache.misses();
+    Serial.printf("  %-24s %10lu %10lu %7.2fx %8lu %8lu %7.1f%% %8lu %6d\n", name, (unsigned long)flashTime,
+                  (unsigned long)cacheTime, cacheTime ? (double)flashTime / cacheTime : 0.0,
+                  (unsigned long)cache.hits(), (unsigned long)cache.misses(),
+                  lookups ? 100.0 * cache.hits() / lookups : 0.0, (unsigned long)cache.unpacks(), mismatches);
+  }
+}
+
+static void benchmarkLayouter(Utf8TextLayout &layout, int index)
+{
+  loadQuestionLayout(layout, index);
+}
+
+static void benchmarkPrerender(PagedCanvas &band)
+{
+  static Utf8TextLayout layout;
+  Prerenderer *prerender = new Prerenderer(band.width(), band.height());
+  prerender->setLayouter(benchmarkLayouter);
+
+  uint32_t idleTime = 0;
+  uint32_t liveTime = 0;
+  uint32_t copyTime = 0;
+  uint32_t bytes = 0;
+  uint32_t maxBytes = 0;
+  int missing = 0;
+  int mismatches = 0;
+
+  for (int i = 0; i < getQuestionCount(); i++)
+  {
+    int16_t question = i;
+    prerender->setCandidates(&question, 1);
+    unsigned long start = micros();
+    prerender->prerenderNext();
+    idleTime += micros() - start;
+
+    const PrerenderedFrame *frame = prerender->find(question);
+    if (!frame)
+    {
+      missing++;
+      continue;
+    }
+    bytes += frame->size;
+    if (frame->size > maxBytes)
+      maxBytes = frame->size;
+
+    // What a page turn costs on the display task: layout plus glyphs, or copying rows
+    uint32_t liveHash = 2166136261UL;
+    uint32_t copyHash = 2166136261UL;
+    for (uint16_t page = 0; page < band.pages(); page++)
+    {
+      band.selectPage(page);
+      band.fillScreen(GxEPD_WHITE);
+      start = micros();
+      if (page == 0)
+        loadQuestionLayout(layout, i);
+      drawUtf8Layout(band, layout, GxEPD_BLACK);
+      liveTime += micros() - start;
+      liveHash = bufferHash(band, liveHash);
+
+      band.fillScreen(GxEPD_WHITE);
+      start = micros();
+      prerender->draw(band, *frame);
+      copyTime += micros() - start;
+      copyHash = bufferHash(band, copyHash);
+    }
+    if (copyHash != liveHash)
+      mismatches++;
+  }
+  band.selectPage(0);
+
+  int count = getQuestionCount() - missing;
+  Serial.printf("Prerendered questions, %d questions in %u bands:\n", getQuestionCount(), band.pages());
+  Serial.printf("  frame size: %lu B average, %lu B max (%u B budget), %d did not fit\n",
+                (unsigned long)(count ? bytes / count : 0), (unsigned long)maxBytes, (unsigned)PRERENDER_BYTES, missing);
+  Serial.printf("  idle prerender: %lu us, page turn: %lu us live vs %lu us prerendered (%.2fx), diff %d\n",
+                (unsigned long)idleTime, (unsigned long)liveTime, (unsigned long)copyTime,
+                copyTime ? (double)liveTime / copyTime : 0.0, mismatches);
+  delete prerender;
+}
+
+// Navigation traces as button initials (R/L next/previous, U/D next/previous category, C random),
+// the order the presses show up in the serial log; each pattern repeats up to GHOSTING_TRACE_PRESSES
+struct NavigationTrace
+{
+  const char *name;
+  const char *pattern;
+};
+
+static const NavigationTrace NAVIGATION_TRACES[] = {
+    {"read through", "R"},
+    {"back and forth", "RRRLRRLL"},
+    {"category browsing", "RRURRRDRUUR"},
+    {"shuffle", "C"},
+};
+
+static const int GHOSTING_TRACE_PRESSES = 300;
+static const int GHOSTING_FIXED_INTERVAL = 20;
+
+// Send one frame of the question screen to both trackers and keep it as the panel content
+static void ghostingFrame(PagedCanvas &canvas, GhostingTracker &estimate, GhostingTracker &exact,
+                          uint8_t *panel, const DirtyRegion *window, const Utf8TextLayout &layout,
+                          const char *category, bool black)
+{
+  uint16_t panelStride = canvas.width() / 8;
+  if (!window)
+    canvas.setFullWindow();
+  else
+    canvas.setPartialWindow(window->x(), window->y(), window->width(), window->height());
+
+  if (black)
+    canvas.fillScreen(GxEPD_BLACK);
+  else
+    drawQuestionScreen(canvas, layout, category, false);
+
+  int16_t x = window ? window->x() : 0;
+  int16_t y = window ? window->y() : 0;
+  int16_t w = window ? window->width() : canvas.width();
+  int16_t h = window ? window->height() : canvas.height();
+  uint16_t stride = w / 8;
+  uint8_t *previous = panel + (uint32_t)y * panelStride + x / 8;
+  if (!window)
+  {
+    estimate.recordFull(canvas.pageBuffer(), stride, 0, h);
+    exact.recordFull(canvas.pageBuffer(), stride, 0, h);
+  }
+  else
+  {
+    estimate.recordPartial(canvas.pageBuffer(), stride, x, y, w, h);
+    exact.recordPartial(canvas.pageBuffer(), stride, x, y, w, h, previous, panelStride);
+  }
+  for (int16_t r = 0; r < h; r++)
+    memcpy(previous + (uint32_t)r * panelStride, canvas.pageBuffer() + (uint32_t)r * stride, stride);
+}
+
+// First question of the neighbouring category, as VOLUME_UP/VOLUME_DOWN in main.cpp
+static int categoryStep(int index, int step)
+{
+  int n = getQuestionCount();
+  int next = (index + step + n) % n;
+  while (strcmp(getQuestionCategory(next), getQuestionCategory(index)) == 0 && next != index)
+    next = (next + step + n) % n;
+  return next;
+}
+
+// Replay a trace with a refresh policy: 0 = partial only, 1 = full every GHOSTING_FIXED_INTERVAL,
+// 2 = GhostingTracker scheduler (estimated flips, as without the shadow framebuffer)
+static void replayTrace(PagedCanvas &canvas, uint8_t *panel, const char *pattern, int policy, uint16_t &peakEstimate,
+                        uint16_t &peakExact, uint32_t &fullRefreshes, uint32_t &flashes, uint32_t &flashedPixels)
+{
+  static Utf8TextLayout layout;
+  static GhostingTracker estimate(canvas.width(), canvas.height());
+  static GhostingTracker exact(canvas.width(), canvas.height());
+  estimate.reset();
+  exact.reset();
+  estimate.setFlipsPerPixel(GHOSTING_FLIPS_PER_PIXEL);
+  exact.setFlipsPerPixel(GHOSTING_FLIPS_PER_PIXEL);
+
+  uint32_t seed = 12345;
+  int index = 0;
+  loadQuestionLayout(layout, index);
+  ghostingFrame(canvas, estimate, exact, panel, nullptr, layout, getQuestionCategory(index), false);
+  DirtyRegion shown;
+  int16_t bx, by, bw, bh;
+  if (getUtf8LayoutBounds(layout, bx, by, bw, bh))
+    shown.add(bx, by, bw, bh);
+
+  peakEstimate = 0;
+  peakExact = 0;
+  size_t patternLength = strlen(pattern);
+  for (int press = 0; press < GHOSTING_TRACE_PRESSES; press++)
+  {
+    int n = getQuestionCount();
+    const char *before = getQuestionCategory(index);
+    switch (pattern[press % patternLength])
+    {
+    case 'R':
+      index = (index + 1) % n;
+      break;
+    case 'L':
+      index = (index - 1 + n) % n;
+      break;
+    case 'U':
+      index = categoryStep(index, 1);
+      break;
+    case 'D':
+      index = categoryStep(index, -1);
+      break;
+    default:
+      seed = seed * 1103515245UL + 12345;
+      index = (seed >> 16) % n;
+      break;
+    }
+    const char *category = getQuestionCategory(index);
+    loadQuestionLayout(layout, index);
+    DirtyRegion incoming;
+    if (getUtf8LayoutBounds(layout, bx, by, bw, bh))
+      incoming.add(bx, by, bw, bh);
+
+    bool full = (policy == 1 && (press + 1) % GHOSTING_FIXED_INTERVAL == 0);
+    DirtyRegion flash;
+    int16_t cx, cy, cw, ch;
+    if (policy == 2 && estimate.flashWindow(cx, cy, cw, ch))
+    {
+      if ((uint32_t)cw * ch * 100 > (uint32_t)canvas.width() * canvas.height() * GHOSTING_FULL_REFRESH_PERCENT)
+        full = true;
+      else
+        flash.add(cx, cy, cw, ch);
+    }
+
+    if (full)
+    {
+      ghostingFrame(canvas, estimate, exact, panel, nullptr, layout, category, false);
+    }
+    else
+    {
+      DirtyRegion dirty = shown;
+      dirty.add(incoming);
+      if (strcmp(before, category) != 0)
+        dirty.add(250, 400, 300, 50);
+      if (!flash.isEmpty())
+      {
+        ghostingFrame(canvas, estimate, exact, panel, &flash, layout, category, true);
+        dirty.add(flash);
+      }
+      dirty.clip(canvas.width(), canvas.height());
+      dirty.alignX(8);
+      if (!dirty.isEmpty())
+        ghostingFrame(canvas, estimate, exact, panel, &dirty, layout, category, false);
+      if (!flash.isEmpty())
+      {
+        estimate.flashed(flash.x(), flash.y(), flash.width(), flash.height());
+        exact.flashed(flash.x(), flash.y(), flash.width(), flash.height());
+      }
+    }
+    shown = incoming;
+
+    if (estimate.peakFlipsPercent() > peakEstimate)
+      peakEstimate = estimate.peakFlipsPercent();
+    if (exact.peakFlipsPercent() > peakExact)
+      peakExact = exact.peakFlipsPercent();
+  }
+  canvas.setFullWindow();
+
+  fullRefreshes = estimate.fullRefreshes() - 1; // Not counting the first screen
+  flashes = estimate.flashes();
+  flashedPixels = estimate.flashedPixels();
+}
+
+static void benchmarkGhosting(PagedCanvas &canvas)
+{
+  uint8_t *panel = (uint8_t *)malloc((uint32_t)(canvas.width() / 8) * canvas.height());
+  if (!panel)
+  {
+    Serial.println("Out of memory for ghosting panel copy");
+    return;
+  }
+
+  static const char *const POLICIES[] = {"partial only", "full every 20", "scheduler"};
+  Serial.printf("Ghosting, %d presses per trace, limit %u flips/pixel per %dpx tile:\n", GHOSTING_TRACE_PRESSES,
+                (unsigned)GHOSTING_FLIPS_PER_PIXEL, GHOSTING_TILE);
+  Serial.printf("  %-18s %-14s %6s %9s %10s %10s %10s\n", "trace", "policy", "full", "flashes", "flashed px",
+                "peak est", "peak exact");
+  for (size_t t = 0; t < sizeof(NAVIGATION_TRACES) / sizeof(NAVIGATION_TRACES[0]); t++)
+  {
+    for (int policy = 0; policy < 3; policy++)
+    {
+      uint16_t peakEstimate, peakExact;
+      uint32_t fullRefreshes, flashes, flashedPixels;
+      replayTrace(canvas, panel, NAVIGATION_TRACES[t].pattern, policy, peakEstimate, peakExact, fullRefreshes,
+                  flashes, flashedPixels);
+      Serial.printf("  %-18s %-14s %6lu %9lu %10lu %7u.%02u %7u.%02u\n", policy == 0 ? NAVIGATION_TRACES[t].name : "",
+                    POLICIES[policy], (unsigned long)fullRefreshes, (unsigned long)flashes,
+                    (unsigned long)flashedPixels, peakEstimate / 100, peakEstimate % 100, peakExact / 100,
+                    peakExact % 100);
+    }
+  }
+  free(panel);
+}
+
+// PagedCanvas as it drew shapes before the span primitives: Adafruit_GFX lines and rects pixel by
+// pixel (clipped to the band first), rounded rects from Adafruit_GFX, the whole page buffer cleared
+class PixelCanvas : public PagedCanvas
+{
+public:
+  PixelCanvas(int16_t w, int16_t h, uint8_t *buffer, uint16_t pageHeight) : PagedCanvas(w, h, buffer, pageHeight) {}
+
+  void fillScreen(uint16_t color) override { memset(_buffer, (color == GxEPD_BLACK) ? 0x00 : 0xFF, pageBufferSize()); }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    int16_t h = 1;
+    if (clipToPage(x, y, w, h))
+      Adafruit_GFX::drawFastHLine(x, y, w, color);
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+  {
+    int16_t w = 1;
+    if (clipToPage(x, y, w, h))
+      Adafruit_GFX::drawFastVLine(x, y, h, color);
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+  {
+    if (clipToPage(x, y, w, h))
+      Adafruit_GFX::fillRect(x, y, w, h, color);
+  }
+
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+  {
+    Adafruit_GFX::drawRoundRect(x, y, w, h, r, color);
+  }
+
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+  {
+    Adafruit_GFX::fillRoundRect(x, y, w, h, r, color);
+  }
+};
+
+// One of the shapes main.cpp draws, on every band of canvas; returns the frame hash and adds the
+// drawing time (without hashing) to time
+template <typename Canvas>
+static uint32_t drawShape(Canvas &canvas, int shape, uint32_t &time)
+{
+  uint32_t hash = 2166136261UL;
+  for (uint16_t page = 0; page < canvas.pages(); page++)
+  {
+    // A partial window ends before the last band
+    canvas.selectPage(page);
+    if (canvas.pageRows() == 0)
+      break;
+    unsigned long start = micros();
+    switch (shape)
+    {
+    case 0:
+      canvas.fillScreen(GxEPD_WHITE);
+      break;
+    case 1:
+      for (int i = 0; i < 5; i++)
+      {
+        canvas.drawRoundRect(50 + i, 50 + i, 700 - i * 2, 320 - i * 2, 20, GxEPD_BLACK);
+      }
+      break;
+    case 2:
+      canvas.fillRoundRect(250, 400, 300, 50, 10, GxEPD_BLACK);
+      break;
+    }
+    time += micros() - start;
+    hash = bufferHash(canvas, hash);
+  }
+  return hash;
+}
+
+// Byte-span primitives against the Adafruit_GFX paths, for the shapes of the question screen
+static void benchmarkPrimitives(PagedCanvas &band)
+{
+  static const char *const SHAPES[] = {"fillScreen", "border (5 round rects)", "banner fillRoundRect"};
+  static const int REPEAT = 50;
+
+  uint8_t *buffer = (uint8_t *)malloc(band.pageBufferSize());
+  if (!buffer)
+  {
+    Serial.println("Out of memory for primitives benchmark");
+    return;
+  }
+  PixelCanvas pixel(band.width(), band.height(), buffer, band.pageHeight());
+
+  // Full screen, and the partial window of a page turn (question text plus banner)
+  static Utf8TextLayout layout;
+  loadQuestionLayout(layout, 0);
+  DirtyRegion window;
+  int16_t x, y, w, h;
+  if (getUtf8LayoutBounds(layout, x, y, w, h))
+    window.add(x, y, w, h);
+  window.add(250, 400, 300, 50);
+  window.alignX(8);
+
+  Serial.printf("Drawing primitives, %u-row bands, us per frame (Adafruit_GFX / spans):\n", band.pageHeight());
+  for (int partial = 0; partial < 2; partial++)
+  {
+    for (int shape = 0; shape < 3; shape++)
+    {
+      uint32_t pixelTime = 0, spanTime = 0;
+      uint32_t pixelHash = 0, spanHash = 0;
+      for (PagedCanvas *canvas : {(PagedCanvas *)&pixel, &band})
+      {
+        if (partial)
+          canvas->setPartialWindow(window.x(), window.y(), window.width(), window.height());
+        else
+          canvas->setFullWindow();
+      }
+
+      // Both start from a white frame so the hashes compare
+      uint32_t unused = 0;
+      drawShape(pixel, 0, unused);
+      drawShape(band, 0, unused);
+      for (int i = 0; i < REPEAT; i++)
+      {
+        pixelHash = drawShape(pixel, shape, pixelTime);
+        spanHash = drawShape(band, shape, spanTime);
+      }
+
+      Serial.printf("  %-7s %-24s %8.1f %8.1f  %5.1fx%s\n", partial ? "partial" : "full", SHAPES[shape],
+                    (double)pixelTime / REPEAT, (double)spanTime / REPEAT,
+                    spanTime ? (double)pixelTime / spanTime : 0.0, pixelHash == spanHash ? "" : "  MISMATCH");
+    }
+  }
+
+  band.setFullWindow();
+  free(buffer);
+}
+
+// Border and category banners: rasterized every time vs blitted from Chrome.h
+static void benchmarkChrome(PagedCanvas &band)
+{
+  static const int REPEAT = 20;
+  uint32_t shapeTime = 0, blitTime = 0;
+  uint32_t bannerTime = 0, bannerBlitTime = 0;
+  int mismatches = 0;
+
+  band.setFullWindow();
+  for (int i = 0; i < REPEAT; i++)
+  {
+    uint32_t shapeHash = 2166136261UL, blitHash = 2166136261UL;
+    for (uint16_t page = 0; page < band.pages(); page++)
+    {
+      band.selectPage(page);
+      band.fillScreen(GxEPD_WHITE);
+      unsigned long start = micros();
+      for (int k = 0; k < CHROME_BORDER_THICKNESS; k++)
+      {
+        band.drawRoundRect(CHROME_BORDER_X + k, CHROME_BORDER_Y + k, CHROME_BORDER_W - k * 2,
+                           CHROME_BORDER_H - k * 2, CHROME_BORDER_RADIUS, GxEPD_BLACK);
+      }
+      shapeTime += micros() - start;
+      shapeHash = bufferHash(band, shapeHash);
+
+      band.fillScreen(GxEPD_WHITE);
+      start = micros();
+      for (uint8_t k = 0; k < CHROME_BORDER_PIECES; k++)
+        drawChrome(band, CHROME_BORDER[k]);
+      blitTime += micros() - start;
+      blitHash = bufferHash(band, blitHash);
+    }
+    if (shapeHash != blitHash)
+      mismatches++;
+
+    for (uint8_t c = 0; c < CHROME_BANNER_COUNT; c++)
+    {
+      shapeHash = blitHash = 2166136261UL;
+      for (uint16_t page = 0; page < band.pages(); page++)
+      {
+        band.selectPage(page);
+        band.fillScreen(GxEPD_WHITE);
+        unsigned long start = micros();
+        if (utf8AreaVisible(band, CHROME_BANNER_X, CHROME_BANNER_Y, CHROME_BANNER_W, CHROME_BANNER_H))
+        {
+          band.fillRoundRect(CHROME_BANNER_X, CHROME_BANNER_Y, CHROME_BANNER_W, CHROME_BANNER_H,
+                             CHROME_BANNER_RADIUS, GxEPD_BLACK);
+          drawUtf8StringCentered(band, BANNER_FONT, CHROME_BANNER_NAMES[c], CHROME_BANNER_X + CHROME_BANNER_W / 2,
+                                 CHROME_BANNER_BASELINE, GxEPD_WHITE);
+        }
+        bannerTime += micros() - start;
+        shapeHash = bufferHash(band, shapeHash);
+
+        band.fillScreen(GxEPD_WHITE);
+        start = micros();
+        drawChrome(band, CHROME_BANNERS[c]);
+        bannerBlitTime += micros() - start;
+        blitHash = bufferHash(band, blitHash);
+      }
+      if (shapeHash != blitHash)
+      {
+        mismatches++;
+        if (i == 0)
+          Serial.printf("  banner mismatch: %s\n", CHROME_BANNER_NAMES[c]);
+      }
+    }
+  }
+
+  int banners = REPEAT * CHROME_BANNER_COUNT;
+  Serial.printf("Chrome, %u-row bands, glyph cache %s:\n", band.pageHeight(), band.glyphCache() ? "on" : "off");
+  Serial.printf("  border: %lu us rasterized, %lu us blitted\n", (unsigned long)(shapeTime / REPEAT),
+                (unsigned long)(blitTime / REPEAT));
+  Serial.printf("  banner: %lu us rasterized, %lu us blitted\n", (unsigned long)(bannerTime / banners),
+                (unsigned long)(bannerBlitTime / banners));
+  Serial.printf("  mismatches: %d\n", mismatches);
+}
+
+// Raw bitmaps through drawBitmap() (the old sleep screen) vs PackBits-compressed ones decoded into the band
+static void benchmarkImages(PagedCanvas &canvas)
+{
+  static const int REPEAT = 5;
+  struct Asset
+  {
+    const char *name;
+    const uint8_t *raw;
+    const PackedImage &image;
+    int16_t x, y;
+  };
+  const Asset assets[] = {
+      {"logo", logo, LOGO_IMAGE, 0, 0},
+      {"dr_mario", dr_mario, DR_MARIO_IMAGE, 264, 100},
+  };
+
+  canvas.setFullWindow();
+  Serial.printf("Images, %u-row bands:\n", canvas.pageHeight());
+  for (const Asset &asset : assets)
+  {
+    const PackedImage &image = asset.image;
+    uint32_t rawSize = (uint32_t)((image.w + 7) / 8) * image.h;
+    uint32_t bitmapTime = 0, packedTime = 0;
+    int mismatches = 0;
+    for (int i = 0; i < REPEAT; i++)
+    {
+      uint32_t bitmapHash = 2166136261UL, packedHash = 2166136261UL;
+      for (uint16_t page = 0; page < canvas.pages(); page++)
+      {
+        canvas.selectPage(page);
+        canvas.fillScreen(GxEPD_WHITE);
+        unsigned long start = micros();
+        int16_t x = asset.x, y = asset.y, w = image.w, h = image.h;
+        if (canvas.clipToPage(x, y, w, h))
+        {
+          canvas.drawBitmap(asset.x, y, asset.raw + (uint32_t)(y - asset.y) * ((image.w + 7) / 8), image.w, h,
+                            GxEPD_BLACK);
+        }
+        bitmapTime += micros() - start;
+        bitmapHash = bufferHash(canvas, bitmapHash);
+
+        canvas.fillScreen(GxEPD_WHITE);
+        start = micros();
+        drawPackedImage(canvas, image, asset.x, asset.y);
+        packedTime += micros() - start;
+        packedHash = bufferHash(canvas, packedHash);
+      }
+      if (bitmapHash != packedHash)
+        mismatches++;
+    }
+    Serial.printf("  %s %ux%u: %lu -> %lu bytes of flash, %lu us drawBitmap, %lu us decoded, mismatches: %d\n",
+                  asset.name, image.w, image.h, (unsigned long)rawSize, (unsigned long)image.size,
+                  (unsigned long)(bitmapTime / REPEAT), (unsigned long)(packedTime / REPEAT), mismatches);
+  }
+}
+
+// PagedDisplay's paging loop over an off-screen buffer, hashing each band instead of sending it
+class OffscreenDisplay : public PagedCanvas
+{
+public:
+  static const int16_t PANEL_WIDTH = 800;
+  static const int16_t PANEL_HEIGHT = 480;
+
+  OffscreenDisplay(uint8_t *buffer, uint16_t pageHeight)
+      : PagedCanvas(PANEL_WIDTH, PANEL_HEIGHT, buffer, pageHeight), hash(0)
+  {
+  }
+
+  void firstPage()
+  {
+    _current_page = 0;
+    hash = 2166136261UL;
+    fillScreen(GxEPD_WHITE);
+  }
+
+  bool nextPage()
+  {
+    hash = bufferHash(*this, hash);
+    _current_page++;
+    if (pageRows() > 0)
+    {
+      fillScreen(GxEPD_WHITE);
+      return true;
+    }
+    _current_page = 0;
+    return false;
+  }
+
+  uint32_t hash;
+};
+
+// A question as a portrait page: border, wrapped text and banner
+static void drawPortraitPage(PagedCanvas &canvas, const Utf8TextLayout &layout, const char *category)
+{
+  canvas.fillScreen(GxEPD_WHITE);
+  if (utf8AreaVisible(canvas, 20, 20, 440, 760))
+  {
+    for (int i = 0; i < 5; i++)
+    {
+      canvas.drawRoundRect(20 + i, 20 + i, 440 - i * 2, 760 - i * 2, 20, GxEPD_BLACK);
+    }
+  }
+  drawUtf8Layout(canvas, layout, GxEPD_BLACK);
+  if (utf8AreaVisible(canvas, 90, 700, 300, 50))
+  {
+    canvas.fillRoundRect(90, 700, 300, 50, 10, GxEPD_BLACK);
+    drawUtf8StringCentered(canvas, BANNER_FONT, category, 240, 735, GxEPD_WHITE);
+  }
+}
+
+// Portrait pages on a rotated canvas (per-pixel rotation), landscape for scale
+static void benchmarkPortrait(PagedCanvas &canvas)
+{
+  static const int QUESTIONS = 40;
+  static Utf8TextLayout landscape, portrait;
+  OffscreenDisplay display(canvas.pageBuffer(), canvas.pageHeight());
+  uint32_t landscapeTime = 0, rotatedTime = 0;
+
+  for (int i = 0; i < QUESTIONS; i++)
+  {
+    layoutUtf8Text(landscape, QUESTION_FONT, getQuestionText(i), 400, 210, 640, 280);
+    layoutUtf8Text(portrait, QUESTION_FONT, getQuestionText(i), 240, 360, 400, 620);
+    const char *category = getQuestionCategory(i);
+
+    unsigned long start = micros();
+    display.setFullWindow();
+    display.firstPage();
+    do
+    {
+      drawQuestionScreen(display, landscape, category, false);
+    } while (display.nextPage());
+    landscapeTime += micros() - start;
+
+    start = micros();
+    display.setRotation(3);
+    display.setFullWindow();
+    display.firstPage();
+    do
+    {
+      drawPortraitPage(display, portrait, category);
+    } while (display.nextPage());
+    display.setRotation(0);
+    rotatedTime += micros() - start;
+  }
+
+  Serial.printf("Portrait page, %d questions, %u-row bands:\n", QUESTIONS, canvas.pageHeight());
+  Serial.printf("  landscape screen:          %lu us/question\n", (unsigned long)(landscapeTime / QUESTIONS));
+  Serial.printf("  portrait, rotated canvas:  %lu us/question\n", (unsigned long)(rotatedTime / QUESTIONS));
+}
+
+// Page buffer RAM against render time: whole screen and the question's partial window, band by band
+static void benchmarkPageHeights(PagedCanvas &canvas)
+{
+  static const uint16_t HEIGHTS[] = {480, 240, 120, 96, 60, 48, 30, 16};
+  static Utf8TextLayout layout;
+  GlyphCache *cache = new GlyphCache();
+  int n = getQuestionCount();
+
+  Serial.printf("Page height, %d questions, glyph cache on:\n", n);
+  Serial.printf("  %6s %6s %8s %14s %14s\n", "rows", "pages", "RAM", "full us/q", "partial us/q");
+  for (size_t i = 0; i < sizeof(HEIGHTS) / sizeof(HEIGHTS[0]); i++)
+  {
+    uint16_t rows = HEIGHTS[i];
+    uint32_t bytes = (uint32_t)(canvas.width() / 8) * rows;
+    uint8_t *buffer = (uint8_t *)malloc(bytes);
+    if (!buffer)
+    {
+      Serial.printf("  %6u   out of memory for %lu B\n", rows, (unsigned long)bytes);
+      continue;
+    }
+    PagedCanvas paged(canvas.width(), canvas.height(), buffer, rows);
+    paged.setGlyphCache(cache);
+
+    uint32_t fullTime = 0;
+    uint32_t partialTime = 0;
+    for (int q = 0; q < n; q++)
+    {
+      loadQuestionLayout(layout, q);
+      const char *category = getQuestionCategory(q);
+
+      paged.setFullWindow();
+      unsigned long start = micros();
+      for (uint16_t page = 0; page < paged.pages(); page++)
+      {
+        paged.selectPage(page);
+        drawQuestionScreen(paged, layout, category, false);
+      }
+      fullTime += micros() - start;
+
+      DirtyRegion window;
+      int16_t x, y, w, h;
+      if (!getUtf8LayoutBounds(layout, x, y, w, h))
+        continue;
+      window.add(x, y, w, h);
+      window.clip(paged.width(), paged.height());
+      window.alignX(8);
+      paged.setPartialWindow(window.x(), window.y(), window.width(), window.height());
+      start = micros();
+      for (uint16_t page = 0; page < paged.pages() && page * rows < window.height(); page++)
+      {
+        paged.selectPage(page);
+        drawQuestionScreen(paged, layout, category, false);
+      }
+      partialTime += micros() - start;
+    }
+
+    Serial.printf("  %6u %6u %7luB %14lu %14lu\n", rows, paged.pages(), (unsigned long)bytes,
+                  (unsigned long)(fullTime / n), (unsigned long)(partialTime / n));
+    free(buffer);
+  }
+  delete cache;
+}
+
+void runRenderBenchmark(PagedCanvas &canvas)
+{
+  Serial.println("\n=== Render benchmark ===");
+  canvas.setFullWindow();
+
+  // Full-frame benchmarks need the whole screen in one buffer; borrow one while the display is paged
+  uint8_t *frameBuffer = nullptr;
+  if (canvas.pages() > 1)
+  {
+    frameBuffer = (uint8_t *)malloc((canvas.width() / 8) * canvas.height());
+    if (!frameBuffer)
+    {
+      Serial.println("Out of memory for frame buffer");
+      return;
+    }
+  }
+  PagedCanvas frame(canvas.width(), canvas.height(), frameBuffer ? frameBuffer : canvas.pageBuffer(),
+                    canvas.height());
+
+  // Off-screen canvas with a small page buffer, rendered band by band via selectPage()
+  uint8_t *bandBuffer = (uint8_t *)malloc((canvas.width() / 8) * BAND_HEIGHT);
+  if (!bandBuffer)
+  {
+    Serial.println("Out of memory for band buffer");
+    free(frameBuffer);
+    return;
+  }
+  PagedCanvas band(canvas.width(), canvas.height(), bandBuffer, BAND_HEIGHT);
+
+  benchmarkUtf8Decode();
+  benchmarkGlyphLookup();
+  benchmarkGlyphBlitter(frame);
+  benchmarkTextLayout(frame);
+  benchmarkTextLayout(band);
+  benchmarkPrecomputedLayout();
+  benchmarkDirtyRegion();
+  benchmarkFontFitting();
+  benchmarkPageBands(frame, band);
+  benchmarkPrimitives(band);
+  benchmarkChrome(band);
+  benchmarkImages(frame);
+  benchmarkImages(band);
+  benchmarkPortrait(frame);
+  benchmarkPortrait(band);
+  benchmarkRleGlyphs(frame, band);
+  benchmarkGlyphCache(band);
+  benchmarkPrerender(band);
+  benchmarkGhosting(frame);
+  benchmarkPageHeights(canvas);
+
+  free(bandBuffer);
+  free(frameBuffer);
+
+  Serial.println("=== Render benchmark done ===\n");
+}
+
+#endif // RENDER_BENCHMARK
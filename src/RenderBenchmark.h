@@ -0,0 +1,12 @@
+#ifndef RENDER_BENCHMARK_H
+#define RENDER_BENCHMARK_H
+
+#include <Arduino.h>
+#include "PagedDisplay.h"
+
+// On-device render benchmark, enabled with -DRENDER_BENCHMARK in platformio.ini.
+// Renders into the page buffer only (nothing is sent to the panel) and prints
+// the results over serial.
+void runRenderBenchmark(PagedCanvas &canvas);
+
+#endif // RENDER_BENCHMARK_H
@@ -0,0 +1,115 @@
+#ifndef SPARSE_FONT_H
+#define SPARSE_FONT_H
+
+#include <Adafruit_GFX.h>
+
+/**
+ * Sparse GFX font: only the glyphs a deck actually uses.
+ *
+ * Dense Adafruit fonts index glyphs by codepoint - first, so covering Czech
+ * (up to U+017F) drags along every glyph in between. A sparse font stores
+ * its glyphs in codepoint order plus a sorted codepoint table, and glyphs
+ * are found by binary search. Generated by src/subset_font.py.
+ *
+ * The search is slower than the dense table's index (the render benchmark
+ * times both). Text drawn through a GlyphCache pays it only on a cache miss.
+ *
+ * The embedded GFXfont is what gets passed around (&font.font); its first
+ * field is set to SPARSE_FONT_FIRST so getFontGlyph() can tell the formats
+ * apart, and plain Adafruit_GFX text calls simply find no glyphs in it.
+ *
+ * Sparse fonts may also store their glyph bitmaps run-length encoded
+ * (first = SPARSE_RLE_FONT_FIRST, see RleGlyphReader below).
+ */
+
+// Markers stored in GFXfont::first of a sparse font (last = glyph count - 1)
+#define SPARSE_FONT_FIRST 0xFFFF
+#define SPARSE_RLE_FONT_FIRST 0xFFFE
+
+struct SparseGFXfont
+{
+  GFXfont font;               // Must stay the first member
+  const uint16_t *codepoints; // Sorted codepoint of each glyph (PROGMEM)
+};
+
+inline bool isSparseFont(const GFXfont *font)
+{
+  return pgm_read_word(&font->first) >= SPARSE_RLE_FONT_FIRST;
+}
+
+inline bool isRleFont(const GFXfont *font)
+{
+  return pgm_read_word(&font->first) == SPARSE_RLE_FONT_FIRST;
+}
+
+/**
+ * Look up the glyph for a codepoint in a dense or sparse font.
+ *
+ * @return Glyph pointer (PROGMEM), or nullptr if the font has no such glyph
+ */
+inline const GFXglyph *getFontGlyph(const GFXfont *font, uint32_t codepoint)
+{
+  GFXglyph *glyphs = (GFXglyph *)pgm_read_ptr(&font->glyph);
+  uint16_t first = pgm_read_word(&font->first);
+  uint16_t last = pgm_read_word(&font->last);
+
+  if (first < SPARSE_RLE_FONT_FIRST)
+  {
+    if (codepoint < first || codepoint > last)
+      return nullptr;
+    return &glyphs[codepoint - first];
+  }
+
+  // Binary search in the sorted codepoint table
+  const uint16_t *codepoints = (const uint16_t *)pgm_read_ptr(&((const SparseGFXfont *)font)->codepoints);
+  int lo = 0;
+  int hi = last;
+  while (lo <= hi)
+  {
+    int mid = (lo + hi) >> 1;
+    uint16_t cp = pgm_read_word(&codepoints[mid]);
+    if (cp == codepoint)
+      return &glyphs[mid];
+    if (cp < codepoint)
+      lo = mid + 1;
+    else
+      hi = mid - 1;
+  }
+  return nullptr;
+}
+
+/**
+ * Sequential reader for a run-length encoded glyph bitmap.
+ *
+ * The glyph's w * h pixels, in the same row-major order as the packed
+ * format, are stored as alternating runs of clear and set pixels starting
+ * with a clear run (which may be empty); runs span row ends. Each run is a
+ * string of 4-bit values, high nibble first, that is summed up for as long
+ * as the value read is 15. The bitmapOffset of an RLE glyph is the byte
+ * where its runs start.
+ */
+class RleGlyphReader
+{
+public:
+  RleGlyphReader(const uint8_t *data) : _data(data), _nibble(0) {}
+
+  uint16_t nextRun()
+  {
+    uint16_t run = 0;
+    uint8_t v;
+    do
+    {
+      uint8_t b = pgm_read_byte(&_data[_nibble >> 1]);
+      v = (_nibble & 1) ? (b & 0x0F) : (b >> 4);
+      _nibble++;
+      run += v;
+    } while (v == 15);
+    return run;
+  }
+
+private:
+  const uint8_t *_data;
+  uint32_t _nibble;
+};
+
+#endif // SPARSE_FONT_H
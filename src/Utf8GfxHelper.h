@@ -2,59 +2,328 @@
 #define UTF8_GFX_HELPER_H
 
 #include <Adafruit_GFX.h>
+#include "GlyphCache.h"
+#include "PagedDisplay.h"
+#include "SparseFont.h"
 
 /**
  * UTF-8 aware text printing for Adafruit GFX with extended character fonts.
  * Decodes UTF-8 multi-byte sequences into Unicode codepoints and draws
  * them using the font's glyph table.
  *
- * Requires fonts generated with extended range (e.g., 32-383 for Czech).
+ * Requires fonts generated with extended range (e.g., 32-383 for Czech),
+ * or sparse fonts subset to the deck's codepoints (see SparseFont.h).
+ *
+ * The draw functions are templates over the target so that a PagedCanvas
+ * (see PagedDisplay.h) gets the byte-wise glyph blitter, while any other
+ * Adafruit_GFX target falls back to per-pixel drawPixel().
+ */
+
+/**
+ * Sequence length by UTF-8 lead byte: 1 for ASCII, 2-4 for a multi-byte
+ * lead, 0 for bytes that cannot start a character (continuation bytes,
+ * overlong leads 0xC0/0xC1, and 0xF5-0xFF beyond U+10FFFF).
+ */
+static const uint8_t UTF8_SEQUENCE_LENGTH[256] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x00
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x10
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x20
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x30
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x40
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x50
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x60
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x70
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x80
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x90
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xA0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xB0
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // 0xC0
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // 0xD0
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, // 0xE0
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xF0
+};
+
+/**
+ * Allowed second-byte range by 3- and 4-byte lead (0xE0-0xF4), low bound in
+ * the high nibble: the edges exclude overlong forms, UTF-16 surrogates and
+ * codepoints above U+10FFFF without a compare chain on the lead byte.
+ */
+static const uint8_t UTF8_SECOND_BYTE_RANGE[21] = {
+    0xAB, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, // 0xE0-0xE7
+    0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x89, 0x8B, 0x8B, // 0xE8-0xEF
+    0x9B, 0x8B, 0x8B, 0x8B, 0x88,                   // 0xF0-0xF4
+};
+
+/**
+ * Decode a 3- or 4-byte sequence, or reject an invalid lead byte. The slow
+ * path of decodeUtf8Char(): the lead byte gives the sequence length through
+ * UTF8_SEQUENCE_LENGTH and the second byte's range through
+ * UTF8_SECOND_BYTE_RANGE.
  */
+inline uint8_t decodeUtf8Long(const char *str, uint32_t &codepoint)
+{
+  uint8_t c = (uint8_t)str[0];
+  uint8_t length = UTF8_SEQUENCE_LENGTH[c];
+  if (length > 2)
+  {
+    uint8_t c2 = (uint8_t)str[1];
+    uint8_t range = UTF8_SECOND_BYTE_RANGE[c - 0xE0];
+    if (c2 >= (range & 0xF0) && c2 <= (uint8_t)(((range & 0x0F) << 4) | 0x0F))
+    {
+      uint32_t cp = ((uint32_t)(c & (0x7F >> length)) << 6) | (c2 & 0x3F);
+      uint8_t i = 2;
+      for (; i < length; i++)
+      {
+        uint8_t cc = (uint8_t)str[i];
+        if ((cc & 0xC0) != 0x80)
+          break;
+        cp = (cp << 6) | (cc & 0x3F);
+      }
+      if (i == length)
+      {
+        codepoint = cp;
+        return length;
+      }
+    }
+  }
+
+  // Invalid or truncated UTF-8, return replacement char
+  codepoint = '?';
+  return 1;
+}
 
 /**
  * Decode a single UTF-8 character and return the Unicode codepoint.
  *
+ * ASCII and two-byte sequences (all of Latin Extended, so nearly all deck
+ * text) take a short branch chain; everything else goes to decodeUtf8Long().
+ * Each continuation byte is checked before the next one is read, so decoding
+ * never reads past a terminating NUL. Overlong forms, UTF-16 surrogates and
+ * codepoints above U+10FFFF are rejected.
+ *
  * @param str Pointer to UTF-8 string
- * @param codepoint Output: decoded Unicode codepoint
+ * @param codepoint Output: decoded Unicode codepoint, '?' if invalid
  * @return Number of bytes consumed (1-4), or 1 if invalid
  */
-inline uint8_t decodeUtf8Char(const char *str, uint16_t &codepoint)
+inline uint8_t decodeUtf8Char(const char *str, uint32_t &codepoint)
 {
-  uint8_t c = (uint8_t)*str;
-
-  // Single byte (ASCII): 0xxxxxxx
-  if ((c & 0x80) == 0)
+  uint8_t c = (uint8_t)str[0];
+  if (c < 0x80)
   {
     codepoint = c;
     return 1;
   }
 
-  // Two bytes: 110xxxxx 10xxxxxx (covers Latin Extended: 0x80-0x7FF)
-  if ((c & 0xE0) == 0xC0)
+  // Two bytes: lead 0xC2-0xDF (0xC0/0xC1 would be overlong), then 10xxxxxx
+  if ((uint8_t)(c - 0xC2) < 0x1E)
   {
     uint8_t c2 = (uint8_t)str[1];
     if ((c2 & 0xC0) == 0x80)
     {
-      codepoint = ((c & 0x1F) << 6) | (c2 & 0x3F);
+      codepoint = ((uint32_t)(c & 0x1F) << 6) | (c2 & 0x3F);
       return 2;
     }
+    codepoint = '?';
+    return 1;
   }
 
-  // Three bytes: 1110xxxx 10xxxxxx 10xxxxxx (covers 0x800-0xFFFF)
-  if ((c & 0xF0) == 0xE0)
+  return decodeUtf8Long(str, codepoint);
+}
+
+/**
+ * Decode up to maxCount characters into a codepoint buffer.
+ *
+ * @param str UTF-8 encoded text
+ * @param codepoints Output buffer
+ * @param maxCount Capacity of codepoints
+ * @param end Optional output: first byte not decoded
+ * @return Number of codepoints written
+ */
+inline uint16_t decodeUtf8(const char *str, uint32_t *codepoints, uint16_t maxCount, const char **end = nullptr)
+{
+  uint16_t count = 0;
+  const char *p = str;
+  if (p)
   {
-    uint8_t c2 = (uint8_t)str[1];
-    uint8_t c3 = (uint8_t)str[2];
-    if ((c2 & 0xC0) == 0x80 && (c3 & 0xC0) == 0x80)
+    while (*p && count < maxCount)
     {
-      codepoint = ((c & 0x0F) << 12) | ((c2 & 0x3F) << 6) | (c3 & 0x3F);
-      return 3;
+      // ASCII runs stay in this loop
+      uint8_t c = (uint8_t)*p;
+      if (c < 0x80)
+      {
+        codepoints[count++] = c;
+        p++;
+        continue;
+      }
+      p += decodeUtf8Char(p, codepoints[count++]);
     }
   }
+  if (end)
+    *end = p;
+  return count;
+}
 
-  // Invalid or unsupported UTF-8, return replacement char
-  codepoint = '?';
-  return 1;
+/**
+ * Check whether an area can produce pixels on the page band being rendered.
+ * Plain Adafruit_GFX targets have no bands, so only the screen clips.
+ */
+inline bool utf8AreaVisible(Adafruit_GFX &gfx, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  return (w > 0) && (h > 0) && (x < gfx.width()) && (y < gfx.height()) && (x + w > 0) && (y + h > 0);
+}
+
+inline bool utf8AreaVisible(PagedCanvas &gfx, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  return gfx.clipToPage(x, y, w, h);
+}
+
+/**
+ * Draw a single glyph bitmap with its origin (baseline) at (x, y).
+ * Generic path: one drawPixel() call per set bit (packed or RLE bitmaps).
+ */
+inline void drawUtf8Glyph(Adafruit_GFX &gfx, const GFXfont *font, const GFXglyph *glyph,
+                          int16_t x, int16_t y, uint16_t color)
+{
+  uint8_t w = pgm_read_byte(&glyph->width);
+  uint8_t h = pgm_read_byte(&glyph->height);
+  if (w == 0 || h == 0)
+    return;
+
+  int8_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+  int8_t yo = (int8_t)pgm_read_byte(&glyph->yOffset);
+  uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+  uint8_t *bitmap = (uint8_t *)pgm_read_ptr(&font->bitmap);
+
+  if (isRleFont(font))
+  {
+    // Walk the runs; only set runs produce pixels
+    RleGlyphReader rle(bitmap + bo);
+    uint16_t total = (uint16_t)w * h;
+    uint16_t pos = 0;
+    uint16_t xx = 0;
+    uint16_t yy = 0;
+    while (pos < total)
+    {
+      uint16_t run = rle.nextRun();
+      pos += run;
+      xx += run;
+      while (xx >= w)
+      {
+        xx -= w;
+        yy++;
+      }
+      if (pos >= total)
+        break;
+
+      run = rle.nextRun();
+      pos += run;
+      while (run--)
+      {
+        gfx.drawPixel(x + xo + xx, y + yo + yy, color);
+        if (++xx == w)
+        {
+          xx = 0;
+          yy++;
+        }
+      }
+    }
+    return;
+  }
+
+  uint8_t bit = 0;
+  uint8_t bits = 0;
+
+  for (uint8_t yy = 0; yy < h; yy++)
+  {
+    for (uint8_t xx = 0; xx < w; xx++)
+    {
+      if (!(bit++ & 7))
+      {
+        bits = pgm_read_byte(&bitmap[bo++]);
+      }
+      if (bits & 0x80)
+      {
+        gfx.drawPixel(x + xo + xx, y + yo + yy, color);
+      }
+      bits <<= 1;
+    }
+  }
+}
+
+/**
+ * Draw a single glyph bitmap straight into a PagedCanvas page buffer.
+ * Glyph rows are written as whole bytes instead of individual pixels (RLE
+ * glyphs as filled spans), and glyphs outside the current page band are
+ * skipped before their bitmap is read.
+ */
+inline void drawUtf8Glyph(PagedCanvas &gfx, const GFXfont *font, const GFXglyph *glyph,
+                          int16_t x, int16_t y, uint16_t color)
+{
+  uint8_t w = pgm_read_byte(&glyph->width);
+  uint8_t h = pgm_read_byte(&glyph->height);
+  if (w == 0 || h == 0)
+    return;
+
+  int8_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+  int8_t yo = (int8_t)pgm_read_byte(&glyph->yOffset);
+  if (!utf8AreaVisible(gfx, x + xo, y + yo, w, h))
+    return;
+
+  uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+  const uint8_t *bitmap = (const uint8_t *)pgm_read_ptr(&font->bitmap);
+
+  if (isRleFont(font))
+    gfx.drawRleBits(x + xo, y + yo, bitmap + bo, w, h, color);
+  else
+    gfx.drawPackedBits(x + xo, y + yo, bitmap, (uint32_t)bo * 8, w, h, color);
+}
+
+/**
+ * Look up and draw one codepoint with its origin (baseline) at (x, y).
+ * Returns the advance in pixels, 0 if the font has no glyph for it.
+ */
+inline uint8_t drawUtf8Codepoint(Adafruit_GFX &gfx, const GFXfont *font, uint32_t codepoint,
+                                 int16_t x, int16_t y, uint16_t color)
+{
+  const GFXglyph *glyph = getFontGlyph(font, codepoint);
+  if (!glyph)
+    return 0;
+  drawUtf8Glyph(gfx, font, glyph, x, y, color);
+  return pgm_read_byte(&glyph->xAdvance);
+}
+
+/**
+ * PagedCanvas version: with a GlyphCache attached, metrics come from RAM and
+ * visible glyphs are blitted from their cached byte-aligned rows. Glyphs too
+ * large for the cache's row buffer still draw straight from flash.
+ */
+inline uint8_t drawUtf8Codepoint(PagedCanvas &gfx, const GFXfont *font, uint32_t codepoint,
+                                 int16_t x, int16_t y, uint16_t color)
+{
+  GlyphCache *cache = gfx.glyphCache();
+  if (!cache)
+  {
+    const GFXglyph *glyph = getFontGlyph(font, codepoint);
+    if (!glyph)
+      return 0;
+    drawUtf8Glyph(gfx, font, glyph, x, y, color);
+    return pgm_read_byte(&glyph->xAdvance);
+  }
+
+  CachedGlyph *entry = cache->get(font, codepoint);
+  if (!entry->glyph)
+    return 0;
+  if (entry->width == 0 || entry->height == 0 ||
+      !utf8AreaVisible(gfx, x + entry->xOffset, y + entry->yOffset, entry->width, entry->height))
+    return entry->xAdvance;
+
+  const uint8_t *rows = cache->rows(entry);
+  if (rows)
+    gfx.drawBitmapRows(x + entry->xOffset, y + entry->yOffset, rows, entry->stride,
+                       entry->width, entry->height, color);
+  else
+    drawUtf8Glyph(gfx, font, entry->glyph, x, y, color);
+  return entry->xAdvance;
 }
 
 /**
@@ -69,7 +338,8 @@ inline uint8_t decodeUtf8Char(const char *str, uint16_t &codepoint)
  * @param color Text color
  * @param lineHeight Line height for newlines (0 = use font yAdvance)
  */
-inline void drawUtf8String(Adafruit_GFX &gfx, const GFXfont *font, const char *str,
+template <typename GFX>
+inline void drawUtf8String(GFX &gfx, const GFXfont *font, const char *str,
                            int16_t x, int16_t y, uint16_t color, uint16_t lineHeight = 0)
 {
   if (!font || !str)
@@ -83,8 +353,6 @@ inline void drawUtf8String(Adafruit_GFX &gfx, const GFXfont *font, const char *s
   int16_t startX = x;
 
   // Get font metrics
-  uint16_t fontFirst = pgm_read_word(&font->first);
-  uint16_t fontLast = pgm_read_word(&font->last);
   uint8_t yAdvance = pgm_read_byte(&font->yAdvance);
 
   if (lineHeight == 0)
@@ -94,7 +362,7 @@ inline void drawUtf8String(Adafruit_GFX &gfx, const GFXfont *font, const char *s
 
   while (*str)
   {
-    uint16_t codepoint;
+    uint32_t codepoint;
     uint8_t bytes = decodeUtf8Char(str, codepoint);
     str += bytes;
 
@@ -112,53 +380,8 @@ inline void drawUtf8String(Adafruit_GFX &gfx, const GFXfont *font, const char *s
       continue;
     }
 
-    // Check if character is in font range
-    if (codepoint >= fontFirst && codepoint <= fontLast)
-    {
-      // Get glyph data
-      uint16_t glyphIndex = codepoint - fontFirst;
-      GFXglyph *glyph = &(((GFXglyph *)pgm_read_ptr(&font->glyph))[glyphIndex]);
-
-      uint8_t w = pgm_read_byte(&glyph->width);
-      uint8_t h = pgm_read_byte(&glyph->height);
-      int8_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
-      int8_t yo = (int8_t)pgm_read_byte(&glyph->yOffset);
-      uint8_t xa = pgm_read_byte(&glyph->xAdvance);
-
-      if (w > 0 && h > 0)
-      {
-        // Draw the character bitmap
-        uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
-        uint8_t *bitmap = (uint8_t *)pgm_read_ptr(&font->bitmap);
-
-        uint8_t bit = 0;
-        uint8_t bits = 0;
-
-        for (uint8_t yy = 0; yy < h; yy++)
-        {
-          for (uint8_t xx = 0; xx < w; xx++)
-          {
-            if (!(bit++ & 7))
-            {
-              bits = pgm_read_byte(&bitmap[bo++]);
-            }
-            if (bits & 0x80)
-            {
-              gfx.drawPixel(cursorX + xo + xx, cursorY + yo + yy, color);
-            }
-            bits <<= 1;
-          }
-        }
-      }
-
-      // Advance cursor
-      cursorX += xa;
-    }
-    else
-    {
-      // Character not in font, draw a placeholder or skip
-      // Skip for now
-    }
+    // Draw the character bitmap and advance; characters not in the font are skipped
+    cursorX += drawUtf8Codepoint(gfx, font, codepoint, cursorX, cursorY, color);
   }
 }
 
@@ -171,13 +394,11 @@ inline uint16_t getUtf8StringWidth(const GFXfont *font, const char *str)
   if (!font || !str)
     return 0;
 
-  uint16_t fontFirst = pgm_read_word(&font->first);
-  uint16_t fontLast = pgm_read_word(&font->last);
   uint16_t width = 0;
 
   while (*str)
   {
-    uint16_t codepoint;
+    uint32_t codepoint;
     uint8_t bytes = decodeUtf8Char(str, codepoint);
     str += bytes;
 
@@ -187,10 +408,9 @@ inline uint16_t getUtf8StringWidth(const GFXfont *font, const char *str)
     if (codepoint == '\r')
       continue;
 
-    if (codepoint >= fontFirst && codepoint <= fontLast)
+    const GFXglyph *glyph = getFontGlyph(font, codepoint);
+    if (glyph)
     {
-      uint16_t glyphIndex = codepoint - fontFirst;
-      GFXglyph *glyph = &(((GFXglyph *)pgm_read_ptr(&font->glyph))[glyphIndex]);
       width += pgm_read_byte(&glyph->xAdvance);
     }
   }
@@ -201,7 +421,8 @@ inline uint16_t getUtf8StringWidth(const GFXfont *font, const char *str)
 /**
  * Draw a centered UTF-8 string.
  */
-inline void drawUtf8StringCentered(Adafruit_GFX &gfx, const GFXfont *font, const char *str,
+template <typename GFX>
+inline void drawUtf8StringCentered(GFX &gfx, const GFXfont *font, const char *str,
                                    int16_t centerX, int16_t y, uint16_t color)
 {
   uint16_t w = getUtf8StringWidth(font, str);
@@ -221,24 +442,21 @@ inline uint16_t getUtf8LineWidth(const GFXfont *font, const char *str, const cha
     return 0;
   }
 
-  uint16_t fontFirst = pgm_read_word(&font->first);
-  uint16_t fontLast = pgm_read_word(&font->last);
   uint16_t width = 0;
 
   const char *p = str;
   while (*p && *p != '\n')
   {
-    uint16_t codepoint;
+    uint32_t codepoint;
     uint8_t bytes = decodeUtf8Char(p, codepoint);
     p += bytes;
 
     if (codepoint == '\r')
       continue;
 
-    if (codepoint >= fontFirst && codepoint <= fontLast)
+    const GFXglyph *glyph = getFontGlyph(font, codepoint);
+    if (glyph)
     {
-      uint16_t glyphIndex = codepoint - fontFirst;
-      GFXglyph *glyph = &(((GFXglyph *)pgm_read_ptr(&font->glyph))[glyphIndex]);
       width += pgm_read_byte(&glyph->xAdvance);
     }
   }
@@ -253,47 +471,185 @@ inline uint16_t getUtf8LineWidth(const GFXfont *font, const char *str, const cha
 }
 
 /**
- * Word-wrap UTF-8 text to fit within a maximum width.
- * Returns number of lines created. Modifies wrappedLines buffer.
+ * Draw multi-line UTF-8 text centered both horizontally and vertically within a rectangle.
+ * Each line is center-aligned.
  *
- * @param font The GFXfont to measure text width
- * @param str UTF-8 encoded text to wrap
+ * @param gfx The Adafruit_GFX display object
+ * @param font The GFXfont to use
+ * @param str UTF-8 encoded text (can contain \n for line breaks)
+ * @param centerX Center X coordinate of the rectangle
+ * @param centerY Center Y coordinate of the rectangle
+ * @param color Text color
+ */
+template <typename GFX>
+inline void drawUtf8MultiLineCentered(GFX &gfx, const GFXfont *font, const char *str,
+                                      int16_t centerX, int16_t centerY, uint16_t color)
+{
+  if (!font || !str || *str == '\0')
+    return;
+
+  // Get font metrics
+  uint8_t yAdvance = pgm_read_byte(&font->yAdvance);
+
+  // Count lines
+  int lineCount = 1;
+  for (const char *p = str; *p; p++)
+  {
+    if (*p == '\n')
+      lineCount++;
+  }
+
+  // Calculate vertical start position
+  int16_t totalHeight = lineCount * yAdvance;
+  int16_t currentY = centerY - totalHeight / 2 + yAdvance; // +yAdvance because y is baseline
+
+  // Process each line
+  const char *lineStart = str;
+
+  while (*lineStart)
+  {
+    // Find line width and next line pointer
+    const char *nextLine;
+    uint16_t lineWidth = getUtf8LineWidth(font, lineStart, &nextLine);
+
+    // Calculate starting X for this line (centered)
+    int16_t cursorX = centerX - lineWidth / 2;
+
+    // Draw characters in this line
+    const char *p = lineStart;
+    while (*p && *p != '\n')
+    {
+      uint32_t codepoint;
+      uint8_t bytes = decodeUtf8Char(p, codepoint);
+      p += bytes;
+
+      if (codepoint == '\r')
+        continue;
+
+      cursorX += drawUtf8Codepoint(gfx, font, codepoint, cursorX, currentY, color);
+    }
+
+    // Move to next line
+    currentY += yAdvance;
+    lineStart = nextLine;
+  }
+}
+
+// Line capacity of a Utf8TextLayout (one slot is kept for a trailing empty line)
+#ifndef UTF8_LAYOUT_MAX_LINES
+#define UTF8_LAYOUT_MAX_LINES 16
+#endif
+
+/**
+ * One laid-out line: a byte span of the source text plus its measured
+ * width and final position.
+ */
+struct Utf8LayoutLine
+{
+  uint16_t start;   // Byte offset of the first character in the source text
+  uint16_t length;  // Length in bytes (excludes the break character)
+  uint16_t width;   // Pixel width (sum of xAdvance)
+  int16_t x;        // Left x of the line (already centered)
+  int16_t baseline; // Baseline y
+  int16_t top;      // Topmost glyph pixel row
+  int16_t bottom;   // One past the bottommost glyph pixel row
+};
+
+/**
+ * Wrapped and positioned text, produced once by layoutUtf8Text() and then
+ * replayed by drawUtf8Layout() on every firstPage()/nextPage() pass.
+ * Holds a pointer to the source text, which must outlive the layout.
+ */
+struct Utf8TextLayout
+{
+  const GFXfont *font;
+  const char *text;
+  uint8_t lineCount;
+  Utf8LayoutLine lines[UTF8_LAYOUT_MAX_LINES];
+};
+
+/**
+ * Position wrapped lines: each line horizontally centered, the block
+ * vertically centered. Expects line top/bottom relative to the baseline
+ * and turns them into absolute rows.
+ */
+inline void positionUtf8Layout(Utf8TextLayout &layout, int16_t centerX, int16_t centerY)
+{
+  uint8_t yAdvance = pgm_read_byte(&layout.font->yAdvance);
+  int16_t totalHeight = layout.lineCount * yAdvance;
+  int16_t currentY = centerY - totalHeight / 2 + yAdvance; // +yAdvance because y is baseline
+  for (uint8_t i = 0; i < layout.lineCount; i++)
+  {
+    layout.lines[i].x = centerX - layout.lines[i].width / 2;
+    layout.lines[i].baseline = currentY;
+    layout.lines[i].top += currentY;
+    layout.lines[i].bottom += currentY;
+    currentY += yAdvance;
+  }
+}
+
+// Longest text wrapUtf8Lines() handles in one call (line offsets are 16 bit)
+#define UTF8_WRAP_MAX_OFFSET 0xFFFF
+
+/**
+ * Word-wrap UTF-8 text without copying it: lines are returned as byte spans
+ * of the original string, with their width and vertical glyph extent
+ * relative to the baseline (x and baseline are left to the caller).
+ *
+ * Breaks at the last space that fits (the space is dropped), inside a word
+ * if it has none, and at every '\n'. A trailing break leaves an empty last
+ * line, which still counts for vertical centering; it may use one slot
+ * beyond maxLines, so lines must hold maxLines + 1 entries.
+ *
+ * @param font The GFXfont used to measure text width
+ * @param str UTF-8 encoded text
  * @param maxWidth Maximum pixel width per line
- * @param wrappedLines Output buffer for wrapped text (must be large enough!)
- * @param maxLines Maximum number of lines to create
- * @return Number of lines created
+ * @param lines Output array, capacity maxLines + 1
+ * @param maxLines Maximum number of text lines
+ * @param rest Optional output: first byte not placed on a line (end of str if all fit)
+ * @return Number of lines written
  */
-inline int wrapUtf8Text(const GFXfont *font, const char *str, uint16_t maxWidth,
-                        char *wrappedLines, int maxLines)
+inline uint8_t wrapUtf8Lines(const GFXfont *font, const char *str, uint16_t maxWidth,
+                             Utf8LayoutLine *lines, uint8_t maxLines, const char **rest = nullptr)
 {
-  if (!font || !str || !wrappedLines || maxLines <= 0)
+  if (rest)
+    *rest = str;
+  if (!font || !str || !lines || *str == '\0')
     return 0;
 
-  uint16_t fontFirst = pgm_read_word(&font->first);
-  uint16_t fontLast = pgm_read_word(&font->last);
-
-  int lineCount = 0;
+  uint8_t lineCount = 0;
   const char *p = str;
-  char *out = wrappedLines;
+  bool endedWithBreak = false;
 
-  while (*p && lineCount < maxLines)
+  while (*p && lineCount < maxLines && p - str < UTF8_WRAP_MAX_OFFSET)
   {
-    uint16_t lineWidth = 0;
     const char *lineStart = p;
+    const char *lineEnd = nullptr;
+    uint16_t lineWidth = 0;
+    uint16_t width = 0;
     const char *lastSpace = nullptr;
-    const char *lastSpaceOut = out;
+    uint16_t widthAtLastSpace = 0;
+    endedWithBreak = false;
+
+    // Vertical glyph extent relative to the baseline, for page-band culling
+    int8_t lineTop = 0, lineBottom = 0;
+    int8_t top = 0, bottom = 0;
+    int8_t topAtLastSpace = 0, bottomAtLastSpace = 0;
 
-    // Build line until we exceed maxWidth
-    while (*p)
+    while (*p && p - str < UTF8_WRAP_MAX_OFFSET)
     {
-      uint16_t codepoint;
+      uint32_t codepoint;
       uint8_t bytes = decodeUtf8Char(p, codepoint);
 
-      // Handle existing newlines
+      // Existing newline ends the line
       if (codepoint == '\n')
       {
-        *out++ = '\n';
+        lineEnd = p;
+        width = lineWidth;
+        top = lineTop;
+        bottom = lineBottom;
         p += bytes;
+        endedWithBreak = true;
         break;
       }
 
@@ -303,163 +659,429 @@ inline int wrapUtf8Text(const GFXfont *font, const char *str, uint16_t maxWidth,
         continue;
       }
 
-      // Get character width
       uint16_t charWidth = 0;
-      if (codepoint >= fontFirst && codepoint <= fontLast)
+      int8_t charTop = 0, charBottom = 0;
+      const GFXglyph *glyph = getFontGlyph(font, codepoint);
+      if (glyph)
       {
-        uint16_t glyphIndex = codepoint - fontFirst;
-        GFXglyph *glyph = &(((GFXglyph *)pgm_read_ptr(&font->glyph))[glyphIndex]);
         charWidth = pgm_read_byte(&glyph->xAdvance);
+        if (pgm_read_byte(&glyph->height) > 0)
+        {
+          charTop = (int8_t)pgm_read_byte(&glyph->yOffset);
+          charBottom = charTop + pgm_read_byte(&glyph->height);
+        }
       }
 
-      // Check if adding this character would exceed width
+      // Break before the character that would exceed the width
       if (lineWidth + charWidth > maxWidth && lineStart != p)
       {
-        // Line too long, need to break
         if (lastSpace != nullptr)
         {
-          // Break at last space
-          out = (char *)lastSpaceOut;
-          p = lastSpace;
-          // Skip the space
-          uint16_t dummy;
-          p += decodeUtf8Char(p, dummy);
+          // Break at last space and skip it
+          lineEnd = lastSpace;
+          width = widthAtLastSpace;
+          top = topAtLastSpace;
+          bottom = bottomAtLastSpace;
+          p = lastSpace + 1;
         }
-        // else: no space found, break at current position (word too long)
-
-        *out++ = '\n';
+        else
+        {
+          // No space found, break inside the word
+          lineEnd = p;
+          width = lineWidth;
+          top = lineTop;
+          bottom = lineBottom;
+        }
+        endedWithBreak = true;
         break;
       }
 
-      // Track spaces for word wrapping
       if (codepoint == ' ')
       {
         lastSpace = p;
-        lastSpaceOut = out;
-      }
-
-      // Copy character bytes to output
-      for (uint8_t i = 0; i < bytes; i++)
-      {
-        *out++ = *p++;
+        widthAtLastSpace = lineWidth;
+        topAtLastSpace = lineTop;
+        bottomAtLastSpace = lineBottom;
       }
 
+      p += bytes;
       lineWidth += charWidth;
+      if (charTop < lineTop)
+        lineTop = charTop;
+      if (charBottom > lineBottom)
+        lineBottom = charBottom;
+    }
+
+    if (lineEnd == nullptr)
+    {
+      lineEnd = p;
+      width = lineWidth;
+      top = lineTop;
+      bottom = lineBottom;
     }
 
-    lineCount++;
+    Utf8LayoutLine &line = lines[lineCount++];
+    line.start = lineStart - str;
+    line.length = lineEnd - lineStart;
+    line.width = width;
+    line.top = top;
+    line.bottom = bottom;
+  }
+
+  if (endedWithBreak)
+  {
+    Utf8LayoutLine &line = lines[lineCount++];
+    line.start = p - str;
+    line.length = 0;
+    line.width = 0;
+    line.top = 0;
+    line.bottom = 0;
   }
 
-  *out = '\0'; // Null terminate
+  if (rest)
+    *rest = p;
   return lineCount;
 }
 
 /**
- * Draw multi-line UTF-8 text centered both horizontally and vertically within a rectangle.
- * Each line is center-aligned.
+ * Word-wrap, measure and position UTF-8 text in a single pass.
+ * Wrapping is done by wrapUtf8Lines(); lines are centered horizontally and
+ * the block vertically in the box.
  *
- * @param gfx The Adafruit_GFX display object
- * @param font The GFXfont to use
- * @param str UTF-8 encoded text (can contain \n for line breaks)
- * @param centerX Center X coordinate of the rectangle
- * @param centerY Center Y coordinate of the rectangle
- * @param color Text color
+ * @param layout Output layout
+ * @param font The GFXfont used to measure text width
+ * @param str UTF-8 encoded text (must stay valid while the layout is used)
+ * @param centerX Center X of the box
+ * @param centerY Center Y of the box
+ * @param maxWidth Maximum width for text (pixels)
+ * @param maxHeight Maximum height for text (pixels)
+ * @return Number of lines in the layout
  */
-inline void drawUtf8MultiLineCentered(Adafruit_GFX &gfx, const GFXfont *font, const char *str,
-                                      int16_t centerX, int16_t centerY, uint16_t color)
+inline uint8_t layoutUtf8Text(Utf8TextLayout &layout, const GFXfont *font, const char *str,
+                              int16_t centerX, int16_t centerY, uint16_t maxWidth, uint16_t maxHeight)
 {
+  layout.font = font;
+  layout.text = str;
+  layout.lineCount = 0;
+
   if (!font || !str || *str == '\0')
-    return;
+    return 0;
 
-  // Get font metrics
   uint8_t yAdvance = pgm_read_byte(&font->yAdvance);
-  uint16_t fontFirst = pgm_read_word(&font->first);
-  uint16_t fontLast = pgm_read_word(&font->last);
 
-  // Count lines
-  int lineCount = 1;
-  for (const char *p = str; *p; p++)
-  {
-    if (*p == '\n')
-      lineCount++;
-  }
+  // Calculate max lines that fit in height
+  int maxLines = maxHeight / yAdvance;
+  if (maxLines < 1)
+    maxLines = 1;
+  if (maxLines > UTF8_LAYOUT_MAX_LINES - 1)
+    maxLines = UTF8_LAYOUT_MAX_LINES - 1;
 
-  // Calculate vertical start position
-  int16_t totalHeight = lineCount * yAdvance;
-  int16_t currentY = centerY - totalHeight / 2 + yAdvance; // +yAdvance because y is baseline
+  layout.lineCount = wrapUtf8Lines(font, str, maxWidth, layout.lines, maxLines);
+  positionUtf8Layout(layout, centerX, centerY);
+  return layout.lineCount;
+}
 
-  // Process each line
-  const char *lineStart = str;
+/**
+ * Check whether a layout holds its whole source text, i.e. layoutUtf8Text()
+ * did not stop at the line limit of the box.
+ */
+inline bool utf8LayoutComplete(const Utf8TextLayout &layout)
+{
+  if (!layout.text)
+    return true;
+  if (layout.lineCount == 0)
+    return *layout.text == '\0';
 
-  while (*lineStart)
-  {
-    // Find line width and next line pointer
-    const char *nextLine;
-    uint16_t lineWidth = getUtf8LineWidth(font, lineStart, &nextLine);
+  const Utf8LayoutLine &last = layout.lines[layout.lineCount - 1];
+  return layout.text[last.start + last.length] == '\0';
+}
 
-    // Calculate starting X for this line (centered)
-    int16_t cursorX = centerX - lineWidth / 2;
+/**
+ * Bounding box of the pixels drawUtf8Layout() would set. Rows come from the
+ * line extents; columns are measured from the glyph offsets and widths at
+ * the line ends, which may reach past the advance-based line width.
+ *
+ * @return false if the layout draws nothing
+ */
+inline bool getUtf8LayoutBounds(const Utf8TextLayout &layout, int16_t &x, int16_t &y, int16_t &w, int16_t &h)
+{
+  const GFXfont *font = layout.font;
+  if (!font || !layout.text)
+    return false;
 
-    // Draw characters in this line
-    const char *p = lineStart;
-    while (*p && *p != '\n')
-    {
-      uint16_t codepoint;
-      uint8_t bytes = decodeUtf8Char(p, codepoint);
-      p += bytes;
+  int16_t x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+  for (uint8_t i = 0; i < layout.lineCount; i++)
+  {
+    const Utf8LayoutLine &line = layout.lines[i];
+    if (line.bottom <= line.top)
+      continue;
 
+    const char *p = layout.text + line.start;
+    const char *end = p + line.length;
+    int16_t cursorX = line.x;
+    while (p < end)
+    {
+      uint32_t codepoint;
+      p += decodeUtf8Char(p, codepoint);
       if (codepoint == '\r')
         continue;
 
-      if (codepoint >= fontFirst && codepoint <= fontLast)
+      const GFXglyph *glyph = getFontGlyph(font, codepoint);
+      if (!glyph)
+        continue;
+
+      uint8_t gw = pgm_read_byte(&glyph->width);
+      if (gw > 0 && pgm_read_byte(&glyph->height) > 0)
       {
-        uint16_t glyphIndex = codepoint - fontFirst;
-        GFXglyph *glyph = &(((GFXglyph *)pgm_read_ptr(&font->glyph))[glyphIndex]);
+        int16_t gx = cursorX + (int8_t)pgm_read_byte(&glyph->xOffset);
+        if (gx < x0)
+          x0 = gx;
+        if (gx + gw > x1)
+          x1 = gx + gw;
+      }
+      cursorX += pgm_read_byte(&glyph->xAdvance);
+    }
+    if (line.top < y0)
+      y0 = line.top;
+    if (line.bottom > y1)
+      y1 = line.bottom;
+  }
 
-        uint8_t w = pgm_read_byte(&glyph->width);
-        uint8_t h = pgm_read_byte(&glyph->height);
-        int8_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
-        int8_t yo = (int8_t)pgm_read_byte(&glyph->yOffset);
-        uint8_t xa = pgm_read_byte(&glyph->xAdvance);
+  if (x0 >= x1 || y0 >= y1)
+    return false;
+  x = x0;
+  y = y0;
+  w = x1 - x0;
+  h = y1 - y0;
+  return true;
+}
 
-        if (w > 0 && h > 0)
-        {
-          uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
-          uint8_t *bitmap = (uint8_t *)pgm_read_ptr(&font->bitmap);
-
-          uint8_t bit = 0;
-          uint8_t bits = 0;
-
-          for (uint8_t yy = 0; yy < h; yy++)
-          {
-            for (uint8_t xx = 0; xx < w; xx++)
-            {
-              if (!(bit++ & 7))
-              {
-                bits = pgm_read_byte(&bitmap[bo++]);
-              }
-              if (bits & 0x80)
-              {
-                gfx.drawPixel(cursorX + xo + xx, currentY + yo + yy, color);
-              }
-              bits <<= 1;
-            }
-          }
-        }
+// Hash slots of Utf8TextMetrics (power of two); text with more distinct codepoints falls back to full layouts
+#ifndef UTF8_METRICS_SLOTS
+#define UTF8_METRICS_SLOTS 128
+#endif
 
-        cursorX += xa;
-      }
+/**
+ * Font-independent summary of a string: how often each codepoint occurs.
+ * Built with one decoding pass, after which the text width in any font is
+ * a sum over the distinct codepoints instead of a walk over the string.
+ */
+struct Utf8TextMetrics
+{
+  bool overflow;   // More distinct codepoints than slots
+  bool hasNewline;
+  uint16_t spaces;
+  uint16_t codepoints[UTF8_METRICS_SLOTS]; // Open addressing, slot used if uses > 0 (fonts stop at U+FFFF)
+  uint16_t uses[UTF8_METRICS_SLOTS];
+};
+
+inline void measureUtf8Text(Utf8TextMetrics &metrics, const char *str)
+{
+  memset(metrics.uses, 0, sizeof(metrics.uses));
+  metrics.overflow = false;
+  metrics.hasNewline = false;
+  metrics.spaces = 0;
+  if (!str)
+    return;
+
+  uint16_t used = 0;
+  for (const char *p = str; *p;)
+  {
+    uint32_t codepoint;
+    p += decodeUtf8Char(p, codepoint);
+
+    if (codepoint == '\n')
+    {
+      metrics.hasNewline = true;
+      continue;
     }
+    if (codepoint == '\r')
+      continue;
+    if (codepoint == ' ')
+    {
+      metrics.spaces++;
+      continue;
+    }
+    if (codepoint > 0xFFFF)
+      continue; // No GFX font has glyphs here, so no width in any size
 
-    // Move to next line
-    currentY += yAdvance;
-    lineStart = nextLine;
+    // Multiplicative hash, linear probing
+    uint16_t slot = (uint16_t)(codepoint * 0x9E37u) % UTF8_METRICS_SLOTS;
+    while (metrics.uses[slot] && metrics.codepoints[slot] != codepoint)
+      slot = (slot + 1) % UTF8_METRICS_SLOTS;
+
+    if (metrics.uses[slot])
+    {
+      metrics.uses[slot]++;
+    }
+    else if (used < UTF8_METRICS_SLOTS - 1)
+    {
+      metrics.codepoints[slot] = codepoint;
+      metrics.uses[slot] = 1;
+      used++;
+    }
+    else
+    {
+      metrics.overflow = true;
+    }
+  }
+}
+
+// Result of checking text metrics against a box, see utf8MetricsFit()
+enum Utf8Fit
+{
+  UTF8_FIT_NO,
+  UTF8_FIT_YES,
+  UTF8_FIT_MAYBE // Needs a full layout to tell
+};
+
+/**
+ * Check whether text can fit a box in a font from its metrics alone: the
+ * non-space width must fit on the available lines, and text without breaks
+ * that is narrower than the box fits on one line.
+ */
+inline Utf8Fit utf8MetricsFit(const Utf8TextMetrics &metrics, const GFXfont *font,
+                              uint16_t maxWidth, uint16_t maxHeight)
+{
+  if (metrics.overflow)
+    return UTF8_FIT_MAYBE;
+
+  uint32_t inkWidth = 0;
+  uint8_t widestGlyph = 0;
+  for (uint16_t i = 0; i < UTF8_METRICS_SLOTS; i++)
+  {
+    if (!metrics.uses[i])
+      continue;
+    const GFXglyph *glyph = getFontGlyph(font, metrics.codepoints[i]);
+    if (glyph)
+    {
+      uint8_t advance = pgm_read_byte(&glyph->xAdvance);
+      inkWidth += (uint32_t)metrics.uses[i] * advance;
+      if (advance > widestGlyph)
+        widestGlyph = advance;
+    }
+  }
+  uint32_t spaceWidth = 0;
+  const GFXglyph *space = getFontGlyph(font, ' ');
+  if (space)
+    spaceWidth = (uint32_t)metrics.spaces * pgm_read_byte(&space->xAdvance);
+
+  int maxLines = maxHeight / pgm_read_byte(&font->yAdvance);
+  if (maxLines < 1)
+    maxLines = 1;
+  if (maxLines > UTF8_LAYOUT_MAX_LINES - 1)
+    maxLines = UTF8_LAYOUT_MAX_LINES - 1;
+
+  // Spaces at breaks are dropped, everything else needs room on some line
+  // (a glyph wider than the box gets a line to itself, so the bound does not hold)
+  if (widestGlyph <= maxWidth && inkWidth > (uint32_t)maxLines * maxWidth)
+    return UTF8_FIT_NO;
+  if (!metrics.hasNewline && inkWidth + spaceWidth <= maxWidth)
+    return UTF8_FIT_YES;
+  return UTF8_FIT_MAYBE;
+}
+
+/**
+ * Lay out text in the largest font that fits the box.
+ *
+ * fonts must be ordered largest first. Most text fits the largest font, so
+ * that is tried directly. Otherwise the string is decoded once into
+ * Utf8TextMetrics and a binary search over the smaller sizes using only
+ * those metrics finds the largest candidate, which is confirmed with a full
+ * layout; only if it overflows are the remaining sizes binary searched with
+ * full layouts. If no font fits, the smallest one is used and the text is
+ * cut at the box height, like layoutUtf8Text().
+ *
+ * @param layout Output: layout in the chosen font
+ * @param metrics Scratch space for the codepoint counts, owned by the caller
+ * @return Index of the chosen font in fonts
+ */
+inline uint8_t fitUtf8Text(Utf8TextLayout &layout, Utf8TextMetrics &metrics, const GFXfont *const *fonts,
+                           uint8_t fontCount, const char *str, int16_t centerX, int16_t centerY,
+                           uint16_t maxWidth, uint16_t maxHeight)
+{
+  layoutUtf8Text(layout, fontCount ? fonts[0] : nullptr, str, centerX, centerY, maxWidth, maxHeight);
+  if (fontCount <= 1 || utf8LayoutComplete(layout))
+    return 0;
+
+  measureUtf8Text(metrics, str);
+
+  // Largest remaining font the metrics do not rule out
+  uint8_t lo = 1;
+  uint8_t hi = fontCount - 1;
+  while (lo < hi)
+  {
+    uint8_t mid = (lo + hi) / 2;
+    if (utf8MetricsFit(metrics, fonts[mid], maxWidth, maxHeight) == UTF8_FIT_NO)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  Utf8Fit fit = utf8MetricsFit(metrics, fonts[lo], maxWidth, maxHeight);
+  layoutUtf8Text(layout, fonts[lo], str, centerX, centerY, maxWidth, maxHeight);
+  if (fit == UTF8_FIT_YES || lo == fontCount - 1 || utf8LayoutComplete(layout))
+    return lo;
+
+  // Candidate overflows: binary search the smaller fonts with full layouts
+  lo++;
+  hi = fontCount - 1;
+  int16_t laidOut = -1;
+  while (lo < hi)
+  {
+    uint8_t mid = (lo + hi) / 2;
+    layoutUtf8Text(layout, fonts[mid], str, centerX, centerY, maxWidth, maxHeight);
+    laidOut = mid;
+    if (utf8LayoutComplete(layout))
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+
+  if (laidOut != lo)
+    layoutUtf8Text(layout, fonts[lo], str, centerX, centerY, maxWidth, maxHeight);
+  return lo;
+}
+
+/**
+ * Draw a layout produced by layoutUtf8Text(). Only decodes and blits glyphs;
+ * no wrapping or measuring is repeated, and lines outside the current page
+ * band are skipped without decoding them.
+ */
+template <typename GFX>
+inline void drawUtf8Layout(GFX &gfx, const Utf8TextLayout &layout, uint16_t color)
+{
+  const GFXfont *font = layout.font;
+  if (!font || !layout.text)
+    return;
+
+  for (uint8_t i = 0; i < layout.lineCount; i++)
+  {
+    const Utf8LayoutLine &line = layout.lines[i];
+    if (line.bottom <= line.top || !utf8AreaVisible(gfx, 0, line.top, gfx.width(), line.bottom - line.top))
+      continue;
+
+    const char *p = layout.text + line.start;
+    const char *end = p + line.length;
+    int16_t cursorX = line.x;
+
+    while (p < end)
+    {
+      uint32_t codepoint;
+      p += decodeUtf8Char(p, codepoint);
+
+      if (codepoint == '\r')
+        continue;
+
+      cursorX += drawUtf8Codepoint(gfx, font, codepoint, cursorX, line.baseline, color);
+    }
   }
 }
 
 /**
  * Draw multi-line UTF-8 text with automatic word wrapping to fit within a box.
- * Text is centered both horizontally and vertically.
+ * Text is centered both horizontally and vertically. Wraps into a layout on
+ * the stack and draws straight from str, so nothing is copied.
  *
  * @param gfx The Adafruit_GFX display object
  * @param font The GFXfont to use
@@ -470,29 +1092,14 @@ inline void drawUtf8MultiLineCentered(Adafruit_GFX &gfx, const GFXfont *font, co
  * @param maxHeight Maximum height for text (pixels)
  * @param color Text color
  */
-inline void drawUtf8MultiLineWrapped(Adafruit_GFX &gfx, const GFXfont *font, const char *str,
+template <typename GFX>
+inline void drawUtf8MultiLineWrapped(GFX &gfx, const GFXfont *font, const char *str,
                                      int16_t centerX, int16_t centerY,
                                      uint16_t maxWidth, uint16_t maxHeight, uint16_t color)
 {
-  if (!font || !str || *str == '\0')
-    return;
-
-  // Allocate buffer for wrapped text (max 1000 chars)
-  static char wrappedBuffer[1000];
-
-  // Get font metrics
-  uint8_t yAdvance = pgm_read_byte(&font->yAdvance);
-
-  // Calculate max lines that fit in height
-  int maxLines = maxHeight / yAdvance;
-  if (maxLines < 1)
-    maxLines = 1;
-
-  // Wrap text to fit width
-  int lineCount = wrapUtf8Text(font, str, maxWidth, wrappedBuffer, maxLines);
-
-  // Draw the wrapped text centered
-  drawUtf8MultiLineCentered(gfx, font, wrappedBuffer, centerX, centerY, color);
+  Utf8TextLayout layout;
+  layoutUtf8Text(layout, font, str, centerX, centerY, maxWidth, maxHeight);
+  drawUtf8Layout(gfx, layout, color);
 }
 
 #endif // UTF8_GFX_HELPER_H
@@ -0,0 +1,86 @@
+#include "Widget.h"
+
+Widget::Widget() : _x(0), _y(0), _w(0), _h(0), _visible(true), _dirty(true), _next(nullptr)
+{
+}
+
+void Widget::setBounds(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (x != _x || y != _y || w != _w || h != _h)
+  {
+    _x = x;
+    _y = y;
+    _w = w;
+    _h = h;
+    _dirty = true;
+  }
+}
+
+void Widget::setVisible(bool visible)
+{
+  if (visible != _visible)
+  {
+    _visible = visible;
+    _dirty = true;
+  }
+}
+
+Compositor::Compositor() : _first(nullptr), _last(nullptr)
+{
+}
+
+void Compositor::add(Widget &widget)
+{
+  widget._next = nullptr;
+  if (_last)
+    _last->_next = &widget;
+  else
+    _first = &widget;
+  _last = &widget;
+}
+
+void Compositor::invalidateAll()
+{
+  for (Widget *w = _first; w; w = w->_next)
+    w->_dirty = true;
+  _extra.clear();
+  _extra.add(0, 0, INT16_MAX, INT16_MAX);
+}
+
+DirtyRegion Compositor::dirtyRegion() const
+{
+  DirtyRegion region = _extra;
+  for (const Widget *w = _first; w; w = w->_next)
+  {
+    if (!w->_dirty)
+      continue;
+    // Pixels it leaves behind, and the ones it draws now
+    region.add(w->_shown);
+    if (w->_visible)
+      region.add(w->_x, w->_y, w->_w, w->_h);
+  }
+  return region;
+}
+
+void Compositor::drawWidgets(PagedCanvas &canvas)
+{
+  canvas.fillScreen(GxEPD_WHITE);
+  for (Widget *w = _first; w; w = w->_next)
+  {
+    int16_t x = w->_x, y = w->_y, cw = w->_w, ch = w->_h;
+    if (w->_visible && canvas.clipToPage(x, y, cw, ch))
+      w->draw(canvas);
+  }
+}
+
+void Compositor::committed()
+{
+  for (Widget *w = _first; w; w = w->_next)
+  {
+    w->_shown.clear();
+    if (w->_visible)
+      w->_shown.add(w->_x, w->_y, w->_w, w->_h);
+    w->_dirty = false;
+  }
+  _extra.clear();
+}
@@ -0,0 +1,128 @@
+#ifndef WIDGET_H
+#define WIDGET_H
+
+#include <Arduino.h>
+#include "DirtyRegion.h"
+#include "PagedDisplay.h"
+
+/**
+ * Element of a retained screen: a box in display (rotated) coordinates, a
+ * dirty flag and a draw method.
+ *
+ * draw() must stay inside the bounds; the Compositor skips widgets on page
+ * bands and windows they do not touch. Changing the bounds or content only
+ * marks the widget; nothing is drawn until the Compositor refreshes.
+ */
+class Widget
+{
+public:
+  Widget();
+  virtual ~Widget() {}
+
+  // Draw into the current page band (white background is already there)
+  virtual void draw(PagedCanvas &canvas) = 0;
+
+  // Move or resize; the old and the new box are both redrawn
+  void setBounds(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  // Show or hide; a hidden widget's box is cleared on the next refresh
+  void setVisible(bool visible);
+
+  // Content changed: redraw the widget on the next refresh
+  void invalidate() { _dirty = true; }
+
+  bool isDirty() const { return _dirty; }
+  bool isVisible() const { return _visible; }
+  int16_t x() const { return _x; }
+  int16_t y() const { return _y; }
+  int16_t width() const { return _w; }
+  int16_t height() const { return _h; }
+
+private:
+  friend class Compositor;
+
+  int16_t _x, _y, _w, _h;
+  DirtyRegion _shown; // Box the widget covers on the panel (empty if hidden or never drawn)
+  bool _visible;
+  bool _dirty;
+  Widget *_next; // Next widget of the Compositor, drawn on top of this one
+};
+
+/**
+ * Redraws a retained screen with the smallest partial window: the union of
+ * the old and new boxes of every invalidated widget. Widgets the window only
+ * overlaps are drawn again as well (the window is cleared to white first), so
+ * screens need no hand-tuned refresh rectangles.
+ *
+ * Widgets are linked into the Compositor, nothing is allocated.
+ */
+class Compositor
+{
+public:
+  Compositor();
+
+  // Append a widget; later widgets are drawn on top
+  void add(Widget &widget);
+
+  // Redraw a screen area regardless of widgets, e.g. after a ghosting tile flash
+  void invalidate(int16_t x, int16_t y, int16_t w, int16_t h) { _extra.add(x, y, w, h); }
+
+  // Redraw everything on the next refresh
+  void invalidateAll();
+
+  // Window the next partial refresh needs (unclipped, unaligned); empty if nothing changed
+  DirtyRegion dirtyRegion() const;
+
+  // Draw every visible widget that touches the current page band and window
+  void drawWidgets(PagedCanvas &canvas);
+
+  // The current state is on the panel: clear all dirty flags
+  void committed();
+
+  // Window of the last refresh (full screen for full refreshes)
+  const DirtyRegion &lastWindow() const { return _window; }
+
+  /**
+   * Draw the invalidated part of the screen and refresh it; full = whole
+   * screen in full refresh mode. Returns false if nothing had changed (the
+   * panel is left alone). Powering the panel down is up to the caller.
+   */
+  template <typename Display>
+  bool refresh(Display &display, bool full)
+  {
+    _window.clear();
+    if (full)
+    {
+      _window.add(0, 0, display.width(), display.height());
+      display.setFullWindow();
+    }
+    else
+    {
+      _window = dirtyRegion();
+      _window.clip(display.width(), display.height());
+      _window.alignX(8);
+      if (_window.isEmpty())
+      {
+        committed();
+        return false;
+      }
+      display.setPartialWindow(_window.x(), _window.y(), _window.width(), _window.height());
+    }
+
+    display.firstPage();
+    do
+    {
+      drawWidgets(display);
+    } while (display.nextPage());
+    committed();
+    return true;
+  }
+
+private:
+  Widget *_first;
+  Widget *_last;
+  DirtyRegion _extra; // Areas invalidated directly
+  DirtyRegion _window;
+};
+
+#endif // WIDGET_H
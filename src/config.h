@@ -40,8 +40,20 @@ const unsigned long POWER_BUTTON_SLEEP_MS = 1000;  // Time required to enter sle
 
 // Display refresh configuration
 const int FULL_REFRESH_INTERVAL = -1;                        // -1 = never, 0 = always, N = every N updates
-const unsigned long BUTTON_DEBOUNCE_FULL_MS = 500;           // Debounce time after full refresh
-const unsigned long BUTTON_DEBOUNCE_PARTIAL_SINGLE_MS = 500; // Debounce time after single-region partial refresh (question only)
-const unsigned long BUTTON_DEBOUNCE_PARTIAL_DUAL_MS = 500;   // Debounce time after dual-region partial refresh (question + banner)
+
+// Ghosting scheduler (GhostingTracker): flash a screen region once partial updates flipped its
+// pixels this many times on average (0 = never); a full refresh if it covers more than the given share
+const uint8_t GHOSTING_FLIPS_PER_PIXEL = 3;
+const int GHOSTING_FULL_REFRESH_PERCENT = 75;
+
+// Display task (DisplayManager)
+const int DISPLAY_QUEUE_LENGTH = 8;     // Display jobs waiting while the panel refreshes
+const int DISPLAY_TASK_STACK = 8192;    // Stack of the render/refresh task in bytes
+const uint32_t EPD_BUSY_WAIT_MS = 50;   // Longest sleep per BUSY check if the interrupt edge is missed
+
+// Panel controller power between jobs: the booster goes off after the first idle time, the controller
+// hibernates after the second (the next refresh then has to reset and re-initialize it; 0 = right away)
+const uint32_t EPD_POWER_OFF_IDLE_MS = 1000;
+const uint32_t EPD_HIBERNATE_IDLE_MS = 20000;
 
 #endif // CONFIG_H
@@ -1,18 +1,24 @@
 #include <Arduino.h>
-#include <GxEPD2_BW.h>
 #include <SPI.h>
 
 #include "config.h"
 #include "BatteryMonitor.h"
 #include "ButtonHandler.h"
+#include "Chrome.h"
 #include "DisplayManager.h"
 #include "PowerManager.h"
 #include "SDCardManager.h"
-#include "Lexend_Bold24pt7b.h"
-#include "Lexend_Light40pt7b.h"
+#include "DeckFonts.h"
+#include "DirtyRegion.h"
+#include "GhostingTracker.h"
+#include "Prerenderer.h"
 #include "Utf8GfxHelper.h"
+#include "Widget.h"
 #include "Questions.h"
-#include "logo.h"
+#include "QuestionLayout.h"
+#ifdef RENDER_BENCHMARK
+#include "RenderBenchmark.h"
+#endif
 
 // Current question state
 int currentQuestionIndex = 0;
@@ -26,39 +32,256 @@ static int rawBat = 0;
 
 // GxEPD2 display - Using GxEPD2_426_GDEQ0426T82
 // Note: XteinkX4 has 4.26" 800x480 display
-GxEPD2_BW<GxEPD2_426_GDEQ0426T82, GxEPD2_426_GDEQ0426T82::HEIGHT> display(
-    GxEPD2_426_GDEQ0426T82(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+// PagedDisplay is a GxEPD2_BW replacement that lets Utf8GfxHelper blit glyphs into the page buffer
+EpdDisplay display(EpdPanel(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
 
 // Global managers
 static DisplayManager g_displayManager(display);
 static PowerManager g_powerManager(&g_displayManager);
 
-// Category tracking for selective refresh (global scope for initialization in setup)
-static char lastCategory[32] = "";
+// Unpacked glyphs of the deck fonts, shared by every page pass (GLYPH_CACHE_BYTES of rows, 28 B per entry)
+static GlyphCache g_glyphCache;
+
+// Neighbouring questions rendered ahead of time while the display task is idle (PRERENDER_BYTES of RAM)
+static Prerenderer g_prerender(GxEPD2_426_GDEQ0426T82::WIDTH_VISIBLE, GxEPD2_426_GDEQ0426T82::HEIGHT);
+
+// Pixel flips per screen tile since it was last flashed or fully refreshed, fed by the display with every frame it sends
+static GhostingTracker g_ghosting(GxEPD2_426_GDEQ0426T82::WIDTH, GxEPD2_426_GDEQ0426T82::HEIGHT);
+
+// Navigation presses since the last question was handed to the display task
+static int g_pendingPresses = 0;
 
-// Display helper functions
-void drawBorder()
+// Rounded frame around the question text, blitted from the pieces in Chrome.h
+class BorderWidget : public Widget
 {
-  // Draw 5px thick rounded rectangle border
-  for (int i = 0; i < 5; i++)
+public:
+  BorderWidget() { setBounds(CHROME_BORDER_X, CHROME_BORDER_Y, CHROME_BORDER_W, CHROME_BORDER_H); }
+
+  void draw(PagedCanvas &canvas) override
   {
-    display.drawRoundRect(50 + i, 50 + i, 700 - i * 2, 320 - i * 2, 20, GxEPD_BLACK);
+    bool blitted = true;
+    for (uint8_t i = 0; i < CHROME_BORDER_PIECES && blitted; i++)
+      blitted = drawChrome(canvas, CHROME_BORDER[i]);
+    if (blitted)
+      return;
+
+    // Rotated display: draw 5px thick rounded rectangle border
+    for (int i = 0; i < CHROME_BORDER_THICKNESS; i++)
+    {
+      canvas.drawRoundRect(CHROME_BORDER_X + i, CHROME_BORDER_Y + i, CHROME_BORDER_W - i * 2,
+                           CHROME_BORDER_H - i * 2, CHROME_BORDER_RADIUS, GxEPD_BLACK);
+    }
   }
-}
+};
 
-void drawQuestionText(const char *text)
+// Question text layout, loaded once per question and replayed on every page pass
+static Utf8TextLayout questionLayout;
+
+void layoutQuestion(Utf8TextLayout &layout, int index)
 {
   // Display question centered in rectangle (50,50,700,320)
   // Rectangle center: (400, 210)
-  // Inner box is 700x320, with padding we use 640x280 for text
-  drawUtf8MultiLineWrapped(display, &Lexend_Light40pt7b, text, 400, 210, 640, 280, GxEPD_BLACK);
+  // Inner box is 700x320, with padding we use 640x280 for text (QUESTION_BOX in convert_csv.py)
+#ifdef RUNTIME_LAYOUT
+  fitQuestionLayout(layout, index);
+#else
+  loadQuestionLayout(layout, index);
+#endif
 }
 
-void drawCategoryBanner(const char *category)
+void layoutQuestionText(int index)
+{
+  layoutQuestion(questionLayout, index);
+}
+
+// Question text, from a prerendered frame or from questionLayout; bounds = ink box
+class QuestionTextWidget : public Widget
+{
+public:
+  QuestionTextWidget() : _frame(nullptr) {}
+
+  // Show a prerendered frame, or questionLayout if frame is nullptr
+  void show(const PrerenderedFrame *frame)
+  {
+    _frame = frame;
+    int16_t x = 0, y = 0, w = 0, h = 0;
+    if (frame)
+    {
+      x = frame->x;
+      y = frame->y;
+      w = frame->w;
+      h = frame->h;
+    }
+    else if (!getUtf8LayoutBounds(questionLayout, x, y, w, h))
+    {
+      w = h = 0;
+    }
+    setBounds(x, y, w, h);
+    invalidate();
+  }
+
+  void draw(PagedCanvas &canvas) override
+  {
+    if (_frame)
+      g_prerender.draw(canvas, *_frame);
+    else
+      drawUtf8Layout(canvas, questionLayout, GxEPD_BLACK);
+  }
+
+private:
+  const PrerenderedFrame *_frame;
+};
+
+// First question after index in a different category (index itself if there is only one category)
+int nextCategoryQuestion(int index)
 {
-  // Draw category banner at bottom (inverted colors)
-  display.fillRoundRect(250, 400, 300, 50, 10, GxEPD_BLACK);
-  drawUtf8StringCentered(display, &Lexend_Bold24pt7b, category, 400, 435, GxEPD_WHITE);
+  const char *currentCat = getQuestionCategory(index);
+  int nextIndex = (index + 1) % getQuestionCount();
+  while (strcmp(getQuestionCategory(nextIndex), currentCat) == 0 && nextIndex != index)
+  {
+    nextIndex = (nextIndex + 1) % getQuestionCount();
+  }
+  return nextIndex;
+}
+
+// Last question before index in a different category
+int prevCategoryQuestion(int index)
+{
+  const char *currentCat = getQuestionCategory(index);
+  int prevIndex = (index - 1 + getQuestionCount()) % getQuestionCount();
+  while (strcmp(getQuestionCategory(prevIndex), currentCat) == 0 && prevIndex != index)
+  {
+    prevIndex = (prevIndex - 1 + getQuestionCount()) % getQuestionCount();
+  }
+  return prevIndex;
+}
+
+// Category name at the bottom of the screen (inverted colors); redrawn only when the category changes
+class CategoryBannerWidget : public Widget
+{
+public:
+  CategoryBannerWidget() : _category("")
+  {
+    setBounds(CHROME_BANNER_X, CHROME_BANNER_Y, CHROME_BANNER_W, CHROME_BANNER_H);
+  }
+
+  void setCategory(const char *category)
+  {
+    if (strcmp(category, _category) != 0)
+      invalidate();
+    _category = category;
+  }
+
+  void draw(PagedCanvas &canvas) override
+  {
+    // Pre-rasterized by render_chrome.py; rasterize names it has not seen and rotated displays
+    const ChromeBitmap *banner = findChromeBanner(_category);
+    if (banner && drawChrome(canvas, *banner))
+      return;
+    canvas.fillRoundRect(CHROME_BANNER_X, CHROME_BANNER_Y, CHROME_BANNER_W, CHROME_BANNER_H, CHROME_BANNER_RADIUS,
+                         GxEPD_BLACK);
+    drawUtf8StringCentered(canvas, BANNER_FONT, _category, CHROME_BANNER_X + CHROME_BANNER_W / 2,
+                           CHROME_BANNER_BASELINE, GxEPD_WHITE);
+  }
+
+private:
+  const char *_category; // Points into the question table
+};
+
+// The question screen; partial refreshes cover only the widgets that changed
+static BorderWidget g_border;
+static QuestionTextWidget g_questionText;
+static CategoryBannerWidget g_banner;
+static Compositor g_questionScreen;
+
+// Questions one button press away from index, the ones worth prerendering
+void prerenderNeighbours(int index)
+{
+  int16_t candidates[PRERENDER_SLOTS] = {
+      int16_t((index + 1) % getQuestionCount()),
+      int16_t((index - 1 + getQuestionCount()) % getQuestionCount()),
+      int16_t(nextCategoryQuestion(index)),
+      int16_t(prevCategoryQuestion(index)),
+  };
+  g_prerender.setCandidates(candidates, PRERENDER_SLOTS);
+}
+
+// Idle work of the display task: one prerendered question per call
+bool prerenderIdle()
+{
+  return g_prerender.prerenderNext();
+}
+
+// Draw question index and refresh the panel; runs on the display task (DISPLAY_QUESTION)
+void renderQuestion(int index)
+{
+  static int refreshCount = 0;
+
+  // Prerendered text only needs its rows copied; otherwise wrap and measure once,
+  // each page pass only blits glyphs
+  const PrerenderedFrame *frame = g_prerender.find(index);
+  if (!frame)
+    layoutQuestionText(index);
+  g_questionText.show(frame);
+  g_banner.setCategory(getQuestionCategory(index));
+
+  // Determine if we need full refresh
+  bool useFullRefresh = false;
+  if (FULL_REFRESH_INTERVAL >= 0) // -1 means never do periodic full refresh
+  {
+    refreshCount++;
+    if (FULL_REFRESH_INTERVAL == 0 || refreshCount >= FULL_REFRESH_INTERVAL)
+    {
+      useFullRefresh = true;
+      refreshCount = 0;
+      Serial.println("Periodic full refresh");
+    }
+  }
+
+  // Flash over-flipped tiles black first, or fully refresh if they cover most of the screen
+  int16_t flashX = 0, flashY = 0, flashW = 0, flashH = 0;
+  bool flashing = !useFullRefresh && g_ghosting.flashWindow(flashX, flashY, flashW, flashH);
+  if (flashing && (uint32_t)flashW * flashH * 100 >
+                      (uint32_t)display.width() * display.height() * GHOSTING_FULL_REFRESH_PERCENT)
+  {
+    Serial.println("Ghosting full refresh");
+    useFullRefresh = true;
+    flashing = false;
+  }
+
+  if (flashing)
+  {
+    Serial.printf("Ghosting tile flash: %d x %d at (%d, %d)\n", flashW, flashH, flashX, flashY);
+    display.setPartialWindow(flashX, flashY, flashW, flashH);
+    display.firstPage();
+    do
+    {
+      display.fillScreen(GxEPD_BLACK);
+    } while (display.nextPage());
+    g_questionScreen.invalidate(flashX, flashY, flashW, flashH);
+  }
+
+  // Partial refresh covers the old and new box of every widget that changed (the outgoing and
+  // incoming question text, the banner on a category change); the rest of the panel stays as it is
+  bool bannerChanged = g_banner.isDirty();
+  if (g_questionScreen.refresh(display, useFullRefresh))
+  {
+    const DirtyRegion &window = g_questionScreen.lastWindow();
+    if (!useFullRefresh)
+      Serial.printf("Partial refresh: %d x %d at (%d, %d)%s\n", window.width(), window.height(), window.x(),
+                    window.y(), bannerChanged ? " incl. banner" : "");
+  }
+  else
+  {
+    Serial.println("Nothing changed, refresh skipped");
+  }
+  if (flashing)
+  {
+    g_ghosting.flashed(flashX, flashY, flashW, flashH);
+  }
+
+  // Get the next page turns ready once the queue is empty
+  prerenderNeighbours(index);
 }
 
 void setup()
@@ -104,6 +327,14 @@ void setup()
   // Ensure landscape orientation (rotation already set in DisplayManager)
   Serial.printf("Display size: %d x %d\n", display.width(), display.height());
 
+#ifdef RENDER_BENCHMARK
+  runRenderBenchmark(display);
+#endif
+
+  display.setGlyphCache(&g_glyphCache);
+  g_ghosting.setFlipsPerPixel(GHOSTING_FLIPS_PER_PIXEL);
+  display.setGhostingTracker(&g_ghosting);
+
   // SD Card Initialization
   if (g_sdManager.begin())
   {
@@ -115,34 +346,24 @@ void setup()
   }
 
   // Draw initial question screen with full refresh (includes border)
-  display.setFullWindow();
-  display.firstPage();
-  do
-  {
-    display.fillScreen(GxEPD_WHITE);
-
-    drawBorder();
-
-    const char *questionText = getQuestionText(currentQuestionIndex);
-    drawQuestionText(questionText);
-
-    const char *categoryText = getQuestionCategory(currentQuestionIndex);
-    drawCategoryBanner(categoryText);
-
-  } while (display.nextPage());
-  display.hibernate();
+  g_questionScreen.add(g_border);
+  g_questionScreen.add(g_questionText);
+  g_questionScreen.add(g_banner);
+  layoutQuestionText(currentQuestionIndex);
+  g_questionText.show(nullptr);
+  g_banner.setCategory(getQuestionCategory(currentQuestionIndex));
+  g_questionScreen.refresh(display, true);
   Serial.println("Question displayed");
+  g_glyphCache.printStats(Serial);
 
-  // Initialize category tracking for partial refresh optimization
-  strncpy(lastCategory, getQuestionCategory(currentQuestionIndex), 31);
-  lastCategory[31] = '\0';
-
-  // DisplayManager task not used - using direct synchronous rendering for button-driven navigation
-  // This approach is simpler, more predictable, and saves ~4KB RAM
-  // g_displayManager.setCurrentButton(NONE);
-  // g_displayManager.setDisplayCommand(DISPLAY_INITIAL);
-  // g_displayManager.startDisplayTask();
-  // Serial.println("Display task created");
+  // From here on the display task draws, and prerenders neighbours in between; loop() only posts jobs
+  g_prerender.setLayouter(layoutQuestion);
+  g_prerender.setGlyphCache(&g_glyphCache);
+  prerenderNeighbours(currentQuestionIndex);
+  g_displayManager.setQuestionRenderer(renderQuestion);
+  g_displayManager.setIdleWork(prerenderIdle);
+  g_displayManager.startDisplayTask();
+  Serial.println("Display task created");
 
   Serial.println("Setup complete!\n");
 }
@@ -174,6 +395,15 @@ void debugIO()
   Serial.println(g_battery.readVolts());
   Serial.print("Charge level: ");
   Serial.println(g_battery.readPercentage());
+  g_glyphCache.printStats(Serial);
+  g_prerender.printStats(Serial);
+  g_ghosting.printStats(Serial);
+  g_displayManager.printPowerStats(Serial);
+  if (display.hasShadow())
+  {
+    Serial.printf("Shadow framebuffer: %lu B not sent, %lu refreshes skipped\n",
+                  (unsigned long)display.shadowBytesAvoided(), (unsigned long)display.shadowRefreshesSkipped());
+  }
   Serial.println("");
 
   // SD card
@@ -182,19 +412,6 @@ void debugIO()
 
 void loop()
 {
-  // Debounce tracking
-  static unsigned long debounceEndTime = 0;
-  static int refreshCount = 0;
-
-  // Check if still in debounce window
-  if (millis() < debounceEndTime)
-  {
-    // Silently ignore button presses during debounce
-    g_buttonHandler.setLastButton(g_buttonHandler.getPressedButton());
-    delay(50);
-    return;
-  }
-
   Button currentButton = g_buttonHandler.getPressedButton();
   Button lastButton = g_buttonHandler.getLastButton();
 
@@ -231,110 +448,22 @@ void loop()
     else if (currentButton == VOLUME_UP)
     {
       // Next category - find next question in different category
-      const char *currentCat = getQuestionCategory(currentQuestionIndex);
-      int nextIndex = (currentQuestionIndex + 1) % getQuestionCount();
-      while (strcmp(getQuestionCategory(nextIndex), currentCat) == 0 && nextIndex != currentQuestionIndex)
-      {
-        nextIndex = (nextIndex + 1) % getQuestionCount();
-      }
-      currentQuestionIndex = nextIndex;
+      currentQuestionIndex = nextCategoryQuestion(currentQuestionIndex);
       needsRedraw = true;
       Serial.printf("Next category question: %d\n", currentQuestionIndex);
     }
     else if (currentButton == VOLUME_DOWN)
     {
       // Previous category - find previous question in different category
-      const char *currentCat = getQuestionCategory(currentQuestionIndex);
-      int prevIndex = (currentQuestionIndex - 1 + getQuestionCount()) % getQuestionCount();
-      while (strcmp(getQuestionCategory(prevIndex), currentCat) == 0 && prevIndex != currentQuestionIndex)
-      {
-        prevIndex = (prevIndex - 1 + getQuestionCount()) % getQuestionCount();
-      }
-      currentQuestionIndex = prevIndex;
+      currentQuestionIndex = prevCategoryQuestion(currentQuestionIndex);
       needsRedraw = true;
       Serial.printf("Previous category question: %d\n", currentQuestionIndex);
     }
 
-    // Redraw display if needed
+    // Redraw display if needed; the target is handed to the display task below
     if (needsRedraw)
     {
-      const char *currentCategory = getQuestionCategory(currentQuestionIndex);
-      bool categoryChanged = (strcmp(lastCategory, currentCategory) != 0);
-
-      // Determine if we need full refresh
-      bool useFullRefresh = false;
-      if (FULL_REFRESH_INTERVAL >= 0) // -1 means never do periodic full refresh
-      {
-        refreshCount++;
-        if (FULL_REFRESH_INTERVAL == 0 || refreshCount >= FULL_REFRESH_INTERVAL)
-        {
-          useFullRefresh = true;
-          refreshCount = 0;
-          Serial.println("Periodic full refresh");
-        }
-      }
-
-      if (useFullRefresh)
-      {
-        // Full refresh - redraw everything including border
-        display.setFullWindow();
-        display.firstPage();
-        do
-        {
-          display.fillScreen(GxEPD_WHITE);
-          drawBorder();
-          drawQuestionText(getQuestionText(currentQuestionIndex));
-          drawCategoryBanner(currentCategory);
-        } while (display.nextPage());
-        display.hibernate();
-
-        debounceEndTime = millis() + BUTTON_DEBOUNCE_FULL_MS;
-      }
-      else if (categoryChanged)
-      {
-        // Category changed - refresh both question and banner
-        Serial.println("Partial refresh (dual-region): question + banner");
-
-        // Single partial window covering both regions - redraw border to fix any erasure
-        display.setPartialWindow(60, 60, 675, 395);
-        display.firstPage();
-        do
-        {
-          display.fillScreen(GxEPD_WHITE);
-
-          // Redraw border in case it gets affected by the partial window
-          drawBorder();
-
-          drawQuestionText(getQuestionText(currentQuestionIndex));
-          drawCategoryBanner(currentCategory);
-        } while (display.nextPage());
-        display.hibernate();
-
-        debounceEndTime = millis() + BUTTON_DEBOUNCE_PARTIAL_DUAL_MS;
-
-        // Update category tracking
-        strncpy(lastCategory, currentCategory, 31);
-        lastCategory[31] = '\0';
-      }
-      else
-      {
-        // Same category - only refresh question area
-        Serial.println("Partial refresh (single-region): question only");
-
-        // Partial window with 10px margin from 5px border, stops before bottom border
-        // Border is at (50, 50, 700, 320), inner edge at (55, 55) to (745, 365)
-        // Partial window: 60 to 735 horizontally, 60 to 355 vertically (5px margin from bottom border)
-        display.setPartialWindow(60, 60, 675, 295);
-        display.firstPage();
-        do
-        {
-          display.fillScreen(GxEPD_WHITE);
-          drawQuestionText(getQuestionText(currentQuestionIndex));
-        } while (display.nextPage());
-        display.hibernate();
-
-        debounceEndTime = millis() + BUTTON_DEBOUNCE_PARTIAL_SINGLE_MS;
-      }
+      g_pendingPresses++;
     }
 
     // COMMENTED OUT: Old display update logic
@@ -356,21 +485,14 @@ void loop()
       // Power button long pressed => go to sleep
       if (currentTime - startTime > POWER_BUTTON_SLEEP_MS)
       {
-        // Display sleep screen with logo
+        // Display sleep screen with logo, after any question still being drawn
         Serial.println("Displaying sleep screen...");
-        display.setFullWindow();
-        display.firstPage();
-        do
-        {
-          display.fillScreen(GxEPD_WHITE);
-          display.drawBitmap(0, 0, logo, 800, 480, GxEPD_BLACK);
-        } while (display.nextPage());
-        display.hibernate();
+        g_displayManager.drawAndWait(DISPLAY_SLEEP);
 
         Serial.println("Entering deep sleep...");
         delay(1000);
 
-        // Enter deep sleep (without DisplayManager command)
+        // Enter deep sleep
         esp_deep_sleep_enable_gpio_wakeup(1ULL << BTN_GPIO3, ESP_GPIO_WAKEUP_GPIO_LOW);
         esp_deep_sleep_start();
       }
@@ -379,5 +501,19 @@ void loop()
 
   g_buttonHandler.setLastButton(currentButton);
 
+  // Presses during a refresh only move currentQuestionIndex; once the panel is free the
+  // display task draws the final target, so N quick presses cost one refresh, not N
+  if (g_pendingPresses > 0 && g_displayManager.isIdle())
+  {
+    if (g_pendingPresses > 1)
+    {
+      Serial.printf("Coalesced %d presses into question %d\n", g_pendingPresses, currentQuestionIndex);
+    }
+    if (g_displayManager.post(DISPLAY_QUESTION, currentQuestionIndex))
+    {
+      g_pendingPresses = 0;
+    }
+  }
+
   delay(50);
 }
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+"""
+Subset dense Adafruit GFX fonts to the glyphs the question deck uses.
+
+Reads fonts produced by ttf_to_gfx.py (dense first..last range) and writes a
+sparse font (see SparseFont.h) containing only the codepoints that occur in
+cards.csv and the category names, plus ' ' and '?' (the UTF-8 decoder's
+replacement character). Prints a flash-size report for every font.
+
+A deck character the source font lacks gets the glyph of a stand-in (see
+FALLBACK_GLYPHS, '?' for anything not listed) and a warning, so it is drawn
+and measured like any other character instead of vanishing. The script
+stops with an error if even the stand-in is missing.
+
+Run from the repository root:
+
+python src/subset_font.py [--rle] src/Lexend_Light40pt7b.h src/Lexend_Bold24pt7b.h
+
+Each input src/Name.h is written to src/Name_sparse.h. With --rle the glyph
+bitmaps are also run-length encoded into src/Name_rle.h (see RleGlyphReader
+in SparseFont.h), and the report gets an RLE column.
+"""
+
+import csv
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from convert_csv import CSV_FILE, CAT_MAP  # noqa: E402
+
+# Flash cost of the C structures on the ESP32 (4-byte pointers, 2-byte aligned glyphs)
+GLYPH_BYTES = 8        # sizeof(GFXglyph)
+CODEPOINT_BYTES = 2    # uint16_t
+FONT_BYTES = 16        # sizeof(GFXfont)
+SPARSE_FONT_BYTES = 20 # sizeof(SparseGFXfont)
+
+# Stand-ins for deck characters outside the source font's range
+FALLBACK_GLYPHS = {
+    0x2018: ord("'"), 0x2019: ord("'"), 0x201A: ord(','),
+    0x201C: ord('"'), 0x201D: ord('"'), 0x201E: ord('"'),
+    0x2013: ord('-'), 0x2014: ord('-'),
+}
+
+
+def deck_codepoints():
+    """Codepoints used by the question texts and category names."""
+    chars = set(' ?')
+    with open(CSV_FILE, 'r', encoding='utf-8') as f:
+        reader = csv.reader(f)
+        next(reader)  # skip header
+        for row in reader:
+            if not row or len(row) < 2:
+                continue
+            chars.update(row[1].replace('\xa0', ' '))
+    for name in CAT_MAP.values():
+        chars.update(name)
+    return sorted(ord(c) for c in chars if ord(c) >= 0x20)
+
+
+def parse_font(path):
+    """Parse a dense GFX font header into (name, bitmaps, glyphs, first, last, yAdvance)."""
+    with open(path, 'r', encoding='ascii') as f:
+        src = f.read()
+
+    m = re.search(r'const uint8_t (\w+)Bitmaps\[\] PROGMEM = \{(.*?)\};', src, re.S)
+    name = m.group(1)
+    bitmaps = [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]{2}', m.group(2))]
+
+    m = re.search(r'const GFXglyph \w+Glyphs\[\] PROGMEM = \{(.*?)\n\};', src, re.S)
+    glyphs = [tuple(int(v) for v in g)
+              for g in re.findall(r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}',
+                                  m.group(1))]
+
+    m = re.search(r'\(GFXglyph \*\)\w+,\s*(0x[0-9A-Fa-f]+),\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\};', src)
+    first, last, y_advance = int(m.group(1), 16), int(m.group(2), 16), int(m.group(3))
+
+    return name, bitmaps, glyphs, first, last, y_advance
+
+
+def parse_sparse_font(path):
+    """Parse a header written by write_font() into ({codepoint: glyph}, yAdvance)."""
+    with open(path, 'r', encoding='ascii') as f:
+        src = f.read()
+
+    m = re.search(r'const GFXglyph \w+Glyphs\[\] PROGMEM = \{(.*?)\n\};', src, re.S)
+    glyphs = [tuple(int(v) for v in g)
+              for g in re.findall(r'\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}',
+                                  m.group(1))]
+
+    m = re.search(r'const uint16_t \w+Codepoints\[\] PROGMEM = \{(.*?)\};', src, re.S)
+    codepoints = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', m.group(1))]
+
+    m = re.search(r'SPARSE_(?:RLE_)?FONT_FIRST,\s*(\d+),\s*(\d+)\s*\}', src)
+    y_advance = int(m.group(2))
+
+    if len(glyphs) != len(codepoints) or len(glyphs) != int(m.group(1)) + 1:
+        raise ValueError(f"{path}: glyph and codepoint tables do not match")
+    return dict(zip(codepoints, glyphs)), y_advance
+
+
+def glyph_bytes(bitmaps, glyph):
+    """Bitmap bytes of one glyph (bit-packed, padded to a byte at the end)."""
+    offset, width, height = glyph[0], glyph[1], glyph[2]
+    return bitmaps[offset:offset + (width * height + 7) // 8]
+
+
+def glyph_bits(bitmaps, glyph):
+    """Pixels of one glyph, row-major, 1 = set."""
+    data = glyph_bytes(bitmaps, glyph)
+    return [(data[i >> 3] >> (7 - (i & 7))) & 1 for i in range(glyph[1] * glyph[2])]
+
+
+def rle_encode(bits):
+    """Alternating clear/set runs (clear first) as 4-bit values, 15 = continue."""
+    runs = []
+    current, length = 0, 0
+    for bit in bits:
+        if bit == current:
+            length += 1
+        else:
+            runs.append(length)
+            current, length = bit, 1
+    runs.append(length)
+
+    nibbles = []
+    for run in runs:
+        while run >= 15:
+            nibbles.append(15)
+            run -= 15
+        nibbles.append(run)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def write_bytes(f, data):
+    for i, byte in enumerate(data):
+        if i % 12 == 0:
+            f.write("  ")
+        f.write(f"0x{byte:02X}")
+        if i < len(data) - 1:
+            f.write(", ")
+        if (i + 1) % 12 == 0:
+            f.write("\n")
+    f.write(" };\n\n")
+
+
+def char_comment(cp):
+    return f"0x{cp:02X} '{chr(cp)}'" if 32 <= cp <= 126 else f"0x{cp:02X}"
+
+
+def write_font(out_path, font_name, source_name, first_marker, bitmaps, glyphs, codepoints, y_advance, note):
+    """Write a sparse font header, return its approximate flash size."""
+    guard = f"{font_name.upper()}_H"
+    with open(out_path, 'w', encoding='ascii') as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write("#include <Adafruit_GFX.h>\n")
+        f.write("#include \"SparseFont.h\"\n\n")
+        f.write(f"// {source_name} subset to the {len(codepoints)} glyphs used by cards.csv and CATEGORY_NAMES{note}\n")
+        f.write("// Generated by src/subset_font.py, do not edit\n\n")
+
+        f.write(f"const uint8_t {font_name}Bitmaps[] PROGMEM = {{\n")
+        write_bytes(f, bitmaps)
+
+        f.write(f"const GFXglyph {font_name}Glyphs[] PROGMEM = {{\n")
+        for i, (g, cp) in enumerate(zip(glyphs, codepoints)):
+            f.write(f"  {{ {g[0]:5}, {g[1]:3}, {g[2]:3}, {g[3]:3}, {g[4]:4}, {g[5]:4} }}")
+            f.write("," if i < len(codepoints) - 1 else "")
+            f.write(f"   // {char_comment(cp)}\n")
+        f.write("};\n\n")
+
+        f.write(f"const uint16_t {font_name}Codepoints[] PROGMEM = {{\n")
+        for i in range(0, len(codepoints), 12):
+            f.write("  " + ", ".join(f"0x{cp:03X}" for cp in codepoints[i:i + 12]))
+            f.write(",\n" if i + 12 < len(codepoints) else " };\n\n")
+
+        f.write(f"const SparseGFXfont {font_name} PROGMEM = {{\n")
+        f.write(f"  {{ (uint8_t  *){font_name}Bitmaps,\n")
+        f.write(f"    (GFXglyph *){font_name}Glyphs,\n")
+        f.write(f"    {first_marker}, {len(codepoints) - 1}, {y_advance} }},\n")
+        f.write(f"  {font_name}Codepoints }};\n\n")
+
+        size = len(bitmaps) + len(codepoints) * (GLYPH_BYTES + CODEPOINT_BYTES) + SPARSE_FONT_BYTES
+        f.write(f"// Approx. {size} bytes\n\n")
+        f.write(f"#endif // {guard}\n")
+    return size
+
+
+def subset_font(path, codepoints, rle):
+    name, bitmaps, glyphs, first, last, y_advance = parse_font(path)
+    out_dir = os.path.dirname(path)
+
+    # Every deck codepoint gets a glyph: its own, or its stand-in's
+    missing = {}
+    for cp in codepoints:
+        if not first <= cp <= last:
+            missing[cp] = FALLBACK_GLYPHS.get(cp, ord('?'))
+            if not first <= missing[cp] <= last:
+                raise ValueError(f"{name} has no glyph for U+{cp:04X} nor its stand-in U+{missing[cp]:04X}")
+    kept = codepoints
+
+    sparse_bitmaps = []
+    sparse_glyphs = []
+    rle_bitmaps = []
+    rle_glyphs = []
+    offsets = {}  # source codepoint -> (packed, RLE) bitmap offset, so stand-ins share one bitmap
+    for cp in kept:
+        source = missing.get(cp, cp)
+        g = glyphs[source - first]
+        if source not in offsets:
+            offsets[source] = (len(sparse_bitmaps), len(rle_bitmaps))
+            sparse_bitmaps.extend(glyph_bytes(bitmaps, g))
+            if g[1] and g[2]:
+                rle_bitmaps.extend(rle_encode(glyph_bits(bitmaps, g)))
+        sparse_glyphs.append((offsets[source][0],) + g[1:])
+        rle_glyphs.append((offsets[source][1],) + g[1:])
+
+    sparse_size = write_font(os.path.join(out_dir, f"{name}_sparse.h"), f"{name}_sparse", name,
+                             "SPARSE_FONT_FIRST", sparse_bitmaps, sparse_glyphs, kept, y_advance, "")
+    rle_size = None
+    if rle:
+        rle_size = write_font(os.path.join(out_dir, f"{name}_rle.h"), f"{name}_rle", name,
+                              "SPARSE_RLE_FONT_FIRST", rle_bitmaps, rle_glyphs, kept, y_advance,
+                              ",\n// glyph bitmaps run-length encoded")
+
+    dense_size = len(bitmaps) + len(glyphs) * GLYPH_BYTES + FONT_BYTES
+    return name, len(glyphs), dense_size, len(kept), sparse_size, rle_size, missing
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    rle = '--rle' in args
+    paths = [a for a in args if a != '--rle']
+    if not paths:
+        print("Usage: python src/subset_font.py [--rle] src/Font1.h [src/Font2.h ...]")
+        sys.exit(1)
+
+    codepoints = deck_codepoints()
+    print(f"Deck uses {len(codepoints)} codepoints\n")
+    header = f"{'Font':<24}{'Glyphs':>8}{'Dense B':>10}{'Glyphs':>8}{'Sparse B':>10}{'Saved':>8}"
+    if rle:
+        header += f"{'RLE B':>10}{'Saved':>8}"
+    print(header)
+
+    total_dense = total_sparse = total_rle = 0
+    for path in paths:
+        try:
+            result = subset_font(path, codepoints, rle)
+        except ValueError as e:
+            print(f"Error: {e}")
+            sys.exit(1)
+        name, dense_glyphs, dense_size, sparse_glyphs, sparse_size, rle_size, missing = result
+        total_dense += dense_size
+        total_sparse += sparse_size
+        saved = 100.0 * (dense_size - sparse_size) / dense_size
+        line = f"{name:<24}{dense_glyphs:>8}{dense_size:>10}{sparse_glyphs:>8}{sparse_size:>10}{saved:>7.1f}%"
+        if rle:
+            total_rle += rle_size
+            saved = 100.0 * (dense_size - rle_size) / dense_size
+            line += f"{rle_size:>10}{saved:>7.1f}%"
+        print(line)
+        if missing:
+            print("  warning, drawn as a stand-in: " +
+                  ", ".join(f"U+{cp:04X} -> '{chr(source)}'" for cp, source in sorted(missing.items())))
+
+    saved = 100.0 * (total_dense - total_sparse) / total_dense
+    line = f"{'Total':<24}{'':>8}{total_dense:>10}{'':>8}{total_sparse:>10}{saved:>7.1f}%"
+    if rle:
+        saved = 100.0 * (total_dense - total_rle) / total_dense
+        line += f"{total_rle:>10}{saved:>7.1f}%"
+    print(line)